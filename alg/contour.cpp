@@ -22,15 +22,23 @@
 
 #include "gdal.h"
 #include "gdal_alg.h"
+#include "gdal_thread_pool.h"
 #include "cpl_conv.h"
 #include "cpl_error_internal.h"
 #include "cpl_string.h"
+#include "cpl_worker_thread_pool.h"
 #include "ogr_api.h"
 #include "ogr_srs_api.h"
 #include "ogr_geometry.h"
 
 #include <climits>
+#include <condition_variable>
+#include <deque>
 #include <limits>
+#include <list>
+#include <map>
+#include <mutex>
+#include <tuple>
 
 static CPLErr OGRPolygonContourWriter(double dfLevelMin, double dfLevelMax,
                                       const OGRMultiPolygon &multipoly,
@@ -219,6 +227,332 @@ struct GDALRingAppender
     void *data_;
 };
 
+/************************************************************************/
+/*                         ContourStripWriter                           */
+/************************************************************************/
+
+// Collects the lines generated for a horizontal strip of the raster. Lines
+// that end near the seam with a neighbouring strip are set apart, as they
+// may continue in that strip.
+struct ContourStripWriter
+{
+    typedef std::pair<double, marching_squares::LineString> LevelLine;
+
+    ContourStripWriter(double topSeamY, double bottomSeamY)
+        : topSeamY_(topSeamY), bottomSeamY_(bottomSeamY)
+    {
+    }
+
+    void addLine(double level, marching_squares::LineString &ls, bool closed)
+    {
+        if (!closed && !ls.empty() &&
+            (isOnSeam(ls.front()) || isOnSeam(ls.back())))
+            pieces.emplace_back(level, std::move(ls));
+        else
+            completeLines.emplace_back(level, std::move(ls));
+    }
+
+    std::vector<LevelLine> completeLines{};
+    std::vector<LevelLine> pieces{};
+
+  private:
+    // NaN when there is no seam
+    const double topSeamY_;
+    const double bottomSeamY_;
+
+    bool isOnSeam(const marching_squares::Point &p) const
+    {
+        // Points on the seam are computed from exactly the same input on
+        // both sides. The tolerance is only there to be on the safe side:
+        // a line wrongly considered as a piece is just emitted a bit later.
+        return std::fabs(p.y - topSeamY_) <= 0.5 ||
+               std::fabs(p.y - bottomSeamY_) <= 0.5;
+    }
+};
+
+/************************************************************************/
+/*                          ContourSeamMerger                           */
+/************************************************************************/
+
+// Joins the pieces of lines coming from consecutive strips by their exactly
+// matching end points, and emits lines as soon as they cannot be extended
+// any more, so that only lines crossing the current seam are kept in memory.
+class ContourSeamMerger
+{
+  public:
+    explicit ContourSeamMerger(GDALRingAppender &appender)
+        : appender_(appender)
+    {
+    }
+
+    void addPiece(double level, marching_squares::LineString &&ls)
+    {
+        lines_.push_back(OpenLine{level, std::move(ls)});
+        auto it = std::prev(lines_.end());
+        bool merged = true;
+        while (merged && !isClosed(it->ls))
+        {
+            merged = false;
+            for (const bool atFront : {false, true})
+            {
+                const auto &p = atFront ? it->ls.front() : it->ls.back();
+                auto endIt = endPoints_.find(Key(level, p.x, p.y));
+                if (endIt == endPoints_.end())
+                    continue;
+                auto other = endIt->second;
+                unregisterLine(other);
+                join(it->ls, atFront, other->ls);
+                lines_.erase(other);
+                merged = true;
+                break;
+            }
+        }
+        if (isClosed(it->ls))
+        {
+            appender_.addLine(it->level, it->ls, /* closed */ true);
+            lines_.erase(it);
+        }
+        else
+        {
+            registerLine(it);
+        }
+    }
+
+    // Emit lines that have no end point near the seam of ordinate seamY.
+    // All lines are emitted if seamY is NaN.
+    void emitLinesNotOnSeam(double seamY)
+    {
+        for (auto it = lines_.begin(); it != lines_.end();)
+        {
+            if (std::fabs(it->ls.front().y - seamY) <= 0.5 ||
+                std::fabs(it->ls.back().y - seamY) <= 0.5)
+            {
+                ++it;
+            }
+            else
+            {
+                unregisterLine(it);
+                appender_.addLine(it->level, it->ls, /* closed */ false);
+                it = lines_.erase(it);
+            }
+        }
+    }
+
+  private:
+    CPL_DISALLOW_COPY_ASSIGN(ContourSeamMerger)
+
+    struct OpenLine
+    {
+        double level;
+        marching_squares::LineString ls;
+    };
+
+    typedef std::list<OpenLine> OpenLines;
+    typedef std::tuple<double, double, double> Key;
+
+    GDALRingAppender &appender_;
+    OpenLines lines_{};
+    std::multimap<Key, OpenLines::iterator> endPoints_{};
+
+    static bool isClosed(const marching_squares::LineString &ls)
+    {
+        return ls.size() > 2 && ls.front() == ls.back();
+    }
+
+    void registerLine(OpenLines::iterator it)
+    {
+        endPoints_.emplace(Key(it->level, it->ls.front().x, it->ls.front().y),
+                           it);
+        endPoints_.emplace(Key(it->level, it->ls.back().x, it->ls.back().y),
+                           it);
+    }
+
+    void unregisterLine(OpenLines::iterator it)
+    {
+        for (const auto *p : {&it->ls.front(), &it->ls.back()})
+        {
+            auto range = endPoints_.equal_range(Key(it->level, p->x, p->y));
+            for (auto endIt = range.first; endIt != range.second; ++endIt)
+            {
+                if (endIt->second == it)
+                {
+                    endPoints_.erase(endIt);
+                    break;
+                }
+            }
+        }
+    }
+
+    // Append other, that shares an end point with the front or back of ls,
+    // to ls.
+    static void join(marching_squares::LineString &ls, bool atFront,
+                     marching_squares::LineString &other)
+    {
+        if (!atFront)
+        {
+            if (other.front() == ls.back())
+                other.pop_front();
+            else
+            {
+                other.pop_back();
+                other.reverse();
+            }
+            ls.splice(ls.end(), other);
+        }
+        else
+        {
+            if (other.back() == ls.front())
+                other.pop_back();
+            else
+            {
+                other.pop_front();
+                other.reverse();
+            }
+            ls.splice(ls.begin(), other);
+        }
+    }
+};
+
+/************************************************************************/
+/*                      ContourGenerateLinesTiled()                     */
+/************************************************************************/
+
+// Generate contour lines by processing horizontal strips of the raster in
+// parallel. Reading and writing are done by the calling thread, in the order
+// of strips.
+static bool ContourGenerateLinesTiled(
+    GDALRasterBandH hBand, bool useNoData, double noDataValue,
+    marching_squares::FixedLevelRangeIterator &levels,
+    GDALRingAppender &appender, CPLWorkerThreadPool *poThreadPool,
+    int nThreads, GDALProgressFunc pfnProgress, void *pProgressArg)
+{
+    using namespace marching_squares;
+
+    const int nWidth = GDALGetRasterBandXSize(hBand);
+    const int nHeight = GDALGetRasterBandYSize(hBand);
+
+    // Strips of about one million pixels, made of whole blocks if possible
+    constexpr int STRIP_PIXEL_COUNT = 1024 * 1024;
+    int nStripHeight = std::max(16, STRIP_PIXEL_COUNT / std::max(1, nWidth));
+    int nBlockYSize = 1;
+    GDALGetBlockSize(hBand, nullptr, &nBlockYSize);
+    if (nBlockYSize > 1 && nBlockYSize < nHeight)
+        nStripHeight =
+            (nStripHeight + nBlockYSize - 1) / nBlockYSize * nBlockYSize;
+    nStripHeight = std::min(nStripHeight, nHeight);
+    const int nStrips = (nHeight + nStripHeight - 1) / nStripHeight;
+
+    struct StripJob
+    {
+        int nYOff = 0;
+        int nYSize = 0;
+        // Line above the strip (if nYOff > 0), followed by the strip lines
+        std::vector<double> adfData{};
+        std::unique_ptr<ContourStripWriter> poWriter{};
+        std::string osError{};
+        bool bDone = false;
+    };
+
+    std::mutex oMutex;
+    std::condition_variable oCV;
+    const auto ProcessStrip = [&](StripJob *psJob)
+    {
+        try
+        {
+            SegmentMerger<ContourStripWriter, FixedLevelRangeIterator> writer(
+                *(psJob->poWriter), levels, /* polygonize */ false);
+            ContourGenerator<decltype(writer), FixedLevelRangeIterator> cg(
+                nWidth, nHeight, useNoData, noDataValue, writer, levels);
+            const double *padfLine = psJob->adfData.data();
+            if (psJob->nYOff > 0)
+            {
+                cg.setStartLine(psJob->nYOff, padfLine);
+                padfLine += nWidth;
+            }
+            for (int i = 0; i < psJob->nYSize; ++i, padfLine += nWidth)
+                cg.feedLine(padfLine);
+        }
+        catch (const std::exception &e)
+        {
+            psJob->osError = e.what();
+        }
+        std::lock_guard oLock(oMutex);
+        psJob->bDone = true;
+        oCV.notify_one();
+    };
+
+    std::deque<std::unique_ptr<StripJob>> apoJobs;
+    // Must be declared after apoJobs and ProcessStrip, so that its
+    // destructor, that waits for pending jobs, is called first.
+    auto poQueue = poThreadPool->CreateJobQueue();
+
+    const int nMaxJobsInFlight = 2 * nThreads;
+    int iNextStripToRead = 0;
+    ContourSeamMerger oSeamMerger(appender);
+    for (int iStrip = 0; iStrip < nStrips; ++iStrip)
+    {
+        while (iNextStripToRead < nStrips &&
+               static_cast<int>(apoJobs.size()) < nMaxJobsInFlight)
+        {
+            auto psJob = std::make_unique<StripJob>();
+            psJob->nYOff = iNextStripToRead * nStripHeight;
+            psJob->nYSize = std::min(nStripHeight, nHeight - psJob->nYOff);
+            const int nExtraLine = psJob->nYOff > 0 ? 1 : 0;
+            const int nLinesToRead = psJob->nYSize + nExtraLine;
+            const double dfNaN = std::numeric_limits<double>::quiet_NaN();
+            psJob->poWriter = std::make_unique<ContourStripWriter>(
+                psJob->nYOff > 0 ? psJob->nYOff - 0.5 : dfNaN,
+                psJob->nYOff + psJob->nYSize < nHeight
+                    ? psJob->nYOff + psJob->nYSize - 0.5
+                    : dfNaN);
+            psJob->adfData.resize(static_cast<size_t>(nWidth) * nLinesToRead);
+            if (GDALRasterIO(hBand, GF_Read, 0, psJob->nYOff - nExtraLine,
+                             nWidth, nLinesToRead, psJob->adfData.data(),
+                             nWidth, nLinesToRead, GDT_Float64, 0,
+                             0) != CE_None)
+            {
+                return false;
+            }
+            StripJob *psJobRaw = psJob.get();
+            apoJobs.push_back(std::move(psJob));
+            poQueue->SubmitJob([psJobRaw, &ProcessStrip]
+                               { ProcessStrip(psJobRaw); });
+            ++iNextStripToRead;
+        }
+
+        auto psJob = std::move(apoJobs.front());
+        apoJobs.pop_front();
+        {
+            std::unique_lock oLock(oMutex);
+            oCV.wait(oLock, [&psJob] { return psJob->bDone; });
+        }
+        if (!psJob->osError.empty())
+        {
+            CPLError(CE_Failure, CPLE_AppDefined, "%s",
+                     psJob->osError.c_str());
+            return false;
+        }
+
+        for (auto &[level, ls] : psJob->poWriter->completeLines)
+            appender.addLine(level, ls, /* closed */ false);
+        for (auto &[level, ls] : psJob->poWriter->pieces)
+            oSeamMerger.addPiece(level, std::move(ls));
+        const int nNextYOff = psJob->nYOff + psJob->nYSize;
+        oSeamMerger.emitLinesNotOnSeam(
+            nNextYOff < nHeight ? nNextYOff - 0.5
+                                : std::numeric_limits<double>::quiet_NaN());
+
+        if (pfnProgress &&
+            !pfnProgress(static_cast<double>(nNextYOff) / nHeight,
+                         "Processing strip", pProgressArg))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 /************************************************************************/
 /* ==================================================================== */
 /*                   Additional C Callable Functions                    */
@@ -564,6 +898,17 @@ mode.
  * A negative value means a single transaction. The function takes care of
  * issuing the starting transaction and committing the final one.
  *
+ *   NUM_THREADS=num|ALL_CPUS
+ *
+ * (GDAL >= 3.13) Number of threads used to generate contour lines. Defaults
+ * to the value of the GDAL_NUM_THREADS configuration option, or 1. When
+ * greater than 1, horizontal strips of the raster are contoured in parallel,
+ * and the pieces of lines crossing the seams between strips are joined by
+ * their matching end points. Only the lines crossing the seam being processed
+ * are kept in memory. The output is the same set of lines as in the
+ * single-threaded mode, but possibly with a different starting point or
+ * direction, and written in a different order. Not used when POLYGONIZE=YES.
+ *
  * @return CE_None on success or CE_Failure if an error occurs.
  */
 CPLErr GDALContourGenerateEx(GDALRasterBandH hBand, void *hLayer,
@@ -681,6 +1026,13 @@ CPLErr GDALContourGenerateEx(GDALRasterBandH hBand, void *hLayer,
 
     bool polygonize = CPLFetchBool(options, "POLYGONIZE", false);
 
+    const char *pszThreads = CSLFetchNameValue(options, "NUM_THREADS");
+    if (pszThreads == nullptr)
+        pszThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+    int nThreads =
+        EQUAL(pszThreads, "ALL_CPUS") ? CPLGetNumCPUs() : atoi(pszThreads);
+    nThreads = std::clamp(nThreads, 1, 128);
+
     int bSuccessMin = FALSE;
     double dfMinimum = GDALGetRasterMinimum(hBand, &bSuccessMin);
     int bSuccessMax = FALSE;
@@ -932,12 +1284,23 @@ CPLErr GDALContourGenerateEx(GDALRasterBandH hBand, void *hLayer,
                 fixedLevels.erase(uniqueIt, fixedLevels.end());
                 FixedLevelRangeIterator levels(
                     &fixedLevels[0], fixedLevels.size(), dfMinimum, dfMaximum);
-                SegmentMerger<GDALRingAppender, FixedLevelRangeIterator> writer(
-                    appender, levels, /* polygonize */ false);
-                ContourGeneratorFromRaster<decltype(writer),
-                                           FixedLevelRangeIterator>
-                    cg(hBand, useNoData, noDataValue, writer, levels);
-                ok = cg.process(pfnProgress, pProgressArg);
+                auto poThreadPool =
+                    nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+                if (poThreadPool)
+                {
+                    ok = ContourGenerateLinesTiled(
+                        hBand, useNoData, noDataValue, levels, appender,
+                        poThreadPool, nThreads, pfnProgress, pProgressArg);
+                }
+                else
+                {
+                    SegmentMerger<GDALRingAppender, FixedLevelRangeIterator>
+                        writer(appender, levels, /* polygonize */ false);
+                    ContourGeneratorFromRaster<decltype(writer),
+                                               FixedLevelRangeIterator>
+                        cg(hBand, useNoData, noDataValue, writer, levels);
+                    ok = cg.process(pfnProgress, pProgressArg);
+                }
             }
         }
     }
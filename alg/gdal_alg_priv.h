@@ -203,6 +203,12 @@ typedef struct
     bool bReversed;
     double dfOversampleFactor;
 
+    // Number of threads used to build the backmap or the quadtree.
+    int nNumThreads;
+
+    // Directory where computed backmaps are cached, or nullptr.
+    char *pszBackMapCacheDir;
+
     // Map from target georef coordinates back to geolocation array
     // pixel line coordinates.  Built only if needed.
     int nBackMapWidth;
@@ -35,9 +35,8 @@ template <> bool areEqualReal(double dfNoDataValue, std::complex<double> dfOut)
 }
 
 // Only valid for T = double or std::complex<double>
-template <typename T>
-bool GDALInterpExtractValuesWindow(GDALRasterBand *pBand,
-                                   std::unique_ptr<DoublePointsCache> &cache,
+template <typename T, typename CacheT>
+bool GDALInterpExtractValuesWindow(GDALRasterBand *pBand, CacheT &cache,
                                    gdal::Vector2i point,
                                    gdal::Vector2i dimensions, T *padfOut)
 {
@@ -50,9 +49,6 @@ bool GDALInterpExtractValuesWindow(GDALRasterBand *pBand,
 
     // Request the DEM by blocks of BLOCK_SIZE * BLOCK_SIZE and put them
     // in cache
-    if (!cache)
-        cache.reset(new DoublePointsCache{});
-
     const int nXIters = (nX + nWidth - 1) / BLOCK_SIZE - nX / BLOCK_SIZE + 1;
     const int nYIters = (nY + nHeight - 1) / BLOCK_SIZE - nY / BLOCK_SIZE + 1;
     const int nRasterXSize = pBand->GetXSize();
@@ -102,7 +98,7 @@ bool GDALInterpExtractValuesWindow(GDALRasterBand *pBand,
 
             constexpr int nTypeFactor = sizeof(T) / sizeof(double);
             std::shared_ptr<std::vector<double>> poValue;
-            if (!cache->tryGet(nKey, poValue))
+            if (!cache.tryGet(nKey, poValue))
             {
                 const GDALDataType eDataType =
                     bIsComplex ? GDT_CFloat64 : GDT_Float64;
@@ -117,7 +113,7 @@ bool GDALInterpExtractValuesWindow(GDALRasterBand *pBand,
                 {
                     return false;
                 }
-                cache->insert(nKey, poValue);
+                cache.insert(nKey, poValue);
             }
 
             double *padfAsDouble = reinterpret_cast<double *>(padfOut);
@@ -161,10 +157,9 @@ bool GDALInterpExtractValuesWindow(GDALRasterBand *pBand,
     return true;
 }
 
-template <typename T>
+template <typename T, typename CacheT>
 bool GDALInterpolateAtPointImpl(GDALRasterBand *pBand,
-                                GDALRIOResampleAlg eResampleAlg,
-                                std::unique_ptr<DoublePointsCache> &cache,
+                                GDALRIOResampleAlg eResampleAlg, CacheT &cache,
                                 double dfXIn, double dfYIn, T &out)
 {
     const gdal::Vector2i rasterSize{pBand->GetXSize(), pBand->GetYSize()};
@@ -409,14 +404,15 @@ bool GDALInterpolateAtPointImpl(GDALRasterBand *pBand,
 }
 
 /************************************************************************/
-/*                       GDALInterpolateAtPoint()                       */
+/*                      GDALInterpolateAtPointT()                       */
 /************************************************************************/
 
-bool GDALInterpolateAtPoint(GDALRasterBand *pBand,
-                            GDALRIOResampleAlg eResampleAlg,
-                            std::unique_ptr<DoublePointsCache> &cache,
-                            const double dfXIn, const double dfYIn,
-                            double *pdfOutputReal, double *pdfOutputImag)
+template <typename CacheT>
+static bool GDALInterpolateAtPointT(GDALRasterBand *pBand,
+                                    GDALRIOResampleAlg eResampleAlg,
+                                    CacheT &cache, const double dfXIn,
+                                    const double dfYIn, double *pdfOutputReal,
+                                    double *pdfOutputImag)
 {
     const bool bIsComplex =
         CPL_TO_BOOL(GDALDataTypeIsComplex(pBand->GetRasterDataType()));
@@ -441,3 +437,31 @@ bool GDALInterpolateAtPoint(GDALRasterBand *pBand,
     }
     return res;
 }
+
+/************************************************************************/
+/*                       GDALInterpolateAtPoint()                       */
+/************************************************************************/
+
+bool GDALInterpolateAtPoint(GDALRasterBand *pBand,
+                            GDALRIOResampleAlg eResampleAlg,
+                            std::unique_ptr<DoublePointsCache> &cache,
+                            const double dfXIn, const double dfYIn,
+                            double *pdfOutputReal, double *pdfOutputImag)
+{
+    if (!cache)
+        cache.reset(new DoublePointsCache{});
+    return GDALInterpolateAtPointT(pBand, eResampleAlg, *cache, dfXIn, dfYIn,
+                                   pdfOutputReal, pdfOutputImag);
+}
+
+/** Same as above, but with a block cache that may be shared between
+ * threads. pBand must not be shared between threads. */
+bool GDALInterpolateAtPoint(GDALRasterBand *pBand,
+                            GDALRIOResampleAlg eResampleAlg,
+                            SharedDoublePointsCache &cache,
+                            const double dfXIn, const double dfYIn,
+                            double *pdfOutputReal, double *pdfOutputImag)
+{
+    return GDALInterpolateAtPointT(pBand, eResampleAlg, cache, dfXIn, dfYIn,
+                                   pdfOutputReal, pdfOutputImag);
+}
@@ -24,10 +24,16 @@
 #include "gdal_priv.h"
 
 #include <memory>
+#include <mutex>
 
 using DoublePointsCache =
     lru11::Cache<uint64_t, std::shared_ptr<std::vector<double>>>;
 
+// Variant of DoublePointsCache that may be shared between several threads,
+// each of them reading blocks through its own GDALRasterBand instance.
+using SharedDoublePointsCache =
+    lru11::Cache<uint64_t, std::shared_ptr<std::vector<double>>, std::mutex>;
+
 class CPL_DLL GDALDoublePointsCache
 {
   public:
@@ -41,6 +47,13 @@ bool CPL_DLL GDALInterpolateAtPoint(GDALRasterBand *pBand,
                                     double *pdfOutputReal,
                                     double *pdfOutputImag);
 
+bool CPL_DLL GDALInterpolateAtPoint(GDALRasterBand *pBand,
+                                    GDALRIOResampleAlg eResampleAlg,
+                                    SharedDoublePointsCache &cache,
+                                    const double dfXIn, const double dfYIn,
+                                    double *pdfOutputReal,
+                                    double *pdfOutputImag);
+
 /*! @endcond */
 
 #endif /* ndef GDAL_INTERPOLATEATPOINT_H_INCLUDED */
@@ -21,7 +21,9 @@
 
 #include <algorithm>
 #include <limits>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -61,6 +63,8 @@ CPL_C_END
 
 constexpr int MAX_ABS_VALUE_WARNINGS = 20;
 constexpr double DEFAULT_PIX_ERR_THRESHOLD = 0.1;
+// Maximum number of 64x64 blocks of DEM values in cache (8 MB)
+constexpr size_t DEM_CACHE_BLOCKS = 256;
 
 /************************************************************************/
 /*                            RPCInfoToMD()                             */
@@ -231,58 +235,60 @@ typedef enum
     /*! Cubic Convolution Approximation (4x4 kernel) */ DRA_CubicSpline = 2
 } DEMResampleAlg;
 
-typedef struct
+struct GDALRPCTransformInfo
 {
 
-    GDALTransformerInfo sTI;
+    GDALTransformerInfo sTI = {};
 
-    GDALRPCInfoV2 sRPC;
+    GDALRPCInfoV2 sRPC = {};
 
-    double adfPLToLatLongGeoTransform[6];
-    double dfRefZ;
+    double adfPLToLatLongGeoTransform[6] = {};
+    double dfRefZ = 0;
 
-    int bReversed;
+    int bReversed = false;
 
-    double dfPixErrThreshold;
+    double dfPixErrThreshold = 0;
 
-    double dfHeightOffset;
+    double dfHeightOffset = 0;
 
-    double dfHeightScale;
+    double dfHeightScale = 0;
 
-    char *pszDEMPath;
+    char *pszDEMPath = nullptr;
 
-    DEMResampleAlg eResampleAlg;
+    DEMResampleAlg eResampleAlg = DRA_NearestNeighbour;
 
-    int bHasDEMMissingValue;
-    double dfDEMMissingValue;
-    char *pszDEMSRS;
-    int bApplyDEMVDatumShift;
+    int bHasDEMMissingValue = false;
+    double dfDEMMissingValue = 0;
+    char *pszDEMSRS = nullptr;
+    int bApplyDEMVDatumShift = false;
 
-    GDALDataset *poDS;
-    // the key is (nYBlock << 32) | nXBlock)
-    lru11::Cache<uint64_t, std::shared_ptr<std::vector<double>>> *poCacheDEM;
+    GDALDataset *poDS = nullptr;
+    // the key is (nYBlock << 32) | nXBlock). Shared with the transformers
+    // created by GDALCreateSimilarRPCTransformer(), typically one per warping
+    // thread, each of them reading DEM blocks through its own poDS.
+    std::shared_ptr<SharedDoublePointsCache> poCacheDEM{};
 
-    OGRCoordinateTransformation *poCT;
+    OGRCoordinateTransformation *poCT = nullptr;
 
-    int nMaxIterations;
+    int nMaxIterations = 0;
 
-    double adfDEMGeoTransform[6];
-    double adfDEMReverseGeoTransform[6];
+    double adfDEMGeoTransform[6] = {};
+    double adfDEMReverseGeoTransform[6] = {};
 
 #ifdef USE_SSE2_OPTIM
-    double adfDoubles[20 * 4 + 1];
+    double adfDoubles[20 * 4 + 1] = {};
     // LINE_NUM_COEFF, LINE_DEN_COEFF, SAMP_NUM_COEFF and then SAMP_DEN_COEFF.
-    double *padfCoeffs;
+    double *padfCoeffs = nullptr;
 #endif
 
-    bool bRPCInverseVerbose;
-    char *pszRPCInverseLog;
+    bool bRPCInverseVerbose = false;
+    char *pszRPCInverseLog = nullptr;
 
-    char *pszRPCFootprint;
-    OGRGeometry *poRPCFootprintGeom;
-    OGRPreparedGeometry *poRPCFootprintPreparedGeom;
+    char *pszRPCFootprint = nullptr;
+    OGRGeometry *poRPCFootprintGeom = nullptr;
+    OGRPreparedGeometry *poRPCFootprintPreparedGeom = nullptr;
 
-} GDALRPCTransformInfo;
+};
 
 static bool GDALRPCOpenDEM(GDALRPCTransformInfo *psTransform);
 
@@ -352,20 +358,16 @@ static double RPCEvaluate(const double *padfTerms, const double *padfCoefs)
 #endif
 
 /************************************************************************/
-/*                         RPCTransformPoint()                          */
+/*                         RPCNormalizeInputs()                         */
 /************************************************************************/
 
-static void RPCTransformPoint(const GDALRPCTransformInfo *psRPCTransformInfo,
-                              double dfLong, double dfLat, double dfHeight,
-                              double *pdfPixel, double *pdfLine)
+static void RPCNormalizeInputs(const GDALRPCTransformInfo *psRPCTransformInfo,
+                               double dfLong, double dfLat, double dfHeight,
+                               double &dfNormalizedLong,
+                               double &dfNormalizedLat,
+                               double &dfNormalizedHeight)
 
 {
-    double adfTermsWithMargin[20 + 1] = {};
-    // Make padfTerms aligned on 16-byte boundary for SSE2 aligned loads.
-    double *padfTerms =
-        adfTermsWithMargin +
-        (reinterpret_cast<GUIntptr_t>(adfTermsWithMargin) % 16) / 8;
-
     // Avoid dateline issues.
     double diffLong = dfLong - psRPCTransformInfo->sRPC.dfLONG_OFF;
     if (diffLong < -270)
@@ -377,14 +379,11 @@ static void RPCTransformPoint(const GDALRPCTransformInfo *psRPCTransformInfo,
         diffLong -= 360;
     }
 
-    const double dfNormalizedLong =
-        diffLong / psRPCTransformInfo->sRPC.dfLONG_SCALE;
-    const double dfNormalizedLat =
-        (dfLat - psRPCTransformInfo->sRPC.dfLAT_OFF) /
-        psRPCTransformInfo->sRPC.dfLAT_SCALE;
-    const double dfNormalizedHeight =
-        (dfHeight - psRPCTransformInfo->sRPC.dfHEIGHT_OFF) /
-        psRPCTransformInfo->sRPC.dfHEIGHT_SCALE;
+    dfNormalizedLong = diffLong / psRPCTransformInfo->sRPC.dfLONG_SCALE;
+    dfNormalizedLat = (dfLat - psRPCTransformInfo->sRPC.dfLAT_OFF) /
+                      psRPCTransformInfo->sRPC.dfLAT_SCALE;
+    dfNormalizedHeight = (dfHeight - psRPCTransformInfo->sRPC.dfHEIGHT_OFF) /
+                         psRPCTransformInfo->sRPC.dfHEIGHT_SCALE;
 
     // The absolute values of the 3 above normalized values are supposed to be
     // below 1. Warn (as debug message) if it is not the case. We allow for some
@@ -434,6 +433,28 @@ static void RPCTransformPoint(const GDALRPCTransformInfo *psRPCTransformInfo,
             }
         }
     }
+}
+
+/************************************************************************/
+/*                         RPCTransformPoint()                          */
+/************************************************************************/
+
+static void RPCTransformPoint(const GDALRPCTransformInfo *psRPCTransformInfo,
+                              double dfLong, double dfLat, double dfHeight,
+                              double *pdfPixel, double *pdfLine)
+
+{
+    double adfTermsWithMargin[20 + 1] = {};
+    // Make padfTerms aligned on 16-byte boundary for SSE2 aligned loads.
+    double *padfTerms =
+        adfTermsWithMargin +
+        (reinterpret_cast<GUIntptr_t>(adfTermsWithMargin) % 16) / 8;
+
+    double dfNormalizedLong = 0.0;
+    double dfNormalizedLat = 0.0;
+    double dfNormalizedHeight = 0.0;
+    RPCNormalizeInputs(psRPCTransformInfo, dfLong, dfLat, dfHeight,
+                       dfNormalizedLong, dfNormalizedLat, dfNormalizedHeight);
 
     RPCComputeTerms(dfNormalizedLong, dfNormalizedLat, dfNormalizedHeight,
                     padfTerms);
@@ -465,6 +486,143 @@ static void RPCTransformPoint(const GDALRPCTransformInfo *psRPCTransformInfo,
                psRPCTransformInfo->sRPC.dfLINE_OFF + 0.5;
 }
 
+/************************************************************************/
+/*                         RPCTransformPoints()                         */
+/************************************************************************/
+
+// Batched version of RPCTransformPoint(). With SSE2, 2 points are evaluated
+// at once, with a SIMD lane per point, which avoids the horizontal sums of
+// RPCEvaluate4(). Partial sums of even and odd terms are accumulated
+// separately so that results are bit-identical to RPCTransformPoint().
+// The output arrays may be the input ones.
+
+static void RPCTransformPoints(const GDALRPCTransformInfo *psRPCTransformInfo,
+                               size_t nPointCount, const double *padfLong,
+                               const double *padfLat, const double *padfHeight,
+                               double *padfPixel, double *padfLine)
+
+{
+    size_t i = 0;
+#ifdef USE_SSE2_OPTIM
+    const double *padfCoeffs = psRPCTransformInfo->padfCoeffs;
+    const XMMReg2Double sampScale =
+        XMMReg2Double::Set1(psRPCTransformInfo->sRPC.dfSAMP_SCALE);
+    const XMMReg2Double sampOff =
+        XMMReg2Double::Set1(psRPCTransformInfo->sRPC.dfSAMP_OFF);
+    const XMMReg2Double lineScale =
+        XMMReg2Double::Set1(psRPCTransformInfo->sRPC.dfLINE_SCALE);
+    const XMMReg2Double lineOff =
+        XMMReg2Double::Set1(psRPCTransformInfo->sRPC.dfLINE_OFF);
+    const XMMReg2Double half = XMMReg2Double::Set1(0.5);
+    for (; i + 1 < nPointCount; i += 2)
+    {
+        double adfNormalizedLong[2];
+        double adfNormalizedLat[2];
+        double adfNormalizedHeight[2];
+        for (int j = 0; j < 2; ++j)
+        {
+            RPCNormalizeInputs(psRPCTransformInfo, padfLong[i + j],
+                               padfLat[i + j], padfHeight[i + j],
+                               adfNormalizedLong[j], adfNormalizedLat[j],
+                               adfNormalizedHeight[j]);
+        }
+        const auto L = XMMReg2Double::Load2Val(adfNormalizedLong);
+        const auto P = XMMReg2Double::Load2Val(adfNormalizedLat);
+        const auto H = XMMReg2Double::Load2Val(adfNormalizedHeight);
+
+        // Same terms and order of operations as RPCComputeTerms()
+        const XMMReg2Double aTerms[20] = {
+            XMMReg2Double::Set1(1.0),
+            L,
+            P,
+            H,
+            L * P,
+            L * H,
+            P * H,
+            L * L,
+            P * P,
+            H * H,
+            L * P * H,
+            L * L * L,
+            L * P * P,
+            L * H * H,
+            L * L * P,
+            P * P * P,
+            P * H * H,
+            L * L * H,
+            P * P * H,
+            H * H * H,
+        };
+
+        // LINE_NUM_COEFF, LINE_DEN_COEFF, SAMP_NUM_COEFF and SAMP_DEN_COEFF.
+        XMMReg2Double aSumEven[4] = {
+            XMMReg2Double::Zero(), XMMReg2Double::Zero(),
+            XMMReg2Double::Zero(), XMMReg2Double::Zero()};
+        XMMReg2Double aSumOdd[4] = {
+            XMMReg2Double::Zero(), XMMReg2Double::Zero(),
+            XMMReg2Double::Zero(), XMMReg2Double::Zero()};
+        for (int k = 0; k < 20; k += 2)
+        {
+            for (int iPoly = 0; iPoly < 4; ++iPoly)
+            {
+                aSumEven[iPoly] +=
+                    aTerms[k] *
+                    XMMReg2Double::Set1(padfCoeffs[iPoly * 20 + k]);
+                aSumOdd[iPoly] +=
+                    aTerms[k + 1] *
+                    XMMReg2Double::Set1(padfCoeffs[iPoly * 20 + k + 1]);
+            }
+        }
+        const auto lineNum = aSumEven[0] + aSumOdd[0];
+        const auto lineDen = aSumEven[1] + aSumOdd[1];
+        const auto sampNum = aSumEven[2] + aSumOdd[2];
+        const auto sampDen = aSumEven[3] + aSumOdd[3];
+
+        // RPCs are using the center of upper left pixel = 0,0 convention
+        // convert to top left corner = 0,0 convention used in GDAL.
+        const auto pixel = (sampNum / sampDen) * sampScale + sampOff + half;
+        const auto line = (lineNum / lineDen) * lineScale + lineOff + half;
+        pixel.Store2Val(padfPixel + i);
+        line.Store2Val(padfLine + i);
+    }
+#endif
+    for (; i < nPointCount; ++i)
+    {
+        RPCTransformPoint(psRPCTransformInfo, padfLong[i], padfLat[i],
+                          padfHeight[i], padfPixel + i, padfLine + i);
+    }
+}
+
+/************************************************************************/
+/*                     RPCTransformIndexedPoints()                      */
+/************************************************************************/
+
+// Transform in place the points of padfX/padfY whose indices are in
+// anIndices, adfHeights[k] being the height of point anIndices[k].
+
+static void
+RPCTransformIndexedPoints(const GDALRPCTransformInfo *psRPCTransformInfo,
+                          const std::vector<int> &anIndices,
+                          const std::vector<double> &adfHeights, double *padfX,
+                          double *padfY)
+{
+    const size_t nCount = anIndices.size();
+    std::vector<double> adfX(nCount);
+    std::vector<double> adfY(nCount);
+    for (size_t k = 0; k < nCount; ++k)
+    {
+        adfX[k] = padfX[anIndices[k]];
+        adfY[k] = padfY[anIndices[k]];
+    }
+    RPCTransformPoints(psRPCTransformInfo, nCount, adfX.data(), adfY.data(),
+                       adfHeights.data(), adfX.data(), adfY.data());
+    for (size_t k = 0; k < nCount; ++k)
+    {
+        padfX[anIndices[k]] = adfX[k];
+        padfY[anIndices[k]] = adfY[k];
+    }
+}
+
 /************************************************************************/
 /*                    GDALSerializeRPCDEMResample()                     */
 /************************************************************************/
@@ -535,6 +693,11 @@ static void *GDALCreateSimilarRPCTransformer(void *hTransformArg,
             &sRPC, psInfo->bReversed, psInfo->dfPixErrThreshold, papszOptions));
     CSLDestroy(papszOptions);
 
+    // Share the cache of DEM blocks, so that warping threads, which each use
+    // their own similar transformer, do not read the same blocks again.
+    if (psNewInfo && psNewInfo->poCacheDEM && psInfo->poCacheDEM)
+        psNewInfo->poCacheDEM = psInfo->poCacheDEM;
+
     return psNewInfo;
 }
 
@@ -731,8 +894,8 @@ void *GDALCreateRPCTransformerV1(GDALRPCInfoV1 *psRPCInfo, int bReversed,
  * extra debug information will be displayed in the "RPC" debug category, so
  * requiring CPL_DEBUG to be also set) and/or by setting RPC_INVERSE_LOG to a
  * filename that will contain the content of iterations (this last option only
- * makes sense when debugging point by point, since each time
- * RPCInverseTransformPoint() is called, the file is rewritten).
+ * makes sense when debugging point by point, since the file is rewritten
+ * for each point).
  *
  * Additional options to the transformer can be supplied in papszOptions.
  *
@@ -819,8 +982,7 @@ void *GDALCreateRPCTransformerV2(const GDALRPCInfoV2 *psRPCInfo, int bReversed,
     /* -------------------------------------------------------------------- */
     /*      Initialize core info.                                           */
     /* -------------------------------------------------------------------- */
-    GDALRPCTransformInfo *psTransform = static_cast<GDALRPCTransformInfo *>(
-        CPLCalloc(sizeof(GDALRPCTransformInfo), 1));
+    GDALRPCTransformInfo *psTransform = new GDALRPCTransformInfo();
 
     memcpy(&(psTransform->sRPC), psRPCInfo, sizeof(GDALRPCInfoV2));
     psTransform->bReversed = bReversed;
@@ -1108,7 +1270,6 @@ void GDALDestroyRPCTransformer(void *pTransformAlg)
 
     if (psTransform->poDS)
         GDALClose(psTransform->poDS);
-    delete psTransform->poCacheDEM;
     if (psTransform->poCT)
         OCTDestroyCoordinateTransformation(
             reinterpret_cast<OGRCoordinateTransformationH>(psTransform->poCT));
@@ -1118,43 +1279,79 @@ void GDALDestroyRPCTransformer(void *pTransformAlg)
     delete psTransform->poRPCFootprintGeom;
     OGRDestroyPreparedGeometry(psTransform->poRPCFootprintPreparedGeom);
 
-    CPLFree(pTransformAlg);
+    delete psTransform;
 }
 
 /************************************************************************/
-/*                      RPCInverseTransformPoint()                      */
+/*                     RPCInverseTransformPoints()                      */
 /************************************************************************/
 
-static bool RPCInverseTransformPoint(GDALRPCTransformInfo *psTransform,
-                                     double dfPixel, double dfLine,
-                                     double dfUserHeight, double *pdfLong,
-                                     double *pdfLat)
+namespace
+{
+struct RPCInverseIterState
+{
+    double dfResultX = 0;
+    double dfResultY = 0;
+    double dfPixelDeltaX = 0;
+    double dfPixelDeltaY = 0;
+    double dfLastResultX = 0;
+    double dfLastResultY = 0;
+    double dfLastPixelDeltaX = 0;
+    double dfLastPixelDeltaY = 0;
+    bool bLastPixelDeltaValid = false;
+    int nCountConsecutiveErrorBelow2 = 0;
+};
+}  // namespace
+
+// Iterate on all points at once, so that the forward RPC evaluation of each
+// iteration can be done with RPCTransformPoints() over all the points that
+// have not converged yet. The iteration of each point is the same as if it
+// was processed alone.
+
+static void RPCInverseTransformPoints(GDALRPCTransformInfo *psTransform,
+                                      int nPointCount, const double *padfPixel,
+                                      const double *padfLine,
+                                      const double *padfUserHeight,
+                                      double *padfLong, double *padfLat,
+                                      int *panSuccess)
 
 {
     // Memo:
     // Known to work with 40 iterations with DEM on all points (int coord and
     // +0.5,+0.5 shift) of flock1.20160216_041050_0905.tif, especially on (0,0).
 
+    const double *padfGT = psTransform->adfPLToLatLongGeoTransform;
+
     /* -------------------------------------------------------------------- */
     /*      Compute an initial approximation based on linear                */
     /*      interpolation from our reference point.                         */
     /* -------------------------------------------------------------------- */
-    double dfResultX = psTransform->adfPLToLatLongGeoTransform[0] +
-                       psTransform->adfPLToLatLongGeoTransform[1] * dfPixel +
-                       psTransform->adfPLToLatLongGeoTransform[2] * dfLine;
-
-    double dfResultY = psTransform->adfPLToLatLongGeoTransform[3] +
-                       psTransform->adfPLToLatLongGeoTransform[4] * dfPixel +
-                       psTransform->adfPLToLatLongGeoTransform[5] * dfLine;
-
-    if (psTransform->bRPCInverseVerbose)
+    std::vector<RPCInverseIterState> asState(nPointCount);
+    // Indices of the points that are still iterated upon
+    std::vector<int> anActive;
+    anActive.reserve(nPointCount);
+    for (int i = 0; i < nPointCount; i++)
     {
-        CPLDebug("RPC", "Computing inverse transform for (pixel,line)=(%f,%f)",
-                 dfPixel, dfLine);
+        panSuccess[i] = FALSE;
+        asState[i].dfResultX = padfGT[0] + padfGT[1] * padfPixel[i] +
+                               padfGT[2] * padfLine[i];
+        asState[i].dfResultY = padfGT[3] + padfGT[4] * padfPixel[i] +
+                               padfGT[5] * padfLine[i];
+        anActive.push_back(i);
+
+        if (psTransform->bRPCInverseVerbose)
+        {
+            CPLDebug("RPC",
+                     "Computing inverse transform for (pixel,line)=(%f,%f)",
+                     padfPixel[i], padfLine[i]);
+        }
     }
+
     VSILFILE *fpLog = nullptr;
     if (psTransform->pszRPCInverseLog)
     {
+        // Only meaningful when called on a single point
+        CPLAssert(nPointCount == 1);
         fpLog = VSIFOpenL(
             CPLResetExtensionSafe(psTransform->pszRPCInverseLog, "csvt")
                 .c_str(),
@@ -1175,200 +1372,227 @@ static bool RPCInverseTransformPoint(GDALRPCTransformInfo *psTransform,
     /*      Now iterate, trying to find a closer LL location that will      */
     /*      back transform to the indicated pixel and line.                 */
     /* -------------------------------------------------------------------- */
-    double dfPixelDeltaX = 0.0;
-    double dfPixelDeltaY = 0.0;
-    double dfLastResultX = 0.0;
-    double dfLastResultY = 0.0;
-    double dfLastPixelDeltaX = 0.0;
-    double dfLastPixelDeltaY = 0.0;
-    bool bLastPixelDeltaValid = false;
     const int nMaxIterations = (psTransform->nMaxIterations > 0)
                                    ? psTransform->nMaxIterations
                                : (psTransform->poDS != nullptr) ? 20
                                                                 : 10;
-    int nCountConsecutiveErrorBelow2 = 0;
+
+    std::vector<double> adfLong(nPointCount);
+    std::vector<double> adfLat(nPointCount);
+    std::vector<double> adfHeight(nPointCount);
+    std::vector<double> adfBackPixel(nPointCount);
+    std::vector<double> adfBackLine(nPointCount);
 
     int iIter = 0;  // Used after for.
-    for (; iIter < nMaxIterations; iIter++)
+    for (; iIter < nMaxIterations && !anActive.empty(); iIter++)
     {
-        double dfBackPixel = 0.0;
-        double dfBackLine = 0.0;
-
         // Update DEMH.
-        double dfDEMH = 0.0;
-        double dfDEMPixel = 0.0;
-        double dfDEMLine = 0.0;
-        if (!GDALRPCGetHeightAtLongLat(psTransform, dfResultX, dfResultY,
-                                       &dfDEMH, &dfDEMPixel, &dfDEMLine))
+        size_t nKept = 0;
+        for (const int i : anActive)
         {
-            if (psTransform->poDS)
-            {
-                CPLDebug("RPC", "DEM (pixel, line) = (%g, %g)", dfDEMPixel,
-                         dfDEMLine);
-            }
-
-            // The first time, the guess might be completely out of the
-            // validity of the DEM, so pickup the "reference Z" as the
-            // first guess or the closest point of the DEM by snapping to it.
-            if (iIter == 0)
+            const double dfPixel = padfPixel[i];
+            const double dfLine = padfLine[i];
+            const double dfResultX = asState[i].dfResultX;
+            const double dfResultY = asState[i].dfResultY;
+            double dfDEMH = 0.0;
+            double dfDEMPixel = 0.0;
+            double dfDEMLine = 0.0;
+            if (!GDALRPCGetHeightAtLongLat(psTransform, dfResultX, dfResultY,
+                                           &dfDEMH, &dfDEMPixel, &dfDEMLine))
             {
-                bool bUseRefZ = true;
                 if (psTransform->poDS)
                 {
-                    if (dfDEMPixel >= psTransform->poDS->GetRasterXSize())
-                        dfDEMPixel = psTransform->poDS->GetRasterXSize() - 0.5;
-                    else if (dfDEMPixel < 0)
-                        dfDEMPixel = 0.5;
-                    if (dfDEMLine >= psTransform->poDS->GetRasterYSize())
-                        dfDEMLine = psTransform->poDS->GetRasterYSize() - 0.5;
-                    else if (dfDEMPixel < 0)
-                        dfDEMPixel = 0.5;
-                    if (GDALRPCGetDEMHeight(psTransform, dfDEMPixel, dfDEMLine,
-                                            &dfDEMH))
+                    CPLDebug("RPC", "DEM (pixel, line) = (%g, %g)", dfDEMPixel,
+                             dfDEMLine);
+                }
+
+                // The first time, the guess might be completely out of the
+                // validity of the DEM, so pickup the "reference Z" as the
+                // first guess or the closest point of the DEM by snapping to
+                // it.
+                if (iIter == 0)
+                {
+                    bool bUseRefZ = true;
+                    if (psTransform->poDS)
                     {
-                        bUseRefZ = false;
+                        if (dfDEMPixel >= psTransform->poDS->GetRasterXSize())
+                            dfDEMPixel =
+                                psTransform->poDS->GetRasterXSize() - 0.5;
+                        else if (dfDEMPixel < 0)
+                            dfDEMPixel = 0.5;
+                        if (dfDEMLine >= psTransform->poDS->GetRasterYSize())
+                            dfDEMLine =
+                                psTransform->poDS->GetRasterYSize() - 0.5;
+                        else if (dfDEMPixel < 0)
+                            dfDEMPixel = 0.5;
+                        if (GDALRPCGetDEMHeight(psTransform, dfDEMPixel,
+                                                dfDEMLine, &dfDEMH))
+                        {
+                            bUseRefZ = false;
+                            CPLDebug("RPC",
+                                     "Iteration %d for (pixel, line) = "
+                                     "(%g, %g): "
+                                     "No elevation value at %.15g %.15g. "
+                                     "Using elevation %g at DEM (pixel, "
+                                     "line) = "
+                                     "(%g, %g) (snapping to boundaries) "
+                                     "instead",
+                                     iIter, dfPixel, dfLine, dfResultX,
+                                     dfResultY, dfDEMH, dfDEMPixel, dfDEMLine);
+                        }
+                    }
+                    if (bUseRefZ)
+                    {
+                        dfDEMH = psTransform->dfRefZ;
                         CPLDebug("RPC",
                                  "Iteration %d for (pixel, line) = (%g, %g): "
                                  "No elevation value at %.15g %.15g. "
-                                 "Using elevation %g at DEM (pixel, line) = "
-                                 "(%g, %g) (snapping to boundaries) instead",
+                                 "Using elevation %g of reference point "
+                                 "instead",
                                  iIter, dfPixel, dfLine, dfResultX, dfResultY,
-                                 dfDEMH, dfDEMPixel, dfDEMLine);
+                                 dfDEMH);
                     }
                 }
-                if (bUseRefZ)
+                else
                 {
-                    dfDEMH = psTransform->dfRefZ;
                     CPLDebug("RPC",
                              "Iteration %d for (pixel, line) = (%g, %g): "
-                             "No elevation value at %.15g %.15g. "
-                             "Using elevation %g of reference point instead",
-                             iIter, dfPixel, dfLine, dfResultX, dfResultY,
-                             dfDEMH);
+                             "No elevation value at %.15g %.15g. Erroring out",
+                             iIter, dfPixel, dfLine, dfResultX, dfResultY);
+                    continue;
                 }
             }
-            else
-            {
-                CPLDebug("RPC",
-                         "Iteration %d for (pixel, line) = (%g, %g): "
-                         "No elevation value at %.15g %.15g. Erroring out",
-                         iIter, dfPixel, dfLine, dfResultX, dfResultY);
-                if (fpLog)
-                    VSIFCloseL(fpLog);
-                return false;
-            }
-        }
 
-        RPCTransformPoint(psTransform, dfResultX, dfResultY,
-                          dfUserHeight + dfDEMH, &dfBackPixel, &dfBackLine);
+            adfLong[nKept] = dfResultX;
+            adfLat[nKept] = dfResultY;
+            adfHeight[nKept] = padfUserHeight[i] + dfDEMH;
+            anActive[nKept] = i;
+            ++nKept;
+        }
+        anActive.resize(nKept);
 
-        dfPixelDeltaX = dfBackPixel - dfPixel;
-        dfPixelDeltaY = dfBackLine - dfLine;
+        RPCTransformPoints(psTransform, nKept, adfLong.data(), adfLat.data(),
+                           adfHeight.data(), adfBackPixel.data(),
+                           adfBackLine.data());
 
-        if (psTransform->bRPCInverseVerbose)
-        {
-            CPLDebug("RPC",
-                     "Iter %d: dfPixelDeltaX=%.02f, dfPixelDeltaY=%.02f, "
-                     "long=%f, lat=%f, height=%f",
-                     iIter, dfPixelDeltaX, dfPixelDeltaY, dfResultX, dfResultY,
-                     dfUserHeight + dfDEMH);
-        }
-        if (fpLog != nullptr)
+        nKept = 0;
+        for (size_t k = 0; k < anActive.size(); ++k)
         {
-            VSIFPrintfL(fpLog,
-                        "%d,%.12f,%.12f,%f,\"POINT(%.12f %.12f)\",%f,%f\n",
-                        iIter, dfResultX, dfResultY, dfUserHeight + dfDEMH,
-                        dfResultX, dfResultY, dfPixelDeltaX, dfPixelDeltaY);
-        }
+            const int i = anActive[k];
+            RPCInverseIterState &sState = asState[i];
+
+            const double dfPixelDeltaX = adfBackPixel[k] - padfPixel[i];
+            const double dfPixelDeltaY = adfBackLine[k] - padfLine[i];
+            sState.dfPixelDeltaX = dfPixelDeltaX;
+            sState.dfPixelDeltaY = dfPixelDeltaY;
 
-        const double dfError =
-            std::max(std::abs(dfPixelDeltaX), std::abs(dfPixelDeltaY));
-        if (dfError < psTransform->dfPixErrThreshold)
-        {
-            iIter = -1;
             if (psTransform->bRPCInverseVerbose)
             {
-                CPLDebug("RPC", "Converged!");
+                CPLDebug("RPC",
+                         "Iter %d: dfPixelDeltaX=%.02f, dfPixelDeltaY=%.02f, "
+                         "long=%f, lat=%f, height=%f",
+                         iIter, dfPixelDeltaX, dfPixelDeltaY, sState.dfResultX,
+                         sState.dfResultY, adfHeight[k]);
             }
-            break;
-        }
-        else if (psTransform->poDS != nullptr && bLastPixelDeltaValid &&
-                 dfPixelDeltaX * dfLastPixelDeltaX < 0 &&
-                 dfPixelDeltaY * dfLastPixelDeltaY < 0)
-        {
-            // When there is a DEM, if the error changes sign, we might
-            // oscillate forever, so take a mean position as a new guess.
-            if (psTransform->bRPCInverseVerbose)
+            if (fpLog != nullptr)
             {
-                CPLDebug("RPC",
-                         "Oscillation detected. "
-                         "Taking mean of 2 previous results as new guess");
+                VSIFPrintfL(fpLog,
+                            "%d,%.12f,%.12f,%f,\"POINT(%.12f %.12f)\",%f,%f\n",
+                            iIter, sState.dfResultX, sState.dfResultY,
+                            adfHeight[k], sState.dfResultX, sState.dfResultY,
+                            dfPixelDeltaX, dfPixelDeltaY);
             }
-            dfResultX = (fabs(dfPixelDeltaX) * dfLastResultX +
-                         fabs(dfLastPixelDeltaX) * dfResultX) /
-                        (fabs(dfPixelDeltaX) + fabs(dfLastPixelDeltaX));
-            dfResultY = (fabs(dfPixelDeltaY) * dfLastResultY +
-                         fabs(dfLastPixelDeltaY) * dfResultY) /
-                        (fabs(dfPixelDeltaY) + fabs(dfLastPixelDeltaY));
-            bLastPixelDeltaValid = false;
-            nCountConsecutiveErrorBelow2 = 0;
-            continue;
-        }
 
-        double dfBoostFactor = 1.0;
-        if (psTransform->poDS != nullptr && nCountConsecutiveErrorBelow2 >= 5 &&
-            dfError < 2)
-        {
-            // When there is a DEM, if we remain below a given threshold
-            // (somewhat arbitrarily set to 2 pixels) for some time, apply a
-            // "boost factor" for the new guessed result, in the hope we will go
-            // out of the somewhat current stuck situation.
-            dfBoostFactor = 10;
-            if (psTransform->bRPCInverseVerbose)
+            const double dfError =
+                std::max(std::abs(dfPixelDeltaX), std::abs(dfPixelDeltaY));
+            if (dfError < psTransform->dfPixErrThreshold)
             {
-                CPLDebug("RPC", "Applying boost factor 10");
+                if (psTransform->bRPCInverseVerbose)
+                {
+                    CPLDebug("RPC", "Converged!");
+                }
+                padfLong[i] = sState.dfResultX;
+                padfLat[i] = sState.dfResultY;
+                panSuccess[i] = TRUE;
+                continue;
             }
-        }
 
-        if (dfError < 2)
-            nCountConsecutiveErrorBelow2++;
-        else
-            nCountConsecutiveErrorBelow2 = 0;
-
-        const double dfNewResultX =
-            dfResultX -
-            (dfPixelDeltaX * psTransform->adfPLToLatLongGeoTransform[1] *
-             dfBoostFactor) -
-            (dfPixelDeltaY * psTransform->adfPLToLatLongGeoTransform[2] *
-             dfBoostFactor);
-        const double dfNewResultY =
-            dfResultY -
-            (dfPixelDeltaX * psTransform->adfPLToLatLongGeoTransform[4] *
-             dfBoostFactor) -
-            (dfPixelDeltaY * psTransform->adfPLToLatLongGeoTransform[5] *
-             dfBoostFactor);
-
-        dfLastResultX = dfResultX;
-        dfLastResultY = dfResultY;
-        dfResultX = dfNewResultX;
-        dfResultY = dfNewResultY;
-        dfLastPixelDeltaX = dfPixelDeltaX;
-        dfLastPixelDeltaY = dfPixelDeltaY;
-        bLastPixelDeltaValid = true;
+            anActive[nKept] = i;
+            ++nKept;
+
+            if (psTransform->poDS != nullptr && sState.bLastPixelDeltaValid &&
+                dfPixelDeltaX * sState.dfLastPixelDeltaX < 0 &&
+                dfPixelDeltaY * sState.dfLastPixelDeltaY < 0)
+            {
+                // When there is a DEM, if the error changes sign, we might
+                // oscillate forever, so take a mean position as a new guess.
+                if (psTransform->bRPCInverseVerbose)
+                {
+                    CPLDebug("RPC",
+                             "Oscillation detected. "
+                             "Taking mean of 2 previous results as new guess");
+                }
+                sState.dfResultX =
+                    (fabs(dfPixelDeltaX) * sState.dfLastResultX +
+                     fabs(sState.dfLastPixelDeltaX) * sState.dfResultX) /
+                    (fabs(dfPixelDeltaX) + fabs(sState.dfLastPixelDeltaX));
+                sState.dfResultY =
+                    (fabs(dfPixelDeltaY) * sState.dfLastResultY +
+                     fabs(sState.dfLastPixelDeltaY) * sState.dfResultY) /
+                    (fabs(dfPixelDeltaY) + fabs(sState.dfLastPixelDeltaY));
+                sState.bLastPixelDeltaValid = false;
+                sState.nCountConsecutiveErrorBelow2 = 0;
+                continue;
+            }
+
+            double dfBoostFactor = 1.0;
+            if (psTransform->poDS != nullptr &&
+                sState.nCountConsecutiveErrorBelow2 >= 5 && dfError < 2)
+            {
+                // When there is a DEM, if we remain below a given threshold
+                // (somewhat arbitrarily set to 2 pixels) for some time, apply
+                // a "boost factor" for the new guessed result, in the hope we
+                // will go out of the somewhat current stuck situation.
+                dfBoostFactor = 10;
+                if (psTransform->bRPCInverseVerbose)
+                {
+                    CPLDebug("RPC", "Applying boost factor 10");
+                }
+            }
+
+            if (dfError < 2)
+                sState.nCountConsecutiveErrorBelow2++;
+            else
+                sState.nCountConsecutiveErrorBelow2 = 0;
+
+            const double dfNewResultX =
+                sState.dfResultX -
+                (dfPixelDeltaX * padfGT[1] * dfBoostFactor) -
+                (dfPixelDeltaY * padfGT[2] * dfBoostFactor);
+            const double dfNewResultY =
+                sState.dfResultY -
+                (dfPixelDeltaX * padfGT[4] * dfBoostFactor) -
+                (dfPixelDeltaY * padfGT[5] * dfBoostFactor);
+
+            sState.dfLastResultX = sState.dfResultX;
+            sState.dfLastResultY = sState.dfResultY;
+            sState.dfResultX = dfNewResultX;
+            sState.dfResultY = dfNewResultY;
+            sState.dfLastPixelDeltaX = dfPixelDeltaX;
+            sState.dfLastPixelDeltaY = dfPixelDeltaY;
+            sState.bLastPixelDeltaValid = true;
+        }
+        anActive.resize(nKept);
     }
     if (fpLog != nullptr)
         VSIFCloseL(fpLog);
 
-    if (iIter != -1)
+    for (const int i : anActive)
     {
         CPLDebug("RPC", "Failed Iterations %d: Got: %.16g,%.16g  Offset=%g,%g",
-                 iIter, dfResultX, dfResultY, dfPixelDeltaX, dfPixelDeltaY);
-        return false;
+                 iIter, asState[i].dfResultX, asState[i].dfResultY,
+                 asState[i].dfPixelDeltaX, asState[i].dfPixelDeltaY);
     }
-
-    *pdfLong = dfResultX;
-    *pdfLat = dfResultY;
-    return true;
 }
 
 /************************************************************************/
@@ -1393,12 +1617,9 @@ static int GDALRPCGetDEMHeight(GDALRPCTransformInfo *psTransform,
             break;
     }
 
-    std::unique_ptr<DoublePointsCache> cacheDEM{psTransform->poCacheDEM};
-    int res =
-        GDALInterpolateAtPoint(psTransform->poDS->GetRasterBand(1), eResample,
-                               cacheDEM, dfXIn, dfYIn, pdfDEMH, nullptr);
-    psTransform->poCacheDEM = cacheDEM.release();
-    return res;
+    return GDALInterpolateAtPoint(psTransform->poDS->GetRasterBand(1),
+                                  eResample, *(psTransform->poCacheDEM), dfXIn,
+                                  dfYIn, pdfDEMH, nullptr);
 }
 
 /************************************************************************/
@@ -1457,6 +1678,12 @@ GDALRPCTransformWholeLineWithDEM(const GDALRPCTransformInfo *psTransform,
     const double dfDeltaY = dfY - nY;
 
     int bRet = TRUE;
+    // Points successfully transformed, and their heights, whose pixel/line
+    // coordinates are computed all at once at the end.
+    std::vector<int> anIndices;
+    std::vector<double> adfHeights;
+    anIndices.reserve(nPointCount);
+    adfHeights.reserve(nPointCount);
     for (int i = 0; i < nPointCount; i++)
     {
         if (padfX[i] == HUGE_VAL)
@@ -1566,11 +1793,10 @@ GDALRPCTransformWholeLineWithDEM(const GDALRPCTransformInfo *psTransform,
                             continue;
                         }
                         dfDEMH = adfElevData[k_valid_sample];
-                        RPCTransformPoint(
-                            psTransform, padfX[i], padfY[i],
+                        anIndices.push_back(i);
+                        adfHeights.push_back(
                             dfZ_i + (psTransform->dfHeightOffset + dfDEMH) *
-                                        psTransform->dfHeightScale,
-                            padfX + i, padfY + i);
+                                        psTransform->dfHeightScale);
 
                         panSuccess[i] = TRUE;
                         continue;
@@ -1586,11 +1812,10 @@ GDALRPCTransformWholeLineWithDEM(const GDALRPCTransformInfo *psTransform,
                             continue;
                         }
                         dfDEMH = psTransform->dfDEMMissingValue;
-                        RPCTransformPoint(
-                            psTransform, padfX[i], padfY[i],
+                        anIndices.push_back(i);
+                        adfHeights.push_back(
                             dfZ_i + (psTransform->dfHeightOffset + dfDEMH) *
-                                        psTransform->dfHeightScale,
-                            padfX + i, padfY + i);
+                                        psTransform->dfHeightScale);
 
                         panSuccess[i] = TRUE;
                         continue;
@@ -1646,16 +1871,17 @@ GDALRPCTransformWholeLineWithDEM(const GDALRPCTransformInfo *psTransform,
             padfY[i] = HUGE_VAL;
             continue;
         }
-        RPCTransformPoint(psTransform, padfX[i], padfY[i],
-                          dfZ_i + (psTransform->dfHeightOffset + dfDEMH) *
-                                      psTransform->dfHeightScale,
-                          padfX + i, padfY + i);
+        anIndices.push_back(i);
+        adfHeights.push_back(dfZ_i + (psTransform->dfHeightOffset + dfDEMH) *
+                                         psTransform->dfHeightScale);
 
         panSuccess[i] = TRUE;
     }
 
     VSIFree(padfDEMBuffer);
 
+    RPCTransformIndexedPoints(psTransform, anIndices, adfHeights, padfX, padfY);
+
     return bRet;
 }
 
@@ -1791,6 +2017,8 @@ static bool GDALRPCOpenDEM(GDALRPCTransformInfo *psTransform)
                                 psTransform->adfDEMReverseGeoTransform))
         {
             bIsValid = true;
+            psTransform->poCacheDEM =
+                std::make_shared<SharedDoublePointsCache>(DEM_CACHE_BLOCKS);
         }
     }
 
@@ -1920,6 +2148,10 @@ int GDALRPCTransform(void *pTransformArg, int bDstToSrc, int nPointCount,
         }
 
         int bRet = TRUE;
+        std::vector<int> anIndices;
+        std::vector<double> adfHeights;
+        anIndices.reserve(nPointCount);
+        adfHeights.reserve(nPointCount);
         for (int i = 0; i < nPointCount; i++)
         {
             if (!RPCIsValidLongLat(psTransform, padfX[i], padfY[i]))
@@ -1941,12 +2173,14 @@ int GDALRPCTransform(void *pTransformArg, int bDstToSrc, int nPointCount,
                 continue;
             }
 
-            RPCTransformPoint(psTransform, padfX[i], padfY[i],
-                              (padfZ ? padfZ[i] : 0.0) + dfHeight, padfX + i,
-                              padfY + i);
+            anIndices.push_back(i);
+            adfHeights.push_back((padfZ ? padfZ[i] : 0.0) + dfHeight);
             panSuccess[i] = TRUE;
         }
 
+        RPCTransformIndexedPoints(psTransform, anIndices, adfHeights, padfX,
+                                  padfY);
+
         return bRet;
     }
 
@@ -1964,14 +2198,23 @@ int GDALRPCTransform(void *pTransformArg, int bDstToSrc, int nPointCount,
     /*      function uses an iterative method from an initial linear        */
     /*      approximation.                                                  */
     /* -------------------------------------------------------------------- */
+    std::vector<double> adfResultX(nPointCount);
+    std::vector<double> adfResultY(nPointCount);
+    // With RPC_INVERSE_LOG, the log file is rewritten for each call
+    const int nBatchSize =
+        psTransform->pszRPCInverseLog ? 1 : std::max(nPointCount, 1);
+    for (int i = 0; i < nPointCount; i += nBatchSize)
+    {
+        const int nCount = std::min(nBatchSize, nPointCount - i);
+        RPCInverseTransformPoints(psTransform, nCount, padfX + i, padfY + i,
+                                  padfZ + i, adfResultX.data() + i,
+                                  adfResultY.data() + i, panSuccess + i);
+    }
+
     int bRet = TRUE;
     for (int i = 0; i < nPointCount; i++)
     {
-        double dfResultX = 0.0;
-        double dfResultY = 0.0;
-
-        if (!RPCInverseTransformPoint(psTransform, padfX[i], padfY[i], padfZ[i],
-                                      &dfResultX, &dfResultY))
+        if (!panSuccess[i])
         {
             bRet = FALSE;
             panSuccess[i] = FALSE;
@@ -1988,10 +2231,8 @@ int GDALRPCTransform(void *pTransformArg, int bDstToSrc, int nPointCount,
             continue;
         }
 
-        padfX[i] = dfResultX;
-        padfY[i] = dfResultY;
-
-        panSuccess[i] = TRUE;
+        padfX[i] = adfResultX[i];
+        padfY[i] = adfResultY[i];
     }
 
     return bRet;
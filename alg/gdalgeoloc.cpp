@@ -32,10 +32,13 @@
 #include "cpl_error.h"
 #include "cpl_minixml.h"
 #include "cpl_quad_tree.h"
+#include "cpl_sha256.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 #include "memdataset.h"
 
 constexpr float INVALID_BMXY = -10.0f;
@@ -1093,6 +1096,14 @@ bool GDALGeoLoc<Accessors>::GenerateBackMap(
     if (!pAccessors->AllocateBackMap())
         return false;
 
+    std::string osCacheFilename;
+    if (psTransform->pszBackMapCacheDir)
+    {
+        osCacheFilename = GetBackMapCacheFilename(psTransform);
+        if (LoadBackMapFromCache(psTransform, osCacheFilename))
+            return true;
+    }
+
     const double dfGeorefConventionOffset =
         psTransform->bOriginIsTopLeftCorner ? 0 : 0.5;
 
@@ -1156,12 +1167,6 @@ bool GDALGeoLoc<Accessors>::GenerateBackMap(
         }
     };
 
-    // Keep those objects in this outer scope, so they are reused, to
-    // save memory allocations.
-    OGRPoint oPoint;
-    OGRLinearRing oRing;
-    oRing.setNumPoints(5);
-
     /* -------------------------------------------------------------------- */
     /*      Run through the whole geoloc array forward projecting and       */
     /*      pushing into the backmap.                                       */
@@ -1219,220 +1224,338 @@ bool GDALGeoLoc<Accessors>::GenerateBackMap(
         xStartEnd[iXBlock].second = dfX + dfStep / 10;
     }
 
-    for (int iYBlock = 0; iYBlock < nYBlocks; ++iYBlock)
+    // Calls func(dfX, dfY) for each sample of a block of the geolocation
+    // array, in a deterministic order.
+    const auto ForEachSampleOfBlock =
+        [&yStartEnd, &xStartEnd, dfStep](int iXBlock, int iYBlock,
+                                         const auto &func)
     {
-        for (int iXBlock = 0; iXBlock < nXBlocks; ++iXBlock)
-        {
 #if 0
         CPLDebug("Process geoloc block (y=%d,x=%d) for y in [%f, %f] and x in [%f, %f]",
                  iYBlock, iXBlock,
                  yStartEnd[iYBlock].first, yStartEnd[iYBlock].second,
                  xStartEnd[iXBlock].first, xStartEnd[iXBlock].second);
 #endif
-            for (double dfY = yStartEnd[iYBlock].first;
-                 dfY < yStartEnd[iYBlock].second; dfY += dfStep)
+        for (double dfY = yStartEnd[iYBlock].first;
+             dfY < yStartEnd[iYBlock].second; dfY += dfStep)
+        {
+            for (double dfX = xStartEnd[iXBlock].first;
+                 dfX < xStartEnd[iXBlock].second; dfX += dfStep)
             {
-                for (double dfX = xStartEnd[iXBlock].first;
-                     dfX < xStartEnd[iXBlock].second; dfX += dfStep)
-                {
-                    // Use forward geolocation array interpolation to compute
-                    // the georeferenced position corresponding to (dfX, dfY)
-                    double dfGeoLocX;
-                    double dfGeoLocY;
-                    if (!PixelLineToXY(psTransform, dfX, dfY, dfGeoLocX,
-                                       dfGeoLocY))
-                        continue;
+                func(dfX, dfY);
+            }
+        }
+    };
+
+    // Result of the forward projection of a sample of the geolocation array.
+    // It only depends on the geolocation array, and not on the content of the
+    // backmap, so it can be computed concurrently for several samples.
+    struct BackMapSample
+    {
+        enum class Status : uint8_t
+        {
+            SKIP,
+            MATCHED,
+            FALLBACK
+        };
+
+        Status eStatus = Status::SKIP;
+        // Floating point coordinates in the pixel space of the backmap
+        double dBMX = 0;
+        double dBMY = 0;
+        // Backmap values when Status::MATCHED
+        float fBMXValue = 0;
+        float fBMYValue = 0;
+    };
 
-                    // Compute the floating point coordinates in the pixel space
-                    // of the backmap
-                    const double dBMX = static_cast<double>(
-                        (dfGeoLocX - dfMinX) / dfPixelXSize);
+    const auto ComputeSample = [&](double dfX, double dfY, OGRPoint &oPoint,
+                                   OGRLinearRing &oRing, BackMapSample &sample)
+    {
+        sample.eStatus = BackMapSample::Status::SKIP;
 
-                    const double dBMY = static_cast<double>(
-                        (dfMaxY - dfGeoLocY) / dfPixelYSize);
+        // Use forward geolocation array interpolation to compute the
+        // georeferenced position corresponding to (dfX, dfY)
+        double dfGeoLocX;
+        double dfGeoLocY;
+        if (!PixelLineToXY(psTransform, dfX, dfY, dfGeoLocX, dfGeoLocY))
+            return;
 
-                    // Get top left index by truncation
-                    const int iBMX = static_cast<int>(std::floor(dBMX));
-                    const int iBMY = static_cast<int>(std::floor(dBMY));
+        // Compute the floating point coordinates in the pixel space of the
+        // backmap
+        const double dBMX =
+            static_cast<double>((dfGeoLocX - dfMinX) / dfPixelXSize);
 
-                    if (iBMX >= 0 && iBMX < nBMXSize && iBMY >= 0 &&
-                        iBMY < nBMYSize)
-                    {
-                        // Compute the georeferenced position of the top-left
-                        // index of the backmap
-                        double dfGeoX = dfMinX + iBMX * dfPixelXSize;
-                        const double dfGeoY = dfMaxY - iBMY * dfPixelYSize;
+        const double dBMY =
+            static_cast<double>((dfMaxY - dfGeoLocY) / dfPixelYSize);
+
+        sample.dBMX = dBMX;
+        sample.dBMY = dBMY;
 
-                        bool bMatchingGeoLocCellFound = false;
+        // Get top left index by truncation
+        const int iBMX = static_cast<int>(std::floor(dBMX));
+        const int iBMY = static_cast<int>(std::floor(dBMY));
 
-                        const int nOuterIters =
-                            psTransform->bGeographicSRSWithMinus180Plus180LongRange &&
-                                    fabs(dfGeoX) >= 180
-                                ? 2
-                                : 1;
+        if (iBMX >= 0 && iBMX < nBMXSize && iBMY >= 0 && iBMY < nBMYSize)
+        {
+            // Compute the georeferenced position of the top-left index of
+            // the backmap
+            double dfGeoX = dfMinX + iBMX * dfPixelXSize;
+            const double dfGeoY = dfMaxY - iBMY * dfPixelYSize;
+
+            bool bMatchingGeoLocCellFound = false;
+
+            const int nOuterIters =
+                psTransform->bGeographicSRSWithMinus180Plus180LongRange &&
+                        fabs(dfGeoX) >= 180
+                    ? 2
+                    : 1;
 
-                        for (int iOuterIter = 0; iOuterIter < nOuterIters;
-                             ++iOuterIter)
+            for (int iOuterIter = 0; iOuterIter < nOuterIters; ++iOuterIter)
+            {
+                if (iOuterIter == 1 && dfGeoX >= 180)
+                    dfGeoX -= 360;
+                else if (iOuterIter == 1 && dfGeoX <= -180)
+                    dfGeoX += 360;
+
+                // Identify a cell (quadrilateral in georeferenced space) in
+                // the geolocation array in which dfGeoX, dfGeoY falls into.
+                oPoint.setX(dfGeoX);
+                oPoint.setY(dfGeoY);
+                const int nX = static_cast<int>(std::floor(dfX));
+                const int nY = static_cast<int>(std::floor(dfY));
+                for (int sx = -1; !bMatchingGeoLocCellFound && sx <= 0; sx++)
+                {
+                    for (int sy = -1; !bMatchingGeoLocCellFound && sy <= 0;
+                         sy++)
+                    {
+                        const int pixel = nX + sx;
+                        const int line = nY + sy;
+                        double x0, y0, x1, y1, x2, y2, x3, y3;
+                        if (!PixelLineToXY(psTransform, pixel, line, x0, y0) ||
+                            !PixelLineToXY(psTransform, pixel + 1, line, x2,
+                                           y2) ||
+                            !PixelLineToXY(psTransform, pixel, line + 1, x1,
+                                           y1) ||
+                            !PixelLineToXY(psTransform, pixel + 1, line + 1,
+                                           x3, y3))
                         {
-                            if (iOuterIter == 1 && dfGeoX >= 180)
-                                dfGeoX -= 360;
-                            else if (iOuterIter == 1 && dfGeoX <= -180)
-                                dfGeoX += 360;
-
-                            // Identify a cell (quadrilateral in georeferenced
-                            // space) in the geolocation array in which dfGeoX,
-                            // dfGeoY falls into.
-                            oPoint.setX(dfGeoX);
-                            oPoint.setY(dfGeoY);
-                            const int nX = static_cast<int>(std::floor(dfX));
-                            const int nY = static_cast<int>(std::floor(dfY));
-                            for (int sx = -1;
-                                 !bMatchingGeoLocCellFound && sx <= 0; sx++)
+                            break;
+                        }
+
+                        int nIters = 1;
+                        if (psTransform
+                                ->bGeographicSRSWithMinus180Plus180LongRange &&
+                            std::fabs(x0) > 170 && std::fabs(x1) > 170 &&
+                            std::fabs(x2) > 170 && std::fabs(x3) > 170 &&
+                            (std::fabs(x1 - x0) > 180 ||
+                             std::fabs(x2 - x0) > 180 ||
+                             std::fabs(x3 - x0) > 180))
+                        {
+                            nIters = 2;
+                            if (x0 > 0)
+                                x0 -= 360;
+                            if (x1 > 0)
+                                x1 -= 360;
+                            if (x2 > 0)
+                                x2 -= 360;
+                            if (x3 > 0)
+                                x3 -= 360;
+                        }
+                        for (int iIter = 0; iIter < nIters; ++iIter)
+                        {
+                            if (iIter == 1)
                             {
-                                for (int sy = -1;
-                                     !bMatchingGeoLocCellFound && sy <= 0; sy++)
-                                {
-                                    const int pixel = nX + sx;
-                                    const int line = nY + sy;
-                                    double x0, y0, x1, y1, x2, y2, x3, y3;
-                                    if (!PixelLineToXY(psTransform, pixel, line,
-                                                       x0, y0) ||
-                                        !PixelLineToXY(psTransform, pixel + 1,
-                                                       line, x2, y2) ||
-                                        !PixelLineToXY(psTransform, pixel,
-                                                       line + 1, x1, y1) ||
-                                        !PixelLineToXY(psTransform, pixel + 1,
-                                                       line + 1, x3, y3))
-                                    {
-                                        break;
-                                    }
-
-                                    int nIters = 1;
-                                    if (psTransform
-                                            ->bGeographicSRSWithMinus180Plus180LongRange &&
-                                        std::fabs(x0) > 170 &&
-                                        std::fabs(x1) > 170 &&
-                                        std::fabs(x2) > 170 &&
-                                        std::fabs(x3) > 170 &&
-                                        (std::fabs(x1 - x0) > 180 ||
-                                         std::fabs(x2 - x0) > 180 ||
-                                         std::fabs(x3 - x0) > 180))
-                                    {
-                                        nIters = 2;
-                                        if (x0 > 0)
-                                            x0 -= 360;
-                                        if (x1 > 0)
-                                            x1 -= 360;
-                                        if (x2 > 0)
-                                            x2 -= 360;
-                                        if (x3 > 0)
-                                            x3 -= 360;
-                                    }
-                                    for (int iIter = 0; iIter < nIters; ++iIter)
-                                    {
-                                        if (iIter == 1)
-                                        {
-                                            x0 += 360;
-                                            x1 += 360;
-                                            x2 += 360;
-                                            x3 += 360;
-                                        }
-
-                                        oRing.setPoint(0, x0, y0);
-                                        oRing.setPoint(1, x2, y2);
-                                        oRing.setPoint(2, x3, y3);
-                                        oRing.setPoint(3, x1, y1);
-                                        oRing.setPoint(4, x0, y0);
-                                        if (oRing.isPointInRing(&oPoint) ||
-                                            oRing.isPointOnRingBoundary(
-                                                &oPoint))
-                                        {
-                                            bMatchingGeoLocCellFound = true;
-                                            double dfBMXValue = pixel;
-                                            double dfBMYValue = line;
-                                            GDALInverseBilinearInterpolation(
-                                                dfGeoX, dfGeoY, x0, y0, x1, y1,
-                                                x2, y2, x3, y3, dfBMXValue,
-                                                dfBMYValue);
-
-                                            dfBMXValue =
-                                                (dfBMXValue +
-                                                 dfGeorefConventionOffset) *
-                                                    psTransform->dfPIXEL_STEP +
-                                                psTransform->dfPIXEL_OFFSET;
-                                            dfBMYValue =
-                                                (dfBMYValue +
-                                                 dfGeorefConventionOffset) *
-                                                    psTransform->dfLINE_STEP +
-                                                psTransform->dfLINE_OFFSET;
-
-                                            pAccessors->backMapXAccessor.Set(
-                                                iBMX, iBMY,
-                                                static_cast<float>(dfBMXValue));
-                                            pAccessors->backMapYAccessor.Set(
-                                                iBMX, iBMY,
-                                                static_cast<float>(dfBMYValue));
-                                            pAccessors->backMapWeightAccessor
-                                                .Set(iBMX, iBMY, 1.0f);
-                                        }
-                                    }
-                                }
+                                x0 += 360;
+                                x1 += 360;
+                                x2 += 360;
+                                x3 += 360;
+                            }
+
+                            oRing.setPoint(0, x0, y0);
+                            oRing.setPoint(1, x2, y2);
+                            oRing.setPoint(2, x3, y3);
+                            oRing.setPoint(3, x1, y1);
+                            oRing.setPoint(4, x0, y0);
+                            if (oRing.isPointInRing(&oPoint) ||
+                                oRing.isPointOnRingBoundary(&oPoint))
+                            {
+                                bMatchingGeoLocCellFound = true;
+                                double dfBMXValue = pixel;
+                                double dfBMYValue = line;
+                                GDALInverseBilinearInterpolation(
+                                    dfGeoX, dfGeoY, x0, y0, x1, y1, x2, y2, x3,
+                                    y3, dfBMXValue, dfBMYValue);
+
+                                dfBMXValue =
+                                    (dfBMXValue + dfGeorefConventionOffset) *
+                                        psTransform->dfPIXEL_STEP +
+                                    psTransform->dfPIXEL_OFFSET;
+                                dfBMYValue =
+                                    (dfBMYValue + dfGeorefConventionOffset) *
+                                        psTransform->dfLINE_STEP +
+                                    psTransform->dfLINE_OFFSET;
+
+                                sample.eStatus = BackMapSample::Status::MATCHED;
+                                sample.fBMXValue =
+                                    static_cast<float>(dfBMXValue);
+                                sample.fBMYValue =
+                                    static_cast<float>(dfBMYValue);
                             }
                         }
-                        if (bMatchingGeoLocCellFound)
-                            continue;
                     }
+                }
+            }
+            if (bMatchingGeoLocCellFound)
+                return;
+        }
 
-                    // We will end up here in non-nominal cases, with nodata,
-                    // holes, etc.
+        // We will end up here in non-nominal cases, with nodata, holes, etc.
 
-                    // Check if the center is in range
-                    if (iBMX < -1 || iBMY < -1 || iBMX > nBMXSize ||
-                        iBMY > nBMYSize)
-                        continue;
+        // Check if the center is in range
+        if (iBMX < -1 || iBMY < -1 || iBMX > nBMXSize || iBMY > nBMYSize)
+            return;
 
-                    const double fracBMX = dBMX - iBMX;
-                    const double fracBMY = dBMY - iBMY;
+        sample.eStatus = BackMapSample::Status::FALLBACK;
+    };
 
-                    // Check logic for top left pixel
-                    if ((iBMX >= 0) && (iBMY >= 0) && (iBMX < nBMXSize) &&
-                        (iBMY < nBMYSize) &&
-                        pAccessors->backMapWeightAccessor.Get(iBMX, iBMY) !=
-                            1.0f)
-                    {
-                        const double tempwt = (1.0 - fracBMX) * (1.0 - fracBMY);
-                        UpdateBackmap(iBMX, iBMY, dfX, dfY, tempwt);
-                    }
+    const auto ApplySample =
+        [&](double dfX, double dfY, const BackMapSample &sample)
+    {
+        if (sample.eStatus == BackMapSample::Status::SKIP)
+            return;
 
-                    // Check logic for top right pixel
-                    if ((iBMY >= 0) && (iBMX + 1 < nBMXSize) &&
-                        (iBMY < nBMYSize) &&
-                        pAccessors->backMapWeightAccessor.Get(iBMX + 1, iBMY) !=
-                            1.0f)
-                    {
-                        const double tempwt = fracBMX * (1.0 - fracBMY);
-                        UpdateBackmap(iBMX + 1, iBMY, dfX, dfY, tempwt);
-                    }
+        const double dBMX = sample.dBMX;
+        const double dBMY = sample.dBMY;
+        const int iBMX = static_cast<int>(std::floor(dBMX));
+        const int iBMY = static_cast<int>(std::floor(dBMY));
 
-                    // Check logic for bottom right pixel
-                    if ((iBMX + 1 < nBMXSize) && (iBMY + 1 < nBMYSize) &&
-                        pAccessors->backMapWeightAccessor.Get(iBMX + 1,
-                                                              iBMY + 1) != 1.0f)
-                    {
-                        const double tempwt = fracBMX * fracBMY;
-                        UpdateBackmap(iBMX + 1, iBMY + 1, dfX, dfY, tempwt);
-                    }
+        if (sample.eStatus == BackMapSample::Status::MATCHED)
+        {
+            pAccessors->backMapXAccessor.Set(iBMX, iBMY, sample.fBMXValue);
+            pAccessors->backMapYAccessor.Set(iBMX, iBMY, sample.fBMYValue);
+            pAccessors->backMapWeightAccessor.Set(iBMX, iBMY, 1.0f);
+            return;
+        }
+
+        const double fracBMX = dBMX - iBMX;
+        const double fracBMY = dBMY - iBMY;
 
-                    // Check logic for bottom left pixel
-                    if ((iBMX >= 0) && (iBMX < nBMXSize) &&
-                        (iBMY + 1 < nBMYSize) &&
-                        pAccessors->backMapWeightAccessor.Get(iBMX, iBMY + 1) !=
-                            1.0f)
+        // Check logic for top left pixel
+        if ((iBMX >= 0) && (iBMY >= 0) && (iBMX < nBMXSize) &&
+            (iBMY < nBMYSize) &&
+            pAccessors->backMapWeightAccessor.Get(iBMX, iBMY) != 1.0f)
+        {
+            const double tempwt = (1.0 - fracBMX) * (1.0 - fracBMY);
+            UpdateBackmap(iBMX, iBMY, dfX, dfY, tempwt);
+        }
+
+        // Check logic for top right pixel
+        if ((iBMY >= 0) && (iBMX + 1 < nBMXSize) && (iBMY < nBMYSize) &&
+            pAccessors->backMapWeightAccessor.Get(iBMX + 1, iBMY) != 1.0f)
+        {
+            const double tempwt = fracBMX * (1.0 - fracBMY);
+            UpdateBackmap(iBMX + 1, iBMY, dfX, dfY, tempwt);
+        }
+
+        // Check logic for bottom right pixel
+        if ((iBMX + 1 < nBMXSize) && (iBMY + 1 < nBMYSize) &&
+            pAccessors->backMapWeightAccessor.Get(iBMX + 1, iBMY + 1) != 1.0f)
+        {
+            const double tempwt = fracBMX * fracBMY;
+            UpdateBackmap(iBMX + 1, iBMY + 1, dfX, dfY, tempwt);
+        }
+
+        // Check logic for bottom left pixel
+        if ((iBMX >= 0) && (iBMX < nBMXSize) && (iBMY + 1 < nBMYSize) &&
+            pAccessors->backMapWeightAccessor.Get(iBMX, iBMY + 1) != 1.0f)
+        {
+            const double tempwt = (1.0 - fracBMX) * fracBMY;
+            UpdateBackmap(iBMX, iBMY + 1, dfX, dfY, tempwt);
+        }
+    };
+
+    // The forward projection of samples can be done in parallel, when the
+    // geolocation arrays are in RAM. The backmap is then updated in the same
+    // order as in the single-threaded case, so that the result is identical.
+    CPLWorkerThreadPool *poThreadPool =
+        psTransform->bUseArray && psTransform->nNumThreads > 1 &&
+                static_cast<int64_t>(nXBlocks) * nYBlocks > 1
+            ? GDALGetGlobalThreadPool(psTransform->nNumThreads)
+            : nullptr;
+    if (poThreadPool)
+    {
+        CPLDebug("GEOLOC", "Using %d threads for backmap generation",
+                 psTransform->nNumThreads);
+
+        // Process blocks by batches, to limit the RAM used to store the
+        // samples.
+        const int nBlocks = nXBlocks * nYBlocks;
+        const int nBatchSize = 2 * psTransform->nNumThreads;
+        std::vector<std::vector<BackMapSample>> aaoSamples(nBatchSize);
+        for (int iFirstBlock = 0; iFirstBlock < nBlocks;
+             iFirstBlock += nBatchSize)
+        {
+            const int nBatchBlocks =
+                std::min(nBatchSize, nBlocks - iFirstBlock);
+            auto poQueue = poThreadPool->CreateJobQueue();
+            for (int i = 0; i < nBatchBlocks; ++i)
+            {
+                poQueue->SubmitJob(
+                    [&aaoSamples, &ForEachSampleOfBlock, &ComputeSample,
+                     nXBlocks, iBlock = iFirstBlock + i, i]()
                     {
-                        const double tempwt = (1.0 - fracBMX) * fracBMY;
-                        UpdateBackmap(iBMX, iBMY + 1, dfX, dfY, tempwt);
-                    }
-                }
+                        OGRPoint oPoint;
+                        OGRLinearRing oRing;
+                        oRing.setNumPoints(5);
+                        auto &aoSamples = aaoSamples[i];
+                        aoSamples.clear();
+                        ForEachSampleOfBlock(
+                            iBlock % nXBlocks, iBlock / nXBlocks,
+                            [&](double dfX, double dfY)
+                            {
+                                aoSamples.emplace_back();
+                                ComputeSample(dfX, dfY, oPoint, oRing,
+                                              aoSamples.back());
+                            });
+                    });
+            }
+            poQueue->WaitCompletion();
+
+            for (int i = 0; i < nBatchBlocks; ++i)
+            {
+                const int iBlock = iFirstBlock + i;
+                const auto &aoSamples = aaoSamples[i];
+                size_t iSample = 0;
+                ForEachSampleOfBlock(iBlock % nXBlocks, iBlock / nXBlocks,
+                                     [&](double dfX, double dfY)
+                                     {
+                                         ApplySample(dfX, dfY,
+                                                     aoSamples[iSample]);
+                                         ++iSample;
+                                     });
+            }
+        }
+    }
+    else
+    {
+        // Keep those objects in this outer scope, so they are reused, to
+        // save memory allocations.
+        OGRPoint oPoint;
+        OGRLinearRing oRing;
+        oRing.setNumPoints(5);
+        BackMapSample sample;
+
+        for (int iYBlock = 0; iYBlock < nYBlocks; ++iYBlock)
+        {
+            for (int iXBlock = 0; iXBlock < nXBlocks; ++iXBlock)
+            {
+                ForEachSampleOfBlock(iXBlock, iYBlock,
+                                     [&](double dfX, double dfY)
+                                     {
+                                         ComputeSample(dfX, dfY, oPoint, oRing,
+                                                       sample);
+                                         ApplySample(dfX, dfY, sample);
+                                     });
             }
         }
     }
@@ -1579,12 +1702,194 @@ bool GDALGeoLoc<Accessors>::GenerateBackMap(
     }
 #endif
 
+    if (!osCacheFilename.empty())
+    {
+        pAccessors->FlushBackmapCaches();
+        SaveBackMapToCache(psTransform, poBackmapDS, osCacheFilename);
+    }
+
     pAccessors->ReleaseBackmapDataset(poBackmapDS);
     CPLDebug("GEOLOC", "Ending backmap generation");
 
     return true;
 }
 
+/************************************************************************/
+/*                 GDALGeoLoc::GetBackMapCacheFilename()                */
+/************************************************************************/
+
+/** Return the name of the file of the backmap cache directory where the
+ * backmap for the geolocation arrays and parameters of psTransform is stored.
+ *
+ * The name includes a SHA256 checksum of the geolocation arrays and of all
+ * the parameters that affect the computation of the backmap.
+ */
+template <class Accessors>
+std::string GDALGeoLoc<Accessors>::GetBackMapCacheFilename(
+    GDALGeoLocTransformInfo *psTransform)
+{
+    CPL_SHA256Context sContext;
+    CPL_SHA256Init(&sContext);
+
+    // Increment if the backmap computation algorithm changes.
+    constexpr int BACKMAP_VERSION = 1;
+    const auto HashValue = [&sContext](const auto &val)
+    { CPL_SHA256Update(&sContext, &val, sizeof(val)); };
+    HashValue(BACKMAP_VERSION);
+    HashValue(psTransform->nGeoLocXSize);
+    HashValue(psTransform->nGeoLocYSize);
+    HashValue(psTransform->dfOversampleFactor);
+    HashValue(psTransform->dfPIXEL_OFFSET);
+    HashValue(psTransform->dfPIXEL_STEP);
+    HashValue(psTransform->dfLINE_OFFSET);
+    HashValue(psTransform->dfLINE_STEP);
+    HashValue(psTransform->bOriginIsTopLeftCorner);
+    HashValue(psTransform->bGeographicSRSWithMinus180Plus180LongRange);
+    HashValue(psTransform->bHasNoData);
+    HashValue(psTransform->dfNoDataX);
+    HashValue(psTransform->nBackMapWidth);
+    HashValue(psTransform->nBackMapHeight);
+    CPL_SHA256Update(&sContext, psTransform->adfBackMapGeoTransform,
+                     sizeof(psTransform->adfBackMapGeoTransform));
+
+    auto pAccessors = static_cast<Accessors *>(psTransform->pAccessors);
+    std::vector<double> adfLine(psTransform->nGeoLocXSize);
+    for (auto *poAccessor :
+         {&pAccessors->geolocXAccessor, &pAccessors->geolocYAccessor})
+    {
+        for (int iY = 0; iY < psTransform->nGeoLocYSize; ++iY)
+        {
+            for (int iX = 0; iX < psTransform->nGeoLocXSize; ++iX)
+                adfLine[iX] = poAccessor->Get(iX, iY);
+            CPL_SHA256Update(&sContext, adfLine.data(),
+                             adfLine.size() * sizeof(double));
+        }
+    }
+
+    GByte abyHash[CPL_SHA256_HASH_SIZE];
+    CPL_SHA256Final(&sContext, abyHash);
+    std::string osHash;
+    for (const GByte byVal : abyHash)
+        osHash += CPLSPrintf("%02x", byVal);
+
+    return CPLFormFilenameSafe(psTransform->pszBackMapCacheDir,
+                               ("geoloc_backmap_" + osHash).c_str(), "tif");
+}
+
+/************************************************************************/
+/*                  GDALGeoLoc::LoadBackMapFromCache()                  */
+/************************************************************************/
+
+template <class Accessors>
+bool GDALGeoLoc<Accessors>::LoadBackMapFromCache(
+    GDALGeoLocTransformInfo *psTransform, const std::string &osFilename)
+{
+    VSIStatBufL sStat;
+    if (VSIStatL(osFilename.c_str(), &sStat) != 0)
+        return false;
+
+    const char *const apszAllowedDrivers[] = {"GTiff", nullptr};
+    std::unique_ptr<GDALDataset> poDS(GDALDataset::Open(
+        osFilename.c_str(), GDAL_OF_RASTER, apszAllowedDrivers));
+    const int nBMXSize = psTransform->nBackMapWidth;
+    const int nBMYSize = psTransform->nBackMapHeight;
+    GDALGeoTransform gt;
+    if (!poDS || poDS->GetRasterXSize() != nBMXSize ||
+        poDS->GetRasterYSize() != nBMYSize || poDS->GetRasterCount() != 2 ||
+        poDS->GetRasterBand(1)->GetRasterDataType() != GDT_Float32 ||
+        poDS->GetRasterBand(2)->GetRasterDataType() != GDT_Float32 ||
+        poDS->GetGeoTransform(gt) != CE_None ||
+        gt != GDALGeoTransform(psTransform->adfBackMapGeoTransform))
+    {
+        CPLDebug("GEOLOC", "Ignoring invalid cached backmap %s",
+                 osFilename.c_str());
+        return false;
+    }
+
+    auto pAccessors = static_cast<Accessors *>(psTransform->pAccessors);
+    std::vector<float> afX(nBMXSize);
+    std::vector<float> afY(nBMXSize);
+    for (int iY = 0; iY < nBMYSize; ++iY)
+    {
+        if (poDS->GetRasterBand(1)->RasterIO(GF_Read, 0, iY, nBMXSize, 1,
+                                             afX.data(), nBMXSize, 1,
+                                             GDT_Float32, 0, 0,
+                                             nullptr) != CE_None ||
+            poDS->GetRasterBand(2)->RasterIO(GF_Read, 0, iY, nBMXSize, 1,
+                                             afY.data(), nBMXSize, 1,
+                                             GDT_Float32, 0, 0,
+                                             nullptr) != CE_None)
+        {
+            // Restore the initial state of the backmap, so that it can
+            // be computed.
+            for (int iYReset = 0; iYReset < iY; ++iYReset)
+            {
+                for (int iX = 0; iX < nBMXSize; ++iX)
+                {
+                    pAccessors->backMapXAccessor.Set(iX, iYReset, 0.0f);
+                    pAccessors->backMapYAccessor.Set(iX, iYReset, 0.0f);
+                }
+            }
+            return false;
+        }
+        for (int iX = 0; iX < nBMXSize; ++iX)
+        {
+            pAccessors->backMapXAccessor.Set(iX, iY, afX[iX]);
+            pAccessors->backMapYAccessor.Set(iX, iY, afY[iX]);
+        }
+    }
+
+    pAccessors->FreeWghtsBackMap();
+    pAccessors->FlushBackmapCaches();
+
+    CPLDebug("GEOLOC", "Backmap loaded from %s", osFilename.c_str());
+    return true;
+}
+
+/************************************************************************/
+/*                   GDALGeoLoc::SaveBackMapToCache()                   */
+/************************************************************************/
+
+template <class Accessors>
+void GDALGeoLoc<Accessors>::SaveBackMapToCache(
+    GDALGeoLocTransformInfo *psTransform, GDALDataset *poBackmapDS,
+    const std::string &osFilename)
+{
+    auto poDriver = GetGDALDriverManager()->GetDriverByName("GTiff");
+    if (!poDriver)
+        return;
+
+    // Write to a temporary file, and rename it afterwards, so that
+    // concurrent processes never see a partially written cache file.
+    const std::string osTmpFilename =
+        osFilename + "." +
+        CPLGetFilename(CPLGenerateTempFilenameSafe(nullptr).c_str()) + ".tmp";
+    const char *const apszOptions[] = {"TILED=YES", nullptr};
+    bool bOK = false;
+    {
+        CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+        std::unique_ptr<GDALDataset> poOutDS(
+            poDriver->CreateCopy(osTmpFilename.c_str(), poBackmapDS, false,
+                                 const_cast<char **>(apszOptions), nullptr,
+                                 nullptr));
+        if (poOutDS)
+        {
+            bOK = poOutDS->SetGeoTransform(GDALGeoTransform(
+                      psTransform->adfBackMapGeoTransform)) == CE_None &&
+                  poOutDS->Close() == CE_None;
+        }
+    }
+    if (bOK && VSIRename(osTmpFilename.c_str(), osFilename.c_str()) == 0)
+    {
+        CPLDebug("GEOLOC", "Backmap saved to %s", osFilename.c_str());
+    }
+    else
+    {
+        CPLDebug("GEOLOC", "Cannot save backmap to %s", osFilename.c_str());
+        VSIUnlink(osTmpFilename.c_str());
+    }
+}
+
 /*! @endcond */
 
 /************************************************************************/
@@ -1627,9 +1932,17 @@ static void *GDALCreateSimilarGeoLocTransformer(void *hTransformArg,
                           1.0);
     }
 
+    CPLStringList aosTransformOptions;
+    aosTransformOptions.SetNameValue("NUM_THREADS",
+                                     CPLSPrintf("%d", psInfo->nNumThreads));
+    if (psInfo->pszBackMapCacheDir)
+        aosTransformOptions.SetNameValue("GEOLOC_BACKMAP_CACHE_DIR",
+                                         psInfo->pszBackMapCacheDir);
+
     auto psInfoNew =
-        static_cast<GDALGeoLocTransformInfo *>(GDALCreateGeoLocTransformer(
-            nullptr, papszGeolocationInfo, psInfo->bReversed));
+        static_cast<GDALGeoLocTransformInfo *>(GDALCreateGeoLocTransformerEx(
+            nullptr, papszGeolocationInfo, psInfo->bReversed, nullptr,
+            aosTransformOptions.List()));
     psInfoNew->dfOversampleFactor = psInfo->dfOversampleFactor;
 
     CSLDestroy(papszGeolocationInfo);
@@ -1799,6 +2112,20 @@ void *GDALCreateGeoLocTransformerEx(GDALDatasetH hBaseDS,
                      CPLGetConfigOption("GDAL_GEOLOC_BACKMAP_OVERSAMPLE_FACTOR",
                                         "1.3")))));
 
+    const char *pszThreads =
+        CSLFetchNameValue(papszTransformOptions, "NUM_THREADS");
+    if (pszThreads == nullptr)
+        pszThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+    psTransform->nNumThreads =
+        EQUAL(pszThreads, "ALL_CPUS") ? CPLGetNumCPUs() : atoi(pszThreads);
+    psTransform->nNumThreads = std::clamp(psTransform->nNumThreads, 1, 128);
+
+    const char *pszBackMapCacheDir = CSLFetchNameValueDef(
+        papszTransformOptions, "GEOLOC_BACKMAP_CACHE_DIR",
+        CPLGetConfigOption("GDAL_GEOLOC_BACKMAP_CACHE_DIR", nullptr));
+    if (pszBackMapCacheDir && pszBackMapCacheDir[0])
+        psTransform->pszBackMapCacheDir = CPLStrdup(pszBackMapCacheDir);
+
     memcpy(psTransform->sTI.abySignature, GDAL_GTI2_SIGNATURE,
            strlen(GDAL_GTI2_SIGNATURE));
     psTransform->sTI.pszClassName = "GDALGeoLocTransformer";
@@ -2085,6 +2412,7 @@ void GDALDestroyGeoLocTransformer(void *pTransformAlg)
         static_cast<GDALGeoLocTransformInfo *>(pTransformAlg);
 
     CSLDestroy(psTransform->papszGeolocationInfo);
+    CPLFree(psTransform->pszBackMapCacheDir);
 
     if (psTransform->bUseArray)
         delete static_cast<GDALGeoLocCArrayAccessors *>(
@@ -15,6 +15,10 @@
 
 #include "gdal_alg_priv.h"
 
+#include <string>
+
+class GDALDataset;
+
 /************************************************************************/
 /*                              GDALGeoLoc                              */
 /************************************************************************/
@@ -27,6 +31,16 @@ template <class Accessors> struct GDALGeoLoc
 
     static bool GenerateBackMap(GDALGeoLocTransformInfo *psTransform);
 
+    static std::string
+    GetBackMapCacheFilename(GDALGeoLocTransformInfo *psTransform);
+
+    static bool LoadBackMapFromCache(GDALGeoLocTransformInfo *psTransform,
+                                     const std::string &osFilename);
+
+    static void SaveBackMapToCache(GDALGeoLocTransformInfo *psTransform,
+                                   GDALDataset *poBackmapDS,
+                                   const std::string &osFilename);
+
     static bool PixelLineToXY(const GDALGeoLocTransformInfo *psTransform,
                               const int nGeoLocPixel, const int nGeoLocLine,
                               double &dfX, double &dfY);
@@ -15,12 +15,15 @@
 #include "gdalgeolocquadtree.h"
 
 #include "cpl_quad_tree.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 
 #include "ogr_geometry.h"
 
 #include <algorithm>
 #include <cstddef>
 #include <limits>
+#include <vector>
 
 /************************************************************************/
 /*                GDALGeoLocQuadTreeGetFeatureCorners()                 */
@@ -133,43 +136,111 @@ bool GDALGeoLocBuildQuadTree(GDALGeoLocTransformInfo *psTransform)
 
     CPLQuadTreeForceUseOfSubNodes(psTransform->hQuadTree);
 
-    for (size_t i = 0; i < nExtendedXYCount; i++)
+    // Computes the bounds of the cells in [nStart, nEnd[ that must be inserted
+    // in the quadtree.
+    struct CellToInsert
     {
-        double x0, y0, x1, y1, x2, y2, x3, y3;
-        if (!GDALGeoLocQuadTreeGetFeatureCorners(psTransform, i, x0, y0, x1, y1,
-                                                 x2, y2, x3, y3))
+        void *hFeature;
+        CPLRectObj sBounds;
+    };
+
+    const auto CollectCells =
+        [psTransform](size_t nStart, size_t nEnd,
+                      std::vector<CellToInsert> &aoCells)
+    {
+        aoCells.clear();
+        for (size_t i = nStart; i < nEnd; i++)
         {
-            continue;
-        }
+            double x0, y0, x1, y1, x2, y2, x3, y3;
+            if (!GDALGeoLocQuadTreeGetFeatureCorners(psTransform, i, x0, y0, x1,
+                                                     y1, x2, y2, x3, y3))
+            {
+                continue;
+            }
 
-        // Skip too large geometries (typically at very high latitudes)
-        // that would fill too many nodes in the quadtree
-        if (psTransform->bGeographicSRSWithMinus180Plus180LongRange &&
-            (std::fabs(x0) > 170 || std::fabs(x1) > 170 ||
-             std::fabs(x2) > 170 || std::fabs(x3) > 170) &&
-            (std::fabs(x1 - x0) > 180 || std::fabs(x2 - x0) > 180 ||
-             std::fabs(x3 - x0) > 180) &&
-            !(std::fabs(x0) > 170 && std::fabs(x1) > 170 &&
-              std::fabs(x2) > 170 && std::fabs(x3) > 170))
+            // Skip too large geometries (typically at very high latitudes)
+            // that would fill too many nodes in the quadtree
+            if (psTransform->bGeographicSRSWithMinus180Plus180LongRange &&
+                (std::fabs(x0) > 170 || std::fabs(x1) > 170 ||
+                 std::fabs(x2) > 170 || std::fabs(x3) > 170) &&
+                (std::fabs(x1 - x0) > 180 || std::fabs(x2 - x0) > 180 ||
+                 std::fabs(x3 - x0) > 180) &&
+                !(std::fabs(x0) > 170 && std::fabs(x1) > 170 &&
+                  std::fabs(x2) > 170 && std::fabs(x3) > 170))
+            {
+                continue;
+            }
+
+            CellToInsert sCell;
+            sCell.hFeature =
+                reinterpret_cast<void *>(static_cast<uintptr_t>(i));
+            GDALGeoLocQuadTreeGetFeatureBounds(sCell.hFeature, psTransform,
+                                               &sCell.sBounds);
+            aoCells.push_back(sCell);
+
+            // For a geometry crossing the antimeridian, we've insert before
+            // the "version" around -180 deg. Insert its corresponding version
+            // around +180 deg.
+            if (psTransform->bGeographicSRSWithMinus180Plus180LongRange &&
+                std::fabs(x0) > 170 && std::fabs(x1) > 170 &&
+                std::fabs(x2) > 170 && std::fabs(x3) > 170 &&
+                (std::fabs(x1 - x0) > 180 || std::fabs(x2 - x0) > 180 ||
+                 std::fabs(x3 - x0) > 180))
+            {
+                sCell.hFeature = reinterpret_cast<void *>(
+                    static_cast<uintptr_t>(i | BIT_IDX_RANGE_180_SET));
+                GDALGeoLocQuadTreeGetFeatureBounds(sCell.hFeature, psTransform,
+                                                   &sCell.sBounds);
+                aoCells.push_back(sCell);
+            }
+        }
+    };
+
+    // Bounds of cells can be computed in parallel when the geolocation arrays
+    // are in RAM. Cells are then inserted in the same order as in the
+    // single-threaded case, so that the quadtree is identical.
+    const int nThreads =
+        psTransform->bUseArray ? std::max(1, psTransform->nNumThreads) : 1;
+    CPLWorkerThreadPool *poThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    constexpr size_t CELLS_PER_JOB = 256 * 1024;
+    const int nJobsPerBatch = poThreadPool ? nThreads : 1;
+    std::vector<std::vector<CellToInsert>> aaoCells(nJobsPerBatch);
+    for (size_t nBatchStart = 0; nBatchStart < nExtendedXYCount;
+         nBatchStart += CELLS_PER_JOB * nJobsPerBatch)
+    {
+        CPLJobQueuePtr poQueue;
+        if (poThreadPool)
+            poQueue = poThreadPool->CreateJobQueue();
+        int nJobs = 0;
+        for (; nJobs < nJobsPerBatch; ++nJobs)
         {
-            continue;
+            const size_t nStart = nBatchStart + nJobs * CELLS_PER_JOB;
+            if (nStart >= nExtendedXYCount)
+                break;
+            const size_t nEnd =
+                std::min(nExtendedXYCount, nStart + CELLS_PER_JOB);
+            auto &aoCells = aaoCells[nJobs];
+            if (poQueue)
+            {
+                poQueue->SubmitJob([&CollectCells, &aoCells, nStart, nEnd]()
+                                   { CollectCells(nStart, nEnd, aoCells); });
+            }
+            else
+            {
+                CollectCells(nStart, nEnd, aoCells);
+            }
         }
+        if (poQueue)
+            poQueue->WaitCompletion();
 
-        CPLQuadTreeInsert(psTransform->hQuadTree,
-                          reinterpret_cast<void *>(static_cast<uintptr_t>(i)));
-
-        // For a geometry crossing the antimeridian, we've insert before
-        // the "version" around -180 deg. Insert its corresponding version
-        // around +180 deg.
-        if (psTransform->bGeographicSRSWithMinus180Plus180LongRange &&
-            std::fabs(x0) > 170 && std::fabs(x1) > 170 && std::fabs(x2) > 170 &&
-            std::fabs(x3) > 170 &&
-            (std::fabs(x1 - x0) > 180 || std::fabs(x2 - x0) > 180 ||
-             std::fabs(x3 - x0) > 180))
+        for (int iJob = 0; iJob < nJobs; ++iJob)
         {
-            CPLQuadTreeInsert(psTransform->hQuadTree,
-                              reinterpret_cast<void *>(static_cast<uintptr_t>(
-                                  i | BIT_IDX_RANGE_180_SET)));
+            for (const auto &sCell : aaoCells[iJob])
+            {
+                CPLQuadTreeInsertWithBounds(psTransform->hQuadTree,
+                                            sCell.hFeature, &sCell.sBounds);
+            }
         }
     }
 
@@ -31,7 +31,7 @@
 #include "cpl_error.h"
 #include "cpl_multiproc.h"
 #include "cpl_progress.h"
-#include "cpl_quad_tree.h"
+#include "cpl_packed_rtree.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
 #include "cpl_worker_thread_pool.h"
@@ -257,8 +257,8 @@ CPLErr GDALGridInverseDistanceToAPowerNearestNeighbor(
 
     GDALGridExtraParameters *psExtraParams =
         static_cast<GDALGridExtraParameters *>(hExtraParamsIn);
-    const CPLQuadTree *phQuadTree = psExtraParams->hQuadTree;
-    CPLAssert(phQuadTree);
+    const CPLPackedRTree *phRTree = psExtraParams->hRTree;
+    CPLAssert(phRTree);
 
     const double dfRPower2 = psExtraParams->dfRadiusPower2PreComp;
     const double dfPowerDiv2 = psExtraParams->dfPowerDiv2PreComp;
@@ -273,7 +273,7 @@ CPLErr GDALGridInverseDistanceToAPowerNearestNeighbor(
     sAoi.maxy = dfYPoint + dfSearchRadius;
     int nFeatureCount = 0;
     GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-        CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+        CPLPackedRTreeSearch(phRTree, &sAoi, &nFeatureCount));
     if (nFeatureCount != 0)
     {
         for (int k = 0; k < nFeatureCount; k++)
@@ -366,8 +366,8 @@ static CPLErr GDALGridInverseDistanceToAPowerNearestNeighborPerQuadrant(
 
     GDALGridExtraParameters *psExtraParams =
         static_cast<GDALGridExtraParameters *>(hExtraParamsIn);
-    const CPLQuadTree *phQuadTree = psExtraParams->hQuadTree;
-    CPLAssert(phQuadTree);
+    const CPLPackedRTree *phRTree = psExtraParams->hRTree;
+    CPLAssert(phRTree);
 
     const double dfRPower2 = psExtraParams->dfRadiusPower2PreComp;
     const double dfPowerDiv2 = psExtraParams->dfPowerDiv2PreComp;
@@ -381,7 +381,7 @@ static CPLErr GDALGridInverseDistanceToAPowerNearestNeighborPerQuadrant(
     sAoi.maxy = dfYPoint + dfSearchRadius;
     int nFeatureCount = 0;
     GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-        CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+        CPLPackedRTreeSearch(phRTree, &sAoi, &nFeatureCount));
     if (nFeatureCount != 0)
     {
         for (int k = 0; k < nFeatureCount; k++)
@@ -646,7 +646,7 @@ CPLErr GDALGridMovingAverage(const void *poOptionsIn, GUInt32 nPoints,
 
     GDALGridExtraParameters *psExtraParams =
         static_cast<GDALGridExtraParameters *>(hExtraParamsIn);
-    const CPLQuadTree *phQuadTree = psExtraParams->hQuadTree;
+    const CPLPackedRTree *phRTree = psExtraParams->hRTree;
 
     // Compute coefficients for coordinate system rotation.
     const double dfAngle = TO_RADIANS * poOptions->dfAngle;
@@ -658,7 +658,7 @@ CPLErr GDALGridMovingAverage(const void *poOptionsIn, GUInt32 nPoints,
     double dfAccumulator = 0.0;
 
     GUInt32 n = 0;  // Used after for.
-    if (phQuadTree != nullptr)
+    if (phRTree != nullptr)
     {
         CPLRectObj sAoi;
         sAoi.minx = dfXPoint - dfSearchRadius;
@@ -667,7 +667,7 @@ CPLErr GDALGridMovingAverage(const void *poOptionsIn, GUInt32 nPoints,
         sAoi.maxy = dfYPoint + dfSearchRadius;
         int nFeatureCount = 0;
         GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-            CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+            CPLPackedRTreeSearch(phRTree, &sAoi, &nFeatureCount));
         if (nFeatureCount != 0)
         {
             for (int k = 0; k < nFeatureCount; k++)
@@ -749,8 +749,8 @@ static CPLErr GDALGridMovingAveragePerQuadrant(
 
     GDALGridExtraParameters *psExtraParams =
         static_cast<GDALGridExtraParameters *>(hExtraParamsIn);
-    const CPLQuadTree *phQuadTree = psExtraParams->hQuadTree;
-    CPLAssert(phQuadTree);
+    const CPLPackedRTree *phRTree = psExtraParams->hRTree;
+    CPLAssert(phRTree);
 
     std::multimap<double, double> oMapDistanceToZValuesPerQuadrant[4];
 
@@ -763,7 +763,7 @@ static CPLErr GDALGridMovingAveragePerQuadrant(
     sAoi.maxy = dfYPoint + dfSearchRadius;
     int nFeatureCount = 0;
     GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-        CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+        CPLPackedRTreeSearch(phRTree, &sAoi, &nFeatureCount));
     if (nFeatureCount != 0)
     {
         for (int k = 0; k < nFeatureCount; k++)
@@ -893,7 +893,7 @@ CPLErr GDALGridNearestNeighbor(const void *poOptionsIn, GUInt32 nPoints,
     const double dfR12Square = dfRadius1Square * dfRadius2Square;
     GDALGridExtraParameters *psExtraParams =
         static_cast<GDALGridExtraParameters *>(hExtraParamsIn);
-    CPLQuadTree *hQuadTree = psExtraParams->hQuadTree;
+    CPLPackedRTree *hRTree = psExtraParams->hRTree;
 
     // Compute coefficients for coordinate system rotation.
     const double dfAngle = TO_RADIANS * poOptions->dfAngle;
@@ -906,7 +906,7 @@ CPLErr GDALGridNearestNeighbor(const void *poOptionsIn, GUInt32 nPoints,
     GUInt32 i = 0;
 
     double dfSearchRadius = psExtraParams->dfInitialSearchRadius;
-    if (hQuadTree != nullptr)
+    if (hRTree != nullptr)
     {
         if (poOptions->dfRadius1 > 0 || poOptions->dfRadius2 > 0)
             dfSearchRadius =
@@ -920,7 +920,7 @@ CPLErr GDALGridNearestNeighbor(const void *poOptionsIn, GUInt32 nPoints,
             sAoi.maxy = dfYPoint + dfSearchRadius;
             int nFeatureCount = 0;
             GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-                CPLQuadTreeSearch(hQuadTree, &sAoi, &nFeatureCount));
+                CPLPackedRTreeSearch(hRTree, &sAoi, &nFeatureCount));
             if (nFeatureCount != 0)
             {
                 // Nearest distance will be initialized with the distance to the
@@ -1051,7 +1051,7 @@ CPLErr GDALGridDataMetricMinimum(const void *poOptionsIn, GUInt32 nPoints,
 
     GDALGridExtraParameters *psExtraParams =
         static_cast<GDALGridExtraParameters *>(hExtraParamsIn);
-    CPLQuadTree *phQuadTree = psExtraParams->hQuadTree;
+    CPLPackedRTree *phRTree = psExtraParams->hRTree;
 
     // Compute coefficients for coordinate system rotation.
     const double dfAngle = TO_RADIANS * poOptions->dfAngle;
@@ -1061,7 +1061,7 @@ CPLErr GDALGridDataMetricMinimum(const void *poOptionsIn, GUInt32 nPoints,
 
     double dfMinimumValue = std::numeric_limits<double>::max();
     GUInt32 n = 0;
-    if (phQuadTree != nullptr)
+    if (phRTree != nullptr)
     {
         CPLRectObj sAoi;
         sAoi.minx = dfXPoint - dfSearchRadius;
@@ -1070,7 +1070,7 @@ CPLErr GDALGridDataMetricMinimum(const void *poOptionsIn, GUInt32 nPoints,
         sAoi.maxy = dfYPoint + dfSearchRadius;
         int nFeatureCount = 0;
         GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-            CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+            CPLPackedRTreeSearch(phRTree, &sAoi, &nFeatureCount));
         if (nFeatureCount != 0)
         {
             for (int k = 0; k < nFeatureCount; k++)
@@ -1163,8 +1163,8 @@ static CPLErr GDALGridDataMetricMinimumOrMaximumPerQuadrant(
 
     GDALGridExtraParameters *psExtraParams =
         static_cast<GDALGridExtraParameters *>(hExtraParamsIn);
-    const CPLQuadTree *phQuadTree = psExtraParams->hQuadTree;
-    CPLAssert(phQuadTree);
+    const CPLPackedRTree *phRTree = psExtraParams->hRTree;
+    CPLAssert(phRTree);
 
     CPLRectObj sAoi;
     sAoi.minx = dfXPoint - dfSearchRadius;
@@ -1173,7 +1173,7 @@ static CPLErr GDALGridDataMetricMinimumOrMaximumPerQuadrant(
     sAoi.maxy = dfYPoint + dfSearchRadius;
     int nFeatureCount = 0;
     GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-        CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+        CPLPackedRTreeSearch(phRTree, &sAoi, &nFeatureCount));
     std::multimap<double, double> oMapDistanceToZValuesPerQuadrant[4];
 
     if (nFeatureCount != 0)
@@ -1345,7 +1345,7 @@ CPLErr GDALGridDataMetricMaximum(const void *poOptionsIn, GUInt32 nPoints,
 
     GDALGridExtraParameters *psExtraParams =
         static_cast<GDALGridExtraParameters *>(hExtraParamsIn);
-    CPLQuadTree *phQuadTree = psExtraParams->hQuadTree;
+    CPLPackedRTree *phRTree = psExtraParams->hRTree;
 
     // Compute coefficients for coordinate system rotation.
     const double dfAngle = TO_RADIANS * poOptions->dfAngle;
@@ -1355,7 +1355,7 @@ CPLErr GDALGridDataMetricMaximum(const void *poOptionsIn, GUInt32 nPoints,
 
     double dfMaximumValue = -std::numeric_limits<double>::max();
     GUInt32 n = 0;
-    if (phQuadTree != nullptr)
+    if (phRTree != nullptr)
     {
         CPLRectObj sAoi;
         sAoi.minx = dfXPoint - dfSearchRadius;
@@ -1364,7 +1364,7 @@ CPLErr GDALGridDataMetricMaximum(const void *poOptionsIn, GUInt32 nPoints,
         sAoi.maxy = dfYPoint + dfSearchRadius;
         int nFeatureCount = 0;
         GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-            CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+            CPLPackedRTreeSearch(phRTree, &sAoi, &nFeatureCount));
         if (nFeatureCount != 0)
         {
             for (int k = 0; k < nFeatureCount; k++)
@@ -1501,7 +1501,7 @@ CPLErr GDALGridDataMetricRange(const void *poOptionsIn, GUInt32 nPoints,
 
     GDALGridExtraParameters *psExtraParams =
         static_cast<GDALGridExtraParameters *>(hExtraParamsIn);
-    CPLQuadTree *phQuadTree = psExtraParams->hQuadTree;
+    CPLPackedRTree *phRTree = psExtraParams->hRTree;
 
     // Compute coefficients for coordinate system rotation.
     const double dfAngle = TO_RADIANS * poOptions->dfAngle;
@@ -1512,7 +1512,7 @@ CPLErr GDALGridDataMetricRange(const void *poOptionsIn, GUInt32 nPoints,
     double dfMaximumValue = -std::numeric_limits<double>::max();
     double dfMinimumValue = std::numeric_limits<double>::max();
     GUInt32 n = 0;
-    if (phQuadTree != nullptr)
+    if (phRTree != nullptr)
     {
         CPLRectObj sAoi;
         sAoi.minx = dfXPoint - dfSearchRadius;
@@ -1521,7 +1521,7 @@ CPLErr GDALGridDataMetricRange(const void *poOptionsIn, GUInt32 nPoints,
         sAoi.maxy = dfYPoint + dfSearchRadius;
         int nFeatureCount = 0;
         GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-            CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+            CPLPackedRTreeSearch(phRTree, &sAoi, &nFeatureCount));
         if (nFeatureCount != 0)
         {
             for (int k = 0; k < nFeatureCount; k++)
@@ -1616,8 +1616,8 @@ static CPLErr GDALGridDataMetricRangePerQuadrant(
 
     GDALGridExtraParameters *psExtraParams =
         static_cast<GDALGridExtraParameters *>(hExtraParamsIn);
-    const CPLQuadTree *phQuadTree = psExtraParams->hQuadTree;
-    CPLAssert(phQuadTree);
+    const CPLPackedRTree *phRTree = psExtraParams->hRTree;
+    CPLAssert(phRTree);
 
     CPLRectObj sAoi;
     sAoi.minx = dfXPoint - dfSearchRadius;
@@ -1626,7 +1626,7 @@ static CPLErr GDALGridDataMetricRangePerQuadrant(
     sAoi.maxy = dfYPoint + dfSearchRadius;
     int nFeatureCount = 0;
     GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-        CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+        CPLPackedRTreeSearch(phRTree, &sAoi, &nFeatureCount));
     std::multimap<double, double> oMapDistanceToZValuesPerQuadrant[4];
 
     if (nFeatureCount != 0)
@@ -1773,7 +1773,7 @@ CPLErr GDALGridDataMetricCount(const void *poOptionsIn, GUInt32 nPoints,
 
     GDALGridExtraParameters *psExtraParams =
         static_cast<GDALGridExtraParameters *>(hExtraParamsIn);
-    CPLQuadTree *phQuadTree = psExtraParams->hQuadTree;
+    CPLPackedRTree *phRTree = psExtraParams->hRTree;
 
     // Compute coefficients for coordinate system rotation.
     const double dfAngle = TO_RADIANS * poOptions->dfAngle;
@@ -1782,7 +1782,7 @@ CPLErr GDALGridDataMetricCount(const void *poOptionsIn, GUInt32 nPoints,
     const double dfCoeff2 = bRotated ? sin(dfAngle) : 0.0;
 
     GUInt32 n = 0;
-    if (phQuadTree != nullptr)
+    if (phRTree != nullptr)
     {
         CPLRectObj sAoi;
         sAoi.minx = dfXPoint - dfSearchRadius;
@@ -1791,7 +1791,7 @@ CPLErr GDALGridDataMetricCount(const void *poOptionsIn, GUInt32 nPoints,
         sAoi.maxy = dfYPoint + dfSearchRadius;
         int nFeatureCount = 0;
         GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-            CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+            CPLPackedRTreeSearch(phRTree, &sAoi, &nFeatureCount));
         if (nFeatureCount != 0)
         {
             for (int k = 0; k < nFeatureCount; k++)
@@ -1878,8 +1878,8 @@ static CPLErr GDALGridDataMetricCountPerQuadrant(
 
     GDALGridExtraParameters *psExtraParams =
         static_cast<GDALGridExtraParameters *>(hExtraParamsIn);
-    const CPLQuadTree *phQuadTree = psExtraParams->hQuadTree;
-    CPLAssert(phQuadTree);
+    const CPLPackedRTree *phRTree = psExtraParams->hRTree;
+    CPLAssert(phRTree);
 
     CPLRectObj sAoi;
     sAoi.minx = dfXPoint - dfSearchRadius;
@@ -1888,7 +1888,7 @@ static CPLErr GDALGridDataMetricCountPerQuadrant(
     sAoi.maxy = dfYPoint + dfSearchRadius;
     int nFeatureCount = 0;
     GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-        CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+        CPLPackedRTreeSearch(phRTree, &sAoi, &nFeatureCount));
     std::multimap<double, double> oMapDistanceToZValuesPerQuadrant[4];
 
     if (nFeatureCount != 0)
@@ -2033,7 +2033,7 @@ CPLErr GDALGridDataMetricAverageDistance(const void *poOptionsIn,
 
     GDALGridExtraParameters *psExtraParams =
         static_cast<GDALGridExtraParameters *>(hExtraParamsIn);
-    CPLQuadTree *phQuadTree = psExtraParams->hQuadTree;
+    CPLPackedRTree *phRTree = psExtraParams->hRTree;
 
     // Compute coefficients for coordinate system rotation.
     const double dfAngle = TO_RADIANS * poOptions->dfAngle;
@@ -2043,7 +2043,7 @@ CPLErr GDALGridDataMetricAverageDistance(const void *poOptionsIn,
 
     double dfAccumulator = 0.0;
     GUInt32 n = 0;
-    if (phQuadTree != nullptr)
+    if (phRTree != nullptr)
     {
         CPLRectObj sAoi;
         sAoi.minx = dfXPoint - dfSearchRadius;
@@ -2052,7 +2052,7 @@ CPLErr GDALGridDataMetricAverageDistance(const void *poOptionsIn,
         sAoi.maxy = dfYPoint + dfSearchRadius;
         int nFeatureCount = 0;
         GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-            CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+            CPLPackedRTreeSearch(phRTree, &sAoi, &nFeatureCount));
         if (nFeatureCount != 0)
         {
             for (int k = 0; k < nFeatureCount; k++)
@@ -2142,8 +2142,8 @@ static CPLErr GDALGridDataMetricAverageDistancePerQuadrant(
 
     GDALGridExtraParameters *psExtraParams =
         static_cast<GDALGridExtraParameters *>(hExtraParamsIn);
-    const CPLQuadTree *phQuadTree = psExtraParams->hQuadTree;
-    CPLAssert(phQuadTree);
+    const CPLPackedRTree *phRTree = psExtraParams->hRTree;
+    CPLAssert(phRTree);
 
     CPLRectObj sAoi;
     sAoi.minx = dfXPoint - dfSearchRadius;
@@ -2152,7 +2152,7 @@ static CPLErr GDALGridDataMetricAverageDistancePerQuadrant(
     sAoi.maxy = dfYPoint + dfSearchRadius;
     int nFeatureCount = 0;
     GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-        CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+        CPLPackedRTreeSearch(phRTree, &sAoi, &nFeatureCount));
     std::multimap<double, double> oMapDistanceToZValuesPerQuadrant[4];
 
     if (nFeatureCount != 0)
@@ -2299,7 +2299,7 @@ CPLErr GDALGridDataMetricAverageDistancePts(
 
     GDALGridExtraParameters *psExtraParams =
         static_cast<GDALGridExtraParameters *>(hExtraParamsIn);
-    CPLQuadTree *phQuadTree = psExtraParams->hQuadTree;
+    CPLPackedRTree *phRTree = psExtraParams->hRTree;
 
     // Compute coefficients for coordinate system rotation.
     const double dfAngle = TO_RADIANS * poOptions->dfAngle;
@@ -2309,7 +2309,7 @@ CPLErr GDALGridDataMetricAverageDistancePts(
 
     double dfAccumulator = 0.0;
     GUInt32 n = 0;
-    if (phQuadTree != nullptr)
+    if (phRTree != nullptr)
     {
         CPLRectObj sAoi;
         sAoi.minx = dfXPoint - dfSearchRadius;
@@ -2318,7 +2318,7 @@ CPLErr GDALGridDataMetricAverageDistancePts(
         sAoi.maxy = dfYPoint + dfSearchRadius;
         int nFeatureCount = 0;
         GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-            CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+            CPLPackedRTreeSearch(phRTree, &sAoi, &nFeatureCount));
         if (nFeatureCount != 0)
         {
             for (int k = 0; k < nFeatureCount - 1; k++)
@@ -2707,7 +2707,7 @@ struct GDALGridContext
     CPLWorkerThreadPool *poWorkerThreadPool;
 };
 
-static void GDALGridContextCreateQuadTree(GDALGridContext *psContext);
+static void GDALGridContextCreateRTree(GDALGridContext *psContext);
 
 /**
  * Creates a context to do regular gridding from the scattered data.
@@ -2759,7 +2759,7 @@ GDALGridContext *GDALGridContextCreate(GDALGridAlgorithm eAlgorithm,
     CPLAssert(padfX);
     CPLAssert(padfY);
     CPLAssert(padfZ);
-    bool bCreateQuadTree = false;
+    bool bCreateRTree = false;
 
     const unsigned int nPointCountThreshold =
         atoi(CPLGetConfigOption("GDAL_GRID_POINT_COUNT_THRESHOLD", "100"));
@@ -2922,7 +2922,7 @@ GDALGridContext *GDALGridContextCreate(GDALGridAlgorithm eAlgorithm,
                 pfnGDALGridMethod =
                     GDALGridInverseDistanceToAPowerNearestNeighbor;
             }
-            bCreateQuadTree = true;
+            bCreateRTree = true;
             break;
         }
         case GGA_MovingAverage:
@@ -2943,15 +2943,15 @@ GDALGridContext *GDALGridContextCreate(GDALGridAlgorithm eAlgorithm,
                 poOptionsOld->nMaxPointsPerQuadrant != 0)
             {
                 pfnGDALGridMethod = GDALGridMovingAveragePerQuadrant;
-                bCreateQuadTree = true;
+                bCreateRTree = true;
             }
             else
             {
                 pfnGDALGridMethod = GDALGridMovingAverage;
-                bCreateQuadTree = (nPoints > nPointCountThreshold &&
-                                   poOptionsOld->dfAngle == 0.0 &&
-                                   (poOptionsOld->dfRadius1 > 0.0 ||
-                                    poOptionsOld->dfRadius2 > 0.0));
+                bCreateRTree = (nPoints > nPointCountThreshold &&
+                                poOptionsOld->dfAngle == 0.0 &&
+                                (poOptionsOld->dfRadius1 > 0.0 ||
+                                 poOptionsOld->dfRadius2 > 0.0));
             }
             break;
         }
@@ -2970,10 +2970,10 @@ GDALGridContext *GDALGridContextCreate(GDALGridAlgorithm eAlgorithm,
                    sizeof(GDALGridNearestNeighborOptions));
 
             pfnGDALGridMethod = GDALGridNearestNeighbor;
-            bCreateQuadTree = (nPoints > nPointCountThreshold &&
-                               poOptionsOld->dfAngle == 0.0 &&
-                               (poOptionsOld->dfRadius1 > 0.0 ||
-                                poOptionsOld->dfRadius2 > 0.0));
+            bCreateRTree = (nPoints > nPointCountThreshold &&
+                            poOptionsOld->dfAngle == 0.0 &&
+                            (poOptionsOld->dfRadius1 > 0.0 ||
+                             poOptionsOld->dfRadius2 > 0.0));
             break;
         }
         case GGA_MetricMinimum:
@@ -2993,15 +2993,15 @@ GDALGridContext *GDALGridContextCreate(GDALGridAlgorithm eAlgorithm,
                 poOptionsOld->nMaxPointsPerQuadrant != 0)
             {
                 pfnGDALGridMethod = GDALGridDataMetricMinimumPerQuadrant;
-                bCreateQuadTree = true;
+                bCreateRTree = true;
             }
             else
             {
                 pfnGDALGridMethod = GDALGridDataMetricMinimum;
-                bCreateQuadTree = (nPoints > nPointCountThreshold &&
-                                   poOptionsOld->dfAngle == 0.0 &&
-                                   (poOptionsOld->dfRadius1 > 0.0 ||
-                                    poOptionsOld->dfRadius2 > 0.0));
+                bCreateRTree = (nPoints > nPointCountThreshold &&
+                                poOptionsOld->dfAngle == 0.0 &&
+                                (poOptionsOld->dfRadius1 > 0.0 ||
+                                 poOptionsOld->dfRadius2 > 0.0));
             }
             break;
         }
@@ -3022,15 +3022,15 @@ GDALGridContext *GDALGridContextCreate(GDALGridAlgorithm eAlgorithm,
                 poOptionsOld->nMaxPointsPerQuadrant != 0)
             {
                 pfnGDALGridMethod = GDALGridDataMetricMaximumPerQuadrant;
-                bCreateQuadTree = true;
+                bCreateRTree = true;
             }
             else
             {
                 pfnGDALGridMethod = GDALGridDataMetricMaximum;
-                bCreateQuadTree = (nPoints > nPointCountThreshold &&
-                                   poOptionsOld->dfAngle == 0.0 &&
-                                   (poOptionsOld->dfRadius1 > 0.0 ||
-                                    poOptionsOld->dfRadius2 > 0.0));
+                bCreateRTree = (nPoints > nPointCountThreshold &&
+                                poOptionsOld->dfAngle == 0.0 &&
+                                (poOptionsOld->dfRadius1 > 0.0 ||
+                                 poOptionsOld->dfRadius2 > 0.0));
             }
 
             break;
@@ -3052,15 +3052,15 @@ GDALGridContext *GDALGridContextCreate(GDALGridAlgorithm eAlgorithm,
                 poOptionsOld->nMaxPointsPerQuadrant != 0)
             {
                 pfnGDALGridMethod = GDALGridDataMetricRangePerQuadrant;
-                bCreateQuadTree = true;
+                bCreateRTree = true;
             }
             else
             {
                 pfnGDALGridMethod = GDALGridDataMetricRange;
-                bCreateQuadTree = (nPoints > nPointCountThreshold &&
-                                   poOptionsOld->dfAngle == 0.0 &&
-                                   (poOptionsOld->dfRadius1 > 0.0 ||
-                                    poOptionsOld->dfRadius2 > 0.0));
+                bCreateRTree = (nPoints > nPointCountThreshold &&
+                                poOptionsOld->dfAngle == 0.0 &&
+                                (poOptionsOld->dfRadius1 > 0.0 ||
+                                 poOptionsOld->dfRadius2 > 0.0));
             }
 
             break;
@@ -3082,15 +3082,15 @@ GDALGridContext *GDALGridContextCreate(GDALGridAlgorithm eAlgorithm,
                 poOptionsOld->nMaxPointsPerQuadrant != 0)
             {
                 pfnGDALGridMethod = GDALGridDataMetricCountPerQuadrant;
-                bCreateQuadTree = true;
+                bCreateRTree = true;
             }
             else
             {
                 pfnGDALGridMethod = GDALGridDataMetricCount;
-                bCreateQuadTree = (nPoints > nPointCountThreshold &&
-                                   poOptionsOld->dfAngle == 0.0 &&
-                                   (poOptionsOld->dfRadius1 > 0.0 ||
-                                    poOptionsOld->dfRadius2 > 0.0));
+                bCreateRTree = (nPoints > nPointCountThreshold &&
+                                poOptionsOld->dfAngle == 0.0 &&
+                                (poOptionsOld->dfRadius1 > 0.0 ||
+                                 poOptionsOld->dfRadius2 > 0.0));
             }
 
             break;
@@ -3113,15 +3113,15 @@ GDALGridContext *GDALGridContextCreate(GDALGridAlgorithm eAlgorithm,
             {
                 pfnGDALGridMethod =
                     GDALGridDataMetricAverageDistancePerQuadrant;
-                bCreateQuadTree = true;
+                bCreateRTree = true;
             }
             else
             {
                 pfnGDALGridMethod = GDALGridDataMetricAverageDistance;
-                bCreateQuadTree = (nPoints > nPointCountThreshold &&
-                                   poOptionsOld->dfAngle == 0.0 &&
-                                   (poOptionsOld->dfRadius1 > 0.0 ||
-                                    poOptionsOld->dfRadius2 > 0.0));
+                bCreateRTree = (nPoints > nPointCountThreshold &&
+                                poOptionsOld->dfAngle == 0.0 &&
+                                (poOptionsOld->dfRadius1 > 0.0 ||
+                                 poOptionsOld->dfRadius2 > 0.0));
             }
 
             break;
@@ -3140,10 +3140,10 @@ GDALGridContext *GDALGridContextCreate(GDALGridAlgorithm eAlgorithm,
             memcpy(poOptionsNew, poOptions, sizeof(GDALGridDataMetricsOptions));
 
             pfnGDALGridMethod = GDALGridDataMetricAverageDistancePts;
-            bCreateQuadTree = (nPoints > nPointCountThreshold &&
-                               poOptionsOld->dfAngle == 0.0 &&
-                               (poOptionsOld->dfRadius1 > 0.0 ||
-                                poOptionsOld->dfRadius2 > 0.0));
+            bCreateRTree = (nPoints > nPointCountThreshold &&
+                            poOptionsOld->dfAngle == 0.0 &&
+                            (poOptionsOld->dfRadius1 > 0.0 ||
+                             poOptionsOld->dfRadius2 > 0.0));
 
             break;
         }
@@ -3201,7 +3201,7 @@ GDALGridContext *GDALGridContextCreate(GDALGridAlgorithm eAlgorithm,
     psContext->pasGridPoints = nullptr;
     psContext->sXYArrays.padfX = padfX;
     psContext->sXYArrays.padfY = padfY;
-    psContext->sExtraParameters.hQuadTree = nullptr;
+    psContext->sExtraParameters.hRTree = nullptr;
     psContext->sExtraParameters.dfInitialSearchRadius = 0.0;
     psContext->sExtraParameters.pafX = pafXAligned;
     psContext->sExtraParameters.pafY = pafYAligned;
@@ -3215,12 +3215,12 @@ GDALGridContext *GDALGridContextCreate(GDALGridAlgorithm eAlgorithm,
         pafXAligned ? false : !bCallerWillKeepPointArraysAlive;
 
     /* -------------------------------------------------------------------- */
-    /*  Create quadtree if requested and possible.                          */
+    /*  Create spatial index if requested and possible.                     */
     /* -------------------------------------------------------------------- */
-    if (bCreateQuadTree)
+    if (bCreateRTree)
     {
-        GDALGridContextCreateQuadTree(psContext);
-        if (psContext->sExtraParameters.hQuadTree == nullptr &&
+        GDALGridContextCreateRTree(psContext);
+        if (psContext->sExtraParameters.hRTree == nullptr &&
             (eAlgorithm == GGA_InverseDistanceToAPowerNearestNeighbor ||
              pfnGDALGridMethod == GDALGridMovingAveragePerQuadrant))
         {
@@ -3294,10 +3294,10 @@ GDALGridContext *GDALGridContextCreate(GDALGridAlgorithm eAlgorithm,
 }
 
 /************************************************************************/
-/*                   GDALGridContextCreateQuadTree()                    */
+/*                     GDALGridContextCreateRTree()                     */
 /************************************************************************/
 
-void GDALGridContextCreateQuadTree(GDALGridContext *psContext)
+void GDALGridContextCreateRTree(GDALGridContext *psContext)
 {
     const GUInt32 nPoints = psContext->nPoints;
     psContext->pasGridPoints = static_cast<GDALGridPoint *>(
@@ -3330,16 +3330,18 @@ void GDALGridContextCreateQuadTree(GDALGridContext *psContext)
         psContext->sExtraParameters.dfInitialSearchRadius = sqrt(
             (sRect.maxx - sRect.minx) * (sRect.maxy - sRect.miny) / nPoints);
 
-        psContext->sExtraParameters.hQuadTree =
-            CPLQuadTreeCreate(&sRect, GDALGridGetPointBounds);
+        psContext->sExtraParameters.hRTree =
+            CPLPackedRTreeCreate(GDALGridGetPointBounds);
 
         for (GUInt32 i = 0; i < nPoints; i++)
         {
             psContext->pasGridPoints[i].psXYArrays = &(psContext->sXYArrays);
             psContext->pasGridPoints[i].i = i;
-            CPLQuadTreeInsert(psContext->sExtraParameters.hQuadTree,
-                              psContext->pasGridPoints + i);
+            CPLPackedRTreeInsert(psContext->sExtraParameters.hRTree,
+                                 psContext->pasGridPoints + i);
         }
+        // Bulk load now, rather than in the first search of a worker thread
+        CPLPackedRTreeBuild(psContext->sExtraParameters.hRTree);
     }
 }
 
@@ -3359,8 +3361,8 @@ void GDALGridContextFree(GDALGridContext *psContext)
     {
         CPLFree(psContext->poOptions);
         CPLFree(psContext->pasGridPoints);
-        if (psContext->sExtraParameters.hQuadTree != nullptr)
-            CPLQuadTreeDestroy(psContext->sExtraParameters.hQuadTree);
+        if (psContext->sExtraParameters.hRTree != nullptr)
+            CPLPackedRTreeDestroy(psContext->sExtraParameters.hRTree);
         if (psContext->bFreePadfXYZArrays)
         {
             CPLFree(psContext->padfX);
@@ -3429,7 +3431,7 @@ CPLErr GDALGridContextProcess(GDALGridContext *psContext, double dfXMin,
     // by sampling along the edges.  If all points on edges are within
     // triangles, then interior points will also be.
     if (psContext->eAlgorithm == GGA_Linear &&
-        psContext->sExtraParameters.hQuadTree == nullptr)
+        psContext->sExtraParameters.hRTree == nullptr)
     {
         bool bNeedNearest = false;
         int nStartLeft = 0;
@@ -3478,7 +3480,7 @@ CPLErr GDALGridContextProcess(GDALGridContext *psContext, double dfXMin,
         if (bNeedNearest)
         {
             CPLDebug("GDAL_GRID", "Will need nearest neighbour");
-            GDALGridContextCreateQuadTree(psContext);
+            GDALGridContextCreateRTree(psContext);
         }
     }
 
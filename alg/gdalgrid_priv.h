@@ -15,7 +15,7 @@
 #define GDALGRID_PRIV_H
 
 #include "cpl_error.h"
-#include "cpl_quad_tree.h"
+#include "cpl_packed_rtree.h"
 
 #include "gdal_alg.h"
 
@@ -35,7 +35,7 @@ typedef struct
 
 typedef struct
 {
-    CPLQuadTree *hQuadTree;
+    CPLPackedRTree *hRTree;
     double dfInitialSearchRadius;
     float *pafX;  // Aligned to be usable with AVX
     float *pafY;
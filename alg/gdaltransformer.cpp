@@ -1950,6 +1950,11 @@ const char *GDALGetGenImgProjTranformerOptionList(void)
            "min='0.1' max='2' description='"
            "Oversample factor used to derive the size of the \"backmap\" used "
            "for geolocation array transformers.' default='1.3'/>"
+           "<Option name='GEOLOC_BACKMAP_CACHE_DIR' type='string' "
+           "description='"
+           "Directory where the backmap computed for geolocation arrays is "
+           "cached, and reused by later transformers using the same "
+           "geolocation arrays.'/>"
            "<Option name='GEOLOC_USE_TEMP_DATASETS' type='boolean' "
            "description='"
            "Whether temporary GeoTIFF datasets should be used to store the "
@@ -1992,7 +1997,10 @@ const char *GDALGetGenImgProjTranformerOptionList(void)
            "  <Value>NO</Value>"
            "</Option>"
            "<Option name='NUM_THREADS' type='string' "
-           "description='Number of threads to use'/>"
+           "description='Number of threads to use, for example to compute "
+           "the backmap of geolocation arrays. Integer value or ALL_CPUS. "
+           "Defaults to the value of the GDAL_NUM_THREADS configuration "
+           "option, or 1'/>"
            "</OptionList>";
 }
 
@@ -2171,6 +2179,13 @@ const char *GDALGetGenImgProjTranformerOptionList(void)
  * factor used to derive the size of the "backmap" used for geolocation array
  * transformers. Default value is 1.3.
  * </li>
+ * <li> GEOLOC_BACKMAP_CACHE_DIR=directory. (GDAL &gt;= 3.13) Directory where
+ * the backmap computed for geolocation array transformers is saved, in a file
+ * whose name includes a checksum of the geolocation arrays. Later
+ * transformers using the same geolocation arrays and parameters load it
+ * instead of computing it again. Can also be set with the
+ * GDAL_GEOLOC_BACKMAP_CACHE_DIR configuration option.
+ * </li>
  * <li> GEOLOC_USE_TEMP_DATASETS=YES/NO.
  * (GDAL &gt;= 3.5) Whether temporary GeoTIFF datasets should be used to store
  * the backmap. The default is NO, that is to use in-memory arrays, unless the
@@ -2206,6 +2221,11 @@ const char *GDALGetGenImgProjTranformerOptionList(void)
  * the coordinate system of the geolocation arrays. The default is to enable this mode
  * when the values in the geolocation array are in the -180,180, otherwise NO.
  * </li>
+ * <li>NUM_THREADS=number_of_threads/ALL_CPUS. (GDAL &gt;= 3.13) Number of
+ * threads used to compute the backmap (or the quadtree) of geolocation array
+ * transformers, when the geolocation arrays are held in RAM. Defaults to the
+ * value of the GDAL_NUM_THREADS configuration option, or 1.
+ * </li>
  * </ul>
  *
  * The use case for the *_APPROX_ERROR_* options is when defining an approximate
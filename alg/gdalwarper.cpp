@@ -1169,6 +1169,10 @@ const char *GDALWarpGetOptionList(void)
            "Can be set to a numeric value or ALL_CPUS to set the number of "
            "threads to use to parallelize the computation part of the warping. "
            "If not set, computation will be done in a single thread..'/>"
+           "<Option name='NUM_CHUNKS_IN_FLIGHT' type='int' min='2' "
+           "description='Only used with -multi. Number of chunks processed "
+           "at the same time, whose source data is read concurrently if the "
+           "source dataset can be read from several threads.' default='2'/>"
            "<Option name='STREAMABLE_OUTPUT' type='boolean' description='"
            "This defaults to FALSE, but may be set to TRUE typically when "
            "writing to a streamed file. The gdalwarp utility automatically "
@@ -1413,6 +1417,16 @@ const char *GDALWarpGetOptionList(void)
  * set the number of threads to use to parallelize the computation part of the
  * warping. If not set, computation will be done in a single thread.</li>
  *
+ * <li>NUM_CHUNKS_IN_FLIGHT: (GDAL >= 3.13) Only used by
+ * GDALWarpOperation::ChunkAndWarpMulti(), that is with gdalwarp -multi.
+ * Number of chunks processed at the same time. Defaults to 2. When set to a
+ * larger value, and if the source dataset can be read from several threads
+ * (see GDALGetThreadSafeDataset()), the source data of that number of chunks
+ * is read concurrently, which can help with high-latency sources such as
+ * cloud-hosted COGs. Destination I/O and warping computations remain
+ * serialized. The warp memory limit is shared between the chunks in flight,
+ * so increasing it along with this option may be appropriate.</li>
+ *
  * <li>STREAMABLE_OUTPUT: This defaults to FALSE, but may
  * be set to TRUE typically when writing to a streamed file. The
  * gdalwarp utility automatically sets this option when writing to
@@ -531,6 +531,12 @@ class CPL_DLL GDALWarpOperation final
     CPLMutex *hIOMutex = nullptr;
     CPLMutex *hWarpMutex = nullptr;
 
+    // Set by ChunkAndWarpMulti() when several chunks are in flight and the
+    // source dataset is thread-safe: only destination I/O is then serialized
+    // by hIOMutex.
+    bool m_bConcurrentSrcIO = false;
+    double m_dfConcurrentProgress = 0;
+
     int nChunkListCount = 0;
     int nChunkListMax = 0;
     GDALWarpChunk *pasChunkList = nullptr;
@@ -552,6 +558,7 @@ class CPL_DLL GDALWarpOperation final
     void CollectChunkList(int nDstXOff, int nDstYOff, int nDstXSize,
                           int nDstYSize);
     void ReportTiming(const char *);
+    CPLErr ChunkAndWarpConcurrent(int nChunksInFlight);
 
   public:
     GDALWarpOperation();
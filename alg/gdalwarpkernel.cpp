@@ -39,7 +39,7 @@
 #include "cpl_string.h"
 #include "cpl_vsi.h"
 #include "cpl_worker_thread_pool.h"
-#include "cpl_quad_tree.h"
+#include "cpl_packed_rtree.h"
 #include "gdal.h"
 #include "gdal_alg.h"
 #include "gdal_alg_priv.h"
@@ -195,6 +195,7 @@ static CPLErr GWKSumPreserving(GDALWarpKernel *);
 static CPLErr GWKCubicNoMasksOrDstDensityOnlyUShort(GDALWarpKernel *);
 static CPLErr GWKCubicSplineNoMasksOrDstDensityOnlyUShort(GDALWarpKernel *);
 static CPLErr GWKBilinearNoMasksOrDstDensityOnlyUShort(GDALWarpKernel *);
+static CPLErr GWKResampleSeparable(GDALWarpKernel *);
 
 /************************************************************************/
 /*                             GWKJobStruct                             */
@@ -1206,6 +1207,26 @@ CPLErr GDALWarpKernel::PerformWarp()
         papanBandSrcValid == nullptr && panUnifiedSrcValid == nullptr &&
         pafUnifiedSrcDensity == nullptr && panDstValid == nullptr;
 
+    // Separable convolution when downsampling with a transformation that is
+    // just a scaling and a translation.
+    if ((eResample == GRA_Bilinear || eResample == GRA_Cubic ||
+         eResample == GRA_CubicSpline || eResample == GRA_Lanczos) &&
+        !bUse4SamplesFormula && bNoMasksOrDstDensityOnly &&
+        !bApplyVerticalShift &&
+        (eWorkingDataType == GDT_UInt8 || eWorkingDataType == GDT_Int16 ||
+         eWorkingDataType == GDT_UInt16 || eWorkingDataType == GDT_Float32 ||
+         eWorkingDataType == GDT_Float64) &&
+        nXRadius <= nSrcXSize && nYRadius <= nSrcYSize &&
+        CPLAtof(CSLFetchNameValueDef(papszWarpOptions, "SRC_COORD_PRECISION",
+                                     "0")) == 0.0 &&
+        GDALTransformIsAffineNoRotation(pfnTransformer, pTransformerArg) &&
+        // for debug/testing purposes
+        CPLTestBool(
+            CPLGetConfigOption("GDAL_WARP_USE_AFFINE_OPTIMIZATION", "YES")))
+    {
+        return GWKResampleSeparable(this);
+    }
+
     if (eWorkingDataType == GDT_UInt8 && eResample == GRA_NearestNeighbour &&
         bNoMasksOrDstDensityOnly)
         return GWKNearestNoMasksOrDstDensityOnlyByte(this);
@@ -4597,16 +4618,13 @@ static bool GWKResampleOptimizedLanczos(const GDALWarpKernel *poWK, int iBand,
 }
 
 /************************************************************************/
-/*                         GWKComputeWeights()                          */
+/*                        GWKComputeWeights1D()                         */
 /************************************************************************/
 
-static void GWKComputeWeights(GDALResampleAlg eResample, int iMin, int iMax,
-                              double dfDeltaX, double dfXScale, int jMin,
-                              int jMax, double dfDeltaY, double dfYScale,
-                              double *padfWeightsHorizontal,
-                              double *padfWeightsVertical, double &dfInvWeights)
+static double GWKComputeWeights1D(GDALResampleAlg eResample, int iMin,
+                                  int iMax, double dfDelta, double dfScale,
+                                  double *padfWeights)
 {
-
     const FilterFuncType pfnGetWeight = apfGWKFilter[eResample];
     CPLAssert(pfnGetWeight);
     const FilterFunc4ValuesType pfnGetWeight4Values =
@@ -4617,45 +4635,39 @@ static void GWKComputeWeights(GDALResampleAlg eResample, int iMin, int iMax,
     int iC = 0;    // Used after for.
     // Not zero, but as close as possible to it, to avoid potential division by
     // zero at end of function
-    double dfAccumulatorWeightHorizontal = cpl::NumericLimits<double>::min();
+    double dfAccumulatorWeight = cpl::NumericLimits<double>::min();
     for (; i + 2 < iMax; i += 4, iC += 4)
     {
-        padfWeightsHorizontal[iC] = (i - dfDeltaX) * dfXScale;
-        padfWeightsHorizontal[iC + 1] = padfWeightsHorizontal[iC] + dfXScale;
-        padfWeightsHorizontal[iC + 2] =
-            padfWeightsHorizontal[iC + 1] + dfXScale;
-        padfWeightsHorizontal[iC + 3] =
-            padfWeightsHorizontal[iC + 2] + dfXScale;
-        dfAccumulatorWeightHorizontal +=
-            pfnGetWeight4Values(padfWeightsHorizontal + iC);
+        padfWeights[iC] = (i - dfDelta) * dfScale;
+        padfWeights[iC + 1] = padfWeights[iC] + dfScale;
+        padfWeights[iC + 2] = padfWeights[iC + 1] + dfScale;
+        padfWeights[iC + 3] = padfWeights[iC + 2] + dfScale;
+        dfAccumulatorWeight += pfnGetWeight4Values(padfWeights + iC);
     }
     for (; i <= iMax; ++i, ++iC)
     {
-        const double dfWeight = pfnGetWeight((i - dfDeltaX) * dfXScale);
-        padfWeightsHorizontal[iC] = dfWeight;
-        dfAccumulatorWeightHorizontal += dfWeight;
+        const double dfWeight = pfnGetWeight((i - dfDelta) * dfScale);
+        padfWeights[iC] = dfWeight;
+        dfAccumulatorWeight += dfWeight;
     }
 
-    int j = jMin;  // Used after for.
-    int jC = 0;    // Used after for.
-    // Not zero, but as close as possible to it, to avoid potential division by
-    // zero at end of function
-    double dfAccumulatorWeightVertical = cpl::NumericLimits<double>::min();
-    for (; j + 2 < jMax; j += 4, jC += 4)
-    {
-        padfWeightsVertical[jC] = (j - dfDeltaY) * dfYScale;
-        padfWeightsVertical[jC + 1] = padfWeightsVertical[jC] + dfYScale;
-        padfWeightsVertical[jC + 2] = padfWeightsVertical[jC + 1] + dfYScale;
-        padfWeightsVertical[jC + 3] = padfWeightsVertical[jC + 2] + dfYScale;
-        dfAccumulatorWeightVertical +=
-            pfnGetWeight4Values(padfWeightsVertical + jC);
-    }
-    for (; j <= jMax; ++j, ++jC)
-    {
-        const double dfWeight = pfnGetWeight((j - dfDeltaY) * dfYScale);
-        padfWeightsVertical[jC] = dfWeight;
-        dfAccumulatorWeightVertical += dfWeight;
-    }
+    return dfAccumulatorWeight;
+}
+
+/************************************************************************/
+/*                         GWKComputeWeights()                          */
+/************************************************************************/
+
+static void GWKComputeWeights(GDALResampleAlg eResample, int iMin, int iMax,
+                              double dfDeltaX, double dfXScale, int jMin,
+                              int jMax, double dfDeltaY, double dfYScale,
+                              double *padfWeightsHorizontal,
+                              double *padfWeightsVertical, double &dfInvWeights)
+{
+    const double dfAccumulatorWeightHorizontal = GWKComputeWeights1D(
+        eResample, iMin, iMax, dfDeltaX, dfXScale, padfWeightsHorizontal);
+    const double dfAccumulatorWeightVertical = GWKComputeWeights1D(
+        eResample, jMin, jMax, dfDeltaY, dfYScale, padfWeightsVertical);
 
     dfInvWeights =
         1. / (dfAccumulatorWeightHorizontal * dfAccumulatorWeightVertical);
@@ -6328,6 +6340,292 @@ static void GWKResampleNoMasksOrDstDensityOnlyHas4SampleThread(void *pData)
             pData);
 }
 
+/************************************************************************/
+/*                       GWKSeparableAxisWeights                        */
+/************************************************************************/
+
+// Kernel weights along one axis of a separable resampling, for each target
+// column (or line).
+struct GWKSeparableAxisWeights
+{
+    // Maximum number of contributing source pixels for a target pixel
+    int nStride = 0;
+    // First contributing source pixel, for each target pixel
+    std::vector<int> anFirst{};
+    // Number of contributing source pixels (0 if the target pixel is not
+    // covered by the source window), for each target pixel
+    std::vector<int> anCount{};
+    // Sum of weights, for each target pixel
+    std::vector<double> adfSumWeights{};
+    // nStride weights for each target pixel
+    std::vector<double> adfWeights{};
+
+    void Init(GDALResampleAlg eResample, const double *padfSrcCoord,
+              const int *pabSuccess, int nDstSize, int nSrcOff, int nSrcSize,
+              int nRadius, double dfScale);
+};
+
+/************************************************************************/
+/*                   GWKSeparableAxisWeights::Init()                    */
+/************************************************************************/
+
+// padfSrcCoord[] are the source coordinates of the centers of the nDstSize
+// target pixels, along the axis.
+void GWKSeparableAxisWeights::Init(GDALResampleAlg eResample,
+                                   const double *padfSrcCoord,
+                                   const int *pabSuccess, int nDstSize,
+                                   int nSrcOff, int nSrcSize, int nRadius,
+                                   double dfScale)
+{
+    nStride = 2 * nRadius;
+    anFirst.resize(nDstSize);
+    anCount.resize(nDstSize);
+    adfSumWeights.resize(nDstSize);
+    adfWeights.resize(static_cast<size_t>(nDstSize) * nStride);
+
+    for (int iDst = 0; iDst < nDstSize; ++iDst)
+    {
+        anCount[iDst] = 0;
+
+        // Same checks as GWKCheckAndComputeSrcOffsets()
+        const double dfSrcCoord = padfSrcCoord[iDst];
+        if (!pabSuccess[iDst] || std::isnan(dfSrcCoord) ||
+            dfSrcCoord < nSrcOff || dfSrcCoord + 1e-10 > nSrcSize + nSrcOff)
+        {
+            continue;
+        }
+
+        // Same window as GWKResampleNoMasksT()
+        const double dfSrc = dfSrcCoord - nSrcOff;
+        const int iSrc = static_cast<int>(floor(dfSrc - 0.5));
+        const double dfDelta = dfSrc - 0.5 - iSrc;
+        int iMin = 1 - nRadius;
+        if (iSrc + iMin < 0)
+            iMin = -iSrc;
+        int iMax = nRadius;
+        if (iSrc + iMax >= nSrcSize - 1)
+            iMax = nSrcSize - 1 - iSrc;
+
+        anFirst[iDst] = iSrc + iMin;
+        anCount[iDst] = iMax - iMin + 1;
+        adfSumWeights[iDst] = GWKComputeWeights1D(
+            eResample, iMin, iMax, dfDelta, dfScale,
+            adfWeights.data() + static_cast<size_t>(iDst) * nStride);
+    }
+}
+
+/************************************************************************/
+/*                     GWKResampleSeparableThread()                     */
+/************************************************************************/
+
+// Convolution resampling (bilinear, cubic, cubicspline, lanczos) when
+// downsampling with a transformation that is just a scaling and a
+// translation, and without source masks.
+// In that situation, the source column of a target pixel only depends on its
+// target column, and its source line on its target line, so kernel weights are
+// computed once per target column and per target line. The convolution is
+// then done in two passes: a horizontal one on each contributing source line,
+// whose result is cached as it is shared by consecutive target lines, and a
+// vertical one combining those cached lines.
+
+template <class T> static void GWKResampleSeparableThread(void *pData)
+{
+    GWKJobStruct *psJob = static_cast<GWKJobStruct *>(pData);
+    GDALWarpKernel *poWK = psJob->poWK;
+    const int iYMin = psJob->iYMin;
+    const int iYMax = psJob->iYMax;
+    const int nDstXSize = poWK->nDstXSize;
+    const int nSrcXSize = poWK->nSrcXSize;
+    const int nSrcYSize = poWK->nSrcYSize;
+    const int nBands = poWK->nBands;
+
+    /* -------------------------------------------------------------------- */
+    /*      Compute the source columns from the first target line, and      */
+    /*      the source lines from the first target column.                  */
+    /* -------------------------------------------------------------------- */
+    const int nLines = iYMax - iYMin;
+    const int nPoints = std::max(nDstXSize, nLines);
+    std::vector<double> adfX(nPoints);
+    std::vector<double> adfY(nPoints);
+    std::vector<double> adfZ(nPoints);
+    std::vector<int> abSuccess(nPoints);
+
+    for (int iDstX = 0; iDstX < nDstXSize; ++iDstX)
+    {
+        adfX[iDstX] = iDstX + 0.5 + poWK->nDstXOff;
+        adfY[iDstX] = iYMin + 0.5 + poWK->nDstYOff;
+    }
+    poWK->pfnTransformer(psJob->pTransformerArg, TRUE, nDstXSize, adfX.data(),
+                         adfY.data(), adfZ.data(), abSuccess.data());
+    GWKSeparableAxisWeights oXWeights;
+    oXWeights.Init(poWK->eResample, adfX.data(), abSuccess.data(), nDstXSize,
+                   poWK->nSrcXOff, nSrcXSize, poWK->nXRadius,
+                   std::min(poWK->dfXScale, 1.0));
+
+    for (int iLine = 0; iLine < nLines; ++iLine)
+    {
+        adfX[iLine] = 0.5 + poWK->nDstXOff;
+        adfY[iLine] = iYMin + iLine + 0.5 + poWK->nDstYOff;
+        adfZ[iLine] = 0;
+    }
+    poWK->pfnTransformer(psJob->pTransformerArg, TRUE, nLines, adfX.data(),
+                         adfY.data(), adfZ.data(), abSuccess.data());
+    GWKSeparableAxisWeights oYWeights;
+    oYWeights.Init(poWK->eResample, adfY.data(), abSuccess.data(), nLines,
+                   poWK->nSrcYOff, nSrcYSize, poWK->nYRadius,
+                   std::min(poWK->dfYScale, 1.0));
+
+    /* -------------------------------------------------------------------- */
+    /*      Cache of the result of the horizontal pass, for each band, on   */
+    /*      the last source lines. As the source lines contributing to a    */
+    /*      target line are consecutive, and there are at most             */
+    /*      oYWeights.nStride of them, source line iSrcY can be stored in   */
+    /*      slot iSrcY % oYWeights.nStride.                                 */
+    /* -------------------------------------------------------------------- */
+    const int nCacheLines = oYWeights.nStride;
+    std::vector<double> adfCache(static_cast<size_t>(nBands) * nCacheLines *
+                                 nDstXSize);
+    std::vector<int> anCacheSrcLine(static_cast<size_t>(nBands) * nCacheLines,
+                                    -1);
+    std::vector<double> adfAccumulator(nDstXSize);
+
+    /* ==================================================================== */
+    /*      Loop over output lines.                                         */
+    /* ==================================================================== */
+    for (int iDstY = iYMin; iDstY < iYMax; iDstY++)
+    {
+        const int iLine = iDstY - iYMin;
+        const int nSrcLineCount = oYWeights.anCount[iLine];
+        if (nSrcLineCount > 0)
+        {
+            const int iSrcYFirst = oYWeights.anFirst[iLine];
+            const double *padfWeightsY =
+                oYWeights.adfWeights.data() +
+                static_cast<size_t>(iLine) * oYWeights.nStride;
+            const double dfSumWeightsY = oYWeights.adfSumWeights[iLine];
+            const GPtrDiff_t iDstLineOffset =
+                static_cast<GPtrDiff_t>(iDstY) * nDstXSize;
+
+            for (int iBand = 0; iBand < nBands; iBand++)
+            {
+                const T *pSrcBand =
+                    reinterpret_cast<const T *>(poWK->papabySrcImage[iBand]);
+                std::fill(adfAccumulator.begin(), adfAccumulator.end(), 0.0);
+
+                for (int jC = 0; jC < nSrcLineCount; ++jC)
+                {
+                    const int iSrcY = iSrcYFirst + jC;
+                    const size_t iSlot =
+                        static_cast<size_t>(iBand) * nCacheLines +
+                        iSrcY % nCacheLines;
+                    double *padfCacheLine = adfCache.data() + iSlot * nDstXSize;
+
+                    /* ---------------------------------------------------- */
+                    /*      Horizontal pass on the source line, if not      */
+                    /*      already done.                                   */
+                    /* ---------------------------------------------------- */
+                    if (anCacheSrcLine[iSlot] != iSrcY)
+                    {
+                        anCacheSrcLine[iSlot] = iSrcY;
+                        const T *pSrcLine =
+                            pSrcBand +
+                            static_cast<GPtrDiff_t>(iSrcY) * nSrcXSize;
+                        for (int iDstX = 0; iDstX < nDstXSize; iDstX++)
+                        {
+                            const int nCount = oXWeights.anCount[iDstX];
+                            const T *pSrc =
+                                pSrcLine + oXWeights.anFirst[iDstX];
+                            const double *padfWeightsX =
+                                oXWeights.adfWeights.data() +
+                                static_cast<size_t>(iDstX) * oXWeights.nStride;
+                            double dfAccumulatorLocal = 0.0;
+                            double dfAccumulatorLocal2 = 0.0;
+                            int i = 0;
+                            for (; i + 1 < nCount; i += 2)
+                            {
+                                dfAccumulatorLocal +=
+                                    double(pSrc[i]) * padfWeightsX[i];
+                                dfAccumulatorLocal2 +=
+                                    double(pSrc[i + 1]) * padfWeightsX[i + 1];
+                            }
+                            if (i < nCount)
+                            {
+                                dfAccumulatorLocal +=
+                                    double(pSrc[i]) * padfWeightsX[i];
+                            }
+                            padfCacheLine[iDstX] =
+                                dfAccumulatorLocal + dfAccumulatorLocal2;
+                        }
+                    }
+
+                    /* ---------------------------------------------------- */
+                    /*      Vertical pass.                                  */
+                    /* ---------------------------------------------------- */
+                    const double dfWeightY = padfWeightsY[jC];
+                    for (int iDstX = 0; iDstX < nDstXSize; iDstX++)
+                    {
+                        adfAccumulator[iDstX] +=
+                            dfWeightY * padfCacheLine[iDstX];
+                    }
+                }
+
+                T *pDstBand =
+                    reinterpret_cast<T *>(poWK->papabyDstImage[iBand]);
+                for (int iDstX = 0; iDstX < nDstXSize; iDstX++)
+                {
+                    if (oXWeights.anCount[iDstX] == 0)
+                        continue;
+                    const GPtrDiff_t iDstOffset = iDstLineOffset + iDstX;
+                    const double dfInvWeights =
+                        1. / (oXWeights.adfSumWeights[iDstX] * dfSumWeightsY);
+                    pDstBand[iDstOffset] = GWKClampValueT<T>(
+                        adfAccumulator[iDstX] * dfInvWeights);
+                    if (poWK->pafDstDensity)
+                        poWK->pafDstDensity[iDstOffset] = 1.0f;
+                }
+            }
+        }
+
+        /* --------------------------------------------------------------------
+         */
+        /*      Report progress to the user, and optionally cancel out. */
+        /* --------------------------------------------------------------------
+         */
+        if (psJob->pfnProgress && psJob->pfnProgress(psJob))
+            break;
+    }
+}
+
+/************************************************************************/
+/*                        GWKResampleSeparable()                        */
+/************************************************************************/
+
+static CPLErr GWKResampleSeparable(GDALWarpKernel *poWK)
+{
+    switch (poWK->eWorkingDataType)
+    {
+        case GDT_UInt8:
+            return GWKRun(poWK, "GWKResampleSeparable<GByte>",
+                          GWKResampleSeparableThread<GByte>);
+        case GDT_Int16:
+            return GWKRun(poWK, "GWKResampleSeparable<GInt16>",
+                          GWKResampleSeparableThread<GInt16>);
+        case GDT_UInt16:
+            return GWKRun(poWK, "GWKResampleSeparable<GUInt16>",
+                          GWKResampleSeparableThread<GUInt16>);
+        case GDT_Float32:
+            return GWKRun(poWK, "GWKResampleSeparable<float>",
+                          GWKResampleSeparableThread<float>);
+        case GDT_Float64:
+            return GWKRun(poWK, "GWKResampleSeparable<double>",
+                          GWKResampleSeparableThread<double>);
+        default:
+            break;
+    }
+    CPLAssert(false);
+    return CE_Failure;
+}
+
 static CPLErr GWKNearestNoMasksOrDstDensityOnlyByte(GDALWarpKernel *poWK)
 {
     return GWKRun(
@@ -8580,12 +8878,9 @@ static void GWKSumPreservingThread(void *pData)
     std::vector<int> abSuccess0(nSrcXSize + 1);
     std::vector<int> abSuccess1(nSrcXSize + 1);
 
-    CPLRectObj sGlobalBounds;
-    sGlobalBounds.minx = -2 * poWK->dfXScale;
-    sGlobalBounds.miny = iYMin - 2 * poWK->dfYScale;
-    sGlobalBounds.maxx = nDstXSize + 2 * poWK->dfXScale;
-    sGlobalBounds.maxy = iYMax + 2 * poWK->dfYScale;
-    CPLQuadTree *hQuadTree = CPLQuadTreeCreate(&sGlobalBounds, nullptr);
+    // All source pixels are collected before any query, so a bulk loaded
+    // R-tree is used rather than an incrementally built quad tree.
+    CPLPackedRTree *hRTree = CPLPackedRTreeCreate(nullptr);
 
     struct SourcePixel
     {
@@ -8861,8 +9156,8 @@ static void GWKSumPreservingThread(void *pData)
                     }
                 }
 
-                CPLQuadTreeInsertWithBounds(
-                    hQuadTree,
+                CPLPackedRTreeInsertWithBounds(
+                    hRTree,
                     reinterpret_cast<void *>(
                         static_cast<uintptr_t>(sourcePixels.size())),
                     &sRect);
@@ -8872,6 +9167,8 @@ static void GWKSumPreservingThread(void *pData)
         }
     }
 
+    CPLPackedRTreeBuild(hRTree);
+
     std::vector<double> adfRealValue(poWK->nBands);
     std::vector<double> adfImagValue(poWK->nBands);
     std::vector<double> adfBandDensity(poWK->nBands);
@@ -8919,7 +9216,7 @@ static void GWKSumPreservingThread(void *pData)
             sRect.maxx = iDstX + 1;
             int nSourcePixels = 0;
             void **pahSourcePixel =
-                CPLQuadTreeSearch(hQuadTree, &sRect, &nSourcePixels);
+                CPLPackedRTreeSearch(hRTree, &sRect, &nSourcePixels);
             if (nSourcePixels == 0)
             {
                 CPLFree(pahSourcePixel);
@@ -9194,5 +9491,5 @@ static void GWKSumPreservingThread(void *pData)
     GEOSGeom_destroy_r(hGEOSContext, hP2);
     OGRGeometry::freeGEOSContext(hGEOSContext);
 #endif
-    CPLQuadTreeDestroy(hQuadTree);
+    CPLPackedRTreeDestroy(hRTree);
 }
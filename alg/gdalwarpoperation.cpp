@@ -22,6 +22,7 @@
 #include <cstring>
 
 #include <algorithm>
+#include <atomic>
 #include <limits>
 #include <map>
 #include <memory>
@@ -35,6 +36,7 @@
 #include "cpl_multiproc.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_priv.h"
 #include "gdal_alg_priv.h"
@@ -1188,6 +1190,78 @@ static void ChunkThreadMain(void *pThreadData)
     }
 }
 
+/************************************************************************/
+/*                       ChunkAndWarpConcurrent()                       */
+/************************************************************************/
+
+// Warp the chunks of pasChunkList with nChunksInFlight threads, each of them
+// processing a whole chunk. Must be called with m_bConcurrentSrcIO set,
+// that is with a thread-safe source dataset: source reads are then done
+// concurrently, while destination I/O is serialized by hIOMutex, and the
+// warping itself by hWarpMutex.
+CPLErr GDALWarpOperation::ChunkAndWarpConcurrent(int nChunksInFlight)
+{
+    CPLAssert(m_bConcurrentSrcIO);
+
+    CPLWorkerThreadPool oPool;
+    if (!oPool.Setup(nChunksInFlight, nullptr, nullptr))
+        return CE_Failure;
+    auto poJobQueue = oPool.CreateJobQueue();
+
+    double dfTotalPixels = 0;
+    for (int iChunk = 0; iChunk < nChunkListCount; iChunk++)
+    {
+        const GDALWarpChunk &sChunk = pasChunkList[iChunk];
+        dfTotalPixels += sChunk.dsx * static_cast<double>(sChunk.dsy);
+    }
+
+    CPLErrorAccumulator oErrorAccumulator;
+    std::atomic<bool> bFailed{false};
+    m_dfConcurrentProgress = 0;
+    for (int iChunk = 0; iChunk < nChunkListCount; iChunk++)
+    {
+        const GDALWarpChunk *pasThisChunk = pasChunkList + iChunk;
+        const double dfProgressScale =
+            pasThisChunk->dsx * static_cast<double>(pasThisChunk->dsy) /
+            dfTotalPixels;
+        const auto Job = [this, pasThisChunk, dfProgressScale, iChunk,
+                          &bFailed, &oErrorAccumulator]()
+        {
+            if (bFailed)
+                return;
+
+            CPLDebug("GDAL", "Start chunk %d / %d.", iChunk, nChunkListCount);
+            CPLErr eErr;
+            {
+                auto oAccumulator = oErrorAccumulator.InstallForCurrentScope();
+                CPL_IGNORE_RET_VAL(oAccumulator);
+
+                // The progress base is assigned in WarpRegionToBuffer()
+                eErr = WarpRegion(
+                    pasThisChunk->dx, pasThisChunk->dy, pasThisChunk->dsx,
+                    pasThisChunk->dsy, pasThisChunk->sx, pasThisChunk->sy,
+                    pasThisChunk->ssx, pasThisChunk->ssy,
+                    pasThisChunk->sExtraSx, pasThisChunk->sExtraSy, 0.0,
+                    dfProgressScale);
+            }
+            if (eErr != CE_None)
+                bFailed = true;
+            CPLDebug("GDAL", "Finished chunk %d / %d.", iChunk,
+                     nChunkListCount);
+        };
+        if (!poJobQueue->SubmitJob(Job))
+        {
+            bFailed = true;
+            break;
+        }
+    }
+    poJobQueue->WaitCompletion();
+
+    oErrorAccumulator.ReplayErrors();
+
+    return bFailed ? CE_Failure : CE_None;
+}
+
 /************************************************************************/
 /*                         ChunkAndWarpMulti()                          */
 /************************************************************************/
@@ -1204,6 +1278,15 @@ static void ChunkThreadMain(void *pThreadData)
  * internally this method uses multiple threads to interleave input/output
  * for one region while the processing is being done for another.
  *
+ * By default, two chunks are in flight. The NUM_CHUNKS_IN_FLIGHT warping
+ * option may be set to a larger value (since GDAL 3.13) so that the source
+ * data of several chunks is read concurrently, which is mostly beneficial
+ * for sources accessed through high-latency network connections. This
+ * requires the source dataset to be thread-safe, or to be one that
+ * GDALGetThreadSafeDataset() can handle. Destination I/O and warping
+ * computations remain serialized. The memory limit is then shared between
+ * the chunks in flight.
+ *
  * @param nDstXOff X offset to window of destination data to be produced.
  * @param nDstYOff Y offset to window of destination data to be produced.
  * @param nDstXSize Width of output window on destination file to be produced.
@@ -1222,6 +1305,55 @@ CPLErr GDALWarpOperation::ChunkAndWarpMulti(int nDstXOff, int nDstYOff,
     CPLReleaseMutex(hIOMutex);
     CPLReleaseMutex(hWarpMutex);
 
+    /* -------------------------------------------------------------------- */
+    /*      Use the concurrent mode if more than two chunks in flight are   */
+    /*      requested, and the source dataset can be read from several      */
+    /*      threads.                                                        */
+    /* -------------------------------------------------------------------- */
+    const int nChunksInFlight = std::max(
+        2, atoi(CSLFetchNameValueDef(psOptions->papszWarpOptions,
+                                     "NUM_CHUNKS_IN_FLIGHT", "2")));
+    GDALDatasetH hThreadSafeSrcDS = nullptr;
+    if (nChunksInFlight > 2 && psOptions->hSrcDS != nullptr)
+    {
+        CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+        hThreadSafeSrcDS = GDALGetThreadSafeDataset(psOptions->hSrcDS,
+                                                    GDAL_OF_RASTER, nullptr);
+        if (hThreadSafeSrcDS == nullptr)
+        {
+            CPLDebug("WARP",
+                     "Source dataset cannot be read from several threads. "
+                     "Ignoring NUM_CHUNKS_IN_FLIGHT=%d",
+                     nChunksInFlight);
+        }
+    }
+
+    if (hThreadSafeSrcDS != nullptr)
+    {
+        // Make the chunks in flight use the same amount of memory as the
+        // two ones of the default mode.
+        const double dfWarpMemoryLimit = psOptions->dfWarpMemoryLimit;
+        psOptions->dfWarpMemoryLimit = dfWarpMemoryLimit * 2 / nChunksInFlight;
+        CollectChunkList(nDstXOff, nDstYOff, nDstXSize, nDstYSize);
+        psOptions->dfWarpMemoryLimit = dfWarpMemoryLimit;
+
+        GDALDatasetH hSrcDS = psOptions->hSrcDS;
+        psOptions->hSrcDS = hThreadSafeSrcDS;
+        m_bConcurrentSrcIO = true;
+
+        const CPLErr eErr = ChunkAndWarpConcurrent(nChunksInFlight);
+
+        m_bConcurrentSrcIO = false;
+        psOptions->hSrcDS = hSrcDS;
+        GDALReleaseDataset(hThreadSafeSrcDS);
+
+        WipeChunkList();
+
+        psOptions->pfnProgress(1.0, "", psOptions->pProgressArg);
+
+        return eErr;
+    }
+
     CPLCond *hCond = CPLCreateCond();
     CPLMutex *hCondMutex = CPLCreateMutex();
     CPLReleaseMutex(hCondMutex);
@@ -1752,6 +1884,7 @@ CPLErr GDALWarpOperation::WarpRegion(
     GDALDataset *poDstDS = GDALDataset::FromHandle(psOptions->hDstDS);
     if (!bDstBufferInitialized)
     {
+        CPLMutexHolderOptionalLockD(m_bConcurrentSrcIO ? hIOMutex : nullptr);
         CPLErr eErr = CE_None;
         if (psOptions->nBandCount == 1)
         {
@@ -1796,6 +1929,7 @@ CPLErr GDALWarpOperation::WarpRegion(
     /* -------------------------------------------------------------------- */
     if (eErr == CE_None)
     {
+        CPLMutexHolderOptionalLockD(m_bConcurrentSrcIO ? hIOMutex : nullptr);
         if (psOptions->nBandCount == 1)
         {
             // Particular case to simplify the stack a bit.
@@ -2179,6 +2313,7 @@ CPLErr GDALWarpOperation::WarpRegionToBuffer(
 
         eErr = CreateKernelMask(&oWK, 0 /* not used */, "DstDensity");
 
+        CPLMutexHolderOptionalLockD(m_bConcurrentSrcIO ? hIOMutex : nullptr);
         if (eErr == CE_None)
             eErr = GDALWarpDstAlphaMasker(
                 psOptions, psOptions->nBandCount, psOptions->eWorkingDataType,
@@ -2395,13 +2530,21 @@ CPLErr GDALWarpOperation::WarpRegionToBuffer(
     /* -------------------------------------------------------------------- */
     if (hIOMutex != nullptr)
     {
-        CPLReleaseMutex(hIOMutex);
+        if (!m_bConcurrentSrcIO)
+            CPLReleaseMutex(hIOMutex);
         if (!CPLAcquireMutex(hWarpMutex, 600.0))
         {
             CPLError(CE_Failure, CPLE_AppDefined,
                      "Failed to acquire WarpMutex in WarpRegion().");
             return CE_Failure;
         }
+        if (m_bConcurrentSrcIO)
+        {
+            // Chunks reach that point in no particular order, so report
+            // progress by accumulating the ones that have been warped.
+            oWK.dfProgressBase = m_dfConcurrentProgress;
+            m_dfConcurrentProgress += dfProgressScale;
+        }
     }
 
     /* -------------------------------------------------------------------- */
@@ -2433,7 +2576,7 @@ CPLErr GDALWarpOperation::WarpRegionToBuffer(
     if (hIOMutex != nullptr)
     {
         CPLReleaseMutex(hWarpMutex);
-        if (!CPLAcquireMutex(hIOMutex, 600.0))
+        if (!m_bConcurrentSrcIO && !CPLAcquireMutex(hIOMutex, 600.0))
         {
             CPLError(CE_Failure, CPLE_AppDefined,
                      "Failed to acquire IOMutex in WarpRegion().");
@@ -2446,6 +2589,7 @@ CPLErr GDALWarpOperation::WarpRegionToBuffer(
     /* -------------------------------------------------------------------- */
     if (eErr == CE_None && psOptions->nDstAlphaBand > 0)
     {
+        CPLMutexHolderOptionalLockD(m_bConcurrentSrcIO ? hIOMutex : nullptr);
         eErr = GDALWarpDstAlphaMasker(
             psOptions, -psOptions->nBandCount, psOptions->eWorkingDataType,
             oWK.nDstXOff, oWK.nDstYOff, oWK.nDstXSize, oWK.nDstYSize,
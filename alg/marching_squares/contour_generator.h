@@ -54,6 +54,16 @@ class ContourGenerator
         return CE_None;
     }
 
+    // Make the next line fed be the line of index startLineIdx of the whole
+    // raster, with previousLine (of width values) being the one above it.
+    // This allows processing a horizontal strip of the raster independently
+    // of the lines before it.
+    void setStartLine(size_t startLineIdx, const double *previousLine)
+    {
+        lineIdx_ = startLineIdx;
+        std::copy(previousLine, previousLine + width_, previousLine_.begin());
+    }
+
   private:
     size_t width_;
     size_t height_;
@@ -113,6 +113,7 @@
  * <li><b>END_ANGLE</b>:  Mask all cells outside of the arc ('start-angle', 'end-angle'). Clockwise degrees from north. Also used to clamp the extent of the output raster.</li>
  * <li><b>LOW_PITCH</b>: Bound observable height to be no lower than the 'low-pitch' angle from the observer. Degrees from horizontal - positive is up. Must be less than 'high-pitch'.</li>
  * <li><b>HIGH_PITCH</b>: Mark all cells out-of-range where the observable height would be higher than the 'high-pitch' angle from the observer. Degrees from horizontal - positive is up. Must be greater than 'low-pitch'.</li>
+ * <li><b>NUM_THREADS</b>: (GDAL >= 3.13) Number of threads (or ALL_CPUS) used to compute the viewshed. Defaults to the value of the GDAL_NUM_THREADS configuration option, or 4. The result does not depend on the number of threads.</li>
  * </ul>
  * If NULL, a 360-degree viewshed is calculated.
  *
@@ -214,6 +215,16 @@ GDALDatasetH GDALViewshedGenerate(
     if (pszHighPitch)
         oOpts.highPitch = CPLAtof(pszHighPitch);
 
+    const char *pszNumThreads =
+        CSLFetchNameValue(papszExtraOptions, "NUM_THREADS");
+    if (!pszNumThreads)
+        pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+    if (pszNumThreads)
+        oOpts.numThreads =
+            std::clamp(EQUAL(pszNumThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                        : atoi(pszNumThreads),
+                       1, 128);
+
     gdal::viewshed::Viewshed v(oOpts);
 
     if (!pfnProgress)
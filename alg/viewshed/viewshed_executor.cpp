@@ -15,7 +15,9 @@
 #include <atomic>
 #include <cassert>
 #include <cmath>
+#include <functional>
 #include <limits>
+#include <memory>
 
 #include "viewshed_executor.h"
 #include "progress.h"
@@ -54,6 +56,15 @@ bool invalid(int i)
     return !valid(i);
 }
 
+/// Number of lines of a tile of a band of lines.
+constexpr int TILE_LINES = 8;
+
+/// Minimum number of columns of a tile of a band of lines.
+constexpr int MIN_TILE_COLUMNS = 64;
+
+/// Maximum number of cells of a band of lines.
+constexpr int MAX_BAND_CELLS = 1 << 21;
+
 /// Calculate the height at nDistance units along a line through the origin given the height
 /// at nDistance - 1 units along the line.
 /// \param nDistance  Distance along the line for the target point.
@@ -151,8 +162,8 @@ ViewshedExecutor::ViewshedExecutor(GDALRasterBand &srcBand,
                                    const Window &outExtent,
                                    const Window &curExtent, const Options &opts,
                                    Progress &progress, bool emitWarningIfNoData)
-    : m_pool(4), m_dummyBand(), m_srcBand(srcBand), m_sdBand(sdBand),
-      m_dstBand(dstBand),
+    : m_pool(opts.numThreads > 0 ? opts.numThreads : 4), m_dummyBand(),
+      m_srcBand(srcBand), m_sdBand(sdBand), m_dstBand(dstBand),
       // If the standard deviation band isn't a dummy band, we're in SD mode.
       m_hasSdBand(dynamic_cast<DummyBand *>(&m_sdBand) == nullptr),
       m_emitWarningIfNoData(emitWarningIfNoData), oOutExtent(outExtent),
@@ -362,8 +373,8 @@ LineLimits ViewshedExecutor::adjustHeight(int nYOffset, Lines &lines)
         if (!m_hasFoundNoData &&
             ((m_hasNoData && val == m_noDataValue) || std::isnan(val)))
         {
-            m_hasFoundNoData = true;
-            if (m_emitWarningIfNoData)
+            // Lines may be adjusted concurrently. Only warn once.
+            if (!m_hasFoundNoData.exchange(true) && m_emitWarningIfNoData)
             {
                 CPLError(CE_Warning, CPLE_AppDefined,
                          "Nodata value found in input DEM. Output will be "
@@ -771,9 +782,11 @@ void ViewshedExecutor::maskLineLeft(std::vector<double> &vResult,
 
     // Mask cells from the left edge to the left limit.
     std::fill(vResult.begin(), vResult.begin() + ll.left, oOpts.outOfRangeVal);
-    // Mask cells from the left min to the observer.
-    if (ll.leftMin < m_nX)
-        std::fill(vResult.begin() + ll.leftMin, vResult.begin() + m_nX,
+    // Mask cells from the left min to the observer, which may be to the
+    // right of the raster.
+    const int nLeftStop = std::min(m_nX, static_cast<int>(vResult.size()));
+    if (ll.leftMin < nLeftStop)
+        std::fill(vResult.begin() + ll.leftMin, vResult.begin() + nLeftStop,
                   oOpts.outOfRangeVal);
 }
 
@@ -789,9 +802,12 @@ void ViewshedExecutor::maskLineRight(std::vector<double> &vResult,
     if (maskAngleRight(vResult, nLine))
         return;
 
-    // Mask cells from the observer to right min.
-    std::fill(vResult.begin() + m_nX + 1, vResult.begin() + ll.rightMin,
-              oOpts.outOfRangeVal);
+    // Mask cells from the observer, which may be to the left of the raster,
+    // to right min.
+    const int nRightStart = std::max(m_nX + 1, 0);
+    if (nRightStart < ll.rightMin)
+        std::fill(vResult.begin() + nRightStart, vResult.begin() + ll.rightMin,
+                  oOpts.outOfRangeVal);
     // Mask cells from the right limit to the right edge.
 
     //
@@ -855,23 +871,26 @@ void ViewshedExecutor::processFirstLineRight(const LineLimits &ll, Lines &lines,
 
 /// Process a line to the left of the observer.
 ///
+/// Only the cells of the columns [nStart, nStop) are processed, so that a
+/// line can be processed by strips of columns, going away from the observer.
+/// Masking is left to the caller.
+///
 /// @param nYOffset  Offset of the line being processed from the observer
 /// @param ll  Line limits
 /// @param lines  Raster lines to process.
 /// @param sdCalc  standard deviation calculation indicator.
-void ViewshedExecutor::processLineLeft(int nYOffset, LineLimits &ll,
-                                       Lines &lines, bool sdCalc)
+/// @param nStart  First column to process.
+/// @param nStop  One past the last column to process.
+void ViewshedExecutor::processLineLeft(int nYOffset, const LineLimits &ll,
+                                       Lines &lines, bool sdCalc, int nStart,
+                                       int nStop)
 {
     int iStart = m_nX - 1;
     int iEnd = ll.left - 1;
-    int nLine = m_nY + nYOffset;
 
     // If start to the left of end, everything is taken care of by processing right.
     if (iStart <= iEnd)
-    {
-        maskLineLeft(lines.result, ll, nLine);
         return;
-    }
     iStart = oCurExtent.clampX(iStart);
 
     // If the observer is to the right of the raster, mark the first cell to the left as
@@ -879,12 +898,17 @@ void ViewshedExecutor::processLineLeft(int nYOffset, LineLimits &ll,
     // with the out of range assignment at the end.
     if (iStart == oCurExtent.xStop - 1)
     {
-        if (oOpts.outputMode == OutputMode::Normal)
-            lines.result[iStart] = oOpts.visibleVal;
-        else
-            setOutputNormal(lines, iStart, lines.cur[iStart]);
+        if (iStart >= nStart && iStart < nStop)
+        {
+            if (oOpts.outputMode == OutputMode::Normal)
+                lines.result[iStart] = oOpts.visibleVal;
+            else
+                setOutputNormal(lines, iStart, lines.cur[iStart]);
+        }
         iStart--;
     }
+    iStart = std::min(iStart, nStop - 1);
+    iEnd = std::max(iEnd, nStart - 1);
 
     // Go from the observer to the left, calculating Z as we go.
     nYOffset = std::abs(nYOffset);
@@ -903,29 +927,30 @@ void ViewshedExecutor::processLineLeft(int nYOffset, LineLimits &ll,
         else
             setOutputSd(lines, iPixel, dfZ);
     }
-
-    maskLineLeft(lines.result, ll, nLine);
 }
 
 /// Process a line to the right of the observer.
 ///
+/// Only the cells of the columns [nStart, nStop) are processed, so that a
+/// line can be processed by strips of columns, going away from the observer.
+/// Masking is left to the caller.
+///
 /// @param nYOffset  Offset of the line being processed from the observer
 /// @param ll  Line limits
 /// @param lines  Raster lines to process.
 /// @param sdCalc  standard deviation calculation indicator.
-void ViewshedExecutor::processLineRight(int nYOffset, LineLimits &ll,
-                                        Lines &lines, bool sdCalc)
+/// @param nStart  First column to process.
+/// @param nStop  One past the last column to process.
+void ViewshedExecutor::processLineRight(int nYOffset, const LineLimits &ll,
+                                        Lines &lines, bool sdCalc, int nStart,
+                                        int nStop)
 {
     int iStart = m_nX + 1;
     int iEnd = ll.right;
-    int nLine = m_nY + nYOffset;
 
     // If start is to the right of end, everything is taken care of by processing left.
     if (iStart >= iEnd)
-    {
-        maskLineRight(lines.result, ll, nLine);
         return;
-    }
     iStart = oCurExtent.clampX(iStart);
 
     // If the observer is to the left of the raster, mark the first cell to the right as
@@ -933,12 +958,17 @@ void ViewshedExecutor::processLineRight(int nYOffset, LineLimits &ll,
     // with the out of range assignment at the end.
     if (iStart == 0)
     {
-        if (oOpts.outputMode == OutputMode::Normal)
-            lines.result[iStart] = oOpts.visibleVal;
-        else
-            setOutputNormal(lines, 0, lines.cur[0]);
+        if (nStart <= 0 && nStop > 0)
+        {
+            if (oOpts.outputMode == OutputMode::Normal)
+                lines.result[iStart] = oOpts.visibleVal;
+            else
+                setOutputNormal(lines, 0, lines.cur[0]);
+        }
         iStart++;
     }
+    iStart = std::max(iStart, nStart);
+    iEnd = std::min(iEnd, nStop);
 
     // Go from the observer to the right, calculating Z as we go.
     nYOffset = std::abs(nYOffset);
@@ -966,8 +996,6 @@ void ViewshedExecutor::processLineRight(int nYOffset, LineLimits &ll,
         else
             setOutputSd(lines, iPixel, dfZ);
     }
-
-    maskLineRight(lines.result, ll, nLine);
 }
 
 /// Apply angular/distance mask to the initial X position.  Assumes m_nX is in the raster.
@@ -1007,60 +1035,110 @@ bool ViewshedExecutor::maskInitial(std::vector<double> &vResult,
     return false;
 }
 
-/// Process a line above or below the observer.
+/// Read the next band of lines above or below the observer and adjust their
+/// heights.
 ///
-/// @param nLine  Line number being processed.
-/// @param lines  Raster lines to process.
-/// @return True on success, false otherwise.
-bool ViewshedExecutor::processLine(int nLine, Lines &lines)
+/// @param band  Band of lines to fill.
+/// @param nMaxLines  Maximum number of lines of the band.
+/// @return  Success or failure.
+bool ViewshedExecutor::readBand(LineBand &band, int nMaxLines)
 {
-    int nYOffset = nLine - m_nY;
-
-    if (!readLine(nLine, lines))
-        return false;
-
-    // Adjust height of the read line.
-    LineLimits ll = adjustHeight(nYOffset, lines);
-
-    std::vector<double> savedLine;
-    if (sdMode())
-        savedLine = lines.cur;
+    const int nRemaining = band.dir < 0
+                               ? band.nextLine - oCurExtent.yStart + 1
+                               : oCurExtent.yStop - band.nextLine;
+    band.firstLine = band.nextLine;
+    band.count = std::clamp(nRemaining, 0, nMaxLines);
+    band.nextLine += band.dir * band.count;
+
+    while (static_cast<int>(band.lines.size()) < band.count)
+    {
+        Lines &lines = band.lines.emplace_back().lines;
+        lines = Lines(oCurExtent.xSize());
+        lines.prev.resize(oCurExtent.xSize());
+        if (oOpts.pitchMasking())
+            lines.pitchMask.resize(oOutExtent.xSize());
+        if (sdMode())
+            lines.sd.resize(oOutExtent.xSize());
+    }
 
-    auto process = [this, nYOffset, &ll, &lines](bool sdCalc)
+    std::atomic<bool> err(false);
+    CPLJobQueuePtr pQueue = m_pool.CreateJobQueue();
+    for (int i = 0; i < band.count; ++i)
     {
-        CPLJobQueuePtr pQueue = m_pool.CreateJobQueue();
-        pQueue->SubmitJob([&]()
-                          { processLineLeft(nYOffset, ll, lines, sdCalc); });
-        pQueue->SubmitJob([&]()
-                          { processLineRight(nYOffset, ll, lines, sdCalc); });
-        pQueue->WaitCompletion();
-    };
+        pQueue->SubmitJob(
+            [this, &band, &err, i]()
+            {
+                LineBand::Line &line = band.lines[i];
+                const int nLine = band.line(i);
+                if (!readLine(nLine, line.lines))
+                {
+                    err = true;
+                    return;
+                }
+                if (oOpts.pitchMasking())
+                    std::fill(line.lines.pitchMask.begin(),
+                              line.lines.pitchMask.end(),
+                              std::numeric_limits<double>::quiet_NaN());
+                line.ll = adjustHeight(nLine - m_nY, line.lines);
+                // Save the adjusted heights for the SD pass.
+                if (sdMode())
+                    line.lines.prevTmp = line.lines.cur;
+            });
+    }
+    pQueue->WaitCompletion();
+    return !err;
+}
 
-    bool masked = false;
-    // Handle initial position on the line.
-    if (oCurExtent.containsX(m_nX))
+/// Write the results of a band of lines.
+///
+/// @param band  Band of lines to write.
+/// @return  True on success, false otherwise.
+bool ViewshedExecutor::writeBand(LineBand &band)
+{
+    for (int i = 0; i < band.count; ++i)
     {
-        masked = maskInitial(lines.result, ll, nLine);
-        if (!masked)
-        {
-            double dfZ = CalcHeightLine(std::abs(nYOffset), lines.cur[m_nX],
-                                        lines.prev[m_nX]);
-            setOutputNormal(lines, m_nX, dfZ);
-        }
+        Lines &lines = band.lines[i].lines;
+        if (oOpts.pitchMasking())
+            applyPitchMask(lines.result, lines.pitchMask);
+        if (!writeLine(band.line(i), lines.result) ||
+            !oProgress.lineComplete())
+            return false;
     }
+    return true;
+}
 
-    process(false);
+/// Process the observer column of the lines of a band.
+///
+/// The cell of a line in the observer column only depends on the cell of
+/// the previous line in the same column, so this is done line by line,
+/// before the cells on each side of the observer.
+///
+/// @param band  Band of lines to process.
+/// @param sdCalc  True when doing standard deviation calculation.
+void ViewshedExecutor::processObserverColumn(LineBand &band, bool sdCalc)
+{
+    if (!oCurExtent.containsX(m_nX))
+        return;
 
-    // Process standard deviation mode
-    if (sdMode())
+    for (int i = 0; i < band.count; ++i)
     {
-        lines.prev = std::move(lines.prevTmp);
-        lines.prevTmp = std::move(lines.cur);
-        lines.cur = std::move(savedLine);
-        // Handle initial position on the line.
-        if (!masked && oCurExtent.containsX(m_nX))
+        LineBand::Line &line = band.lines[i];
+        Lines &lines = line.lines;
+        const int nLine = band.line(i);
+        const int nYOffset = std::abs(nLine - m_nY);
+        if (!sdCalc)
+        {
+            line.masked = maskInitial(lines.result, line.ll, nLine);
+            if (!line.masked)
+            {
+                double dfZ =
+                    CalcHeightLine(nYOffset, lines.cur[m_nX], lines.prev[m_nX]);
+                setOutputNormal(lines, m_nX, dfZ);
+            }
+        }
+        else if (!line.masked)
         {
-            if (std::abs(nYOffset) == 1)
+            if (nYOffset == 1)
             {
                 lines.result[m_nX] = oOpts.visibleVal;
                 if (lines.sd[m_nX] > 1)
@@ -1068,25 +1146,182 @@ bool ViewshedExecutor::processLine(int nLine, Lines &lines)
             }
             else
             {
-
-                double dfZ = CalcHeightLine(std::abs(nYOffset), lines.cur[m_nX],
-                                            lines.prev[m_nX]);
+                double dfZ =
+                    CalcHeightLine(nYOffset, lines.cur[m_nX], lines.prev[m_nX]);
                 setOutputSd(lines, m_nX, dfZ);
             }
         }
-        process(true);
-        lines.prev = std::move(lines.prevTmp);
-        lines.prevTmp = lines.cur;
+        band.nextPrev(i, sdCalc)[m_nX] = lines.cur[m_nX];
     }
-    else
-        lines.prev = lines.cur;
+}
 
-    if (oOpts.pitchMasking())
-        applyPitchMask(lines.result, lines.pitchMask);
-    if (!writeLine(nLine, lines.result))
-        return false;
+/// Run a pass of the computation on the cells on each side of the observer
+/// column of bands of lines.
+///
+/// The cells on each side of the observer column of a band are split in
+/// tiles of TILE_LINES lines by a strip of columns. A cell depends on the
+/// cell next to it towards the observer column and on the cells of the
+/// previous line, so a tile can be processed once the tile before it on its
+/// line of tiles and the tile above it (in processing order) are done. The
+/// tiles are thus submitted to the thread pool as a wavefront, and the
+/// result is the same as processing cells line by line.
+///
+/// @param bands  Bands of lines above and below the observer.
+/// @param sdCalc  True when doing standard deviation calculation.
+void ViewshedExecutor::processBandsPass(const std::array<LineBand *, 2> &bands,
+                                        bool sdCalc)
+{
+    const int nXSize = oCurExtent.xSize();
+    // Columns on the left [0, nLeftStop) and on the right
+    // [nRightStart, nXSize) of the observer column.
+    const int nLeftStop = std::clamp(m_nX, 0, nXSize);
+    const int nRightStart = std::clamp(m_nX + 1, 0, nXSize);
+    const int nHalfSize = std::max(nLeftStop, nXSize - nRightStart);
+    const int nThreads = m_pool.GetThreadCount();
+    const int nStripSize =
+        std::max(MIN_TILE_COLUMNS, (nHalfSize + nThreads - 1) / nThreads);
+
+    struct Wavefront
+    {
+        LineBand *band;
+        bool left;
+        int nTileLines;
+        int nStrips;
+        std::vector<std::atomic<int>> anDeps;
+
+        Wavefront(LineBand *bandIn, bool leftIn, int nStripsIn)
+            : band(bandIn), left(leftIn),
+              nTileLines((bandIn->count + TILE_LINES - 1) / TILE_LINES),
+              nStrips(nStripsIn),
+              anDeps(static_cast<size_t>(nTileLines) * nStrips)
+        {
+            // Number of tiles to process before each tile.
+            for (int i = 0; i < nTileLines; ++i)
+                for (int j = 0; j < nStrips; ++j)
+                    anDeps[static_cast<size_t>(i) * nStrips + j] =
+                        (i > 0) + (j > 0);
+        }
+    };
 
-    return oProgress.lineComplete();
+    std::vector<std::unique_ptr<Wavefront>> wavefronts;
+    for (LineBand *band : bands)
+    {
+        if (band->count == 0)
+            continue;
+        if (nLeftStop > 0)
+            wavefronts.push_back(std::make_unique<Wavefront>(
+                band, true, (nLeftStop + nStripSize - 1) / nStripSize));
+        if (nRightStart < nXSize)
+            wavefronts.push_back(std::make_unique<Wavefront>(
+                band, false,
+                (nXSize - nRightStart + nStripSize - 1) / nStripSize));
+    }
+
+    CPLJobQueuePtr pQueue = m_pool.CreateJobQueue();
+    std::function<void(Wavefront &, int, int)> processTile;
+    processTile = [&](Wavefront &wf, int iTileLine, int iStrip)
+    {
+        LineBand &band = *wf.band;
+        int nStart;
+        int nStop;
+        if (wf.left)
+        {
+            nStop = nLeftStop - iStrip * nStripSize;
+            nStart = std::max(0, nStop - nStripSize);
+        }
+        else
+        {
+            nStart = nRightStart + iStrip * nStripSize;
+            nStop = std::min(nXSize, nStart + nStripSize);
+        }
+
+        const int iFirst = iTileLine * TILE_LINES;
+        const int iLast = std::min(band.count, iFirst + TILE_LINES);
+        for (int i = iFirst; i < iLast; ++i)
+        {
+            LineBand::Line &line = band.lines[i];
+            const int nYOffset = band.line(i) - m_nY;
+            if (wf.left)
+                processLineLeft(nYOffset, line.ll, line.lines, sdCalc, nStart,
+                                nStop);
+            else
+                processLineRight(nYOffset, line.ll, line.lines, sdCalc,
+                                 nStart, nStop);
+            std::copy(line.lines.cur.begin() + nStart,
+                      line.lines.cur.begin() + nStop,
+                      band.nextPrev(i, sdCalc).begin() + nStart);
+        }
+
+        // Submit the tiles that were only waiting for this one.
+        const auto release = [&](int iNextTileLine, int iNextStrip)
+        {
+            if (--wf.anDeps[static_cast<size_t>(iNextTileLine) * wf.nStrips +
+                            iNextStrip] == 0)
+            {
+                pQueue->SubmitJob(
+                    [&processTile, &wf, iNextTileLine, iNextStrip]()
+                    { processTile(wf, iNextTileLine, iNextStrip); });
+            }
+        };
+        if (iTileLine + 1 < wf.nTileLines)
+            release(iTileLine + 1, iStrip);
+        if (iStrip + 1 < wf.nStrips)
+            release(iTileLine, iStrip + 1);
+    };
+
+    for (auto &wf : wavefronts)
+    {
+        Wavefront *pWf = wf.get();
+        pQueue->SubmitJob([&processTile, pWf]() { processTile(*pWf, 0, 0); });
+    }
+    pQueue->WaitCompletion();
+
+    for (LineBand *band : bands)
+    {
+        for (int i = 0; i < band->count; ++i)
+        {
+            LineBand::Line &line = band->lines[i];
+            maskLineLeft(line.lines.result, line.ll, band->line(i));
+            maskLineRight(line.lines.result, line.ll, band->line(i));
+        }
+    }
+}
+
+/// Process bands of lines above and below the observer.
+///
+/// @param up  Band of lines above the observer.
+/// @param down  Band of lines below the observer.
+void ViewshedExecutor::processBands(LineBand &up, LineBand &down)
+{
+    const std::array<LineBand *, 2> bands{&up, &down};
+
+    for (LineBand *band : bands)
+    {
+        if (band->count == 0)
+            continue;
+        band->lines[0].lines.prev = band->prev;
+        processObserverColumn(*band, false);
+    }
+    processBandsPass(bands, false);
+
+    // Process standard deviation mode, starting again from the adjusted
+    // heights.
+    if (sdMode())
+    {
+        for (LineBand *band : bands)
+        {
+            if (band->count == 0)
+                continue;
+            for (int i = 0; i < band->count; ++i)
+            {
+                Lines &lines = band->lines[i].lines;
+                std::swap(lines.cur, lines.prevTmp);
+            }
+            band->lines[0].lines.prev = band->prevTmp;
+            processObserverColumn(*band, true);
+        }
+        processBandsPass(bands, true);
+    }
 }
 
 // Calculate the ray angle from the origin to middle of the top or bottom
@@ -1156,58 +1391,36 @@ bool ViewshedExecutor::run()
     else if (oOpts.cellMode == CellMode::Max)
         oZcalc = doMax;
 
-    // scan upwards
-    int yStart = oCurExtent.clampY(m_nY);
-    std::atomic<bool> err(false);
-    CPLJobQueuePtr pQueue = m_pool.CreateJobQueue();
-    pQueue->SubmitJob(
-        [&]()
-        {
-            Lines lines(oCurExtent.xSize());
-            lines.prev = firstLine.prev;
-            lines.prevTmp = firstLine.prevTmp;
-            if (oOpts.pitchMasking())
-                lines.pitchMask.resize(
-                    oOutExtent.xSize(),
-                    std::numeric_limits<double>::quiet_NaN());
-            if (sdMode())
-                lines.sd.resize(oOutExtent.xSize());
-
-            for (int nLine = yStart - 1; nLine >= oCurExtent.yStart && !err;
-                 nLine--)
-            {
-                if (!processLine(nLine, lines))
-                    err = true;
-                if (oOpts.pitchMasking())
-                    std::fill(lines.pitchMask.begin(), lines.pitchMask.end(),
-                              std::numeric_limits<double>::quiet_NaN());
-            }
-        });
+    // Process the lines above and below the observer by bands of lines.
+    // Bands are read, processed and written in turn, the cells of a band
+    // being processed in parallel.
+    const int yStart = oCurExtent.clampY(m_nY);
+    const int nBandLines = std::max(
+        TILE_LINES,
+        std::min(2 * m_pool.GetThreadCount() * TILE_LINES,
+                 MAX_BAND_CELLS / std::max(1, oCurExtent.xSize())));
+    LineBand up;
+    up.dir = -1;
+    up.nextLine = yStart - 1;
+    LineBand down;
+    down.dir = 1;
+    down.nextLine = yStart + 1;
+    for (LineBand *band : {&up, &down})
+    {
+        band->prev = firstLine.prev;
+        band->prevTmp = firstLine.prevTmp;
+    }
 
-    // scan downwards
-    pQueue->SubmitJob(
-        [&]()
-        {
-            Lines lines(oCurExtent.xSize());
-            lines.prev = firstLine.prev;
-            lines.prevTmp = firstLine.prevTmp;
-            if (oOpts.pitchMasking())
-                lines.pitchMask.resize(
-                    oOutExtent.xSize(),
-                    std::numeric_limits<double>::quiet_NaN());
-            if (sdMode())
-                lines.sd.resize(oOutExtent.xSize());
-
-            for (int nLine = yStart + 1; nLine < oCurExtent.yStop && !err;
-                 nLine++)
-            {
-                if (!processLine(nLine, lines))
-                    err = true;
-                if (oOpts.pitchMasking())
-                    std::fill(lines.pitchMask.begin(), lines.pitchMask.end(),
-                              std::numeric_limits<double>::quiet_NaN());
-            }
-        });
+    while (true)
+    {
+        if (!readBand(up, nBandLines) || !readBand(down, nBandLines))
+            return false;
+        if (up.count == 0 && down.count == 0)
+            break;
+        processBands(up, down);
+        if (!writeBand(up) || !writeBand(down))
+            return false;
+    }
     return true;
 }
 
@@ -14,6 +14,7 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <limits>
 #include <mutex>
 
@@ -53,6 +54,49 @@ struct Lines
     }
 };
 
+/**
+ * Consecutive lines above or below the observer, processed together.
+ */
+struct LineBand
+{
+    /// Line of the band.
+    struct Line
+    {
+        Lines lines{};              //!< Lines for processing
+        LineLimits ll{0, 0, 0, 0};  //!< Processing limits
+        bool masked{false};         //!< Observer column is masked
+    };
+
+    int dir{0};                     //!< -1 above the observer, 1 below
+    int firstLine{0};               //!< Number of the first line of the band
+    int nextLine{0};                //!< Number of the next line to read
+    int count{0};                   //!< Number of lines in the band
+    std::vector<Line> lines{};      //!< Lines of the band
+    std::vector<double> prev{};     //!< Height values for line before band
+    std::vector<double> prevTmp{};  //!< Same as prev, for the SD pass
+
+    /// Number of a line of the band.
+    /// \param i  Index of the line in the band.
+    /// \return  Line number.
+    int line(int i) const
+    {
+        return firstLine + dir * i;
+    }
+
+    /// Height values of the previous line for the line after a line of the
+    /// band. This is the prev vector of the following line of the band, or
+    /// the one of the band itself for the last line.
+    /// \param i  Index of the line in the band.
+    /// \param sdCalc  True when doing standard deviation calculation.
+    /// \return  Height values to fill.
+    std::vector<double> &nextPrev(int i, bool sdCalc)
+    {
+        if (i + 1 < count)
+            return lines[i + 1].lines.prev;
+        return sdCalc ? prevTmp : prev;
+    }
+};
+
 /// Dummy raster band.
 //! @cond Doxygen_Suppress
 class DummyBand : public GDALRasterBand
@@ -83,7 +127,7 @@ class ViewshedExecutor
     /** Return whether an input pixel is at the nodata value. */
     bool hasFoundNoData() const
     {
-        return m_hasFoundNoData;
+        return m_hasFoundNoData.load();
     }
 
   private:
@@ -96,7 +140,7 @@ class ViewshedExecutor
     double m_noDataValue = 0;
     bool m_hasNoData = false;
     bool m_emitWarningIfNoData = false;
-    bool m_hasFoundNoData = false;
+    std::atomic<bool> m_hasFoundNoData{false};
     const Window oOutExtent;
     const Window oCurExtent;
     const int m_nX;
@@ -122,15 +166,20 @@ class ViewshedExecutor
 
     bool readLine(int nLine, Lines &lines);
     bool writeLine(int nLine, std::vector<double> &vResult);
-    bool processLine(int nLine, Lines &lines);
     bool processFirstLine(Lines &lines);
+    bool readBand(LineBand &band, int nMaxLines);
+    bool writeBand(LineBand &band);
+    void processBands(LineBand &up, LineBand &down);
+    void processObserverColumn(LineBand &band, bool sdCalc);
+    void processBandsPass(const std::array<LineBand *, 2> &bands,
+                          bool sdCalc);
     void processFirstLineLeft(const LineLimits &ll, Lines &lines, bool sdCalc);
     void processFirstLineRight(const LineLimits &ll, Lines &lines, bool sdCalc);
     void processFirstLineTopOrBottom(const LineLimits &ll, Lines &lines);
-    void processLineLeft(int nYOffset, LineLimits &ll, Lines &lines,
-                         bool sdCalc);
-    void processLineRight(int nYOffset, LineLimits &ll, Lines &lines,
-                          bool sdCalc);
+    void processLineLeft(int nYOffset, const LineLimits &ll, Lines &lines,
+                         bool sdCalc, int nStart, int nStop);
+    void processLineRight(int nYOffset, const LineLimits &ll, Lines &lines,
+                          bool sdCalc, int nStart, int nStop);
     LineLimits adjustHeight(int iLine, Lines &lines);
     bool maskInitial(std::vector<double> &vResult, const LineLimits &ll,
                      int nLine);
@@ -85,6 +85,7 @@ struct Options
     CellMode cellMode{CellMode::Edge};  //!< Mode of cell height calculation.
     int observerSpacing{10};  //!< Observer spacing in cumulative mode.
     uint8_t numJobs{3};       //!< Relative number of jobs in cumulative mode.
+    int numThreads{0};  //!< Number of threads in standard mode (0 = default).
 
     /// True if angle masking will occur.
     bool angleMasking() const
@@ -54,6 +54,7 @@ struct GDALContourOptions
     std::string osDestDataSource{};
     std::string osSrcDataSource{};
     GIntBig nGroupTransactions = 100 * 1000;
+    std::string osNumThreads{};
     GDALProgressFunc pfnProgress = GDALDummyProgress;
     void *pProgressData = nullptr;
 };
@@ -426,6 +427,12 @@ CPLErr GDALContourProcessOptions(GDALContourOptions *psOptions,
                                                "COMMIT_INTERVAL=" CPL_FRMT_GIB,
                                                psOptions->nGroupTransactions);
     }
+    if (!psOptions->osNumThreads.empty())
+    {
+        *ppapszStringOptions =
+            CSLAppendPrintf(*ppapszStringOptions, "NUM_THREADS=%s",
+                            psOptions->osNumThreads.c_str());
+    }
 
     return CE_None;
 }
@@ -548,6 +555,20 @@ GDALContourAppOptionsGetParser(GDALContourOptions *psOptions,
             })
         .help(_("Group <n> features per transaction."));
 
+    argParser->add_argument("-num_threads")
+        .metavar("<value>|ALL_CPUS")
+        .action(
+            [psOptions](const std::string &s)
+            {
+                if (!EQUAL(s.c_str(), "ALL_CPUS") &&
+                    !(CPLGetValueType(s.c_str()) == CPL_VALUE_INTEGER &&
+                      atoi(s.c_str()) >= 1))
+                    throw std::invalid_argument(
+                        "Invalid value for -num_threads");
+                psOptions->osNumThreads = s;
+            })
+        .help(_("Number of threads used to generate contour lines."));
+
     // Written that way so that in library mode, users can still use the -q
     // switch, even if it has no effect
     argParser->add_quiet_argument(
@@ -1864,13 +1864,65 @@ bool GDALAbstractPipelineAlgorithm::RunStep(GDALPipelineStepRunContext &ctxt)
         }
     }
 
-    // Because of multiprocessing in gdal raster tile, make sure that all
-    // steps before it are serialized in a .gdal.json file
+    // For "write", multi-threading only consists in pulling blocks of the
+    // output of the previous steps concurrently, so fall back to a sequential
+    // execution if some steps cannot be replicated in worker threads.
+    const auto CanReplicateStepsInWorkerThreads = [this]()
+    {
+        if (m_steps.back()->GetName() != "write")
+            return true;
+        // Steps that directly write the output with their own
+        // multi-threading, such as "reproject", are better at it.
+        const auto &poPrevStep = m_steps[m_steps.size() - 2];
+        if (poPrevStep->CanHandleNextStep(m_steps.back().get()) &&
+            poPrevStep->GetArg(GDAL_ARG_NAME_NUM_THREADS))
+        {
+            return false;
+        }
+        for (size_t i = 0; i + 1 < m_steps.size(); ++i)
+        {
+            if (!m_steps[i]->CanBeReplicatedInWorkerThreads())
+            {
+                CPLDebug("GDAL",
+                         "Step %s cannot be replicated in worker threads. "
+                         "Running pipeline sequentially",
+                         m_steps[i]->GetName().c_str());
+                return false;
+            }
+        }
+        auto poSrcDS = m_inputDataset.size() == 1
+                           ? m_inputDataset[0].GetDatasetRef()
+                           : nullptr;
+        if (poSrcDS)
+        {
+            auto poSrcDriver = poSrcDS->GetDriver();
+            if (!poSrcDriver || EQUAL(poSrcDriver->GetDescription(), "MEM"))
+            {
+                CPLDebug("GDAL", "Input dataset is a non-materialized "
+                                 "dataset. Running pipeline sequentially");
+                return false;
+            }
+        }
+        return true;
+    };
+
+    if (m_steps.size() >= 2 && m_steps.back()->SupportsInputMultiThreading())
+    {
+        int nHaloSize = 0;
+        for (size_t i = 0; i + 1 < m_steps.size(); ++i)
+            nHaloSize += m_steps[i]->GetInputHaloSize();
+        m_steps.back()->m_upstreamHaloSize = nHaloSize;
+    }
+
+    // Because of multiprocessing in gdal raster tile, or of the concurrent
+    // pulling of blocks in gdal raster write, make sure that all steps before
+    // it are serialized in a .gdal.json file
     if (m_steps.size() >= 2 && m_steps.back()->SupportsInputMultiThreading() &&
         m_steps.back()
                 ->GetArg(GDAL_ARG_NAME_NUM_THREADS_INT_HIDDEN)
                 ->Get<int>() > 1 &&
-        !(m_steps.size() == 2 && m_steps[0]->GetName() == "read"))
+        !(m_steps.size() == 2 && m_steps[0]->GetName() == "read") &&
+        CanReplicateStepsInWorkerThreads())
     {
         bool ret = false;
         auto poSrcDS = m_inputDataset.size() == 1
@@ -1907,6 +1959,12 @@ bool GDALAbstractPipelineAlgorithm::RunStep(GDALPipelineStepRunContext &ctxt)
                 poCurDS->Release();
                 ret = tileAlg->RunStep(ctxt);
                 tileAlg->m_inputDataset[0].Close();
+                if (ret && tileAlg->m_outputDataset.GetDatasetRef() &&
+                    !m_outputDataset.GetDatasetRef())
+                {
+                    m_outputDataset.Set(
+                        tileAlg->m_outputDataset.GetDatasetRef());
+                }
             }
         }
         return ret;
@@ -306,6 +306,23 @@ class GDALPipelineStepAlgorithm /* non final */ : public GDALAlgorithm
         return false;
     }
 
+    //! Whether the step can be instantiated again, from its serialized
+    //! arguments, in each worker thread of a parallel execution of the
+    //! pipeline, so that different parts of its output are computed
+    //! concurrently.
+    virtual bool CanBeReplicatedInWorkerThreads() const
+    {
+        return IsNativelyStreamingCompatible() &&
+               !GeneratesFilesFromUserInput();
+    }
+
+    //! Number of pixels, around the window of a request on its output, that
+    //! the step needs to read from its input (for neighborhood operations).
+    virtual int GetInputHaloSize() const
+    {
+        return 0;
+    }
+
     virtual bool CanHandleNextStep(GDALPipelineStepAlgorithm *) const
     {
         return false;
@@ -348,6 +365,10 @@ class GDALPipelineStepAlgorithm /* non final */ : public GDALAlgorithm
     GDALInConstructionAlgorithmArg *m_outputFormatArg = nullptr;
     bool m_appendRaster = false;
 
+    // Sum of the halo sizes of the steps preceding this one. Set by the
+    // pipeline before RunStep() for steps that SupportsInputMultiThreading()
+    int m_upstreamHaloSize = 0;
+
     // Output arguments (vector specific)
     std::vector<std::string> m_layerCreationOptions{};
     bool m_update = false;
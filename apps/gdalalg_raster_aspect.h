@@ -36,6 +36,12 @@ class GDALRasterAspectAlgorithm /* non final */
   private:
     bool RunStep(GDALPipelineStepRunContext &ctxt) override;
 
+    // 3x3 window
+    int GetInputHaloSize() const override
+    {
+        return 1;
+    }
+
     int m_band = 1;
     std::string m_convention = "azimuth";
     std::string m_gradientAlg = "Horn";
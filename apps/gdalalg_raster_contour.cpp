@@ -78,6 +78,9 @@ GDALRasterContourAlgorithm::GDALRasterContourAlgorithm(bool standaloneStep)
            _("Group n features per transaction (default 100 000)"),
            &m_groupTransactions)
         .SetMinValueIncluded(0);
+    AddNumThreadsArg(&m_numThreads, &m_numThreadsStr,
+                     _("Number of jobs (or ALL_CPUS) used to generate "
+                       "contour lines"));
 }
 
 /************************************************************************/
@@ -202,6 +205,11 @@ bool GDALRasterContourAlgorithm::RunStep(GDALPipelineStepRunContext &ctxt)
     {
         aosOptions.AddString("-p");
     }
+    if (m_numThreads > 1)
+    {
+        aosOptions.AddString("-num_threads");
+        aosOptions.AddString(CPLSPrintf("%d", m_numThreads));
+    }
     if (!m_outputLayerName.empty())
     {
         aosOptions.AddString("-nln");
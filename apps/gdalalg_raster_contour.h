@@ -72,6 +72,8 @@ class GDALRasterContourAlgorithm /* non final */
     int m_expBase = 0;  // -e <base>
     bool m_polygonize = false;    // -p
     int m_groupTransactions = 0;  // gt <n>
+    int m_numThreads = 1;         // -num_threads <n>
+    std::string m_numThreadsStr{};
 };
 
 /************************************************************************/
@@ -39,6 +39,12 @@ class GDALRasterHillshadeAlgorithm /* non final */
   private:
     bool RunStep(GDALPipelineStepRunContext &ctxt) override;
 
+    // 3x3 window
+    int GetInputHaloSize() const override
+    {
+        return 1;
+    }
+
     int m_band = 1;
     double m_zfactor = 1;
     double m_xscale = std::numeric_limits<double>::quiet_NaN();
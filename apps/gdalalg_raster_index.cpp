@@ -108,6 +108,11 @@ void GDALRasterIndexAlgorithm::AddCommonOptions()
 
     AddArg("skip-errors", 0, _("Skip errors related to input datasets"),
            &m_skipErrors);
+    AddArg("incremental", 0,
+           _("Only (re-)index datasets that are not in the index, or whose "
+             "size or modification time has changed"),
+           &m_incremental);
+    AddNumThreadsArg(&m_numThreads, &m_numThreadsStr);
     AddArg("profile", 0, _("Profile of output dataset"), &m_profile)
         .SetDefault(m_profile)
         .SetChoices(PROFILE_NONE, PROFILE_STAC_GEOPARQUET);
@@ -230,6 +235,15 @@ bool GDALRasterIndexAlgorithm::RunImpl(GDALProgressFunc pfnProgress,
     {
         aosOptions.push_back("-skip_errors");
     }
+    if (m_incremental)
+    {
+        aosOptions.push_back("-incremental");
+    }
+    if (m_numThreads > 1)
+    {
+        aosOptions.push_back("-num_threads");
+        aosOptions.push_back(CPLSPrintf("%d", m_numThreads));
+    }
     if (m_recursive)
     {
         aosOptions.push_back("-recursive");
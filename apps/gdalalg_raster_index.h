@@ -62,6 +62,9 @@ class CPL_DLL GDALRasterIndexAlgorithm /* non final */
     std::string m_sourceCrsFormat = "auto";
     std::vector<std::string> m_metadata{};
     bool m_skipErrors = false;
+    bool m_incremental = false;
+    int m_numThreads = 0;
+    std::string m_numThreadsStr{"ALL_CPUS"};
 
     static constexpr const char *PROFILE_NONE = "none";
     static constexpr const char *PROFILE_STAC_GEOPARQUET = "STAC-GeoParquet";
@@ -66,6 +66,7 @@ GDALRasterMosaicStackCommonAlgorithm::GDALRasterMosaicStackCommonAlgorithm(
         &m_writeAbsolutePaths,
         _("Whether the path to the input datasets should be stored as an "
           "absolute path"));
+    AddNumThreadsArg(&m_numThreads, &m_numThreadsStr);
 
     auto &resArg =
         AddArg("resolution", 0,
@@ -269,6 +270,11 @@ void GDALRasterMosaicStackCommonAlgorithm::SetBuildVRTOptions(
     {
         aosOptions.push_back("-write_absolute_path");
     }
+    if (m_numThreads > 1)
+    {
+        aosOptions.push_back("-num_threads");
+        aosOptions.push_back(CPLSPrintf("%d", m_numThreads));
+    }
 }
 
 /************************************************************************/
@@ -51,6 +51,8 @@ class GDALRasterMosaicStackCommonAlgorithm /* non final */
     std::vector<int> m_bands{};
     bool m_hideNoData = false;
     bool m_writeAbsolutePaths = false;
+    int m_numThreads = 0;
+    std::string m_numThreadsStr{"ALL_CPUS"};
 };
 
 //! @endcond
@@ -40,6 +40,12 @@ class GDALRasterNeighborsAlgorithm : public GDALRasterPipelineStepAlgorithm
   private:
     bool RunStep(GDALPipelineStepRunContext &ctxt) override;
 
+    int GetInputHaloSize() const override
+    {
+        // Default kernels are at most 5x5
+        return m_size > 0 ? m_size / 2 : 2;
+    }
+
     int m_band = 0;
     std::vector<std::string> m_method{};
     int m_size = 0;
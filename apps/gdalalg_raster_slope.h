@@ -36,6 +36,12 @@ class GDALRasterSlopeAlgorithm /* non final */
   private:
     bool RunStep(GDALPipelineStepRunContext &ctxt) override;
 
+    // 3x3 window
+    int GetInputHaloSize() const override
+    {
+        return 1;
+    }
+
     int m_band = 1;
     std::string m_unit = "degree";
     double m_xscale = std::numeric_limits<double>::quiet_NaN();
@@ -37,6 +37,12 @@ class GDALRasterTPIAlgorithm /* non final */
   private:
     bool RunStep(GDALPipelineStepRunContext &ctxt) override;
 
+    // 3x3 window
+    int GetInputHaloSize() const override
+    {
+        return 1;
+    }
+
     int m_band = 1;
     bool m_noEdges = false;
 };
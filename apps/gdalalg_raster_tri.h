@@ -37,6 +37,12 @@ class GDALRasterTRIAlgorithm /* non final */
   private:
     bool RunStep(GDALPipelineStepRunContext &ctxt) override;
 
+    // 3x3 window
+    int GetInputHaloSize() const override
+    {
+        return 1;
+    }
+
     int m_band = 1;
     std::string m_algorithm = "Riley";
     bool m_noEdges = false;
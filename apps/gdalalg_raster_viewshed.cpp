@@ -258,8 +258,7 @@ bool GDALRasterViewshedAlgorithm::RunStep(GDALPipelineStepRunContext &ctxt)
     }
     else
     {
-        static const std::vector<std::string> badArgs{
-            "observer-spacing", GDAL_ARG_NAME_NUM_THREADS};
+        static const std::vector<std::string> badArgs{"observer-spacing"};
         for (const auto &arg : badArgs)
             if (GetArg(arg)->IsExplicitlySet())
             {
@@ -278,6 +277,9 @@ bool GDALRasterViewshedAlgorithm::RunStep(GDALPipelineStepRunContext &ctxt)
                 return false;
             }
 
+        if (GetArg(GDAL_ARG_NAME_NUM_THREADS)->IsExplicitlySet())
+            m_opts.numThreads = m_numThreads;
+
         gdal::viewshed::Viewshed oViewshed(m_opts);
         const bool bSuccess = oViewshed.run(
             GDALRasterBand::ToHandle(poSrcDS->GetRasterBand(m_band)), sdBand,
@@ -12,12 +12,23 @@
 
 #include "gdalalg_raster_write.h"
 
+#include "cpl_error_internal.h"
 #include "cpl_string.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_proxy.h"
 #include "gdal_utils.h"
 #include "gdal_priv.h"
 
+#include <algorithm>
+#include <future>
+#include <map>
+
 //! @cond Doxygen_Suppress
 
+#ifndef _
+#define _(x) (x)
+#endif
+
 /************************************************************************/
 /*         GDALRasterWriteAlgorithm::GDALRasterWriteAlgorithm()         */
 /************************************************************************/
@@ -27,8 +38,469 @@ GDALRasterWriteAlgorithm::GDALRasterWriteAlgorithm()
                                       /* standaloneStep =*/false)
 {
     AddRasterOutputArgs(/* hiddenForCLI = */ false);
+    AddNumThreadsArg(&m_numThreads, &m_numThreadsStr,
+                     _("Number of jobs (or ALL_CPUS) used to compute "
+                       "concurrently blocks of the output of previous steps"));
+}
+
+/************************************************************************/
+/*       GDALRasterWriteAlgorithm::SupportsInputMultiThreading()        */
+/************************************************************************/
+
+bool GDALRasterWriteAlgorithm::SupportsInputMultiThreading() const
+{
+    // A streamed or VRT output just references the output of the previous
+    // steps, so there is nothing to compute.
+    if (EQUAL(m_format.c_str(), "stream") || EQUAL(m_format.c_str(), "VRT"))
+        return false;
+    return !(m_format.empty() &&
+             EQUAL(CPLGetExtensionSafe(m_outputDataset.GetName().c_str())
+                       .c_str(),
+                   "vrt"));
 }
 
+namespace
+{
+
+/************************************************************************/
+/*                         ParallelPullDataset                          */
+/************************************************************************/
+
+// Dataset that forwards everything to the output dataset of the previous
+// steps, except pixel reads, which are served from horizontal chunks that
+// worker threads compute concurrently, and ahead of the (sequential) reads
+// done by the writer, from thread-safe clones of the output of the previous
+// steps. When the previous steps are a pipeline, such clones are obtained
+// by re-instantiating the pipeline, serialized as GDALG, in each thread.
+class ParallelPullDataset final : public GDALProxyDataset
+{
+  public:
+    static std::unique_ptr<ParallelPullDataset>
+    Create(GDALDataset *poSrcDS, int nThreads, int nHaloSize);
+
+    ~ParallelPullDataset() override;
+
+    CPLErr ReadFromChunks(int nXOff, int nYOff, int nXSize, int nYSize,
+                          void *pData, GDALDataType eBufType, int nBandCount,
+                          const int *panBandMap, GSpacing nPixelSpace,
+                          GSpacing nLineSpace, GSpacing nBandSpace);
+
+  protected:
+    GDALDataset *RefUnderlyingDataset() const override
+    {
+        return m_poSrcDS;
+    }
+
+    void UnrefUnderlyingDataset(GDALDataset *) const override
+    {
+    }
+
+    CPLErr IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize,
+                     int nYSize, void *pData, int nBufXSize, int nBufYSize,
+                     GDALDataType eBufType, int nBandCount,
+                     BANDMAP_TYPE panBandMap, GSpacing nPixelSpace,
+                     GSpacing nLineSpace, GSpacing nBandSpace,
+                     GDALRasterIOExtraArg *psExtraArg) override;
+
+  private:
+    struct Chunk
+    {
+        std::vector<GByte> abyData{};
+        CPLErr eErr = CE_None;
+        CPLErrorAccumulator oErrorAccumulator{};
+        std::promise<void> oPromise{};
+        std::shared_future<void> oFuture{};
+        bool bErrorsReplayed = false;
+    };
+
+    GDALDataset *const m_poSrcDS;
+    GDALDataset *m_poThreadSafeDS = nullptr;
+    const int m_nThreads;
+    int m_nChunkHeight = 0;
+    int m_nChunkCount = 0;
+    bool m_bSameDataType = true;
+    std::vector<size_t> m_anBandOffsets{};
+    size_t m_nChunkSize = 0;
+    CPLWorkerThreadPool m_oPool{};
+    std::unique_ptr<CPLJobQueue> m_poJobQueue{};
+    std::map<int, std::shared_ptr<Chunk>> m_oMapChunks{};
+
+    ParallelPullDataset(GDALDataset *poSrcDS, int nThreads);
+
+    void ComputeChunk(Chunk &oChunk, int iChunk) const;
+
+    CPL_DISALLOW_COPY_ASSIGN(ParallelPullDataset)
+};
+
+/************************************************************************/
+/*                           ParallelPullBand                           */
+/************************************************************************/
+
+class ParallelPullBand final : public GDALProxyRasterBand
+{
+  public:
+    ParallelPullBand(ParallelPullDataset *poDS, GDALRasterBand *poSrcBand);
+
+  protected:
+    GDALRasterBand *
+    RefUnderlyingRasterBand(bool /* bForceOpen */) const override
+    {
+        return m_poSrcBand;
+    }
+
+    void UnrefUnderlyingRasterBand(GDALRasterBand *) const override
+    {
+    }
+
+    CPLErr IReadBlock(int nBlockXOff, int nBlockYOff, void *pImage) override;
+
+    CPLErr IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize,
+                     int nYSize, void *pData, int nBufXSize, int nBufYSize,
+                     GDALDataType eBufType, GSpacing nPixelSpace,
+                     GSpacing nLineSpace,
+                     GDALRasterIOExtraArg *psExtraArg) override;
+
+  private:
+    GDALRasterBand *const m_poSrcBand;
+
+    CPL_DISALLOW_COPY_ASSIGN(ParallelPullBand)
+};
+
+/************************************************************************/
+/*              ParallelPullDataset::ParallelPullDataset()              */
+/************************************************************************/
+
+ParallelPullDataset::ParallelPullDataset(GDALDataset *poSrcDS, int nThreads)
+    : m_poSrcDS(poSrcDS), m_nThreads(nThreads)
+{
+    nRasterXSize = poSrcDS->GetRasterXSize();
+    nRasterYSize = poSrcDS->GetRasterYSize();
+    for (int i = 0; i < poSrcDS->GetRasterCount(); ++i)
+    {
+        SetBand(i + 1, std::make_unique<ParallelPullBand>(
+                           this, poSrcDS->GetRasterBand(i + 1)));
+    }
+}
+
+/************************************************************************/
+/*             ParallelPullDataset::~ParallelPullDataset()              */
+/************************************************************************/
+
+ParallelPullDataset::~ParallelPullDataset()
+{
+    if (m_poJobQueue)
+        m_poJobQueue->WaitCompletion();
+    m_poJobQueue.reset();
+    if (m_poThreadSafeDS)
+        m_poThreadSafeDS->ReleaseRef();
+}
+
+/************************************************************************/
+/*                    ParallelPullDataset::Create()                     */
+/************************************************************************/
+
+/* static */ std::unique_ptr<ParallelPullDataset>
+ParallelPullDataset::Create(GDALDataset *poSrcDS, int nThreads, int nHaloSize)
+{
+    const int nBands = poSrcDS->GetRasterCount();
+    if (nBands == 0 || poSrcDS->GetRasterYSize() < 2)
+        return nullptr;
+
+    auto poDS = std::unique_ptr<ParallelPullDataset>(
+        new ParallelPullDataset(poSrcDS, nThreads));
+
+    {
+        CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+        poDS->m_poThreadSafeDS =
+            GDALGetThreadSafeDataset(poSrcDS, GDAL_OF_RASTER);
+    }
+    if (!poDS->m_poThreadSafeDS)
+    {
+        CPLDebug("GDAL", "Cannot get a thread-safe version of %s. "
+                         "Pulling blocks sequentially",
+                 poSrcDS->GetDescription());
+        return nullptr;
+    }
+
+    // Chunks are horizontal strips of the whole width of the raster, which
+    // matches the order in which GDALDatasetCopyWholeRaster() reads the
+    // source.
+    const GDALDataType eDT = poSrcDS->GetRasterBand(1)->GetRasterDataType();
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    poSrcDS->GetRasterBand(1)->GetBlockSize(&nBlockXSize, &nBlockYSize);
+    size_t nLineSize = 0;
+    for (int i = 1; i <= nBands; ++i)
+    {
+        const GDALDataType eBandDT =
+            poSrcDS->GetRasterBand(i)->GetRasterDataType();
+        if (eBandDT != eDT)
+            poDS->m_bSameDataType = false;
+        nLineSize += static_cast<size_t>(GDALGetDataTypeSizeBytes(eBandDT)) *
+                     poDS->nRasterXSize;
+    }
+
+    // Target about 1 MB per chunk, without leaving threads idle.
+    constexpr size_t CHUNK_SIZE_TARGET = 1024 * 1024;
+    int nChunkHeight = static_cast<int>(std::clamp<size_t>(
+        CHUNK_SIZE_TARGET / nLineSize, 1, poDS->nRasterYSize));
+    nChunkHeight = std::min(
+        nChunkHeight, DIV_ROUND_UP(poDS->nRasterYSize, 2 * nThreads));
+    // Neighborhood steps read nHaloSize extra lines above and below each
+    // chunk. Make chunks tall enough for that overhead to remain small.
+    nChunkHeight = std::max(nChunkHeight, 32 * nHaloSize);
+    if (nBlockYSize > 1 && nBlockYSize < poDS->nRasterYSize)
+    {
+        nChunkHeight = DIV_ROUND_UP(nChunkHeight, nBlockYSize) * nBlockYSize;
+    }
+    nChunkHeight = std::clamp(nChunkHeight, 1, poDS->nRasterYSize);
+    poDS->m_nChunkHeight = nChunkHeight;
+    poDS->m_nChunkCount = DIV_ROUND_UP(poDS->nRasterYSize, nChunkHeight);
+    if (poDS->m_nChunkCount < 2)
+        return nullptr;
+
+    for (int i = 1; i <= nBands; ++i)
+    {
+        poDS->m_anBandOffsets.push_back(poDS->m_nChunkSize);
+        poDS->m_nChunkSize +=
+            static_cast<size_t>(GDALGetDataTypeSizeBytes(
+                poSrcDS->GetRasterBand(i)->GetRasterDataType())) *
+            poDS->nRasterXSize * nChunkHeight;
+    }
+
+    if (!poDS->m_oPool.Setup(nThreads, nullptr, nullptr))
+        return nullptr;
+    poDS->m_poJobQueue = poDS->m_oPool.CreateJobQueue();
+
+    CPLDebug("GDAL",
+             "Pulling chunks of %d lines of %s concurrently with %d threads "
+             "(halo size = %d)",
+             nChunkHeight, poSrcDS->GetDescription()[0]
+                               ? poSrcDS->GetDescription()
+                               : "output of previous steps",
+             nThreads, nHaloSize);
+
+    return poDS;
+}
+
+/************************************************************************/
+/*                 ParallelPullDataset::ComputeChunk()                  */
+/************************************************************************/
+
+// Called from a worker thread
+void ParallelPullDataset::ComputeChunk(Chunk &oChunk, int iChunk) const
+{
+    auto oAccumulator = oChunk.oErrorAccumulator.InstallForCurrentScope();
+    CPL_IGNORE_RET_VAL(oAccumulator);
+
+    try
+    {
+        oChunk.abyData.resize(m_nChunkSize);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory allocating chunk buffer");
+        oChunk.eErr = CE_Failure;
+        return;
+    }
+
+    const int nYOff = iChunk * m_nChunkHeight;
+    const int nYSize = std::min(m_nChunkHeight, nRasterYSize - nYOff);
+    const int nSrcBands = m_poThreadSafeDS->GetRasterCount();
+    if (m_bSameDataType)
+    {
+        const GDALDataType eDT =
+            m_poThreadSafeDS->GetRasterBand(1)->GetRasterDataType();
+        const int nDTSize = GDALGetDataTypeSizeBytes(eDT);
+        oChunk.eErr = m_poThreadSafeDS->RasterIO(
+            GF_Read, 0, nYOff, nRasterXSize, nYSize, oChunk.abyData.data(),
+            nRasterXSize, nYSize, eDT, nSrcBands, nullptr, nDTSize,
+            static_cast<GSpacing>(nDTSize) * nRasterXSize,
+            static_cast<GSpacing>(m_anBandOffsets.size() > 1
+                                      ? m_anBandOffsets[1]
+                                      : m_nChunkSize),
+            nullptr);
+    }
+    else
+    {
+        for (int i = 0; i < nSrcBands && oChunk.eErr == CE_None; ++i)
+        {
+            auto poBand = m_poThreadSafeDS->GetRasterBand(i + 1);
+            const GDALDataType eDT = poBand->GetRasterDataType();
+            oChunk.eErr = poBand->RasterIO(
+                GF_Read, 0, nYOff, nRasterXSize, nYSize,
+                oChunk.abyData.data() + m_anBandOffsets[i], nRasterXSize,
+                nYSize, eDT, 0, 0, nullptr);
+        }
+    }
+}
+
+/************************************************************************/
+/*                ParallelPullDataset::ReadFromChunks()                 */
+/************************************************************************/
+
+// Called from the thread of the writer
+CPLErr ParallelPullDataset::ReadFromChunks(
+    int nXOff, int nYOff, int nXSize, int nYSize, void *pData,
+    GDALDataType eBufType, int nBandCount, const int *panBandMap,
+    GSpacing nPixelSpace, GSpacing nLineSpace, GSpacing nBandSpace)
+{
+    const int iFirstChunk = nYOff / m_nChunkHeight;
+    const int iLastChunk = (nYOff + nYSize - 1) / m_nChunkHeight;
+    // Keep a few chunks in flight after the requested ones, so that worker
+    // threads are busy while the writer compresses and writes.
+    const int iLastPrefetchedChunk =
+        std::min(m_nChunkCount - 1, iLastChunk + 2 * m_nThreads);
+
+    // Writers normally read from top to bottom: forget chunks that are
+    // outside of the current window.
+    for (auto oIter = m_oMapChunks.begin(); oIter != m_oMapChunks.end();)
+    {
+        if (oIter->first < iFirstChunk || oIter->first > iLastPrefetchedChunk)
+            oIter = m_oMapChunks.erase(oIter);
+        else
+            ++oIter;
+    }
+
+    for (int iChunk = iFirstChunk; iChunk <= iLastPrefetchedChunk; ++iChunk)
+    {
+        if (cpl::contains(m_oMapChunks, iChunk))
+            continue;
+        auto poChunk = std::make_shared<Chunk>();
+        poChunk->oFuture = poChunk->oPromise.get_future().share();
+        m_oMapChunks[iChunk] = poChunk;
+        m_poJobQueue->SubmitJob(
+            [this, poChunk, iChunk]()
+            {
+                ComputeChunk(*poChunk, iChunk);
+                poChunk->oPromise.set_value();
+            });
+    }
+
+    for (int iChunk = iFirstChunk; iChunk <= iLastChunk; ++iChunk)
+    {
+        auto poChunk = m_oMapChunks[iChunk];
+        poChunk->oFuture.wait();
+        if (!poChunk->bErrorsReplayed)
+        {
+            poChunk->bErrorsReplayed = true;
+            poChunk->oErrorAccumulator.ReplayErrors();
+        }
+        if (poChunk->eErr != CE_None)
+        {
+            // So that a new attempt computes it again
+            m_oMapChunks.erase(iChunk);
+            return CE_Failure;
+        }
+
+        const int nChunkYOff = iChunk * m_nChunkHeight;
+        const int nYStart = std::max(nYOff, nChunkYOff);
+        const int nYEnd = std::min(nYOff + nYSize, nChunkYOff + m_nChunkHeight);
+        for (int i = 0; i < nBandCount; ++i)
+        {
+            const int iBand = panBandMap[i] - 1;
+            const GDALDataType eDT =
+                m_poSrcDS->GetRasterBand(iBand + 1)->GetRasterDataType();
+            const int nDTSize = GDALGetDataTypeSizeBytes(eDT);
+            const GByte *pabySrc = poChunk->abyData.data() +
+                                   m_anBandOffsets[iBand] +
+                                   static_cast<size_t>(nDTSize) * nXOff;
+            for (int iY = nYStart; iY < nYEnd; ++iY)
+            {
+                GDALCopyWords64(
+                    pabySrc + static_cast<size_t>(iY - nChunkYOff) *
+                                  nRasterXSize * nDTSize,
+                    eDT, nDTSize,
+                    static_cast<GByte *>(pData) + i * nBandSpace +
+                        (iY - nYOff) * nLineSpace,
+                    eBufType, static_cast<int>(nPixelSpace), nXSize);
+            }
+        }
+    }
+
+    return CE_None;
+}
+
+/************************************************************************/
+/*                   ParallelPullDataset::IRasterIO()                   */
+/************************************************************************/
+
+CPLErr ParallelPullDataset::IRasterIO(
+    GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize, int nYSize,
+    void *pData, int nBufXSize, int nBufYSize, GDALDataType eBufType,
+    int nBandCount, BANDMAP_TYPE panBandMap, GSpacing nPixelSpace,
+    GSpacing nLineSpace, GSpacing nBandSpace, GDALRasterIOExtraArg *psExtraArg)
+{
+    if (eRWFlag == GF_Read && nXSize == nBufXSize && nYSize == nBufYSize)
+    {
+        return ReadFromChunks(nXOff, nYOff, nXSize, nYSize, pData, eBufType,
+                              nBandCount, panBandMap, nPixelSpace, nLineSpace,
+                              nBandSpace);
+    }
+    return GDALProxyDataset::IRasterIO(
+        eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize, nBufYSize,
+        eBufType, nBandCount, panBandMap, nPixelSpace, nLineSpace, nBandSpace,
+        psExtraArg);
+}
+
+/************************************************************************/
+/*                 ParallelPullBand::ParallelPullBand()                 */
+/************************************************************************/
+
+ParallelPullBand::ParallelPullBand(ParallelPullDataset *poDSIn,
+                                   GDALRasterBand *poSrcBand)
+    : m_poSrcBand(poSrcBand)
+{
+    poDS = poDSIn;
+    nBand = poSrcBand->GetBand();
+    eDataType = poSrcBand->GetRasterDataType();
+    nRasterXSize = poSrcBand->GetXSize();
+    nRasterYSize = poSrcBand->GetYSize();
+    poSrcBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+}
+
+/************************************************************************/
+/*                    ParallelPullBand::IReadBlock()                    */
+/************************************************************************/
+
+CPLErr ParallelPullBand::IReadBlock(int nBlockXOff, int nBlockYOff,
+                                    void *pImage)
+{
+    const int nXOff = nBlockXOff * nBlockXSize;
+    const int nYOff = nBlockYOff * nBlockYSize;
+    const int nXSize = std::min(nBlockXSize, nRasterXSize - nXOff);
+    const int nYSize = std::min(nBlockYSize, nRasterYSize - nYOff);
+    const int nDTSize = GDALGetDataTypeSizeBytes(eDataType);
+    return cpl::down_cast<ParallelPullDataset *>(poDS)->ReadFromChunks(
+        nXOff, nYOff, nXSize, nYSize, pImage, eDataType, 1, &nBand, nDTSize,
+        static_cast<GSpacing>(nDTSize) * nBlockXSize, 0);
+}
+
+/************************************************************************/
+/*                    ParallelPullBand::IRasterIO()                     */
+/************************************************************************/
+
+CPLErr ParallelPullBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
+                                   int nXSize, int nYSize, void *pData,
+                                   int nBufXSize, int nBufYSize,
+                                   GDALDataType eBufType, GSpacing nPixelSpace,
+                                   GSpacing nLineSpace,
+                                   GDALRasterIOExtraArg *psExtraArg)
+{
+    if (eRWFlag == GF_Read && nXSize == nBufXSize && nYSize == nBufYSize)
+    {
+        return cpl::down_cast<ParallelPullDataset *>(poDS)->ReadFromChunks(
+            nXOff, nYOff, nXSize, nYSize, pData, eBufType, 1, &nBand,
+            nPixelSpace, nLineSpace, 0);
+    }
+    return GDALProxyRasterBand::IRasterIO(
+        eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize, nBufYSize,
+        eBufType, nPixelSpace, nLineSpace, psExtraArg);
+}
+
+}  // namespace
+
 /************************************************************************/
 /*                 GDALRasterWriteAlgorithm::RunStep()                  */
 /************************************************************************/
@@ -78,7 +550,15 @@ bool GDALRasterWriteAlgorithm::RunStep(GDALPipelineStepRunContext &ctxt)
     const std::string osLastErrorMsg = CPLGetLastErrorMsg();
     const auto nLastErrorCounter = CPLGetErrorCounter();
 
-    GDALDatasetH hSrcDS = GDALDataset::ToHandle(poSrcDS);
+    std::unique_ptr<ParallelPullDataset> poParallelDS;
+    if (m_numThreads > 1 && SupportsInputMultiThreading())
+    {
+        poParallelDS = ParallelPullDataset::Create(poSrcDS, m_numThreads,
+                                                   m_upstreamHaloSize);
+    }
+
+    GDALDatasetH hSrcDS = GDALDataset::ToHandle(
+        poParallelDS ? poParallelDS.get() : poSrcDS);
     auto poRetDS = GDALDataset::FromHandle(GDALTranslate(
         m_outputDataset.GetName().c_str(), hSrcDS, psOptions, nullptr));
     GDALTranslateOptionsFree(psOptions);
@@ -46,9 +46,14 @@ class GDALRasterWriteAlgorithm final : public GDALRasterPipelineStepAlgorithm
         return false;
     }
 
+    bool SupportsInputMultiThreading() const override;
+
   private:
     friend class GDALRasterPipelineStepAlgorithm;
     bool RunStep(GDALPipelineStepRunContext &ctxt) override;
+
+    int m_numThreads = 1;
+    std::string m_numThreadsStr{};
 };
 
 //! @endcond
@@ -133,6 +133,13 @@ class GDALVectorGeomOneToOneAlgorithmLayer /* non final */
             apoOutFeatures.push_back(std::move(poDstFeature));
     }
 
+    // TranslateFeature() only depends on the passed feature and on
+    // immutable state.
+    bool IsTranslateFeatureThreadSafe() const override
+    {
+        return true;
+    }
+
   private:
     int m_iGeomIdx = -1;
 };
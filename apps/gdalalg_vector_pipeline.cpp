@@ -44,10 +44,14 @@
 #include "../frmts/mem/memdataset.h"
 
 #include "cpl_conv.h"
+#include "cpl_error_internal.h"
 #include "cpl_string.h"
+#include "cpl_worker_thread_pool.h"
+#include "ogrlayerarrow.h"
 
 #include <algorithm>
 #include <cassert>
+#include <cerrno>
 
 //! @cond Doxygen_Suppress
 
@@ -350,11 +354,19 @@ OGRFeature *GDALVectorPipelineOutputLayer::GetNextRawFeature()
     m_idxInPendingFeatures = 0;
     while (true)
     {
-        auto poSrcFeature =
-            std::unique_ptr<OGRFeature>(m_srcLayer.GetNextFeature());
-        if (!poSrcFeature)
-            return nullptr;
-        TranslateFeature(std::move(poSrcFeature), m_pendingFeatures);
+        if (GetTranslateThreadCount() > 1)
+        {
+            if (!TranslateBatchInParallel())
+                return nullptr;
+        }
+        else
+        {
+            auto poSrcFeature =
+                std::unique_ptr<OGRFeature>(m_srcLayer.GetNextFeature());
+            if (!poSrcFeature)
+                return nullptr;
+            TranslateFeature(std::move(poSrcFeature), m_pendingFeatures);
+        }
         if (m_translateError)
         {
             return nullptr;
@@ -367,6 +379,335 @@ OGRFeature *GDALVectorPipelineOutputLayer::GetNextRawFeature()
     return poFeature;
 }
 
+/************************************************************************/
+/*       GDALVectorPipelineOutputLayer::GetTranslateThreadCount()       */
+/************************************************************************/
+
+int GDALVectorPipelineOutputLayer::GetTranslateThreadCount()
+{
+    if (m_nTranslateThreads < 0)
+    {
+        m_nTranslateThreads = 1;
+        const char *pszNumThreads =
+            CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+        if (pszNumThreads && IsTranslateFeatureThreadSafe())
+        {
+            m_nTranslateThreads =
+                EQUAL(pszNumThreads, "ALL_CPUS")
+                    ? CPLGetNumCPUs()
+                    : std::clamp(atoi(pszNumThreads), 1, 1024);
+        }
+        if (m_nTranslateThreads > 1)
+        {
+            m_poThreadPool = std::make_unique<CPLWorkerThreadPool>();
+            if (!m_poThreadPool->Setup(m_nTranslateThreads, nullptr, nullptr))
+            {
+                m_poThreadPool.reset();
+                m_nTranslateThreads = 1;
+            }
+        }
+    }
+    return m_nTranslateThreads;
+}
+
+/************************************************************************/
+/*      GDALVectorPipelineOutputLayer::TranslateBatchInParallel()       */
+/************************************************************************/
+
+/** Read a batch of source features, translate them with several threads,
+ * and append the resulting features to m_pendingFeatures in the order of
+ * the source features.
+ *
+ * @return false if there are no more source features.
+ */
+bool GDALVectorPipelineOutputLayer::TranslateBatchInParallel()
+{
+    // Somewhat arbitrary. Large enough to amortize the synchronization cost,
+    // small enough to keep a streaming behavior.
+    constexpr size_t BATCH_SIZE_PER_THREAD = 64;
+    const size_t nThreads = static_cast<size_t>(m_nTranslateThreads);
+
+    std::vector<std::unique_ptr<OGRFeature>> apoSrcFeatures;
+    while (apoSrcFeatures.size() < nThreads * BATCH_SIZE_PER_THREAD)
+    {
+        auto poSrcFeature =
+            std::unique_ptr<OGRFeature>(m_srcLayer.GetNextFeature());
+        if (!poSrcFeature)
+            break;
+        apoSrcFeatures.push_back(std::move(poSrcFeature));
+    }
+    if (apoSrcFeatures.empty())
+        return false;
+
+    struct Chunk
+    {
+        std::vector<std::unique_ptr<OGRFeature>> apoOutFeatures{};
+        CPLErrorAccumulator oErrorAccumulator{};
+    };
+
+    const size_t nChunks = std::min(nThreads, apoSrcFeatures.size());
+    std::vector<Chunk> aoChunks(nChunks);
+    auto poJobQueue = m_poThreadPool->CreateJobQueue();
+    for (size_t iChunk = 0; iChunk < nChunks; ++iChunk)
+    {
+        const size_t iStart = iChunk * apoSrcFeatures.size() / nChunks;
+        const size_t iEnd = (iChunk + 1) * apoSrcFeatures.size() / nChunks;
+        Chunk &oChunk = aoChunks[iChunk];
+        poJobQueue->SubmitJob(
+            [this, &oChunk, &apoSrcFeatures, iStart, iEnd]()
+            {
+                auto oAccumulator =
+                    oChunk.oErrorAccumulator.InstallForCurrentScope();
+                CPL_IGNORE_RET_VAL(oAccumulator);
+                for (size_t i = iStart; i < iEnd; ++i)
+                {
+                    TranslateFeature(std::move(apoSrcFeatures[i]),
+                                     oChunk.apoOutFeatures);
+                }
+            });
+    }
+    poJobQueue->WaitCompletion();
+
+    for (auto &oChunk : aoChunks)
+    {
+        oChunk.oErrorAccumulator.ReplayErrors();
+        for (auto &poFeature : oChunk.apoOutFeatures)
+            m_pendingFeatures.push_back(std::move(poFeature));
+    }
+    return true;
+}
+
+/************************************************************************/
+/*        GDALVectorPipelineOutputLayer::TranslateArrowSchema()         */
+/************************************************************************/
+
+bool GDALVectorPipelineOutputLayer::TranslateArrowSchema(struct ArrowSchema *)
+{
+    return true;
+}
+
+/************************************************************************/
+/*         GDALVectorPipelineOutputLayer::TranslateArrowBatch()         */
+/************************************************************************/
+
+bool GDALVectorPipelineOutputLayer::TranslateArrowBatch(
+    const struct ArrowSchema *, struct ArrowArray *)
+{
+    return true;
+}
+
+/************************************************************************/
+/*         GDALVectorPipelineOutputLayer::HasFastArrowStream()          */
+/************************************************************************/
+
+bool GDALVectorPipelineOutputLayer::HasFastArrowStream() const
+{
+    if (m_poAttrQuery || m_poFilterGeom ||
+        !m_srcLayer.TestCapability(OLCFastGetArrowStream) ||
+        !CanTranslateArrowBatch(nullptr))
+    {
+        return false;
+    }
+
+    // Fields ignored on this layer are unknown to the source layer.
+    const OGRFeatureDefn *poDefn = GetLayerDefn();
+    for (const auto poFieldDefn : poDefn->GetFields())
+    {
+        if (poFieldDefn->IsIgnored())
+            return false;
+    }
+    for (const auto poGeomFieldDefn : poDefn->GetGeomFields())
+    {
+        if (poGeomFieldDefn->IsIgnored())
+            return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*      GDALVectorPipelineOutputLayer::SelectArrowSchemaChildren()      */
+/************************************************************************/
+
+/** Modify the schema so that it only exposes the specified children. The
+ * original schema, including its other children, is released when the
+ * modified schema is released. */
+/* static */
+void GDALVectorPipelineOutputLayer::SelectArrowSchemaChildren(
+    struct ArrowSchema *schema, const std::vector<int> &anChildren)
+{
+    struct PrivateData
+    {
+        struct ArrowSchema m_oOriSchema{};
+        std::vector<struct ArrowSchema *> m_apoChildren{};
+
+        static void Release(struct ArrowSchema *psSchema)
+        {
+            auto poData = static_cast<PrivateData *>(psSchema->private_data);
+            if (poData->m_oOriSchema.release)
+                poData->m_oOriSchema.release(&(poData->m_oOriSchema));
+            delete poData;
+            psSchema->release = nullptr;
+        }
+    };
+
+    auto poData = new PrivateData();
+    poData->m_oOriSchema = *schema;
+    for (int iChild : anChildren)
+        poData->m_apoChildren.push_back(schema->children[iChild]);
+    schema->n_children = static_cast<int64_t>(anChildren.size());
+    schema->children = poData->m_apoChildren.data();
+    schema->private_data = poData;
+    schema->release = PrivateData::Release;
+}
+
+/************************************************************************/
+/*      GDALVectorPipelineOutputLayer::SelectArrowArrayChildren()       */
+/************************************************************************/
+
+/** Modify the array so that it only exposes the specified children. The
+ * original array, including its other children, is released when the
+ * modified array is released. */
+/* static */
+void GDALVectorPipelineOutputLayer::SelectArrowArrayChildren(
+    struct ArrowArray *array, const std::vector<int> &anChildren)
+{
+    struct PrivateData
+    {
+        struct ArrowArray m_oOriArray{};
+        std::vector<struct ArrowArray *> m_apoChildren{};
+
+        static void Release(struct ArrowArray *psArray)
+        {
+            auto poData = static_cast<PrivateData *>(psArray->private_data);
+            if (poData->m_oOriArray.release)
+                poData->m_oOriArray.release(&(poData->m_oOriArray));
+            delete poData;
+            psArray->release = nullptr;
+        }
+    };
+
+    auto poData = new PrivateData();
+    poData->m_oOriArray = *array;
+    for (int iChild : anChildren)
+        poData->m_apoChildren.push_back(array->children[iChild]);
+    array->n_children = static_cast<int64_t>(anChildren.size());
+    array->children = poData->m_apoChildren.data();
+    array->private_data = poData;
+    array->release = PrivateData::Release;
+}
+
+/************************************************************************/
+/*          GDALVectorPipelineOutputLayer::GetArrowStream()             */
+/************************************************************************/
+
+struct GDALVectorPipelineOutputLayer::ArrowStreamPrivateData
+{
+    GDALVectorPipelineOutputLayer *m_poLayer = nullptr;
+    OGRArrowArrayStream m_oSrcStream{};
+    struct ArrowSchema m_oSrcSchema{};
+    std::string m_osLastError{};
+};
+
+bool GDALVectorPipelineOutputLayer::GetArrowStream(
+    struct ArrowArrayStream *out_stream, CSLConstList papszOptions)
+{
+    if (!HasFastArrowStream() || !CanTranslateArrowBatch(papszOptions))
+        return OGRLayer::GetArrowStream(out_stream, papszOptions);
+
+    auto poData = std::make_unique<ArrowStreamPrivateData>();
+    poData->m_poLayer = this;
+    if (!m_srcLayer.GetArrowStream(poData->m_oSrcStream.get(), papszOptions))
+        return false;
+
+    memset(out_stream, 0, sizeof(*out_stream));
+    out_stream->get_schema = ArrowStreamGetSchema;
+    out_stream->get_next = ArrowStreamGetNext;
+    out_stream->get_last_error = ArrowStreamGetLastError;
+    out_stream->release = ArrowStreamRelease;
+    out_stream->private_data = poData.release();
+    return true;
+}
+
+/************************************************************************/
+/*       GDALVectorPipelineOutputLayer::ArrowStreamGetSchema()          */
+/************************************************************************/
+
+/* static */
+int GDALVectorPipelineOutputLayer::ArrowStreamGetSchema(
+    struct ArrowArrayStream *stream, struct ArrowSchema *out_schema)
+{
+    auto poData = static_cast<ArrowStreamPrivateData *>(stream->private_data);
+    const int ret = poData->m_oSrcStream.get_schema(out_schema);
+    if (ret != 0)
+        return ret;
+    if (!poData->m_poLayer->TranslateArrowSchema(out_schema))
+    {
+        out_schema->release(out_schema);
+        poData->m_osLastError = "TranslateArrowSchema() failed";
+        return EIO;
+    }
+    return 0;
+}
+
+/************************************************************************/
+/*        GDALVectorPipelineOutputLayer::ArrowStreamGetNext()           */
+/************************************************************************/
+
+/* static */
+int GDALVectorPipelineOutputLayer::ArrowStreamGetNext(
+    struct ArrowArrayStream *stream, struct ArrowArray *out_array)
+{
+    auto poData = static_cast<ArrowStreamPrivateData *>(stream->private_data);
+    if (!poData->m_oSrcSchema.release)
+    {
+        const int ret = poData->m_oSrcStream.get_schema(&poData->m_oSrcSchema);
+        if (ret != 0)
+            return ret;
+    }
+    const int ret = poData->m_oSrcStream.get_next(out_array);
+    if (ret != 0 || !out_array->release)
+        return ret;
+    if (!poData->m_poLayer->TranslateArrowBatch(&poData->m_oSrcSchema,
+                                                out_array))
+    {
+        out_array->release(out_array);
+        poData->m_osLastError = "TranslateArrowBatch() failed";
+        return EIO;
+    }
+    return 0;
+}
+
+/************************************************************************/
+/*      GDALVectorPipelineOutputLayer::ArrowStreamGetLastError()        */
+/************************************************************************/
+
+/* static */
+const char *GDALVectorPipelineOutputLayer::ArrowStreamGetLastError(
+    struct ArrowArrayStream *stream)
+{
+    auto poData = static_cast<ArrowStreamPrivateData *>(stream->private_data);
+    if (!poData->m_osLastError.empty())
+        return poData->m_osLastError.c_str();
+    auto psSrcStream = poData->m_oSrcStream.get();
+    return psSrcStream->get_last_error(psSrcStream);
+}
+
+/************************************************************************/
+/*         GDALVectorPipelineOutputLayer::ArrowStreamRelease()          */
+/************************************************************************/
+
+/* static */
+void GDALVectorPipelineOutputLayer::ArrowStreamRelease(
+    struct ArrowArrayStream *stream)
+{
+    auto poData = static_cast<ArrowStreamPrivateData *>(stream->private_data);
+    if (poData->m_oSrcSchema.release)
+        poData->m_oSrcSchema.release(&poData->m_oSrcSchema);
+    delete poData;
+    stream->private_data = nullptr;
+    stream->release = nullptr;
+}
+
 /************************************************************************/
 /*                       GDALVectorOutputDataset                        */
 /************************************************************************/
@@ -20,9 +20,12 @@
 #include "ogrlayerwithtranslatefeature.h"
 
 #include <map>
+#include <memory>
 #include <tuple>
 #include <vector>
 
+class CPLWorkerThreadPool;
+
 //! @cond Doxygen_Suppress
 
 /************************************************************************/
@@ -293,6 +296,15 @@ class GDALVectorAlgorithmLayerProgressHelper
 /** Class that implements GetNextFeature() by forwarding to
  * OGRLayerWithTranslateFeature::TranslateFeature() implementation, which
  * might return several features.
+ *
+ * When IsTranslateFeatureThreadSafe() returns true and the GDAL_NUM_THREADS
+ * configuration option is set, source features are translated by batches
+ * with several threads, while preserving their order.
+ *
+ * Implementations may also override CanTranslateArrowBatch(),
+ * TranslateArrowSchema() and TranslateArrowBatch() so that GetArrowStream()
+ * directly processes the batches of the source layer, when it has a fast
+ * GetArrowStream() implementation, instead of going through features.
  */
 class GDALVectorPipelineOutputLayer /* non final */
     : public OGRLayerWithTranslateFeature,
@@ -306,19 +318,69 @@ class GDALVectorPipelineOutputLayer /* non final */
 
     OGRLayer &m_srcLayer;
 
+    /** Must not be called by implementations whose
+     * IsTranslateFeatureThreadSafe() returns true. */
     void FailTranslation()
     {
         m_translateError = true;
     }
 
+    /** Whether TranslateFeature() may be called concurrently by several
+     * threads. */
+    virtual bool IsTranslateFeatureThreadSafe() const
+    {
+        return false;
+    }
+
+    /** Whether TranslateArrowSchema() and TranslateArrowBatch() can process
+     * the Arrow stream of the source layer, returned with the passed
+     * GetArrowStream() options. */
+    virtual bool CanTranslateArrowBatch(CSLConstList /* papszOptions */) const
+    {
+        return false;
+    }
+
+    /** Modify in place the schema of the Arrow stream of the source layer. */
+    virtual bool TranslateArrowSchema(struct ArrowSchema *schema);
+
+    /** Modify in place a batch of the Arrow stream of the source layer,
+     * whose schema (before TranslateArrowSchema()) is srcSchema. */
+    virtual bool TranslateArrowBatch(const struct ArrowSchema *srcSchema,
+                                     struct ArrowArray *array);
+
+    /** Return whether GetArrowStream() processes the Arrow stream of the
+     * source layer (to be used for OLCFastGetArrowStream). */
+    bool HasFastArrowStream() const;
+
+    static void SelectArrowSchemaChildren(struct ArrowSchema *schema,
+                                          const std::vector<int> &anChildren);
+    static void SelectArrowArrayChildren(struct ArrowArray *array,
+                                         const std::vector<int> &anChildren);
+
   public:
     void ResetReading() override;
     OGRFeature *GetNextRawFeature();
 
+    bool GetArrowStream(struct ArrowArrayStream *out_stream,
+                        CSLConstList papszOptions = nullptr) override;
+
   private:
     std::vector<std::unique_ptr<OGRFeature>> m_pendingFeatures{};
     size_t m_idxInPendingFeatures = 0;
     bool m_translateError = false;
+    int m_nTranslateThreads = -1;
+    std::unique_ptr<CPLWorkerThreadPool> m_poThreadPool{};
+
+    int GetTranslateThreadCount();
+    bool TranslateBatchInParallel();
+
+    struct ArrowStreamPrivateData;
+    static int ArrowStreamGetSchema(struct ArrowArrayStream *stream,
+                                    struct ArrowSchema *out_schema);
+    static int ArrowStreamGetNext(struct ArrowArrayStream *stream,
+                                  struct ArrowArray *out_array);
+    static const char *ArrowStreamGetLastError(struct ArrowArrayStream *stream);
+    static void ArrowStreamRelease(struct ArrowArrayStream *stream);
 };
 
 /************************************************************************/
@@ -362,6 +424,21 @@ class GDALVectorPipelinePassthroughLayer /* non final */
     {
         apoOutFeatures.push_back(std::move(poSrcFeature));
     }
+
+    OGRErr SetIgnoredFields(CSLConstList papszFields) override
+    {
+        // The layer definition is the one of the source layer, which must
+        // also honour ignored fields in the Arrow stream forwarded below.
+        return m_srcLayer.SetIgnoredFields(papszFields);
+    }
+
+    bool GetArrowStream(struct ArrowArrayStream *out_stream,
+                        CSLConstList papszOptions = nullptr) override
+    {
+        if (!m_poAttrQuery && !m_poFilterGeom)
+            return m_srcLayer.GetArrowStream(out_stream, papszOptions);
+        return OGRLayer::GetArrowStream(out_stream, papszOptions);
+    }
 };
 
 /************************************************************************/
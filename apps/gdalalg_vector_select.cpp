@@ -15,6 +15,7 @@
 #include "gdal_priv.h"
 #include "ogrsf_frmts.h"
 #include "ogr_p.h"
+#include "ogr_recordbatch.h"
 
 #include <set>
 
@@ -89,6 +90,62 @@ class GDALVectorSelectAlgorithmLayer final
         apoOutFeatures.push_back(TranslateFeature(std::move(poSrcFeature)));
     }
 
+    bool CanTranslateArrowBatch(CSLConstList) const override
+    {
+        return true;
+    }
+
+    /** Return the indices of the children of the source Arrow schema that
+     * must be kept: the selected fields, and the FID column. */
+    std::vector<int> GetSelectedArrowChildren(const ArrowSchema *schema) const
+    {
+        std::vector<int> anChildren;
+        const auto poSrcLayerDefn = m_srcLayer.GetLayerDefn();
+        for (int i = 0; i < static_cast<int>(schema->n_children); ++i)
+        {
+            const char *pszName = schema->children[i]->name;
+            if (poSrcLayerDefn->GetFieldIndex(pszName) >= 0)
+            {
+                if (m_poFeatureDefn->GetFieldIndex(pszName) >= 0)
+                    anChildren.push_back(i);
+                continue;
+            }
+            int iSrcGeomField = poSrcLayerDefn->GetGeomFieldIndex(pszName);
+            if (iSrcGeomField < 0 &&
+                strcmp(pszName, OGRLayer::DEFAULT_ARROW_GEOMETRY_NAME) == 0)
+            {
+                iSrcGeomField = poSrcLayerDefn->GetGeomFieldIndex("");
+            }
+            if (iSrcGeomField >= 0)
+            {
+                if (m_poFeatureDefn->GetGeomFieldIndex(
+                        poSrcLayerDefn->GetGeomFieldDefn(iSrcGeomField)
+                            ->GetNameRef()) >= 0)
+                {
+                    anChildren.push_back(i);
+                }
+                continue;
+            }
+            anChildren.push_back(i);
+        }
+        return anChildren;
+    }
+
+    bool TranslateArrowSchema(struct ArrowSchema *schema) override
+    {
+        SelectArrowSchemaChildren(schema, GetSelectedArrowChildren(schema));
+        return true;
+    }
+
+    bool TranslateArrowBatch(const struct ArrowSchema *srcSchema,
+                             struct ArrowArray *array) override
+    {
+        // Not cached, as the source schema depends on the options passed to
+        // GetArrowStream(). This is cheap compared to the batch processing.
+        SelectArrowArrayChildren(array, GetSelectedArrowChildren(srcSchema));
+        return true;
+    }
+
   public:
     explicit GDALVectorSelectAlgorithmLayer(OGRLayer &oSrcLayer)
         : GDALVectorPipelineOutputLayer(oSrcLayer),
@@ -267,6 +324,8 @@ class GDALVectorSelectAlgorithmLayer final
 
     int TestCapability(const char *pszCap) const override
     {
+        if (EQUAL(pszCap, OLCFastGetArrowStream))
+            return HasFastArrowStream();
         if (EQUAL(pszCap, OLCRandomRead) || EQUAL(pszCap, OLCCurveGeometries) ||
             EQUAL(pszCap, OLCMeasuredGeometries) ||
             EQUAL(pszCap, OLCZGeometries) ||
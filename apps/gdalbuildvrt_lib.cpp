@@ -26,6 +26,8 @@
 #include <cstring>
 
 #include <algorithm>
+#include <deque>
+#include <future>
 #include <memory>
 #include <set>
 #include <string>
@@ -34,11 +36,13 @@
 #include "commonutils.h"
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_float.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
 #include "cpl_vsi_virtual.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_vrt.h"
 #include "gdal_priv.h"
@@ -196,6 +200,114 @@ static int GetSrcDstWin(DatasetProperty *psDP, double we_res, double ns_res,
            *pdfDstYSize > 0;
 }
 
+/************************************************************************/
+/*                          DatasetPrefetcher                           */
+/************************************************************************/
+
+namespace
+{
+
+// Opens input datasets in worker threads, ahead of their analysis, which is
+// done sequentially, and in order, by VRTBuilder::Build(). This hides the
+// latency of opening datasets, typically on network file systems.
+class DatasetPrefetcher
+{
+  public:
+    DatasetPrefetcher(int nThreads, CSLConstList papszOpenOptions);
+    ~DatasetPrefetcher();
+
+    bool Init();
+    GDALDatasetH Open(int iFile, int nInputFiles,
+                      const char *const *ppszInputFilenames);
+
+  private:
+    struct Entry
+    {
+        GDALDatasetH hDS = nullptr;
+        CPLErrorAccumulator oErrorAccumulator{};
+        std::promise<void> oPromise{};
+    };
+
+    const int m_nThreads;
+    const CPLStringList m_aosOpenOptions;
+    CPLWorkerThreadPool m_oPool{};
+    std::unique_ptr<CPLJobQueue> m_poJobQueue{};
+    std::deque<std::pair<std::shared_ptr<Entry>, std::future<void>>>
+        m_aoPending{};
+    int m_nSubmitted = 0;
+
+    CPL_DISALLOW_COPY_ASSIGN(DatasetPrefetcher)
+};
+
+DatasetPrefetcher::DatasetPrefetcher(int nThreads,
+                                     CSLConstList papszOpenOptions)
+    : m_nThreads(nThreads), m_aosOpenOptions(papszOpenOptions)
+{
+}
+
+DatasetPrefetcher::~DatasetPrefetcher()
+{
+    if (m_poJobQueue)
+        m_poJobQueue->WaitCompletion();
+    for (auto &oPending : m_aoPending)
+    {
+        if (oPending.first->hDS)
+            GDALClose(oPending.first->hDS);
+    }
+}
+
+bool DatasetPrefetcher::Init()
+{
+    if (!m_oPool.Setup(m_nThreads, nullptr, nullptr))
+        return false;
+    m_poJobQueue = m_oPool.CreateJobQueue();
+    return true;
+}
+
+// Return the dataset of index iFile, that must be called with consecutive
+// values, and submit the opening of the next ones. Errors emitted while
+// opening it are replayed in the calling thread.
+GDALDatasetH DatasetPrefetcher::Open(int iFile, int nInputFiles,
+                                     const char *const *ppszInputFilenames)
+{
+    // nInputFiles may increase between calls, when subdatasets are added
+    const int nLookAhead = 4 * m_nThreads;
+    while (m_nSubmitted < std::min(nInputFiles, iFile + 1 + nLookAhead))
+    {
+        auto poEntry = std::make_shared<Entry>();
+        m_aoPending.emplace_back(poEntry, poEntry->oPromise.get_future());
+        // ppszInputFilenames may be reallocated, so pass a copy
+        const std::string osFilename(ppszInputFilenames[m_nSubmitted]);
+        ++m_nSubmitted;
+        const auto oOpenTask = [this, poEntry, osFilename]()
+        {
+            {
+                auto oAccumulator =
+                    poEntry->oErrorAccumulator.InstallForCurrentScope();
+                CPL_IGNORE_RET_VAL(oAccumulator);
+                poEntry->hDS =
+                    GDALOpenEx(osFilename.c_str(), GDAL_OF_RASTER, nullptr,
+                               m_aosOpenOptions.List(), nullptr);
+            }
+            poEntry->oPromise.set_value();
+        };
+        // If the job cannot be queued, open the dataset right now, so that
+        // its promise is always fulfilled.
+        if (!m_poJobQueue->SubmitJob(oOpenTask))
+            oOpenTask();
+    }
+
+    CPLAssert(!m_aoPending.empty());
+    CPL_IGNORE_RET_VAL(iFile);
+    auto oPending = std::move(m_aoPending.front());
+    m_aoPending.pop_front();
+    oPending.second.wait();
+    oPending.first->oErrorAccumulator.ReplayErrors();
+    return oPending.first->hDS;
+}
+
+}  // namespace
+
 /************************************************************************/
 /*                              VRTBuilder                              */
 /************************************************************************/
@@ -292,6 +404,7 @@ class VRTBuilder
                                        void *pProgressData);
 
     std::string m_osProgramName{};
+    int m_nNumThreads = 1;
 };
 
 /************************************************************************/
@@ -1769,6 +1882,15 @@ std::unique_ptr<GDALDataset> VRTBuilder::Build(GDALProgressFunc pfnProgress,
         }
     }
 
+    std::unique_ptr<DatasetPrefetcher> poPrefetcher;
+    if (pahSrcDS == nullptr && m_nNumThreads > 1 && nInputFiles > 1)
+    {
+        poPrefetcher = std::make_unique<DatasetPrefetcher>(
+            std::min(m_nNumThreads, nInputFiles), papszOpenOptions);
+        if (!poPrefetcher->Init())
+            poPrefetcher.reset();
+    }
+
     bool bFoundValid = false;
     for (int i = 0; ppszInputFilenames != nullptr && i < nInputFiles; i++)
     {
@@ -1779,10 +1901,12 @@ std::unique_ptr<GDALDataset> VRTBuilder::Build(GDALProgressFunc pfnProgress,
             return nullptr;
         }
 
-        GDALDatasetH hDS = (pahSrcDS)
-                               ? pahSrcDS[i]
-                               : GDALOpenEx(dsFileName, GDAL_OF_RASTER, nullptr,
-                                            papszOpenOptions, nullptr);
+        GDALDatasetH hDS =
+            pahSrcDS       ? pahSrcDS[i]
+            : poPrefetcher ? poPrefetcher->Open(i, nInputFiles,
+                                                ppszInputFilenames)
+                           : GDALOpenEx(dsFileName, GDAL_OF_RASTER, nullptr,
+                                        papszOpenOptions, nullptr);
         asDatasetProperties[i].isFileOK = FALSE;
 
         if (hDS)
@@ -1998,6 +2122,7 @@ struct GDALBuildVRTOptions
     bool bWriteAbsolutePath = false;
     std::string osPixelFunction{};
     CPLStringList aosPixelFunctionArgs{};
+    int nNumThreads = 1;
 
     /*! allow or suppress progress monitor and other non-error output */
     bool bQuiet = true;
@@ -2154,6 +2279,7 @@ GDALDatasetH GDALBuildVRT(const char *pszDest, int nSrcCount,
         sOptions.aosPixelFunctionArgs, sOptions.aosOpenOptions.List(),
         sOptions.aosCreateOptions, sOptions.bWriteAbsolutePath);
     oBuilder.m_osProgramName = sOptions.osProgramName;
+    oBuilder.m_nNumThreads = sOptions.nNumThreads;
 
     return GDALDataset::ToHandle(
         oBuilder.Build(sOptions.pfnProgress, sOptions.pProgressData).release());
@@ -2436,6 +2562,22 @@ GDALBuildVRTOptionsGetParser(GDALBuildVRTOptions *psOptions,
 
     argParser->add_creation_options_argument(psOptions->aosCreateOptions);
 
+    argParser->add_argument("-num_threads")
+        .metavar("<value>|ALL_CPUS")
+        .action(
+            [psOptions](const std::string &s)
+            {
+                if (EQUAL(s.c_str(), "ALL_CPUS"))
+                    psOptions->nNumThreads = CPLGetNumCPUs();
+                else if (CPLGetValueType(s.c_str()) == CPL_VALUE_INTEGER &&
+                         atoi(s.c_str()) >= 1)
+                    psOptions->nNumThreads = atoi(s.c_str());
+                else
+                    throw std::invalid_argument(
+                        "Invalid value for -num_threads");
+            })
+        .help(_("Number of threads used to open input datasets."));
+
     argParser->add_argument("-write_absolute_path")
         .flag()
         .store_into(psOptions->bWriteAbsolutePath)
@@ -13,10 +13,12 @@
 
 #include "cpl_port.h"
 #include "cpl_conv.h"
+#include "cpl_error_internal.h"
 #include "cpl_md5.h"
 #include "cpl_minixml.h"
 #include "cpl_string.h"
 #include "cpl_vsi_virtual.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal_utils.h"
 #include "gdal_priv.h"
 #include "gdal_utils_priv.h"
@@ -32,7 +34,10 @@
 
 #include <algorithm>
 #include <cmath>
+#include <deque>
+#include <future>
 #include <limits>
+#include <map>
 #include <set>
 
 constexpr const char ARROW_FORMAT_INT32[] = "i";
@@ -54,6 +59,10 @@ constexpr int ARROW_BUF_BYTES = 2;
 
 constexpr int COUNT_STAC_EXTENSIONS = 2;
 
+// Fields used by -incremental to detect modified files
+constexpr const char FILE_SIZE_FIELD_NAME[] = "file_size";
+constexpr const char FILE_MTIME_FIELD_NAME[] = "file_mtime";
+
 typedef enum
 {
     FORMAT_AUTO,
@@ -115,6 +124,8 @@ struct GDALTileIndexOptions
     std::string osBaseURL{};         // Used for "STAC-GeoParquet"
     std::string osIdMethod{};        // Used for "STAC-GeoParquet"
     std::string osIdMetadataItem{};  // Used for "STAC-GeoParquet"
+    int nNumThreads = 1;
+    bool bIncremental = false;
 };
 
 /************************************************************************/
@@ -236,6 +247,28 @@ static std::unique_ptr<GDALArgumentParser> GDALTileIndexAppOptionsGetParser(
         .help(_("Write the absolute path of the raster files in the tile index "
                 "file."));
 
+    argParser->add_argument("-incremental")
+        .flag()
+        .store_into(psOptions->bIncremental)
+        .help(_("Only (re-)index files that are not in the tile index, or "
+                "whose size or modification time has changed."));
+
+    argParser->add_argument("-num_threads")
+        .metavar("<value>|ALL_CPUS")
+        .action(
+            [psOptions](const std::string &s)
+            {
+                if (EQUAL(s.c_str(), "ALL_CPUS"))
+                    psOptions->nNumThreads = CPLGetNumCPUs();
+                else if (CPLGetValueType(s.c_str()) == CPL_VALUE_INTEGER &&
+                         atoi(s.c_str()) >= 1)
+                    psOptions->nNumThreads = atoi(s.c_str());
+                else
+                    throw std::invalid_argument(
+                        "Invalid value for -num_threads");
+            })
+        .help(_("Number of threads used to open input datasets."));
+
     argParser->add_argument("-skip_different_projection")
         .flag()
         .store_into(psOptions->bSkipDifferentProjection)
@@ -1173,6 +1206,27 @@ GDALDatasetH GDALTileIndexInternal(const char *pszDest,
         }
     }
 
+    if (psOptions->bIncremental)
+    {
+        if (bIsSTACGeoParquet)
+        {
+            CPLError(CE_Failure, CPLE_NotSupported,
+                     "-incremental is not supported with the STAC-GeoParquet "
+                     "profile");
+            return nullptr;
+        }
+        for (const char *pszFieldName :
+             {FILE_SIZE_FIELD_NAME, FILE_MTIME_FIELD_NAME})
+        {
+            if (poLayerDefn->GetFieldIndex(pszFieldName) < 0)
+            {
+                OGRFieldDefn oField(pszFieldName, OFTInteger64);
+                if (poLayer->CreateField(&oField) != OGRERR_NONE)
+                    return nullptr;
+            }
+        }
+    }
+
     if (bIsSTACGeoParquet)
     {
         {
@@ -1387,8 +1441,27 @@ GDALDatasetH GDALTileIndexInternal(const char *pszDest,
         }
     }
 
+    const int iFileSizeField =
+        psOptions->bIncremental
+            ? poLayerDefn->GetFieldIndex(FILE_SIZE_FIELD_NAME)
+            : -1;
+    const int iFileMTimeField =
+        psOptions->bIncremental
+            ? poLayerDefn->GetFieldIndex(FILE_MTIME_FIELD_NAME)
+            : -1;
+
+    // Characteristics of a file already in the tile index, used by
+    // -incremental
+    struct ExistingFile
+    {
+        GIntBig nFID = OGRNullFID;
+        GIntBig nSize = -1;
+        GIntBig nMTime = -1;
+    };
+
     // Load in memory existing file names in tile index.
     std::set<std::string> oSetExistingFiles;
+    std::map<std::string, ExistingFile> oMapExistingFiles;
     OGRSpatialReference oAlreadyExistingSRS;
     if (bExistingLayer)
     {
@@ -1396,6 +1469,19 @@ GDALDatasetH GDALTileIndexInternal(const char *pszDest,
         {
             if (poFeature->IsFieldSetAndNotNull(ti_field))
             {
+                if (psOptions->bIncremental)
+                {
+                    ExistingFile &oExistingFile =
+                        oMapExistingFiles[poFeature->GetFieldAsString(
+                            ti_field)];
+                    oExistingFile.nFID = poFeature->GetFID();
+                    if (poFeature->IsFieldSetAndNotNull(iFileSizeField))
+                        oExistingFile.nSize =
+                            poFeature->GetFieldAsInteger64(iFileSizeField);
+                    if (poFeature->IsFieldSetAndNotNull(iFileMTimeField))
+                        oExistingFile.nMTime =
+                            poFeature->GetFieldAsInteger64(iFileMTimeField);
+                }
                 if (oSetExistingFiles.empty())
                 {
                     auto poSrcDS =
@@ -1789,38 +1875,134 @@ GDALDatasetH GDALTileIndexInternal(const char *pszDest,
         return ret;
     };
 
+    // Input datasets are opened (and, with -incremental, checked for
+    // modifications) by worker threads, ahead of their processing, which is
+    // done sequentially in the order in which they are enumerated.
+    struct PendingSource
+    {
+        std::string osSrcFilename{};
+        std::string osFileNameToWrite{};
+        bool bAlreadyInIndex = false;
+        const ExistingFile *psExistingFile = nullptr;
+        bool bUnchanged = false;
+        GIntBig nFileSize = -1;
+        GIntBig nFileMTime = -1;
+        std::unique_ptr<GDALDataset> poDS{};
+        CPLErrorAccumulator oErrorAccumulator{};
+        std::promise<void> oPromise{};
+    };
+
+    const bool bIncremental = psOptions->bIncremental;
+    const auto PrepareSource = [bIncremental](PendingSource &oSource)
+    {
+        if (bIncremental)
+        {
+            VSIStatBufL sStat;
+            if (VSIStatL(oSource.osSrcFilename.c_str(), &sStat) == 0)
+            {
+                oSource.nFileSize = static_cast<GIntBig>(sStat.st_size);
+                oSource.nFileMTime = static_cast<GIntBig>(sStat.st_mtime);
+                oSource.bUnchanged =
+                    oSource.psExistingFile &&
+                    oSource.psExistingFile->nSize == oSource.nFileSize &&
+                    oSource.psExistingFile->nMTime == oSource.nFileMTime;
+                if (oSource.bUnchanged)
+                    return;
+            }
+        }
+        oSource.poDS.reset(GDALDataset::Open(oSource.osSrcFilename.c_str(),
+                                             GDAL_OF_RASTER |
+                                                 GDAL_OF_VERBOSE_ERROR,
+                                             nullptr, nullptr, nullptr));
+    };
+
+    CPLWorkerThreadPool oThreadPool;
+    std::unique_ptr<CPLJobQueue> poJobQueue;
+    if (psOptions->nNumThreads > 1 &&
+        oThreadPool.Setup(psOptions->nNumThreads, nullptr, nullptr))
+    {
+        poJobQueue = oThreadPool.CreateJobQueue();
+    }
+    const int nLookAhead = poJobQueue ? 4 * psOptions->nNumThreads : 0;
+    std::deque<std::shared_ptr<PendingSource>> apoPendingSources;
+    bool bNoMoreSources = false;
+
     int iCur = 0;
     int nTotal = nSrcCount + 1;
     while (true)
     {
-        const std::string osSrcFilename = oGDALTileIndexTileIterator.next();
-        if (osSrcFilename.empty())
-            break;
-        if (bSkipFirstTile)
+        while (!bNoMoreSources &&
+               static_cast<int>(apoPendingSources.size()) <= nLookAhead)
         {
-            bSkipFirstTile = false;
-            continue;
-        }
+            std::string osSrcFilename = oGDALTileIndexTileIterator.next();
+            if (osSrcFilename.empty())
+            {
+                bNoMoreSources = true;
+                break;
+            }
+            if (bSkipFirstTile)
+            {
+                bSkipFirstTile = false;
+                continue;
+            }
 
-        std::string osFileNameToWrite;
-        VSIStatBuf sStatBuf;
+            auto poSource = std::make_shared<PendingSource>();
+            VSIStatBuf sStatBuf;
 
-        // Make sure it is a file before building absolute path name.
-        if (!osCurrentPath.empty() &&
-            CPLIsFilenameRelative(osSrcFilename.c_str()) &&
-            VSIStat(osSrcFilename.c_str(), &sStatBuf) == 0)
-        {
-            osFileNameToWrite = CPLProjectRelativeFilenameSafe(
-                osCurrentPath.c_str(), osSrcFilename.c_str());
-        }
-        else
-        {
-            osFileNameToWrite = osSrcFilename.c_str();
+            // Make sure it is a file before building absolute path name.
+            if (!osCurrentPath.empty() &&
+                CPLIsFilenameRelative(osSrcFilename.c_str()) &&
+                VSIStat(osSrcFilename.c_str(), &sStatBuf) == 0)
+            {
+                poSource->osFileNameToWrite = CPLProjectRelativeFilenameSafe(
+                    osCurrentPath.c_str(), osSrcFilename.c_str());
+            }
+            else
+            {
+                poSource->osFileNameToWrite = osSrcFilename;
+            }
+            poSource->osSrcFilename = std::move(osSrcFilename);
+
+            // Checks that file is not already in tileindex.
+            if (bIncremental)
+            {
+                const auto oIter =
+                    oMapExistingFiles.find(poSource->osFileNameToWrite);
+                if (oIter != oMapExistingFiles.end())
+                    poSource->psExistingFile = &(oIter->second);
+            }
+            else if (oSetExistingFiles.find(poSource->osFileNameToWrite) !=
+                     oSetExistingFiles.end())
+            {
+                poSource->bAlreadyInIndex = true;
+            }
+
+            if (poJobQueue && !poSource->bAlreadyInIndex)
+            {
+                poJobQueue->SubmitJob(
+                    [poSource, &PrepareSource]()
+                    {
+                        {
+                            auto oAccumulator =
+                                poSource->oErrorAccumulator
+                                    .InstallForCurrentScope();
+                            CPL_IGNORE_RET_VAL(oAccumulator);
+                            PrepareSource(*poSource);
+                        }
+                        poSource->oPromise.set_value();
+                    });
+            }
+            apoPendingSources.push_back(std::move(poSource));
         }
+        if (apoPendingSources.empty())
+            break;
+
+        const auto poSource = std::move(apoPendingSources.front());
+        apoPendingSources.pop_front();
+        const std::string &osSrcFilename = poSource->osSrcFilename;
+        const std::string &osFileNameToWrite = poSource->osFileNameToWrite;
 
-        // Checks that file is not already in tileindex.
-        if (oSetExistingFiles.find(osFileNameToWrite) !=
-            oSetExistingFiles.end())
+        if (poSource->bAlreadyInIndex)
         {
             CPLError(CE_Warning, CPLE_AppDefined,
                      "File %s is already in tileindex. Skipping it.",
@@ -1837,9 +2019,25 @@ GDALDatasetH GDALTileIndexInternal(const char *pszDest,
                     std::make_unique<CPLTurnFailureIntoWarningBackuper>();
             CPL_IGNORE_RET_VAL(poFailureIntoWarning);
 
-            poSrcDS.reset(GDALDataset::Open(
-                osSrcFilename.c_str(), GDAL_OF_RASTER | GDAL_OF_VERBOSE_ERROR,
-                nullptr, nullptr, nullptr));
+            if (poJobQueue)
+            {
+                poSource->oPromise.get_future().wait();
+                poSource->oErrorAccumulator.ReplayErrors();
+            }
+            else
+            {
+                PrepareSource(*poSource);
+            }
+
+            if (poSource->bUnchanged)
+            {
+                CPLDebug("GDALTileIndex",
+                         "%s is unchanged since it was indexed. Skipping it.",
+                         osFileNameToWrite.c_str());
+                continue;
+            }
+
+            poSrcDS = std::move(poSource->poDS);
             if (poSrcDS == nullptr)
             {
                 CPLError(bFailOnErrors ? CE_Failure : CE_Warning,
@@ -2776,9 +2974,26 @@ GDALDatasetH GDALTileIndexInternal(const char *pszDest,
                 }
             }
 
+            if (iFileSizeField >= 0 && poSource->nFileSize >= 0)
+            {
+                poFeature->SetField(iFileSizeField, poSource->nFileSize);
+                poFeature->SetField(iFileMTimeField, poSource->nFileMTime);
+            }
+
             poFeature->SetGeometryDirectly(poPoly.release());
 
-            if (poLayer->CreateFeature(poFeature.get()) != OGRERR_NONE)
+            // Modified file already in the tile index: replace its feature
+            if (poSource->psExistingFile)
+            {
+                poFeature->SetFID(poSource->psExistingFile->nFID);
+                if (poLayer->SetFeature(poFeature.get()) != OGRERR_NONE)
+                {
+                    CPLError(CE_Failure, CPLE_AppDefined,
+                             "Failed to update feature in tile index.");
+                    return nullptr;
+                }
+            }
+            else if (poLayer->CreateFeature(poFeature.get()) != OGRERR_NONE)
             {
                 CPLError(CE_Failure, CPLE_AppDefined,
                          "Failed to create feature in tile index.");
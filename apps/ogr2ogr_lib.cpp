@@ -25,6 +25,7 @@
 
 #include <algorithm>
 #include <atomic>
+#include <deque>
 #include <future>
 #include <limits>
 #include <map>
@@ -39,11 +40,13 @@
 #include "commonutils.h"
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_multiproc.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_time.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_alg.h"
 #include "gdal_alg_priv.h"
@@ -398,6 +401,12 @@ struct GDALVectorTranslateOptions
     /*! Maximum number of features, or -1 if no limit. */
     GIntBig nLimit = -1;
 
+    /*! Number of threads used to translate features (reprojection,
+     * clipping, geometry operations), when the Arrow interface is not used.
+     * Features are still read and written by the calling thread, and in
+     * their original order. */
+    int nNumThreads = 1;
+
     /*! Wished offset w.r.t UTC of dateTime */
     int nTZOffsetInSec = TZ_OFFSET_INVALID;
 
@@ -597,14 +606,14 @@ class LayerTranslator
 
     OGRGeometry *m_poClipSrcOri = nullptr;
     bool m_bWarnedClipSrcSRS = false;
-    std::unique_ptr<OGRGeometry> m_poClipSrcReprojectedToSrcSRS{};
+    std::shared_ptr<OGRGeometry> m_poClipSrcReprojectedToSrcSRS{};
     const OGRSpatialReference *m_poClipSrcReprojectedToSrcSRS_SRS = nullptr;
     OGREnvelope m_oClipSrcEnv{};
     bool m_bClipSrcIsRectangle = false;
 
     OGRGeometry *m_poClipDstOri = nullptr;
     bool m_bWarnedClipDstSRS = false;
-    std::unique_ptr<OGRGeometry> m_poClipDstReprojectedToDstSRS{};
+    std::shared_ptr<OGRGeometry> m_poClipDstReprojectedToDstSRS{};
     const OGRSpatialReference *m_poClipDstReprojectedToDstSRS_SRS = nullptr;
     OGREnvelope m_oClipDstEnv{};
     bool m_bClipDstIsRectangle = false;
@@ -621,10 +630,16 @@ class LayerTranslator
                    const GDALVectorTranslateOptions *psOptions);
 
   private:
+    // Protects the clip geometry caches and psInfo->m_aoReprojectionInfo
+    // when features are translated by several threads.
+    std::mutex m_oMutex{};
+
     struct ClipGeomDesc
     {
+        // Keeps poGeom alive if the cache is updated by another thread
+        std::shared_ptr<const OGRGeometry> poGeomHolder{};
         const OGRGeometry *poGeom = nullptr;
-        const OGREnvelope *poEnv = nullptr;
+        OGREnvelope oEnv{};
         bool bGeomIsRectangle = false;
     };
 
@@ -6582,13 +6597,11 @@ bool LayerTranslator::Translate(
         }
     }
 
-    std::unique_ptr<OGRFeature> poFeature;
-    auto poDstFeature = std::make_unique<OGRFeature>(poDstFDefn);
     int nFeaturesInTransaction = 0;
     GIntBig nCount = 0; /* written + failed */
     GIntBig nFeaturesWritten = 0;
-    bool bRunSetPrecisionEvaluated = false;
-    bool bRunSetPrecision = false;
+    const bool bRunSetPrecision =
+        CPLTestBool(CPLGetConfigOption("OGR_APPLY_GEOM_SET_PRECISION", "YES"));
 
     bool bRet = true;
     CPLErrorReset();
@@ -6603,42 +6616,44 @@ bool LayerTranslator::Translate(
     }
 
     const bool bSingleIteration = poFeatureIn != nullptr;
-    while (true)
-    {
-        if (m_nLimit >= 0 && psInfo->m_nFeaturesRead >= m_nLimit)
-        {
-            break;
-        }
 
-        if (poFeatureIn != nullptr)
-            poFeature = std::move(poFeatureIn);
-        else if (psOptions->nFIDToFetch != OGRNullFID)
-            poFeature.reset(poSrcLayer->GetFeature(psOptions->nFIDToFetch));
-        else
-            poFeature.reset(poSrcLayer->GetNextFeature());
-
-        if (poFeature == nullptr)
-        {
-            if (CPLGetLastErrorType() == CE_Failure)
-            {
-                bRet = false;
-            }
-            break;
-        }
+    // Target feature resulting from the translation of (a part of) a source
+    // feature.
+    struct TranslatedPart
+    {
+        // Feature to write, or nullptr if it must be skipped
+        std::unique_ptr<OGRFeature> poDstFeature{};
+        bool bSetFromFailed = false;
+        bool bReprojectionFailed = false;
+    };
 
-        if (!bSetupCTOK &&
-            (psInfo->m_nFeaturesRead == 0 || psInfo->m_bPerFeatureCT))
-        {
-            if (!SetupCT(psInfo, poSrcLayer, m_bTransform, m_bWrapDateline,
-                         m_osDateLineOffset, m_poUserSourceSRS, poFeature.get(),
-                         poOutputSRS, m_poGCPCoordTrans, true))
-            {
-                return false;
-            }
-        }
+    // Result of the translation of a source feature: one target feature, or
+    // one per part of its geometry with -explodecollections.
+    struct TranslatedFeature
+    {
+        GIntBig nSrcFID = OGRNullFID;
+        GIntBig nDesiredFID = OGRNullFID;
+        std::vector<TranslatedPart> aoParts{};
+    };
 
-        psInfo->m_nFeaturesRead++;
+    // State that cannot be shared by threads translating features
+    struct TranslationContext
+    {
+        OGRGeometryFactory::TransformWithOptionsCache
+            *poTransformWithOptionsCache = nullptr;
+        OGRGeometryFactory::TransformWithOptionsCache
+            oTransformWithOptionsCache{};
+        // Clones of the coordinate transformations of psInfo, if not empty
+        std::vector<std::unique_ptr<OGRCoordinateTransformation>> apoCT{};
+        std::unique_ptr<OGRFeature> poSpareDstFeature{};
+    };
 
+    // Translate a source feature, without writing it. May be called
+    // concurrently by several threads, with different contexts.
+    const auto TranslateFeature =
+        [&](std::unique_ptr<OGRFeature> poFeature,
+            TranslationContext &oContext, TranslatedFeature &oTranslated)
+    {
         int nIters = 1;
         std::unique_ptr<OGRGeometryCollection> poCollToExplode;
         int iGeomCollToExplode = -1;
@@ -6679,31 +6694,14 @@ bool LayerTranslator::Translate(
                  poFeature->IsFieldSetAndNotNull(psInfo->m_iSrcFIDField))
             nDesiredFID =
                 poFeature->GetFieldAsInteger64(psInfo->m_iSrcFIDField);
+        oTranslated.nSrcFID = nSrcFID;
+        oTranslated.nDesiredFID = nDesiredFID;
 
         for (int iPart = 0; iPart < nIters; iPart++)
         {
-            if (psOptions->nLayerTransaction &&
-                ++nFeaturesInTransaction == psOptions->nGroupTransactions)
-            {
-                if (poDstLayer->CommitTransaction() == OGRERR_FAILURE ||
-                    poDstLayer->StartTransaction() == OGRERR_FAILURE)
-                {
-                    return false;
-                }
-                nFeaturesInTransaction = 0;
-            }
-            else if (!psOptions->nLayerTransaction &&
-                     psOptions->nGroupTransactions > 0 &&
-                     ++nTotalEventsDone >= psOptions->nGroupTransactions)
-            {
-                if (m_poODS->CommitTransaction() == OGRERR_FAILURE ||
-                    m_poODS->StartTransaction(psOptions->bForceTransaction) ==
-                        OGRERR_FAILURE)
-                {
-                    return false;
-                }
-                nTotalEventsDone = 0;
-            }
+            oTranslated.aoParts.emplace_back();
+            TranslatedPart &oPart = oTranslated.aoParts.back();
+            std::unique_ptr<OGRFeature> poDstFeature;
 
             CPLErrorReset();
             if (psInfo->m_bCanAvoidSetFrom)
@@ -6741,12 +6739,12 @@ bool LayerTranslator::Translate(
                     const auto clipGeomDesc =
                         GetSrcClipGeom(poStolenGeometry->getSpatialReference());
 
-                    if (clipGeomDesc.poGeom && clipGeomDesc.poEnv)
+                    if (clipGeomDesc.poGeom)
                     {
                         OGREnvelope oEnv;
                         poStolenGeometry->getEnvelope(&oEnv);
-                        if (!clipGeomDesc.poEnv->Contains(oEnv) &&
-                            !(clipGeomDesc.poEnv->Intersects(oEnv) &&
+                        if (!clipGeomDesc.oEnv.Contains(oEnv) &&
+                            !(clipGeomDesc.oEnv.Intersects(oEnv) &&
                               clipGeomDesc.poGeom->Intersects(
                                   poStolenGeometry.get())))
                         {
@@ -6755,6 +6753,10 @@ bool LayerTranslator::Translate(
                     }
                 }
 
+                if (oContext.poSpareDstFeature)
+                    poDstFeature = std::move(oContext.poSpareDstFeature);
+                else
+                    poDstFeature = std::make_unique<OGRFeature>(poDstFDefn);
                 poDstFeature->Reset();
 
                 if (poDstFeature->SetFrom(
@@ -6762,23 +6764,13 @@ bool LayerTranslator::Translate(
                         /* bUseISO8601ForDateTimeAsString = */ true) !=
                     OGRERR_NONE)
                 {
-                    if (psOptions->nGroupTransactions)
-                    {
-                        if (psOptions->nLayerTransaction)
-                        {
-                            if (poDstLayer->CommitTransaction() != OGRERR_NONE)
-                            {
-                                return false;
-                            }
-                        }
-                    }
-
                     CPLError(CE_Failure, CPLE_AppDefined,
                              "Unable to translate feature " CPL_FRMT_GIB
                              " from layer %s.",
                              nSrcFID, poSrcLayer->GetName());
 
-                    return false;
+                    oPart.bSetFromFailed = true;
+                    return;
                 }
 
                 /* ... and now we can attach the stolen geometry */
@@ -6797,8 +6789,12 @@ bool LayerTranslator::Translate(
                         if (poFeature->IsFieldSetAndNotNull(nSrcField))
                         {
                             const auto poDomain = kv.second.poDomain;
-                            const auto &oMapKV =
-                                psInfo->m_oMapDomainToKV[poDomain];
+                            const auto oIterDomain =
+                                psInfo->m_oMapDomainToKV.find(poDomain);
+                            if (oIterDomain ==
+                                psInfo->m_oMapDomainToKV.end())
+                                continue;
+                            const auto &oMapKV = oIterDomain->second;
                             const auto iter = oMapKV.find(
                                 poFeature->GetFieldAsString(nSrcField));
                             if (iter != oMapKV.end())
@@ -6996,17 +6992,17 @@ bool LayerTranslator::Translate(
                     const auto clipGeomDesc =
                         GetSrcClipGeom(poDstGeometry->getSpatialReference());
 
-                    if (!(clipGeomDesc.poGeom && clipGeomDesc.poEnv))
+                    if (!clipGeomDesc.poGeom)
                         goto end_loop;
 
                     OGREnvelope oDstEnv;
                     poDstGeometry->getEnvelope(&oDstEnv);
 
                     if (!(clipGeomDesc.bGeomIsRectangle &&
-                          clipGeomDesc.poEnv->Contains(oDstEnv)))
+                          clipGeomDesc.oEnv.Contains(oDstEnv)))
                     {
                         std::unique_ptr<OGRGeometry> poClipped;
-                        if (clipGeomDesc.poEnv->Intersects(oDstEnv))
+                        if (clipGeomDesc.oEnv.Intersects(oDstEnv))
                         {
                             poClipped.reset(clipGeomDesc.poGeom->Intersection(
                                 poDstGeometry.get()));
@@ -7041,7 +7037,9 @@ bool LayerTranslator::Translate(
                 }
 
                 OGRCoordinateTransformation *const poCT =
-                    psInfo->m_aoReprojectionInfo[iGeom].m_poCT.get();
+                    oContext.apoCT.empty()
+                        ? psInfo->m_aoReprojectionInfo[iGeom].m_poCT.get()
+                        : oContext.apoCT[iGeom].get();
                 char **const papszTransformOptions =
                     psInfo->m_aoReprojectionInfo[iGeom]
                         .m_aosTransformOptions.List();
@@ -7106,6 +7104,7 @@ bool LayerTranslator::Translate(
                         };
 
                         Visitor oVisit(psInfo->m_aoReprojectionInfo[iGeom]);
+                        std::lock_guard oLock(m_oMutex);
                         poDstGeometry->accept(&oVisit);
                     }
 
@@ -7115,30 +7114,18 @@ bool LayerTranslator::Translate(
                             OGRGeometryFactory::transformWithOptions(
                                 poDstGeometry.get(), poCT,
                                 papszTransformOptions,
-                                m_transformWithOptionsCache));
+                                *oContext.poTransformWithOptionsCache));
                         if (poReprojectedGeom == nullptr)
                         {
-                            if (psOptions->nGroupTransactions)
-                            {
-                                if (psOptions->nLayerTransaction)
-                                {
-                                    if (poDstLayer->CommitTransaction() !=
-                                            OGRERR_NONE &&
-                                        !psOptions->bSkipFailures)
-                                    {
-                                        return false;
-                                    }
-                                }
-                            }
-
                             CPLError(CE_Failure, CPLE_AppDefined,
                                      "Failed to reproject feature " CPL_FRMT_GIB
                                      " (geometry probably out of source or "
                                      "destination SRS).",
                                      nSrcFID);
+                            oPart.bReprojectionFailed = true;
                             if (!psOptions->bSkipFailures)
                             {
-                                return false;
+                                return;
                             }
                         }
 
@@ -7207,7 +7194,7 @@ bool LayerTranslator::Translate(
 
                         const auto clipGeomDesc = GetDstClipGeom(
                             poDstGeometry->getSpatialReference());
-                        if (!clipGeomDesc.poGeom || !clipGeomDesc.poEnv)
+                        if (!clipGeomDesc.poGeom)
                         {
                             goto end_loop;
                         }
@@ -7216,10 +7203,10 @@ bool LayerTranslator::Translate(
                         poDstGeometry->getEnvelope(&oDstEnv);
 
                         if (!(clipGeomDesc.bGeomIsRectangle &&
-                              clipGeomDesc.poEnv->Contains(oDstEnv)))
+                              clipGeomDesc.oEnv.Contains(oDstEnv)))
                         {
                             std::unique_ptr<OGRGeometry> poClipped;
-                            if (clipGeomDesc.poEnv->Intersects(oDstEnv))
+                            if (clipGeomDesc.oEnv.Intersects(oDstEnv))
                             {
                                 poClipped.reset(
                                     clipGeomDesc.poGeom->Intersection(
@@ -7268,12 +7255,6 @@ bool LayerTranslator::Translate(
                         // ogr2ogr -xyRes context, we force calling SetPrecision(),
                         // unless the user explicitly asks not to do it by
                         // setting the config option to NO.
-                        if (!bRunSetPrecisionEvaluated)
-                        {
-                            bRunSetPrecisionEvaluated = true;
-                            bRunSetPrecision = CPLTestBool(CPLGetConfigOption(
-                                "OGR_APPLY_GEOM_SET_PRECISION", "YES"));
-                        }
                         if (bRunSetPrecision)
                         {
                             auto poNewGeom = std::unique_ptr<OGRGeometry>(
@@ -7327,19 +7308,86 @@ bool LayerTranslator::Translate(
                 poDstFeature->SetGeomField(iGeom, std::move(poDstGeometry));
             }
 
+            oPart.poDstFeature = std::move(poDstFeature);
+
+        end_loop:;  // nothing
+        }
+    };
+
+    // Write the translated feature(s). Return false in case of fatal error.
+    const auto WriteTranslatedFeature =
+        [&](TranslatedFeature &oTranslated, TranslationContext &oContext)
+    {
+        for (auto &oPart : oTranslated.aoParts)
+        {
+            if (psOptions->nLayerTransaction &&
+                ++nFeaturesInTransaction == psOptions->nGroupTransactions)
+            {
+                if (poDstLayer->CommitTransaction() == OGRERR_FAILURE ||
+                    poDstLayer->StartTransaction() == OGRERR_FAILURE)
+                {
+                    return false;
+                }
+                nFeaturesInTransaction = 0;
+            }
+            else if (!psOptions->nLayerTransaction &&
+                     psOptions->nGroupTransactions > 0 &&
+                     ++nTotalEventsDone >= psOptions->nGroupTransactions)
+            {
+                if (m_poODS->CommitTransaction() == OGRERR_FAILURE ||
+                    m_poODS->StartTransaction(psOptions->bForceTransaction) ==
+                        OGRERR_FAILURE)
+                {
+                    return false;
+                }
+                nTotalEventsDone = 0;
+            }
+
+            if (oPart.bSetFromFailed)
+            {
+                if (psOptions->nGroupTransactions &&
+                    psOptions->nLayerTransaction)
+                {
+                    CPL_IGNORE_RET_VAL(poDstLayer->CommitTransaction());
+                }
+                return false;
+            }
+
+            if (oPart.bReprojectionFailed)
+            {
+                if (psOptions->nGroupTransactions)
+                {
+                    if (psOptions->nLayerTransaction)
+                    {
+                        if (poDstLayer->CommitTransaction() != OGRERR_NONE &&
+                            !psOptions->bSkipFailures)
+                        {
+                            return false;
+                        }
+                    }
+                }
+                if (!psOptions->bSkipFailures)
+                {
+                    return false;
+                }
+            }
+
+            if (!oPart.poDstFeature)
+                continue;
+
             CPLErrorReset();
             if ((psOptions->bUpsert
-                     ? poDstLayer->UpsertFeature(poDstFeature.get())
-                     : poDstLayer->CreateFeature(poDstFeature.get())) ==
+                     ? poDstLayer->UpsertFeature(oPart.poDstFeature.get())
+                     : poDstLayer->CreateFeature(oPart.poDstFeature.get())) ==
                 OGRERR_NONE)
             {
                 nFeaturesWritten++;
-                if (nDesiredFID != OGRNullFID &&
-                    poDstFeature->GetFID() != nDesiredFID)
+                if (oTranslated.nDesiredFID != OGRNullFID &&
+                    oPart.poDstFeature->GetFID() != oTranslated.nDesiredFID)
                 {
                     CPLError(CE_Warning, CPLE_AppDefined,
                              "Feature id " CPL_FRMT_GIB " not preserved",
-                             nDesiredFID);
+                             oTranslated.nDesiredFID);
                 }
             }
             else if (!psOptions->bSkipFailures)
@@ -7353,7 +7401,7 @@ bool LayerTranslator::Translate(
                 CPLError(CE_Failure, CPLE_AppDefined,
                          "Unable to write feature " CPL_FRMT_GIB
                          " from layer %s.",
-                         nSrcFID, poSrcLayer->GetName());
+                         oTranslated.nSrcFID, poSrcLayer->GetName());
 
                 return false;
             }
@@ -7362,7 +7410,7 @@ bool LayerTranslator::Translate(
                 CPLDebug("GDALVectorTranslate",
                          "Unable to write feature " CPL_FRMT_GIB
                          " into layer %s.",
-                         nSrcFID, poSrcLayer->GetName());
+                         oTranslated.nSrcFID, poSrcLayer->GetName());
                 if (psOptions->nGroupTransactions)
                 {
                     if (psOptions->nLayerTransaction)
@@ -7378,9 +7426,221 @@ bool LayerTranslator::Translate(
                 }
             }
 
-        end_loop:;  // nothing
+
+            oContext.poSpareDstFeature = std::move(oPart.poDstFeature);
+        }
+        return true;
+    };
+
+    /* -------------------------------------------------------------------- */
+    /*      In pipelined mode, source features are read by batches in this  */
+    /*      thread, translated by worker threads, and the resulting         */
+    /*      features are written in this thread, in their original order.   */
+    /* -------------------------------------------------------------------- */
+    struct FeatureBatch
+    {
+        std::vector<std::unique_ptr<OGRFeature>> apoSrcFeatures{};
+        std::vector<TranslatedFeature> aoTranslatedFeatures{};
+        bool bFailed = false;
+        CPLErrorAccumulator oErrorAccumulator{};
+        std::promise<void> oPromise{};
+    };
+
+    std::mutex oFreeContextsMutex;
+    std::vector<std::unique_ptr<TranslationContext>> apoFreeContexts;
+
+    const auto TranslateBatch = [&](FeatureBatch &oBatch)
+    {
+        std::unique_ptr<TranslationContext> poContext;
+        {
+            std::lock_guard oLock(oFreeContextsMutex);
+            if (!apoFreeContexts.empty())
+            {
+                poContext = std::move(apoFreeContexts.back());
+                apoFreeContexts.pop_back();
+            }
+        }
+        if (!poContext)
+        {
+            poContext = std::make_unique<TranslationContext>();
+            poContext->poTransformWithOptionsCache =
+                &(poContext->oTransformWithOptionsCache);
+            for (const auto &oReprojectionInfo : psInfo->m_aoReprojectionInfo)
+            {
+                const auto poCT = oReprojectionInfo.m_poCT.get();
+                poContext->apoCT.emplace_back(poCT ? poCT->Clone() : nullptr);
+                if (poCT && !poContext->apoCT.back())
+                {
+                    CPLError(CE_Failure, CPLE_AppDefined,
+                             "Cannot clone OGRCoordinateTransformation");
+                    oBatch.bFailed = true;
+                    return;
+                }
+            }
         }
 
+        oBatch.aoTranslatedFeatures.resize(oBatch.apoSrcFeatures.size());
+        for (size_t i = 0; i < oBatch.apoSrcFeatures.size(); ++i)
+        {
+            TranslateFeature(std::move(oBatch.apoSrcFeatures[i]), *poContext,
+                             oBatch.aoTranslatedFeatures[i]);
+        }
+        oBatch.apoSrcFeatures.clear();
+
+        std::lock_guard oLock(oFreeContextsMutex);
+        apoFreeContexts.push_back(std::move(poContext));
+    };
+
+    CPLWorkerThreadPool oThreadPool;
+    std::unique_ptr<CPLJobQueue> poJobQueue;
+    if (psOptions->nNumThreads > 1 && !bSingleIteration &&
+        psOptions->nFIDToFetch == OGRNullFID && !psInfo->m_bPerFeatureCT &&
+        oThreadPool.Setup(psOptions->nNumThreads, nullptr, nullptr))
+    {
+        poJobQueue = oThreadPool.CreateJobQueue();
+    }
+
+    std::deque<std::shared_ptr<FeatureBatch>> apoBatches;
+    std::shared_ptr<FeatureBatch> poCurBatch;
+    size_t iInCurBatch = 0;
+    bool bNoMoreSrcFeatures = false;
+
+    // Read source features and submit them for translation, so that there
+    // are at most 2 batches per thread in flight.
+    const auto SubmitBatches = [&]()
+    {
+        const int nBatchSize = std::max(
+            1, atoi(CPLGetConfigOption("OGR2OGR_PIPELINE_BATCH_SIZE", "256")));
+        while (!bNoMoreSrcFeatures &&
+               static_cast<int>(apoBatches.size()) <
+                   2 * psOptions->nNumThreads)
+        {
+            auto poBatch = std::make_shared<FeatureBatch>();
+            while (static_cast<int>(poBatch->apoSrcFeatures.size()) <
+                   nBatchSize)
+            {
+                if (m_nLimit >= 0 && psInfo->m_nFeaturesRead >= m_nLimit)
+                {
+                    bNoMoreSrcFeatures = true;
+                    break;
+                }
+
+                CPLErrorReset();
+                std::unique_ptr<OGRFeature> poSrcFeature(
+                    poSrcLayer->GetNextFeature());
+                if (poSrcFeature == nullptr)
+                {
+                    if (CPLGetLastErrorType() == CE_Failure)
+                    {
+                        bRet = false;
+                    }
+                    bNoMoreSrcFeatures = true;
+                    break;
+                }
+
+                if (!bSetupCTOK && psInfo->m_nFeaturesRead == 0)
+                {
+                    if (!SetupCT(psInfo, poSrcLayer, m_bTransform,
+                                 m_bWrapDateline, m_osDateLineOffset,
+                                 m_poUserSourceSRS, poSrcFeature.get(),
+                                 poOutputSRS, m_poGCPCoordTrans, true))
+                    {
+                        return false;
+                    }
+                }
+
+                psInfo->m_nFeaturesRead++;
+                poBatch->apoSrcFeatures.push_back(std::move(poSrcFeature));
+            }
+            if (poBatch->apoSrcFeatures.empty())
+                break;
+
+            poJobQueue->SubmitJob(
+                [poBatch, &TranslateBatch]()
+                {
+                    {
+                        auto oAccumulator =
+                            poBatch->oErrorAccumulator.InstallForCurrentScope();
+                        CPL_IGNORE_RET_VAL(oAccumulator);
+                        TranslateBatch(*poBatch);
+                    }
+                    poBatch->oPromise.set_value();
+                });
+            apoBatches.push_back(std::move(poBatch));
+        }
+        return true;
+    };
+
+    TranslationContext oContext;
+    oContext.poTransformWithOptionsCache = &m_transformWithOptionsCache;
+    std::unique_ptr<OGRFeature> poFeature;
+    while (true)
+    {
+        TranslatedFeature oTranslated;
+        if (poJobQueue)
+        {
+            if (!poCurBatch ||
+                iInCurBatch == poCurBatch->aoTranslatedFeatures.size())
+            {
+                if (!SubmitBatches())
+                    return false;
+                if (apoBatches.empty())
+                    break;
+                poCurBatch = std::move(apoBatches.front());
+                apoBatches.pop_front();
+                poCurBatch->oPromise.get_future().wait();
+                poCurBatch->oErrorAccumulator.ReplayErrors();
+                if (poCurBatch->bFailed)
+                    return false;
+                iInCurBatch = 0;
+            }
+            oTranslated =
+                std::move(poCurBatch->aoTranslatedFeatures[iInCurBatch++]);
+        }
+        else
+        {
+            if (m_nLimit >= 0 && psInfo->m_nFeaturesRead >= m_nLimit)
+            {
+                break;
+            }
+
+            if (poFeatureIn != nullptr)
+                poFeature = std::move(poFeatureIn);
+            else if (psOptions->nFIDToFetch != OGRNullFID)
+                poFeature.reset(
+                    poSrcLayer->GetFeature(psOptions->nFIDToFetch));
+            else
+                poFeature.reset(poSrcLayer->GetNextFeature());
+
+            if (poFeature == nullptr)
+            {
+                if (CPLGetLastErrorType() == CE_Failure)
+                {
+                    bRet = false;
+                }
+                break;
+            }
+
+            if (!bSetupCTOK &&
+                (psInfo->m_nFeaturesRead == 0 || psInfo->m_bPerFeatureCT))
+            {
+                if (!SetupCT(psInfo, poSrcLayer, m_bTransform,
+                             m_bWrapDateline, m_osDateLineOffset,
+                             m_poUserSourceSRS, poFeature.get(), poOutputSRS,
+                             m_poGCPCoordTrans, true))
+                {
+                    return false;
+                }
+            }
+
+            psInfo->m_nFeaturesRead++;
+
+            TranslateFeature(std::move(poFeature), oContext, oTranslated);
+        }
+
+        if (!WriteTranslatedFeature(oTranslated, oContext))
+            return false;
+
         /* Report progress */
         nCount++;
         bool bGoOn = true;
@@ -7438,6 +7698,8 @@ bool LayerTranslator::Translate(
 LayerTranslator::ClipGeomDesc
 LayerTranslator::GetDstClipGeom(const OGRSpatialReference *poGeomSRS)
 {
+    std::lock_guard oLock(m_oMutex);
+
     if (m_poClipDstReprojectedToDstSRS_SRS != poGeomSRS)
     {
         auto poClipDstSRS = m_poClipDstOri->getSpatialReference();
@@ -7477,8 +7739,10 @@ LayerTranslator::GetDstClipGeom(const OGRSpatialReference *poGeomSRS)
         m_bClipDstIsRectangle = poGeom->IsRectangle();
     }
     ClipGeomDesc ret;
+    ret.poGeomHolder = m_poClipDstReprojectedToDstSRS;
     ret.poGeom = poGeom;
-    ret.poEnv = poGeom ? &m_oClipDstEnv : nullptr;
+    if (poGeom)
+        ret.oEnv = m_oClipDstEnv;
     ret.bGeomIsRectangle = m_bClipDstIsRectangle;
     return ret;
 }
@@ -7496,6 +7760,8 @@ LayerTranslator::GetDstClipGeom(const OGRSpatialReference *poGeomSRS)
 LayerTranslator::ClipGeomDesc
 LayerTranslator::GetSrcClipGeom(const OGRSpatialReference *poGeomSRS)
 {
+    std::lock_guard oLock(m_oMutex);
+
     if (m_poClipSrcReprojectedToSrcSRS_SRS != poGeomSRS)
     {
         auto poClipSrcSRS = m_poClipSrcOri->getSpatialReference();
@@ -7534,8 +7800,10 @@ LayerTranslator::GetSrcClipGeom(const OGRSpatialReference *poGeomSRS)
         m_bClipSrcIsRectangle = poGeom->IsRectangle();
     }
     ClipGeomDesc ret;
+    ret.poGeomHolder = m_poClipSrcReprojectedToSrcSRS;
     ret.poGeom = poGeom;
-    ret.poEnv = poGeom ? &m_oClipSrcEnv : nullptr;
+    if (poGeom)
+        ret.oEnv = m_oClipSrcEnv;
     ret.bGeomIsRectangle = m_bClipDstIsRectangle;
     return ret;
 }
@@ -8427,6 +8695,22 @@ static std::unique_ptr<GDALArgumentParser> GDALVectorTranslateOptionsGetParser(
         .store_into(psOptions->nLimit)
         .help(_("Limit the number of features per layer."));
 
+    argParser->add_argument("-num_threads")
+        .metavar("<value>|ALL_CPUS")
+        .action(
+            [psOptions](const std::string &s)
+            {
+                if (EQUAL(s.c_str(), "ALL_CPUS"))
+                    psOptions->nNumThreads = CPLGetNumCPUs();
+                else if (CPLGetValueType(s.c_str()) == CPL_VALUE_INTEGER &&
+                         atoi(s.c_str()) >= 1)
+                    psOptions->nNumThreads = atoi(s.c_str());
+                else
+                    throw std::invalid_argument(
+                        "Invalid value for -num_threads");
+            })
+        .help(_("Number of threads used to translate features."));
+
     argParser->add_argument("-ds_transaction")
         .flag()
         .action(
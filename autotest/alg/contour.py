@@ -515,6 +515,66 @@ cellsize     1
     ogrtest.check_feature_geometry(f, "LINESTRING (1.5 0.0,1.5 0.5,1.5 1.5,1.5 2.0)")
 
 
+###############################################################################
+# Test NUM_THREADS option: horizontal strips are contoured in parallel and
+# lines crossing the seams between strips are joined
+
+
+@pytest.mark.parametrize("use_nodata", [False, True])
+def test_contour_num_threads(use_nodata):
+
+    # Make the raster wide enough for several strips to be used
+    src_ds = gdal.Translate(
+        "",
+        "data/contour_in.tif",
+        format="MEM",
+        width=2000,
+        height=1500,
+        resampleAlg="bilinear",
+    )
+    if use_nodata:
+        src_ds.GetRasterBand(1).WriteRaster(
+            500, 400, 40, 300, b"\0" * (40 * 300), buf_type=gdal.GDT_Byte
+        )
+
+    def contour(num_threads):
+        ogr_ds = ogr.GetDriverByName("MEM").CreateDataSource("")
+        lyr = ogr_ds.CreateLayer("contour", geom_type=ogr.wkbLineString)
+        lyr.CreateField(ogr.FieldDefn("ID", ogr.OFTInteger))
+        lyr.CreateField(ogr.FieldDefn("ELEV", ogr.OFTReal))
+        options = [
+            "LEVEL_INTERVAL=10",
+            "ID_FIELD=0",
+            "ELEV_FIELD=1",
+            f"NUM_THREADS={num_threads}",
+        ]
+        if use_nodata:
+            options.append("NODATA=0")
+        assert (
+            gdal.ContourGenerateEx(src_ds.GetRasterBand(1), lyr, options=options)
+            == gdal.CE_None
+        )
+        ret = []
+        ids = set()
+        for f in lyr:
+            g = f.GetGeometryRef()
+            ret.append(
+                (
+                    f["ELEV"],
+                    g.GetPointCount(),
+                    round(g.Length(), 6),
+                    g.IsRing(),
+                )
+            )
+            ids.add(f["ID"])
+        assert len(ids) == len(ret)
+        return sorted(ret)
+
+    expected = contour(1)
+    assert len(expected) > 0
+    assert contour(4) == expected
+
+
 ###############################################################################
 # Test scenario of https://github.com/OSGeo/gdal/issues/11340
 
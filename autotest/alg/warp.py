@@ -2130,6 +2130,77 @@ def test_warp_multi_threaded_errors(tmp_vsimem):
             gdal.Warp("", ds, format="MEM", multithread=True)
 
 
+###############################################################################
+# Test -multi with more than 2 chunks in flight
+
+
+@gdaltest.enable_exceptions()
+@pytest.mark.parametrize("dstalpha", [False, True])
+def test_warp_multi_num_chunks_in_flight(tmp_vsimem, dstalpha):
+
+    src_filename = str(tmp_vsimem / "src.tif")
+    gdal.Translate(
+        src_filename,
+        "../gcore/data/byte.tif",
+        width=1000,
+        height=1000,
+        creationOptions=["TILED=YES"],
+    )
+
+    def warp(**kwargs):
+        with gdal.Open(src_filename) as src_ds:
+            return gdal.Warp(
+                "",
+                src_ds,
+                format="MEM",
+                dstSRS="EPSG:4326",
+                dstAlpha=dstalpha,
+                errorThreshold=0,
+                **kwargs,
+            )
+
+    # The memory limit is shared between the 4 chunks in flight, so the
+    # reference must use chunks of the same size.
+    ref_ds = warp(warpMemoryLimit=500 * 1000)
+    out_ds = warp(
+        warpMemoryLimit=1000 * 1000,
+        multithread=True,
+        warpOptions=["NUM_CHUNKS_IN_FLIGHT=4"],
+    )
+    assert [
+        out_ds.GetRasterBand(i + 1).Checksum() for i in range(out_ds.RasterCount)
+    ] == [ref_ds.GetRasterBand(i + 1).Checksum() for i in range(ref_ds.RasterCount)]
+
+
+@gdaltest.enable_exceptions()
+def test_warp_multi_num_chunks_in_flight_errors(tmp_vsimem):
+
+    filename1 = str(tmp_vsimem / "tmp1.tif")
+    ds = gdal.GetDriverByName("GTiff").Create(filename1, 1, 1)
+    ds.SetGeoTransform([2, 1, 0, 49, 0, -1])
+    ds.Close()
+
+    filename2 = str(tmp_vsimem / "tmp2.tif")
+    ds = gdal.GetDriverByName("GTiff").Create(filename2, 1, 1)
+    ds.SetGeoTransform([3, 1, 0, 49, 0, -1])
+    ds.Close()
+
+    vrt_filename = str(tmp_vsimem / "tmp.vrt")
+    gdal.BuildVRT(vrt_filename, [filename1, filename2])
+
+    gdal.Unlink(filename2)
+
+    with gdal.Open(vrt_filename) as ds:
+        with pytest.raises(Exception):
+            gdal.Warp(
+                "",
+                ds,
+                format="MEM",
+                multithread=True,
+                warpOptions=["NUM_CHUNKS_IN_FLIGHT=4"],
+            )
+
+
 ###############################################################################
 
 
@@ -2302,3 +2373,55 @@ def test_warp_zero_sized_target_extent():
     )
     assert out_ds.RasterXSize == 1
     assert out_ds.RasterYSize == 1
+
+
+###############################################################################
+# Test the separable resampling used when downsampling with a transformation
+# that is a scaling and a translation, against the general code path
+
+
+@pytest.mark.parametrize("resampling", ["bilinear", "cubic", "cubicspline", "lanczos"])
+@pytest.mark.parametrize(
+    "dt", [gdal.GDT_UInt8, gdal.GDT_Int16, gdal.GDT_Float32, gdal.GDT_Float64]
+)
+def test_warp_downsampling_affine_separable(resampling, dt):
+
+    gdaltest.importorskip_gdal_array()
+    numpy = pytest.importorskip("numpy")
+
+    src_ds = gdal.Translate(
+        "",
+        "../gcore/data/byte.tif",
+        format="MEM",
+        outputType=dt,
+        width=203,
+        height=187,
+        resampleAlg="bilinear",
+    )
+    src_ds.AddBand(dt)
+    src_ds.GetRasterBand(2).WriteArray(255 - src_ds.GetRasterBand(1).ReadAsArray())
+
+    def warp():
+        return gdal.Warp(
+            "",
+            src_ds,
+            format="MEM",
+            outputBounds=[440780, 3750400, 441890, 3751300],
+            xRes=60 * 1.37,
+            yRes=60 * 2.61,
+            resampleAlg=resampling,
+        )
+
+    out_ds = warp()
+    with gdaltest.config_option("GDAL_WARP_USE_AFFINE_OPTIMIZATION", "NO"):
+        ref_ds = warp()
+
+    assert out_ds.RasterXSize == ref_ds.RasterXSize
+    assert out_ds.RasterYSize == ref_ds.RasterYSize
+    for i in range(2):
+        got = out_ds.GetRasterBand(i + 1).ReadAsArray().astype(numpy.float64)
+        expected = ref_ds.GetRasterBand(i + 1).ReadAsArray().astype(numpy.float64)
+        if dt in (gdal.GDT_Float32, gdal.GDT_Float64):
+            assert numpy.allclose(got, expected, rtol=1e-5, atol=1e-5)
+        else:
+            assert numpy.max(numpy.abs(got - expected)) <= 1
@@ -38,12 +38,14 @@
 #include "cpl_http.h"
 #include "cpl_auto_close.h"
 #include "cpl_minixml.h"
+#include "cpl_packed_rtree.h"
 #include "cpl_quad_tree.h"
 #include "cpl_spawn.h"
 #include "cpl_worker_thread_pool.h"
 #include "cpl_vsi_virtual.h"
 #include "cpl_threadsafe_queue.hpp"
 
+#include <algorithm>
 #include <atomic>
 #include <cmath>
 #include <limits>
@@ -3918,6 +3920,127 @@ TEST_F(test_cpl, CPLQuadTree)
     CPLQuadTreeDestroy(hTree);
 }
 
+// Test CPLPackedRTree
+TEST_F(test_cpl, CPLPackedRTree)
+{
+    unsigned next = 0;
+    constexpr int MAX_RAND_VAL = 32767;
+    const auto DummyRand = [&]()
+    {
+        next = next * 1103515245 + 12345;
+        return ((unsigned)(next / 65536) % (MAX_RAND_VAL + 1));
+    };
+
+    const auto GenerateRandomRect = [&](CPLRectObj &rect, double dfMaxSize)
+    {
+        rect.minx = double(DummyRand()) / MAX_RAND_VAL;
+        rect.miny = double(DummyRand()) / MAX_RAND_VAL;
+        rect.maxx = rect.minx + double(DummyRand()) / MAX_RAND_VAL * dfMaxSize;
+        rect.maxy = rect.miny + double(DummyRand()) / MAX_RAND_VAL * dfMaxSize;
+    };
+
+    const auto Overlaps = [](const CPLRectObj &a, const CPLRectObj &b)
+    {
+        return !(a.minx > b.maxx || a.maxx < b.minx || a.miny > b.maxy ||
+                 a.maxy < b.miny);
+    };
+
+    {
+        auto hTree = CPLPackedRTreeCreate(nullptr);
+        ASSERT_TRUE(hTree != nullptr);
+        CPLRectObj globalbounds = {0, 0, 1, 1};
+        int nFeatureCount = -1;
+        EXPECT_EQ(CPLPackedRTreeSearch(hTree, &globalbounds, &nFeatureCount),
+                  nullptr);
+        EXPECT_EQ(nFeatureCount, 0);
+        EXPECT_FALSE(CPLPackedRTreeHasMatch(hTree, &globalbounds));
+        CPLPackedRTreeDestroy(hTree);
+    }
+
+    // Features are pointers to their bounds
+    const auto GetBounds = [](const void *hFeature, CPLRectObj *pBounds)
+    { *pBounds = *static_cast<const CPLRectObj *>(hFeature); };
+
+    for (bool bWithGetBounds : {false, true})
+    {
+        for (int nNodeCapacity : {2, 3, 16})
+        {
+            for (int nFeatures : {1, 15, 16, 17, 1000})
+            {
+                auto hTree = CPLPackedRTreeCreate(
+                    bWithGetBounds ? static_cast<CPLQuadTreeGetBoundsFunc>(
+                                         GetBounds)
+                                   : nullptr);
+                CPLPackedRTreeSetNodeCapacity(hTree, nNodeCapacity);
+
+                std::vector<CPLRectObj> asBounds(nFeatures);
+                for (int i = 0; i < nFeatures; i++)
+                {
+                    GenerateRandomRect(asBounds[i], 0.05);
+                    if (bWithGetBounds)
+                        CPLPackedRTreeInsert(hTree, &asBounds[i]);
+                    else
+                        CPLPackedRTreeInsertWithBounds(hTree, &asBounds[i],
+                                                       &asBounds[i]);
+                }
+                EXPECT_EQ(CPLPackedRTreeGetFeatureCount(hTree), nFeatures);
+                if (nFeatures > 1)
+                    CPLPackedRTreeBuild(hTree);
+
+                std::vector<CPLRectObj> asAois(300);
+                for (auto &sAoi : asAois)
+                    GenerateRandomRect(sAoi, 0.2);
+
+                for (const auto &sAoi : asAois)
+                {
+                    std::vector<void *> apahExpected;
+                    for (int i = 0; i < nFeatures; i++)
+                    {
+                        if (Overlaps(asBounds[i], sAoi))
+                            apahExpected.push_back(&asBounds[i]);
+                    }
+
+                    // Features are returned in an unspecified order
+                    int nFeatureCount = 0;
+                    void **pahFeatures =
+                        CPLPackedRTreeSearch(hTree, &sAoi, &nFeatureCount);
+                    std::vector<void *> apahGot(pahFeatures,
+                                                pahFeatures + nFeatureCount);
+                    CPLFree(pahFeatures);
+                    std::sort(apahGot.begin(), apahGot.end());
+                    EXPECT_EQ(apahGot, apahExpected);
+
+                    EXPECT_EQ(CPLPackedRTreeHasMatch(hTree, &sAoi),
+                              !apahExpected.empty());
+                }
+
+                CPLWorkerThreadPool oPool;
+                ASSERT_TRUE(oPool.Setup(4, nullptr, nullptr));
+                for (CPLWorkerThreadPool *poPool :
+                     {static_cast<CPLWorkerThreadPool *>(nullptr), &oPool})
+                {
+                    std::vector<CPLRectObj> asManyAois(asAois);
+                    for (int k = 0; k < 10; ++k)
+                        asManyAois.insert(asManyAois.end(), asAois.begin(),
+                                          asAois.end());
+                    const auto aapahFeatures =
+                        CPLPackedRTreeSearchBatch(hTree, asManyAois, poPool);
+                    ASSERT_EQ(aapahFeatures.size(), asManyAois.size());
+                    for (size_t i = 0; i < asManyAois.size(); ++i)
+                    {
+                        std::vector<void *> apahFeatures;
+                        CPLPackedRTreeSearch(hTree, asManyAois[i],
+                                             apahFeatures);
+                        EXPECT_EQ(aapahFeatures[i], apahFeatures);
+                    }
+                }
+
+                CPLPackedRTreeDestroy(hTree);
+            }
+        }
+    }
+}
+
 // Test bUnlinkAndSize on VSIGetMemFileBuffer
 TEST_F(test_cpl, VSIGetMemFileBuffer_unlink_and_size)
 {
@@ -4463,6 +4586,59 @@ TEST_F(test_cpl, CPLWorkerThreadPool_recursion)
     ASSERT_EQ(ctxt.nCounter, 3 * 3);
 }
 
+// Test CPLWorkerThreadPool work-stealing mode
+TEST_F(test_cpl, CPLWorkerThreadPool_work_stealing)
+{
+    CPLWorkerThreadPool oPool;
+    oPool.SetWorkStealing(true);
+    ASSERT_TRUE(oPool.IsWorkStealing());
+    ASSERT_TRUE(oPool.Setup(3, nullptr, nullptr, false));
+
+    // Each job waits for nested jobs, themselves waiting for nested jobs:
+    // waiting worker threads must run pending jobs for this to complete.
+    std::function<int(int)> sum;
+    sum = [&oPool, &sum](int nDepth) -> int
+    {
+        if (nDepth == 0)
+            return 1;
+        std::vector<int> anRes(4);
+        auto poQueue = oPool.CreateJobQueue();
+        for (int i = 0; i < 4; ++i)
+        {
+            poQueue->SubmitJob([&anRes, &sum, i, nDepth]
+                               { anRes[i] = sum(nDepth - 1); });
+        }
+        poQueue->WaitCompletion();
+        return anRes[0] + anRes[1] + anRes[2] + anRes[3];
+    };
+
+    {
+        std::atomic<int> nTotal{0};
+        auto poQueue = oPool.CreateJobQueue();
+        for (int i = 0; i < 8; ++i)
+            poQueue->SubmitJob([&nTotal, &sum] { nTotal += sum(4); });
+        poQueue->WaitCompletion();
+        ASSERT_EQ(nTotal, 8 * 4 * 4 * 4 * 4);
+    }
+
+    {
+        std::vector<int> res(1000);
+        std::vector<void *> resPtr(1000);
+        for (int i = 0; i < 1000; i++)
+        {
+            res[i] = i;
+            resPtr[i] = res.data() + i;
+        }
+        oPool.SubmitJobs([](void *pData) { (*static_cast<int *>(pData))++; },
+                         resPtr);
+        oPool.WaitCompletion();
+        for (int i = 0; i < 1000; i++)
+        {
+            ASSERT_EQ(res[i], i + 1);
+        }
+    }
+}
+
 // Test /vsimem/ PRead() implementation
 TEST_F(test_cpl, vsimem_pread)
 {
@@ -6119,6 +6119,224 @@ TEST_F(test_gdal, GDALRasterBand_arithmetic_operators)
         std::runtime_error);
 }
 
+// Test that the fused evaluation of GDALComputedRasterBand expression trees
+// gives the same results as the evaluation through nested VRT datasets
+TEST_F(test_gdal, GDALRasterBand_arithmetic_operators_fused)
+{
+    constexpr int WIDTH = 301;
+    constexpr int HEIGHT = 703;
+    auto poByteDS = std::unique_ptr<GDALDataset, GDALDatasetUniquePtrReleaser>(
+        MEMDataset::Create("", WIDTH, HEIGHT, 1, GDT_Byte, nullptr));
+    auto poFloat32DS =
+        std::unique_ptr<GDALDataset, GDALDatasetUniquePtrReleaser>(
+            MEMDataset::Create("", WIDTH, HEIGHT, 1, GDT_Float32, nullptr));
+    auto poFloat64DS =
+        std::unique_ptr<GDALDataset, GDALDatasetUniquePtrReleaser>(
+            MEMDataset::Create("", WIDTH, HEIGHT, 1, GDT_Float64, nullptr));
+    {
+        std::vector<GByte> abyVals(WIDTH * HEIGHT);
+        std::vector<float> afVals(WIDTH * HEIGHT);
+        std::vector<double> adfVals(WIDTH * HEIGHT);
+        for (int i = 0; i < WIDTH * HEIGHT; ++i)
+        {
+            abyVals[i] = static_cast<GByte>((i * 7) % 256);
+            afVals[i] = static_cast<float>(i % 1000) / 7.0f - 50.0f;
+            adfVals[i] = static_cast<double>((i * 13) % 2000) / 3.0 - 100.0;
+        }
+        ASSERT_EQ(poByteDS->GetRasterBand(1)->RasterIO(
+                      GF_Write, 0, 0, WIDTH, HEIGHT, abyVals.data(), WIDTH,
+                      HEIGHT, GDT_Byte, 0, 0, nullptr),
+                  CE_None);
+        ASSERT_EQ(poFloat32DS->GetRasterBand(1)->RasterIO(
+                      GF_Write, 0, 0, WIDTH, HEIGHT, afVals.data(), WIDTH,
+                      HEIGHT, GDT_Float32, 0, 0, nullptr),
+                  CE_None);
+        ASSERT_EQ(poFloat64DS->GetRasterBand(1)->RasterIO(
+                      GF_Write, 0, 0, WIDTH, HEIGHT, adfVals.data(), WIDTH,
+                      HEIGHT, GDT_Float64, 0, 0, nullptr),
+                  CE_None);
+    }
+    auto &a = *(poByteDS->GetRasterBand(1));
+    auto &b = *(poFloat32DS->GetRasterBand(1));
+    auto &c = *(poFloat64DS->GetRasterBand(1));
+
+    const auto ExpectClose = [](double dfGot, double dfExpected, int i)
+    {
+        if (std::isnan(dfExpected))
+        {
+            EXPECT_TRUE(std::isnan(dfGot)) << i;
+        }
+        else if (std::isinf(dfExpected))
+        {
+            EXPECT_EQ(dfGot, dfExpected) << i;
+        }
+        else
+        {
+            EXPECT_NEAR(dfGot, dfExpected,
+                        1e-12 * std::max(1.0, std::fabs(dfExpected)))
+                << i;
+        }
+    };
+
+    const auto Check = [&ExpectClose](GDALComputedRasterBand &&band)
+    {
+        std::vector<double> adfExpected(WIDTH * HEIGHT);
+        {
+            CPLConfigOptionSetter oSetter("GDAL_COMPUTED_RASTER_BAND_FUSED",
+                                          "NO", false);
+            ASSERT_EQ(band.RasterIO(GF_Read, 0, 0, WIDTH, HEIGHT,
+                                    adfExpected.data(), WIDTH, HEIGHT,
+                                    GDT_Float64, 0, 0, nullptr),
+                      CE_None);
+        }
+
+        CPLConfigOptionSetter oSetter("GDAL_NUM_THREADS", "4", false);
+
+        std::vector<double> adfGot(WIDTH * HEIGHT);
+        ASSERT_EQ(band.RasterIO(GF_Read, 0, 0, WIDTH, HEIGHT, adfGot.data(),
+                                WIDTH, HEIGHT, GDT_Float64, 0, 0, nullptr),
+                  CE_None);
+        for (int i = 0; i < WIDTH * HEIGHT; ++i)
+        {
+            ExpectClose(adfGot[i], adfExpected[i], i);
+        }
+
+        // Sub-window read into a buffer of the band data type
+        if (band.GetRasterDataType() == GDT_Byte)
+        {
+            constexpr int XOFF = 17;
+            constexpr int YOFF = 23;
+            constexpr int XSIZE = 100;
+            constexpr int YSIZE = 50;
+            std::vector<GByte> abyGot(XSIZE * YSIZE);
+            ASSERT_EQ(band.RasterIO(GF_Read, XOFF, YOFF, XSIZE, YSIZE,
+                                    abyGot.data(), XSIZE, YSIZE, GDT_Byte, 0,
+                                    0, nullptr),
+                      CE_None);
+            for (int j = 0; j < YSIZE; ++j)
+            {
+                for (int i = 0; i < XSIZE; ++i)
+                {
+                    EXPECT_EQ(abyGot[j * XSIZE + i],
+                              adfExpected[(j + YOFF) * WIDTH + i + XOFF]);
+                }
+            }
+        }
+
+        // Block reading
+        int nBlockXSize = 0;
+        int nBlockYSize = 0;
+        band.GetBlockSize(&nBlockXSize, &nBlockYSize);
+        const int nDTSize = GDALGetDataTypeSizeBytes(band.GetRasterDataType());
+        std::vector<GByte> abyBlock(static_cast<size_t>(nBlockXSize) *
+                                    nBlockYSize * nDTSize);
+        ASSERT_EQ(band.ReadBlock(0, 0, abyBlock.data()), CE_None);
+        std::vector<double> adfBlock(static_cast<size_t>(nBlockXSize) *
+                                     nBlockYSize);
+        GDALCopyWords64(abyBlock.data(), band.GetRasterDataType(), nDTSize,
+                        adfBlock.data(), GDT_Float64, sizeof(double),
+                        adfBlock.size());
+        for (int i = 0; i < nBlockXSize && i < WIDTH; ++i)
+        {
+            ExpectClose(adfBlock[i], adfExpected[i], i);
+        }
+    };
+
+    Check(a + b * c - 3);
+    Check((a + b) / c);
+    Check(a / 0.5 + 2 / b);
+    Check((a * 3).AsType(GDT_Byte));
+    Check((b * c + a).AsType(GDT_Int16) + 0.25);
+    Check(gdal::min(a, b, c));
+    Check(gdal::max(a, 100, b, c));
+    Check(gdal::mean(a, b, c));
+    Check(gdal::abs(b) + gdal::sqrt(a) + gdal::log10(c));
+    Check(gdal::pow(a, 0.5) * gdal::pow(2.0, b / 100));
+#ifdef HAVE_MUPARSER
+    Check(gdal::IfThenElse(a > b, b * 2, c - a));
+    Check((a >= 128) && (b < 0 || c != 0));
+    Check(gdal::log(a + 1) + gdal::pow(a, b / 100));
+#endif
+}
+
+// Test that the fused evaluation of the mean gives exactly the same integer
+// values as the evaluation through nested VRT datasets
+TEST_F(test_gdal, GDALRasterBand_arithmetic_operators_fused_mean_integer)
+{
+    constexpr int WIDTH = 256;
+    constexpr int HEIGHT = 64;
+    constexpr int BAND_COUNT = 6;
+    auto poByteDS = std::unique_ptr<GDALDataset, GDALDatasetUniquePtrReleaser>(
+        MEMDataset::Create("", WIDTH, HEIGHT, BAND_COUNT, GDT_Byte, nullptr));
+    auto poInt16DS =
+        std::unique_ptr<GDALDataset, GDALDatasetUniquePtrReleaser>(
+            MEMDataset::Create("", WIDTH, HEIGHT, BAND_COUNT, GDT_Int16,
+                               nullptr));
+    for (int iBand = 1; iBand <= BAND_COUNT; ++iBand)
+    {
+        // Values chosen so that many means are exactly halfway between two
+        // integers
+        std::vector<GInt16> anVals(WIDTH * HEIGHT);
+        for (int i = 0; i < WIDTH * HEIGHT; ++i)
+        {
+            anVals[i] =
+                static_cast<GInt16>(((i * (2 * iBand + 1)) >> iBand) % 256);
+        }
+        ASSERT_EQ(poByteDS->GetRasterBand(iBand)->RasterIO(
+                      GF_Write, 0, 0, WIDTH, HEIGHT, anVals.data(), WIDTH,
+                      HEIGHT, GDT_Int16, 0, 0, nullptr),
+                  CE_None);
+        for (auto &nVal : anVals)
+            nVal = static_cast<GInt16>(nVal * 131 - 16000);
+        ASSERT_EQ(poInt16DS->GetRasterBand(iBand)->RasterIO(
+                      GF_Write, 0, 0, WIDTH, HEIGHT, anVals.data(), WIDTH,
+                      HEIGHT, GDT_Int16, 0, 0, nullptr),
+                  CE_None);
+    }
+
+    const auto Check = [](GDALComputedRasterBand &&band)
+    {
+        const GDALDataType eDT = band.GetRasterDataType();
+        const int nDTSize = GDALGetDataTypeSizeBytes(eDT);
+        std::vector<GByte> abyExpected(WIDTH * HEIGHT * nDTSize);
+        {
+            CPLConfigOptionSetter oSetter("GDAL_COMPUTED_RASTER_BAND_FUSED",
+                                          "NO", false);
+            ASSERT_EQ(band.RasterIO(GF_Read, 0, 0, WIDTH, HEIGHT,
+                                    abyExpected.data(), WIDTH, HEIGHT, eDT,
+                                    0, 0, nullptr),
+                      CE_None);
+        }
+        std::vector<GByte> abyGot(WIDTH * HEIGHT * nDTSize);
+        ASSERT_EQ(band.RasterIO(GF_Read, 0, 0, WIDTH, HEIGHT, abyGot.data(),
+                                WIDTH, HEIGHT, eDT, 0, 0, nullptr),
+                  CE_None);
+        EXPECT_TRUE(abyGot == abyExpected);
+    };
+
+    auto &a = *(poByteDS->GetRasterBand(1));
+    auto &b = *(poByteDS->GetRasterBand(2));
+    auto &c = *(poByteDS->GetRasterBand(3));
+    auto &d = *(poByteDS->GetRasterBand(4));
+    auto &e = *(poByteDS->GetRasterBand(5));
+    auto &f = *(poByteDS->GetRasterBand(6));
+    Check(gdal::mean(a, b));
+    Check(gdal::mean(a, b, c));
+    Check(gdal::mean(a, b, c, d));
+    Check(gdal::mean(a, b, c, d, e, f));
+    Check(gdal::mean(a, b, c, d, e, f) + gdal::mean(a, b));
+
+    auto &g = *(poInt16DS->GetRasterBand(1));
+    auto &h = *(poInt16DS->GetRasterBand(2));
+    auto &i = *(poInt16DS->GetRasterBand(3));
+    auto &j = *(poInt16DS->GetRasterBand(4));
+    auto &k = *(poInt16DS->GetRasterBand(5));
+    auto &l = *(poInt16DS->GetRasterBand(6));
+    Check(gdal::mean(g, h, i));
+    Check(gdal::mean(g, h, i, j, k, l));
+    Check(gdal::mean(a, g, b, h));
+}
+
 TEST_F(test_gdal, GDALRasterBand_window_iterator)
 {
     GDALDriver *poDrv = GetGDALDriverManager()->GetDriverByName("GTiff");
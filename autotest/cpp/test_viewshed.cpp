@@ -11,7 +11,9 @@
 
 #include <algorithm>
 #include <array>
+#include <cmath>
 #include <utility>
+#include <vector>
 
 #include <iomanip>
 
@@ -1155,5 +1157,55 @@ TEST(Viewshed, sd_2)
     }
 }
 
+// Test that the result doesn't depend on the number of threads.
+TEST(Viewshed, num_threads)
+{
+    const int xlen = 401;
+    const int ylen = 257;
+    std::vector<int8_t> in(xlen * ylen);
+    std::vector<double> inSd(xlen * ylen);
+    std::vector<double> sd(xlen * ylen);
+    for (int y = 0; y < ylen; ++y)
+        for (int x = 0; x < xlen; ++x)
+        {
+            const size_t i = static_cast<size_t>(y) * xlen + x;
+            in[i] = static_cast<int8_t>(
+                40 * std::sin(x * 0.07) * std::cos(y * 0.05) + (x + y) % 7);
+            inSd[i] = in[i];
+            sd[i] = ((x * 3 + y * 5) % 4) * 0.5;
+        }
+
+    const auto runWithThreads = [&](OutputMode mode, bool withSd,
+                                    int numThreads)
+    {
+        Options opts = stdOptions(123, 97);
+        opts.outputMode = mode;
+        opts.observer.z = 10;
+        opts.maxDistance = 250;
+        opts.numThreads = numThreads;
+        DatasetPtr ds =
+            withSd
+                ? runViewshed(inSd.data(), sd.data(), xlen, ylen, opts)
+                : runViewshed(in.data(), xlen, ylen, opts);
+        std::vector<double> out(xlen * ylen);
+        CPLErr err = ds->GetRasterBand(1)->RasterIO(
+            GF_Read, 0, 0, xlen, ylen, out.data(), xlen, ylen, GDT_Float64, 0,
+            0, nullptr);
+        EXPECT_EQ(err, CE_None);
+        return out;
+    };
+
+    for (OutputMode mode :
+         {OutputMode::Normal, OutputMode::DEM, OutputMode::Ground})
+    {
+        const auto expected = runWithThreads(mode, false, 1);
+        EXPECT_EQ(runWithThreads(mode, false, 3), expected);
+        EXPECT_EQ(runWithThreads(mode, false, 8), expected);
+    }
+
+    const auto expected = runWithThreads(OutputMode::Normal, true, 1);
+    EXPECT_EQ(runWithThreads(OutputMode::Normal, true, 8), expected);
+}
+
 }  // namespace viewshed
 }  // namespace gdal
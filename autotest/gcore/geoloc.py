@@ -627,3 +627,100 @@ def test_geoloc_normalize_longitude():
         transformerOptions=["GEOLOC_NORMALIZE_LONGITUDE_MINUS_180_PLUS_180=YES"],
     )
     assert struct.unpack("f", warped_ds.ReadRaster(2, 0, 1, 1)) == (12.0,)
+
+
+###############################################################################
+# Test multithreaded backmap/quadtree construction and backmap caching
+
+
+def _create_noisy_geoloc_dataset(tmp_vsimem, size):
+
+    r = random.Random(0)
+    geoloc_filename = str(tmp_vsimem / "geoloc.tif")
+    geoloc_ds = gdal.GetDriverByName("GTiff").Create(
+        geoloc_filename, size, size, 2, gdal.GDT_Float64
+    )
+    for y in range(size):
+        lon = array.array(
+            "d", [-80 + 0.01 * x + r.uniform(-0.002, 0.002) for x in range(size)]
+        )
+        lat = array.array(
+            "d", [50 - 0.01 * y + r.uniform(-0.002, 0.002) for x in range(size)]
+        )
+        geoloc_ds.GetRasterBand(1).WriteRaster(0, y, size, 1, lon)
+        geoloc_ds.GetRasterBand(2).WriteRaster(0, y, size, 1, lat)
+    geoloc_ds = None
+
+    ds = gdal.GetDriverByName("MEM").Create("", size, size)
+    md = {
+        "LINE_OFFSET": "0",
+        "LINE_STEP": "1",
+        "PIXEL_OFFSET": "0",
+        "PIXEL_STEP": "1",
+        "X_DATASET": geoloc_filename,
+        "X_BAND": "1",
+        "Y_DATASET": geoloc_filename,
+        "Y_BAND": "2",
+        "SRS": "EPSG:4326",
+    }
+    ds.SetMetadata(md, "GEOLOCATION")
+    return ds
+
+
+def _inverse_transform_grid(tr, size):
+
+    res = []
+    for j in range(0, size + 1, 7):
+        for i in range(0, size + 1, 7):
+            res.append(tr.TransformPoint(True, -80 + 0.01 * i, 50 - 0.01 * j))
+    return res
+
+
+@pytest.mark.parametrize("inverse_method", ["BACKMAP", "QUADTREE"])
+def test_geoloc_multithreaded(tmp_vsimem, inverse_method):
+
+    size = 300
+    ds = _create_noisy_geoloc_dataset(tmp_vsimem, size)
+
+    res = []
+    with gdaltest.config_option("GDAL_GEOLOC_INVERSE_METHOD", inverse_method):
+        for num_threads in ("1", "4"):
+            tr = gdal.Transformer(ds, None, ["NUM_THREADS=" + num_threads])
+            res.append(_inverse_transform_grid(tr, size))
+    assert res[0] == res[1]
+
+
+@pytest.mark.parametrize("use_temp_datasets", ["YES", "NO"])
+def test_geoloc_backmap_cache(tmp_vsimem, use_temp_datasets):
+
+    size = 50
+    ds = _create_noisy_geoloc_dataset(tmp_vsimem, size)
+
+    cache_dir = tmp_vsimem / "cache"
+    gdal.Mkdir(cache_dir, 0o755)
+    options = [
+        "GEOLOC_BACKMAP_CACHE_DIR=" + str(cache_dir),
+        "GEOLOC_USE_TEMP_DATASETS=" + use_temp_datasets,
+    ]
+
+    ref = _inverse_transform_grid(gdal.Transformer(ds, None, options[1:]), size)
+
+    res = _inverse_transform_grid(gdal.Transformer(ds, None, options), size)
+    assert res == ref
+    files = gdal.ReadDir(cache_dir)
+    assert len(files) == 1
+    assert files[0].startswith("geoloc_backmap_")
+
+    # Second time, the cached backmap is used
+    res = _inverse_transform_grid(gdal.Transformer(ds, None, options), size)
+    assert res == ref
+    assert gdal.ReadDir(cache_dir) == files
+
+    # Different parameters result in a different cache file
+    _inverse_transform_grid(
+        gdal.Transformer(
+            ds, None, options + ["GEOLOC_BACKMAP_OVERSAMPLE_FACTOR=1.5"]
+        ),
+        size,
+    )
+    assert len(gdal.ReadDir(cache_dir)) == 2
@@ -1091,6 +1091,90 @@ def test_pixfun_norm_diff_r():
     assert numpy.allclose(data, (refdata1 - refdata2) / (refdata1 + refdata2))
 
 
+###############################################################################
+# Verify arithmetic pixel functions with NoData on lines longer than the
+# chunks of values they are processed by
+
+
+@pytest.mark.parametrize("src_type", ["UInt16", "Int32", "Float32", "Float64"])
+@pytest.mark.parametrize("buf_type", [gdal.GDT_Float32, gdal.GDT_Float64])
+@pytest.mark.parametrize(
+    "pixfn,args",
+    [
+        ("diff", ""),
+        ("div", ""),
+        ("norm_diff", ""),
+        ("mul", ""),
+        ("mul", 'propagateNoData="true"'),
+        ("sum", 'k="0.5"'),
+        ("sum", 'propagateNoData="true"'),
+    ],
+)
+def test_pixfun_arith_nodata_long_lines(
+    tmp_vsimem, src_type, buf_type, pixfn, args
+):
+
+    nodata = 7
+    width = 601
+    a = (numpy.arange(3 * width) % 11).reshape(3, width)
+    b = (numpy.arange(3 * width) * 3 % 13).reshape(3, width)
+
+    src_filename = tmp_vsimem / "src.tif"
+    with gdal.GetDriverByName("GTiff").Create(
+        src_filename, width, 3, 2, gdal.GetDataTypeByName(src_type)
+    ) as src_ds:
+        src_ds.GetRasterBand(1).WriteArray(a)
+        src_ds.GetRasterBand(2).WriteArray(b)
+
+    sources = "".join(
+        f"""<SimpleSource>
+          <SourceFilename>{src_filename}</SourceFilename>
+          <SourceBand>{band}</SourceBand>
+        </SimpleSource>"""
+        for band in (1, 2)
+    )
+    xml = f"""
+    <VRTDataset rasterXSize="{width}" rasterYSize="3">
+      <VRTRasterBand dataType="Float64" band="1" subClass="VRTDerivedRasterBand">
+        <NoDataValue>{nodata}</NoDataValue>
+        <PixelFunctionType>{pixfn}</PixelFunctionType>
+        <PixelFunctionArguments {args} />
+        <SourceTransferType>{src_type}</SourceTransferType>
+        {sources}
+      </VRTRasterBand>
+    </VRTDataset>"""
+
+    data = gdal.Open(xml).GetRasterBand(1).ReadAsArray(buf_type=buf_type)
+
+    a = a.astype(numpy.float64)
+    b = b.astype(numpy.float64)
+    any_nodata = (a == nodata) | (b == nodata)
+    with numpy.errstate(divide="ignore", invalid="ignore"):
+        if pixfn == "diff":
+            expected = numpy.where(any_nodata, nodata, a - b)
+        elif pixfn == "div":
+            expected = numpy.where(b == 0, numpy.inf, a / b)
+            expected = numpy.where(any_nodata, nodata, expected)
+        elif pixfn == "norm_diff":
+            expected = numpy.where(a + b == 0, numpy.inf, (a - b) / (a + b))
+            expected = numpy.where(any_nodata, nodata, expected)
+        elif pixfn == "mul":
+            expected = numpy.where(a == nodata, 1, a) * numpy.where(
+                b == nodata, 1, b
+            )
+        else:
+            expected = (
+                (0.5 if "k=" in args else 0)
+                + numpy.where(a == nodata, 0, a)
+                + numpy.where(b == nodata, 0, b)
+            )
+    if "propagateNoData" in args:
+        expected = numpy.where(any_nodata, nodata, expected)
+
+    np_type = numpy.float32 if buf_type == gdal.GDT_Float32 else numpy.float64
+    numpy.testing.assert_array_equal(data, expected.astype(np_type))
+
+
 ###############################################################################
 # Verify linear pixel interpolation
 
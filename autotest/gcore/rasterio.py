@@ -3898,3 +3898,128 @@ def test_rasterio_gdt_unknown():
         # Caught at the SWIG level
         with pytest.raises(Exception, match="Illegal value for data type"):
             ds.GetRasterBand(1).ReadRaster(buf_type=gdal.GDT_Unknown)
+
+
+###############################################################################
+# Test GDALDatasetCopyWholeRaster() with reading and writing overlapped
+
+
+@pytest.mark.parametrize("interleave", ["PIXEL", "BAND"])
+@pytest.mark.parametrize("overlap_io", ["YES", "NO"])
+def test_rasterio_copy_whole_raster_overlap_io(tmp_vsimem, interleave, overlap_io):
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", 1000, 1500, 3)
+    for i in range(3):
+        src_ds.GetRasterBand(i + 1).WriteRaster(
+            0, 0, 1000, 1500, bytes(((x * (i + 1)) % 251) for x in range(1500000))
+        )
+
+    pct = []
+
+    def my_progress(p, msg, user_data):
+        pct.append(p)
+        return True
+
+    out_filename = str(tmp_vsimem / "out.tif")
+    # Small swaths, so that there are several of them
+    with gdal.config_options(
+        {
+            "GDAL_SWATH_SIZE": "1000000",
+            "GDAL_NUM_THREADS": "2",
+            "GDAL_COPY_WHOLE_RASTER_OVERLAP_IO": overlap_io,
+        }
+    ):
+        out_ds = gdal.GetDriverByName("GTiff").CreateCopy(
+            out_filename,
+            src_ds,
+            options=["COMPRESS=DEFLATE", "TILED=YES", "INTERLEAVE=" + interleave],
+            callback=my_progress,
+        )
+
+    assert pct == sorted(pct)
+    assert pct[-1] == 1.0
+    assert out_ds.ReadRaster() == src_ds.ReadRaster()
+
+
+###############################################################################
+# Test MODE resampling on small windows of Byte and UInt16 data (which may use
+# an AVX2 code path), against a reference implementation
+
+
+@pytest.mark.parametrize("dt", [gdal.GDT_Byte, gdal.GDT_UInt16])
+@pytest.mark.parametrize("factor", [2, 3, 4, 8])
+@pytest.mark.parametrize("nodata", [None, 3])
+def test_rasterio_mode_small_windows(dt, factor, nodata):
+
+    size = 8 * factor
+    # Few distinct values so that there are ties
+    vals = [((x * 7 + (x // size) * 13) % 11) % 5 for x in range(size * size)]
+    if dt == gdal.GDT_UInt16:
+        vals = [v * 1000 for v in vals]
+        if nodata is not None:
+            nodata *= 1000
+    fmt = "B" if dt == gdal.GDT_Byte else "H"
+
+    ds = gdal.GetDriverByName("MEM").Create("", size, size, 1, dt)
+    if nodata is not None:
+        ds.GetRasterBand(1).SetNoDataValue(nodata)
+    ds.WriteRaster(0, 0, size, size, struct.pack(fmt * (size * size), *vals))
+
+    expected = []
+    for j in range(8):
+        for i in range(8):
+            counts = {}
+            best = None
+            for y in range(j * factor, (j + 1) * factor):
+                for x in range(i * factor, (i + 1) * factor):
+                    v = vals[y * size + x]
+                    if v == nodata:
+                        continue
+                    counts[v] = counts.get(v, 0) + 1
+                    if best is None or counts[v] > counts[best]:
+                        best = v
+            expected.append(nodata if best is None else best)
+
+    for use_avx2 in ("NO", "YES"):
+        with gdal.config_option("GDAL_USE_AVX2", use_avx2):
+            data = ds.GetRasterBand(1).ReadRaster(
+                0, 0, size, size, 8, 8, resample_alg=gdal.GRIORA_Mode
+            )
+        assert list(struct.unpack(fmt * 64, data)) == expected
+
+
+###############################################################################
+# Test that GAUSS resampling gives the same result with and without AVX2
+
+
+@pytest.mark.parametrize("factor", [2, 4, 7])
+def test_rasterio_gauss_avx2(factor):
+
+    size = 9 * factor + 1
+    ds = gdal.GetDriverByName("MEM").Create("", size, size, 1, gdal.GDT_UInt16)
+    ds.WriteRaster(
+        0,
+        0,
+        size,
+        size,
+        struct.pack(
+            "H" * (size * size), *[(x * 37) % 1021 for x in range(size * size)]
+        ),
+    )
+
+    res = []
+    for use_avx2 in ("NO", "YES"):
+        with gdal.config_option("GDAL_USE_AVX2", use_avx2):
+            res.append(
+                ds.GetRasterBand(1).ReadRaster(
+                    0,
+                    0,
+                    size,
+                    size,
+                    9,
+                    9,
+                    buf_type=gdal.GDT_Float64,
+                    resample_alg=gdal.GRIORA_Gauss,
+                )
+            )
+    assert res[0] == res[1]
@@ -15,6 +15,7 @@
 
 
 import math
+import struct
 
 import gdaltest
 import pytest
@@ -1220,6 +1221,64 @@ def test_transformer_dem_overrride_srs():
     gdal.Unlink("/vsimem/dem.tif")
 
 
+###############################################################################
+# Test that transforming several points at once with RPC gives the same
+# results as transforming them one at a time.
+
+
+@pytest.mark.skipif(
+    not gdaltest.vrt_has_open_support(),
+    reason="VRT driver open missing",
+)
+@pytest.mark.parametrize("method", ["near", "bilinear", "cubic"])
+def test_transformer_rpc_batch_same_as_single_point(tmp_vsimem, method):
+
+    ds = gdal.Open("data/rpc.vrt")
+    dem_filename = str(tmp_vsimem / "dem.tif")
+    ds_dem = gdal.GetDriverByName("GTiff").Create(
+        dem_filename, 100, 100, 1, gdal.GDT_Float32
+    )
+    sr = osr.SpatialReference()
+    sr.ImportFromEPSG(32652)
+    ds_dem.SetProjection(sr.ExportToWkt())
+    ds_dem.SetGeoTransform([213300, 200, 0, 4418700, 0, -200])
+    ds_dem.GetRasterBand(1).WriteRaster(
+        0,
+        0,
+        100,
+        100,
+        b"".join(
+            struct.pack("f", 10 + 5 * math.sin(i / 7.0) + (i // 100) * 0.5)
+            for i in range(100 * 100)
+        ),
+    )
+    ds_dem = None
+
+    tr = gdal.Transformer(
+        ds,
+        None,
+        [
+            "METHOD=RPC",
+            "RPC_DEM=" + dem_filename,
+            "RPC_DEMINTERPOLATION=" + method,
+        ],
+    )
+
+    points = [(x + 0.5, y * 3 + 0.25, 0) for y in range(7) for x in range(0, 20, 3)]
+
+    for direction in (0, 1):
+        batch_pnts, batch_success = tr.TransformPoints(direction, points)
+        assert any(batch_success)
+        for i, pnt in enumerate(points):
+            success, single_pnt = tr.TransformPoint(direction, *pnt)
+            assert success == batch_success[i]
+            if success:
+                assert single_pnt[0] == batch_pnts[i][0]
+                assert single_pnt[1] == batch_pnts[i][1]
+        if direction == 0:
+            points = [p for p, s in zip(batch_pnts, batch_success) if s]
+
+
 ###############################################################################
 # Test gdal.SuggestedWarpOutput
 
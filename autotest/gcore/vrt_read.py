@@ -3261,3 +3261,42 @@ def test_vrt_read_multithreaded_non_integer_coordinates_nearest_two_sources(tmp_
                 ds.GetMetadataItem("MULTI_THREADED_RASTERIO_LAST_USED", "__DEBUG__")
                 == "0"
             )
+
+
+###############################################################################
+# Test multi-threaded reading of a mosaic with more sources than the size of
+# the dataset pool
+
+
+@pytest.mark.parametrize("thread_safe", ["NO", "YES"])
+def test_vrt_read_multithreaded_dataset_pool(tmp_path, thread_safe):
+
+    if test_cli_utilities.get_gdalinfo_path() is None:
+        pytest.skip()
+
+    src_ds = gdal.Open("data/byte.tif")
+    gt = src_ds.GetGeoTransform()
+    tiles = []
+    for j in range(4):
+        for i in range(4):
+            filename = str(tmp_path / f"tile_{i}_{j}.tif")
+            ds = gdal.Translate(filename, src_ds)
+            ds.SetGeoTransform(
+                [gt[0] + i * 20 * gt[1], gt[1], 0, gt[3] + j * 20 * gt[5], 0, gt[5]]
+            )
+            ds.GetRasterBand(1).Fill(i + 4 * j + 1)
+            ds = None
+            tiles.append(filename)
+    vrt_filename = str(tmp_path / "mosaic.vrt")
+    gdal.BuildVRT(vrt_filename, tiles).Close()
+
+    with gdal.Open(vrt_filename) as ds:
+        expected_cs = ds.GetRasterBand(1).Checksum()
+
+    ret = gdaltest.runexternal(
+        test_cli_utilities.get_gdalinfo_path()
+        + f" -checksum {vrt_filename} --config GDAL_NUM_THREADS 4"
+        + " --config GDAL_MAX_DATASET_POOL_SIZE 4"
+        + f" --config GDAL_DATASET_POOL_THREAD_SAFE {thread_safe}"
+    )
+    assert f"Checksum={expected_cs}" in ret
@@ -1766,3 +1766,99 @@ def test_vsicurl_test_redirect_301_to_url_ending_slash_and_then_403(server):
             gdal.VSIStatL("/vsicurl/http://localhost:%d/test_redirect" % server.port)
             is None
         )
+
+
+###############################################################################
+# Test the persistent disk cache
+
+
+def test_vsicurl_disk_cache(server, tmp_path):
+
+    gdal.VSICurlClearCache()
+
+    cache_dir = str(tmp_path / "cache")
+
+    def get_cache_entries():
+        return [
+            x
+            for x in gdal.ReadDirRecursive(cache_dir)
+            if not x.endswith("/") and not x.endswith(".tmp")
+        ]
+
+    filename = f"/vsicurl/http://localhost:{server.port}/test_disk_cache.bin"
+
+    with gdal.config_option("CPL_VSIL_CURL_DISK_CACHE_DIR", cache_dir):
+
+        handler = webserver.SequentialHandler()
+        handler.add(
+            "HEAD",
+            "/test_disk_cache.bin",
+            200,
+            {"Content-Length": "3", "ETag": '"etag1"'},
+        )
+        handler.add(
+            "GET", "/test_disk_cache.bin", 200, {"Content-Length": "3"}, b"abc"
+        )
+        with webserver.install_http_handler(handler):
+            with gdal.VSIFile(filename, "rb") as f:
+                assert f.read() == b"abc"
+
+        assert len(get_cache_entries()) == 1
+
+        # Simulate a new process: no GET request must be issued
+        gdal.VSICurlClearCache()
+
+        handler = webserver.SequentialHandler()
+        handler.add(
+            "HEAD",
+            "/test_disk_cache.bin",
+            200,
+            {"Content-Length": "3", "ETag": '"etag1"'},
+        )
+        with webserver.install_http_handler(handler):
+            with gdal.VSIFile(filename, "rb") as f:
+                assert f.read() == b"abc"
+
+        # The remote file has been modified, and thus its ETag
+        gdal.VSICurlClearCache()
+
+        handler = webserver.SequentialHandler()
+        handler.add(
+            "HEAD",
+            "/test_disk_cache.bin",
+            200,
+            {"Content-Length": "3", "ETag": '"etag2"'},
+        )
+        handler.add(
+            "GET", "/test_disk_cache.bin", 200, {"Content-Length": "3"}, b"def"
+        )
+        with webserver.install_http_handler(handler):
+            with gdal.VSIFile(filename, "rb") as f:
+                assert f.read() == b"def"
+
+        assert len(get_cache_entries()) == 2
+
+        # Without ETag, nothing is cached on disk
+        gdal.VSICurlClearCache()
+
+        handler = webserver.SequentialHandler()
+        handler.add(
+            "HEAD", "/test_disk_cache_no_etag.bin", 200, {"Content-Length": "3"}
+        )
+        handler.add(
+            "GET",
+            "/test_disk_cache_no_etag.bin",
+            200,
+            {"Content-Length": "3"},
+            b"ghi",
+        )
+        with webserver.install_http_handler(handler):
+            with gdal.VSIFile(
+                f"/vsicurl/http://localhost:{server.port}/test_disk_cache_no_etag.bin",
+                "rb",
+            ) as f:
+                assert f.read() == b"ghi"
+
+        assert len(get_cache_entries()) == 2
+
+    gdal.VSICurlClearCache()
@@ -947,6 +947,62 @@ def test_vsizip_byte_sozip(tmp_path):
         assert len(os.listdir("/proc/self/fd")) == fds_open
 
 
+###############################################################################
+# Test multi-threaded decompression of a SOZip-enabled file
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_vsizip_sozip_multithreaded_read(tmp_vsimem, num_threads):
+
+    data = b"".join(
+        (b"%d," % ((i * 7919) % 100003)) * (1 + i % 5) for i in range(20000)
+    )
+    srcfilename = str(tmp_vsimem / "src.bin")
+    gdal.FileFromMemBuffer(srcfilename, data)
+    zipfilename = str(tmp_vsimem / "test.zip")
+    dstfilename = f"/vsizip/{zipfilename}/test.bin"
+    options = ["SOZIP_ENABLED=YES", "SOZIP_CHUNK_SIZE=1024"]
+    assert gdal.CopyFile(srcfilename, dstfilename, options=options) == 0
+
+    md = gdal.GetFileMetadata(dstfilename, "ZIP")
+    assert md["SOZIP_VALID"] == "YES"
+
+    with gdaltest.config_option("GDAL_NUM_THREADS", num_threads):
+
+        # Whole file at once
+        f = gdal.VSIFOpenL(dstfilename, "rb")
+        try:
+            assert gdal.VSIFReadL(1, len(data) + 1, f) == data
+        finally:
+            gdal.VSIFCloseL(f)
+
+        # Sequential reads of small pieces
+        f = gdal.VSIFOpenL(dstfilename, "rb")
+        try:
+            got = b""
+            while True:
+                piece = gdal.VSIFReadL(1, 1000, f)
+                if not piece:
+                    break
+                got += piece
+            assert got == data
+        finally:
+            gdal.VSIFCloseL(f)
+
+        # Random access, then sequential reads from there
+        f = gdal.VSIFOpenL(dstfilename, "rb")
+        try:
+            for offset in (len(data) - 10, 50000, 3, 100000, 50000):
+                gdal.VSIFSeekL(f, offset, 0)
+                assert gdal.VSIFReadL(1, 5000, f) == data[offset : offset + 5000]
+                assert (
+                    gdal.VSIFReadL(1, 5000, f)
+                    == data[offset + 5000 : offset + 10000]
+                )
+        finally:
+            gdal.VSIFCloseL(f)
+
+
 ###############################################################################
 
 
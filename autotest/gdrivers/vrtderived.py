@@ -1345,6 +1345,95 @@ def test_vrt_pixelfn_expression_invalid(
     assert exception in "".join(messages)
 
 
+###############################################################################
+# Check that evaluating an expression on whole lines gives the same result as
+# the per-pixel interpreter
+
+
+@pytest.mark.parametrize("dialect", ["muparser", "exprtk"])
+@pytest.mark.parametrize(
+    "expression,dialects",
+    [
+        ("A + B * 2 - 3", None),
+        ("(A - B) / (A + B)", None),
+        ("A / B", None),
+        ("A ^ 2 + sqrt(abs(B))", None),
+        ("2 ^ -A", None),
+        ("-A * -(B - 1)", None),
+        ("min(A, B, 3) + max(A, B)", None),
+        ("sum(A, B) / avg(A, B, 1)", None),
+        ("A < B", None),
+        ("(A >= B) * A + (A < B) * B", None),
+        ("A == B", None),
+        ("A != NODATA", None),
+        ("sin(A) * cos(B) + tan(0.5) + exp(-abs(A))", None),
+        ("log10(abs(B) + 1)", None),
+        ("A", None),
+        ("42", None),
+        ("A > 3 && B < 10 || A == 0", ["muparser"]),
+        ("A > B ? A : B - 1", ["muparser"]),
+        ("A > 0 ? B > 0 ? 1 : 2 : 3", ["muparser"]),
+        ("ln(abs(A) + 1)", ["muparser"]),
+        ("_pi * A + 1.5e-1 + .5", ["muparser"]),
+        ("(A > 3 and B < 10) or A < 0", ["exprtk"]),
+        ("log(abs(A) + 1) + floor(B / 3) + ceil(A / 3)", ["exprtk"]),
+    ],
+)
+@pytest.mark.parametrize("propagate_nodata", [False, True])
+def test_vrt_pixelfn_expression_vectorized(
+    tmp_vsimem, expression, dialects, dialect, propagate_nodata
+):
+    gdaltest.importorskip_gdal_array()
+    np = pytest.importorskip("numpy")
+
+    if not gdaltest.gdal_has_vrt_expression_dialect(dialect):
+        pytest.skip(f"Expression dialect {dialect} is not available")
+
+    if dialects and dialect not in dialects:
+        pytest.skip(f"Expression not supported for dialect {dialect}")
+
+    nx, ny = 301, 3
+    a = np.arange(nx * ny, dtype=np.int16).reshape(ny, nx) % 17 - 5
+    b = (np.arange(nx * ny, dtype=np.float32).reshape(ny, nx) % 13) * 0.75 - 4
+    b[1][7] = float("nan")
+    b[2][11] = 0
+
+    with gdal.GetDriverByName("GTiff").Create(
+        tmp_vsimem / "a.tif", nx, ny, 1, gdal.GDT_Int16
+    ) as ds:
+        ds.GetRasterBand(1).WriteArray(a)
+    with gdal.GetDriverByName("GTiff").Create(
+        tmp_vsimem / "b.tif", nx, ny, 1, gdal.GDT_Float32
+    ) as ds:
+        ds.GetRasterBand(1).WriteArray(b)
+
+    expression = (
+        expression.replace("&", "&amp;").replace("<", "&lt;").replace(">", "&gt;")
+    )
+    sources = ""
+    for name in ("a", "b"):
+        sources += f"""<SimpleSource name="{name.upper()}">
+                         <SourceFilename>{tmp_vsimem / (name + ".tif")}</SourceFilename>
+                         <SourceBand>1</SourceBand>
+                       </SimpleSource>"""
+    xml = f"""<VRTDataset rasterXSize="{nx}" rasterYSize="{ny}">
+              <VRTRasterBand dataType="Float64" band="1" subClass="VRTDerivedRasterBand">
+                 <NoDataValue>3</NoDataValue>
+                 <PixelFunctionType>expression</PixelFunctionType>
+                 <PixelFunctionArguments expression="{expression}" dialect="{dialect}" propagateNoData="{propagate_nodata}" />
+                 {sources}
+              </VRTRasterBand>
+            </VRTDataset>"""
+
+    with gdal.Open(xml) as ds:
+        got = ds.ReadAsArray()
+    with gdal.config_option("GDAL_VRT_EXPRESSION_VECTORIZED", "NO"):
+        with gdal.Open(xml) as ds:
+            expected = ds.ReadAsArray()
+
+    np.testing.assert_array_equal(got, expected)
+
+
 def test_vrt_pixelfn_expression_coordinates():
 
     if not gdaltest.gdal_has_vrt_expression_dialect("muparser"):
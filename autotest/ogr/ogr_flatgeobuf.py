@@ -1150,6 +1150,86 @@ def test_ogr_flatgeobuf_arrow_stream_numpy(layer_creation_options):
     ogr.GetDriverByName("FlatGeobuf").DeleteDataSource("/vsimem/test.fgb")
 
 
+###############################################################################
+# Test column-at-a-time evaluation of attribute filters on Arrow batches
+
+
+@pytest.mark.parametrize(
+    "filter",
+    [
+        "int32 = 2",
+        "2 < int32",
+        "int32 <> 2",
+        "int32 >= 2 AND float64 < 3.5",
+        "int32 < 2 OR str = 'C'",
+        "NOT (int32 = 2)",
+        "int32 BETWEEN 1 AND 2",
+        "int32 IN (0, 3)",
+        "int64 IN (1234567890123)",
+        "float64 = 1",
+        "float64 IN (1.5, 2.5)",
+        "int32 IS NULL",
+        "str IS NOT NULL",
+        "str = 'b'",
+        "str IN ('A', 'c')",
+        "str BETWEEN 'b' AND 'c'",
+        "str LIKE 'b%'",
+        "str ILIKE 'B%'",
+        "str NOT LIKE '%a%'",
+        "NOT (str = 'b' OR int32 IS NULL)",
+        # not handled by the columnar evaluator
+        "int32 + 1 = 3",
+        "FID = 1",
+    ],
+)
+def test_ogr_flatgeobuf_arrow_stream_columnar_filter(tmp_vsimem, filter):
+    gdaltest.importorskip_gdal_array()
+    pytest.importorskip("numpy")
+
+    filename = str(tmp_vsimem / "test.fgb")
+    ds = ogr.GetDriverByName("FlatGeoBuf").CreateDataSource(filename)
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint)
+    lyr.CreateField(ogr.FieldDefn("int32", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("int64", ogr.OFTInteger64))
+    lyr.CreateField(ogr.FieldDefn("float64", ogr.OFTReal))
+    lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    for int32, int64, float64, s in [
+        (0, 0, 0.5, "a"),
+        (1, 1234567890123, 1.0, "B"),
+        (2, 2, 1.5, "b"),
+        (None, 3, 2.5, None),
+        (3, None, None, "c"),
+        (2, 5, 3.5, "ba"),
+    ]:
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["int32"] = int32
+        f["int64"] = int64
+        f["float64"] = float64
+        f["str"] = s
+        f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (1 2)"))
+        lyr.CreateFeature(f)
+    ds = None
+
+    def get_fids():
+        ds = ogr.Open(filename)
+        lyr = ds.GetLayer(0)
+        lyr.SetAttributeFilter(filter)
+        stream = lyr.GetArrowStreamAsNumPy(options=["USE_MASKED_ARRAYS=NO"])
+        fids = []
+        for batch in stream:
+            fids += list(batch["OGC_FID"])
+        return fids
+
+    with gdal.config_option("OGR_ARROW_COLUMNAR_FILTER", "NO"):
+        expected = get_fids()
+    assert get_fids() == expected
+
+    ds = ogr.Open(filename)
+    lyr = ds.GetLayer(0)
+    lyr.SetAttributeFilter(filter)
+    assert expected == [f.GetFID() for f in lyr]
+
+
 ###############################################################################
 # Test reading an empty file with GetArrowStream()
 
@@ -31,7 +31,7 @@ import os
 import ogrtest
 import pytest
 
-from osgeo import ogr
+from osgeo import gdal, ogr
 
 pytestmark = pytest.mark.require_driver("MapInfo File")
 
@@ -40,7 +40,9 @@ pytestmark = pytest.mark.require_driver("MapInfo File")
 
 @pytest.fixture(autouse=True, scope="module")
 def startup_and_cleanup():
-    yield
+    # Most tests of this module check the MapInfo .idm/.ind index files
+    with gdal.config_option("OGR_ATTR_INDEX_FORMAT", "MAPINFO"):
+        yield
 
     for filename in ["join_t.idm", "join_t.ind"]:
         assert not os.path.exists(filename)
@@ -443,3 +445,204 @@ def test_ogr_index_11(tmp_path):
     ogr_index_11_check(lyr, [0, 1, 2, 3, 4])
 
     ds = None
+
+
+###############################################################################
+# Test the sorted block-compressed .oidx attribute index format
+
+
+_sorted_index_filters = [
+    "ival = 5",
+    "ival IN (1, 3, 16)",
+    "ival > 10",
+    "ival >= 10",
+    "ival < 3",
+    "ival <= 3",
+    "ival BETWEEN 4 AND 6",
+    "5 < ival",
+    "ival > 10.5",
+    "ival <= 3.5",
+    "ival > 1000",
+    "rval > 20.25",
+    "rval BETWEEN 10 AND 11",
+    "sval = 'VALUE 07'",
+    "sval > 'value 10'",
+    "sval < 'Value 03'",
+    "ival > 10 AND sval = 'Value 01'",
+    "ival < 2 OR rval > 45",
+]
+
+
+def _sorted_index_get_fids(lyr, attr_filter):
+    lyr.SetAttributeFilter(attr_filter)
+    fids = sorted(f.GetFID() for f in lyr)
+    lyr.SetAttributeFilter(None)
+    return fids
+
+
+@pytest.mark.parametrize(
+    "driver_name,filename,options",
+    [
+        ("ESRI Shapefile", "test.shp", []),
+        ("CSV", "test.csv", ["CREATE_CSVT=YES", "GEOMETRY=AS_XY"]),
+        ("GeoJSON", "test.geojson", []),
+        ("FlatGeobuf", "test.fgb", []),
+    ],
+)
+def test_ogr_index_sorted_format(tmp_path, driver_name, filename, options):
+
+    drv = ogr.GetDriverByName(driver_name)
+    if drv is None:
+        pytest.skip(f"{driver_name} driver not available")
+
+    filename = str(tmp_path / filename)
+    index_filename = str(tmp_path / "test.oidx")
+
+    with drv.CreateDataSource(filename) as ds:
+        lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint, options=options)
+        lyr.CreateField(ogr.FieldDefn("ival", ogr.OFTInteger))
+        lyr.CreateField(ogr.FieldDefn("rval", ogr.OFTReal))
+        lyr.CreateField(ogr.FieldDefn("sval", ogr.OFTString))
+        for i in range(100):
+            f = ogr.Feature(lyr.GetLayerDefn())
+            if i % 10 != 0:
+                f["ival"] = i % 17
+                f["rval"] = i * 0.5
+                f["sval"] = "Value %02d" % (i % 13)
+            f.SetGeometry(ogr.CreateGeometryFromWkt(f"POINT ({i} {i})"))
+            lyr.CreateFeature(f)
+
+    with gdal.config_option("OGR_ATTR_INDEX_FORMAT", "SORTED"):
+        with ogr.Open(filename) as ds:
+            lyr = ds.GetLayer(0)
+            expected = {
+                attr_filter: _sorted_index_get_fids(lyr, attr_filter)
+                for attr_filter in _sorted_index_filters
+            }
+
+            # Index creation must not be affected by an active filter
+            lyr.SetAttributeFilter("ival = 1")
+            for field_name in ("ival", "rval", "sval"):
+                ds.ExecuteSQL(f"CREATE INDEX ON test USING {field_name}")
+            lyr.SetAttributeFilter(None)
+            assert os.path.exists(index_filename)
+
+            for attr_filter in _sorted_index_filters:
+                assert (
+                    _sorted_index_get_fids(lyr, attr_filter) == expected[attr_filter]
+                ), attr_filter
+
+        # Re-open and use the persisted index
+        with ogr.Open(filename) as ds:
+            lyr = ds.GetLayer(0)
+            for attr_filter in _sorted_index_filters:
+                assert (
+                    _sorted_index_get_fids(lyr, attr_filter) == expected[attr_filter]
+                ), attr_filter
+
+            for field_name in ("ival", "rval", "sval"):
+                ds.ExecuteSQL(f"DROP INDEX ON test USING {field_name}")
+
+        assert not os.path.exists(index_filename)
+
+
+###############################################################################
+# Test that a .oidx file created for another dataset is ignored
+
+
+@pytest.mark.require_driver("CSV")
+def test_ogr_index_sorted_format_stale_index(tmp_path):
+
+    with gdal.config_option("OGR_ATTR_INDEX_FORMAT", "SORTED"):
+        filename = str(tmp_path / "test.csv")
+        with open(filename, "wt") as f:
+            f.write("id,name\n1,foo\n2,bar\n3,baz\n")
+        with ogr.Open(filename) as ds:
+            ds.ExecuteSQL("CREATE INDEX ON test USING name")
+
+        # Rename the indexed file: the index refers to test.csv
+        os.rename(filename, str(tmp_path / "other.csv"))
+        os.rename(str(tmp_path / "test.oidx"), str(tmp_path / "other.oidx"))
+
+        with ogr.Open(str(tmp_path / "other.csv")) as ds:
+            lyr = ds.GetLayer(0)
+            lyr.SetAttributeFilter("name = 'bar'")
+            assert [f["id"] for f in lyr] == ["2"]
+
+
+###############################################################################
+# Test that a .oidx file is ignored once the indexed file has been modified
+
+
+@pytest.mark.require_driver("CSV")
+def test_ogr_index_sorted_format_data_file_modified(tmp_path):
+
+    with gdal.config_option("OGR_ATTR_INDEX_FORMAT", "SORTED"):
+        filename = str(tmp_path / "test.csv")
+        with open(filename, "wt") as f:
+            f.write("id,name\n1,foo\n2,bar\n3,baz\n")
+        with ogr.Open(filename) as ds:
+            ds.ExecuteSQL("CREATE INDEX ON test USING name")
+        assert os.path.exists(str(tmp_path / "test.oidx"))
+
+        with open(filename, "wt") as f:
+            f.write("id,name\n1,foo\n2,bar\n3,baz\n4,bar\n")
+
+        with ogr.Open(filename) as ds:
+            lyr = ds.GetLayer(0)
+            lyr.SetAttributeFilter("name = 'bar'")
+            assert [f["id"] for f in lyr] == ["2", "4"]
+
+
+# Same, with a modification that keeps the file size, and is likely done in
+# the same second as the index creation
+
+
+@pytest.mark.require_driver("CSV")
+def test_ogr_index_sorted_format_data_file_modified_same_size(tmp_path):
+
+    with gdal.config_option("OGR_ATTR_INDEX_FORMAT", "SORTED"):
+        filename = str(tmp_path / "test.csv")
+        with open(filename, "wt") as f:
+            f.write("id,name\n1,foo\n2,bar\n3,baz\n")
+        with ogr.Open(filename) as ds:
+            ds.ExecuteSQL("CREATE INDEX ON test USING name")
+        assert os.path.exists(str(tmp_path / "test.oidx"))
+
+        with open(filename, "wt") as f:
+            f.write("id,name\n1,bar\n2,foo\n3,baz\n")
+
+        with ogr.Open(filename) as ds:
+            lyr = ds.GetLayer(0)
+            lyr.SetAttributeFilter("name = 'bar'")
+            assert [f["id"] for f in lyr] == ["1"]
+
+
+@pytest.mark.require_driver("ESRI Shapefile")
+def test_ogr_index_sorted_format_shapefile_modified(tmp_path):
+
+    filename = str(tmp_path / "test.shp")
+    with ogr.GetDriverByName("ESRI Shapefile").CreateDataSource(filename) as ds:
+        lyr = ds.CreateLayer("test", geom_type=ogr.wkbNone)
+        lyr.CreateField(ogr.FieldDefn("ival", ogr.OFTInteger))
+        for i in range(3):
+            f = ogr.Feature(lyr.GetLayerDefn())
+            f["ival"] = i
+            lyr.CreateFeature(f)
+
+    with gdal.config_option("OGR_ATTR_INDEX_FORMAT", "SORTED"):
+        with ogr.Open(filename) as ds:
+            ds.ExecuteSQL("CREATE INDEX ON test USING ival")
+        assert os.path.exists(str(tmp_path / "test.oidx"))
+
+        # Only the .dbf file is modified
+        with ogr.Open(filename, update=1) as ds:
+            lyr = ds.GetLayer(0)
+            f = ogr.Feature(lyr.GetLayerDefn())
+            f["ival"] = 1
+            lyr.CreateFeature(f)
+
+        with ogr.Open(filename) as ds:
+            lyr = ds.GetLayer(0)
+            lyr.SetAttributeFilter("ival = 1")
+            assert [f.GetFID() for f in lyr] == [1, 3]
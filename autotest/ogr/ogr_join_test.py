@@ -546,3 +546,61 @@ def test_ogr_join_on_special_field():
         assert f["a"] == "a2"
         assert f["b"] is None
         assert sql_lyr.GetNextFeature() is None
+
+
+###############################################################################
+# Test hash join on equality of a primary and a secondary field
+
+
+@pytest.mark.parametrize("join_hash", ["YES", "NO"])
+@pytest.mark.parametrize("max_memory", [None, "1"])
+def test_ogr_join_hash(join_hash, max_memory):
+
+    ds = ogr.GetDriverByName("MEM").CreateDataSource("")
+    lyr = ds.CreateLayer("first")
+    lyr.CreateField(ogr.FieldDefn("int_key", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("str_key", ogr.OFTString))
+    lyr.CreateField(ogr.FieldDefn("real_key", ogr.OFTReal))
+    for int_key, str_key, real_key in [
+        (1, "a", 1.5),
+        (2, "B", None),
+        (None, None, 2.5),
+        (4, "d", 4),
+    ]:
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["int_key"] = int_key
+        f["str_key"] = str_key
+        f["real_key"] = real_key
+        lyr.CreateFeature(f)
+
+    lyr = ds.CreateLayer("second")
+    lyr.CreateField(ogr.FieldDefn("int_key", ogr.OFTInteger64))
+    lyr.CreateField(ogr.FieldDefn("str_key", ogr.OFTString))
+    lyr.CreateField(ogr.FieldDefn("real_key", ogr.OFTReal))
+    lyr.CreateField(ogr.FieldDefn("val", ogr.OFTString))
+    for int_key, str_key, real_key, val in [
+        (None, None, None, "null"),
+        (2, "b", 4, "v2"),
+        (1, "A", 1.5, "v1"),
+        (2, "b", 4, "v2_dup"),
+    ]:
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["int_key"] = int_key
+        f["str_key"] = str_key
+        f["real_key"] = real_key
+        f["val"] = val
+        lyr.CreateFeature(f)
+
+    options = {"OGR_SQL_JOIN_HASH": join_hash}
+    if max_memory:
+        options["OGR_SQL_JOIN_HASH_MAX_MEMORY"] = max_memory
+    with gdal.config_options(options):
+        for key, expected in [
+            ("int_key", ["v1", "v2", None, None]),
+            ("str_key", ["v1", "v2", None, None]),
+            ("real_key", ["v1", None, None, "v2"]),
+        ]:
+            with ds.ExecuteSQL(
+                f"SELECT val FROM first LEFT JOIN second ON first.{key} = second.{key}"
+            ) as sql_lyr:
+                assert [f["val"] for f in sql_lyr] == expected
@@ -1436,6 +1436,76 @@ def test_ogr_sql_48():
             assert sql_lyr.GetFeature(i)["int_field"] == lyr.GetFeature(i)["int_field"]
 
 
+###############################################################################
+# Test ORDER BY with an external merge sort
+
+
+@pytest.mark.parametrize("max_memory", [None, "1", "10000"])
+def test_ogr_sql_order_by_external_sort(max_memory):
+
+    ds = ogr.GetDriverByName("MEM").CreateDataSource("")
+    lyr = ds.CreateLayer("test")
+    lyr.CreateField(ogr.FieldDefn("int_field", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("str_field", ogr.OFTString))
+    for i in range(1000):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        if i != 500:
+            f["int_field"] = (i * 37) % 100
+        f["str_field"] = "val%04d" % i
+        f.SetStyleString("style%d" % i)
+        f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (%d 0)" % i))
+        lyr.CreateFeature(f)
+
+    expected = sorted(
+        [f for f in lyr],
+        key=lambda f: (
+            -1 if f["int_field"] is None else f["int_field"],
+            f["str_field"],
+        ),
+    )
+    expected = [(f["int_field"], f["str_field"], f.GetFID()) for f in expected]
+
+    options = {"OGR_SQL_ORDER_BY_EXTERNAL_SORT": "YES"}
+    if max_memory:
+        options["OGR_SQL_ORDER_BY_MAX_MEMORY"] = max_memory
+    with gdal.config_options(options):
+        # Features with identical int_field are returned in source order,
+        # which is also str_field order.
+        with ds.ExecuteSQL("SELECT * FROM test ORDER BY int_field") as sql_lyr:
+            got = []
+            for f in sql_lyr:
+                got.append((f["int_field"], f["str_field"], f.GetFID()))
+                assert f.GetStyleString() == "style%d" % f.GetFID()
+                assert f.GetGeometryRef().GetX() == f.GetFID()
+            assert got == expected
+            assert sql_lyr.TestCapability(ogr.OLCFastSetNextByIndex) == 0
+
+            sql_lyr.SetNextByIndex(10)
+            f = sql_lyr.GetNextFeature()
+            assert f["str_field"] == expected[10][1]
+            sql_lyr.SetNextByIndex(5)
+            f = sql_lyr.GetNextFeature()
+            assert f["str_field"] == expected[5][1]
+
+            sql_lyr.ResetReading()
+            f = sql_lyr.GetNextFeature()
+            assert f["str_field"] == expected[0][1]
+
+        with ds.ExecuteSQL(
+            "SELECT * FROM test ORDER BY int_field DESC, str_field LIMIT 3 OFFSET 2"
+        ) as sql_lyr:
+            got = [f["str_field"] for f in sql_lyr]
+            expected_desc = sorted(
+                expected, key=lambda x: (-(-1 if x[0] is None else x[0]), x[1])
+            )
+            assert got == [x[1] for x in expected_desc[2:5]]
+
+        with ds.ExecuteSQL(
+            "SELECT * FROM test WHERE int_field = 1000 ORDER BY int_field"
+        ) as sql_lyr:
+            assert sql_lyr.GetNextFeature() is None
+
+
 ###############################################################################
 # Test arithmetic expressions
 
@@ -522,3 +522,36 @@ def test_gdalalg_raster_index_stac_geoparquet_error_not_epsg_4326(tmp_vsimem):
             profile="STAC-GeoParquet",
             dst_crs="EPSG:3857",
         )
+
+
+def test_gdalalg_raster_index_incremental_num_threads(tmp_path):
+
+    src_filename = str(tmp_path / "byte.tif")
+    gdal.Translate(src_filename, "../gcore/data/byte.tif")
+    out_filename = str(tmp_path / "out.gpkg")
+
+    alg = get_alg()
+    alg["input"] = src_filename
+    alg["output"] = out_filename
+    alg["incremental"] = True
+    alg["num-threads"] = 2
+    assert alg.Run()
+    assert alg.Finalize()
+
+    alg = get_alg()
+    alg["input"] = [src_filename, "../gcore/data/uint16.tif"]
+    alg["output"] = out_filename
+    alg["append"] = True
+    alg["incremental"] = True
+    alg["num-threads"] = 2
+    gdal.ErrorReset()
+    assert alg.Run()
+    assert alg.Finalize()
+    assert gdal.GetLastErrorMsg() == ""
+
+    with ogr.Open(out_filename) as ds:
+        lyr = ds.GetLayer(0)
+        assert [f["location"] for f in lyr] == [
+            src_filename,
+            "../gcore/data/uint16.tif",
+        ]
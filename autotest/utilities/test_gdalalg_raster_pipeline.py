@@ -745,3 +745,51 @@ def test_gdalalg_raster_pipeline_info_executable():
         f"{gdal_path} raster pipeline read ../gcore/data/byte.tif ! info"
     )
     assert out.startswith("Driver: GTiff/GeoTIFF")
+
+
+@pytest.mark.parametrize(
+    "pipeline_str",
+    [
+        "read ../gdrivers/data/n43.tif ! write",
+        "read ../gdrivers/data/n43.tif ! hillshade ! write",
+        "read ../gdrivers/data/n43.tif ! reproject --dst-crs EPSG:32617 ! slope ! write",
+    ],
+)
+def test_gdalalg_raster_pipeline_write_num_threads(tmp_vsimem, pipeline_str):
+
+    out_filename_ref = str(tmp_vsimem / "ref.tif")
+    out_filename = str(tmp_vsimem / "out.tif")
+
+    with gdal.Run(
+        "raster", "pipeline", pipeline=f"{pipeline_str} {out_filename_ref}"
+    ) as alg:
+        ref_cs = alg.Output().GetRasterBand(1).Checksum()
+
+    with gdal.config_option("GDAL_DEBUG_CPU_COUNT", "4"):
+        with gdal.Run(
+            "raster",
+            "pipeline",
+            pipeline=f"{pipeline_str} -j 4 {out_filename}",
+        ) as alg:
+            assert alg.Output().GetRasterBand(1).Checksum() == ref_cs
+
+
+def test_gdalalg_raster_pipeline_write_num_threads_non_materialized_input(
+    tmp_vsimem,
+):
+
+    src_ds = gdal.Translate("", "../gdrivers/data/n43.tif", format="MEM")
+
+    def run(out_filename, extra_args):
+        pipeline = get_pipeline_alg()
+        pipeline["input"] = src_ds
+        assert pipeline.ParseRunAndFinalize(
+            ["read", "!", "hillshade", "!", "write"] + extra_args + [out_filename]
+        )
+        with gdal.Open(out_filename) as ds:
+            return ds.GetRasterBand(1).Checksum()
+
+    # Falls back to sequential execution
+    assert run(str(tmp_vsimem / "out.tif"), ["-j", "2"]) == run(
+        str(tmp_vsimem / "ref.tif"), []
+    )
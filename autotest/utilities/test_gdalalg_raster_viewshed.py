@@ -104,6 +104,20 @@ def test_gdalalg_raster_viewshed_overwrite_and_creation_option(
     assert ds.GetRasterBand(1).Checksum() == VIEWSHED_NOMINAL_CHECKSUM
 
 
+@pytest.mark.parametrize("num_threads", ["1", "3", "ALL_CPUS"])
+def test_gdalalg_raster_viewshed_num_threads(viewshed_input, num_threads):
+
+    alg = get_alg()
+    alg["input"] = viewshed_input
+    alg["output"] = ""
+    alg["output-format"] = "MEM"
+    alg["position"] = [621528, 4817617, 100]
+    alg["num-threads"] = num_threads
+    assert alg.Run()
+    ds = alg["output"].GetDataset()
+    assert ds.GetRasterBand(1).Checksum() == VIEWSHED_NOMINAL_CHECKSUM
+
+
 def test_gdalalg_raster_viewshed_target_height(viewshed_input):
 
     alg = get_alg()
@@ -999,3 +999,166 @@ def test_gdalalg_vector_pipeline_read_limit(tmp_vsimem):
     with gdal.OpenEx(dst_filename) as ds:
         assert ds.GetLayer(0).GetFeatureCount() == 3
         assert ds.GetLayer(1).GetFeatureCount() == 3
+
+
+@pytest.mark.require_driver("GPKG")
+def test_gdalalg_vector_pipeline_select_arrow_stream(tmp_vsimem):
+
+    src_filename = tmp_vsimem / "src.gpkg"
+    dst_filename = tmp_vsimem / "dst.gpkg"
+
+    with gdal.GetDriverByName("GPKG").CreateVector(src_filename) as src_ds:
+        lyr = src_ds.CreateLayer("test")
+        for name in ("a", "b", "c"):
+            lyr.CreateField(ogr.FieldDefn(name, ogr.OFTInteger))
+        for i in range(10):
+            f = ogr.Feature(lyr.GetLayerDefn())
+            f["a"] = i
+            f["b"] = 10 * i
+            f["c"] = 100 * i
+            f.SetGeometry(ogr.CreateGeometryFromWkt(f"POINT({i} {i})"))
+            lyr.CreateFeature(f)
+
+    pipeline = get_pipeline_alg()
+    assert pipeline.ParseCommandLineArguments(
+        [
+            "read",
+            src_filename,
+            "!",
+            "select",
+            "c,a",
+            "!",
+            "write",
+            "--of=stream",
+            "streamed_dataset",
+        ]
+    )
+    assert pipeline.Run()
+    out_lyr = pipeline["output"].GetDataset().GetLayer(0)
+    assert out_lyr.TestCapability(ogr.OLCFastGetArrowStream)
+
+    stream = out_lyr.GetArrowStream()
+    schema = stream.GetSchema()
+    assert [
+        schema.GetChild(i).GetName() for i in range(schema.GetChildrenCount())
+    ] == ["fid", "a", "c"]
+    batch = stream.GetNextRecordBatch()
+    assert batch.GetLength() == 10
+    assert batch.GetChildrenCount() == 3
+    assert stream.GetNextRecordBatch() is None
+    del stream
+
+    # Not a fast stream anymore when a filter is set on the output layer
+    out_lyr.SetAttributeFilter("a >= 5")
+    assert not out_lyr.TestCapability(ogr.OLCFastGetArrowStream)
+    out_lyr.SetAttributeFilter(None)
+
+    gdal.VectorTranslate(dst_filename, pipeline["output"].GetDataset())
+    with ogr.Open(dst_filename) as ds:
+        lyr = ds.GetLayer(0)
+        assert [
+            lyr.GetLayerDefn().GetFieldDefn(i).GetName()
+            for i in range(lyr.GetLayerDefn().GetFieldCount())
+        ] == ["a", "c"]
+        assert [(f["a"], f["c"]) for f in lyr] == [(i, 100 * i) for i in range(10)]
+
+
+@pytest.mark.require_driver("GPKG")
+def test_gdalalg_vector_pipeline_arrow_stream_options_and_ignored_fields(
+    tmp_vsimem,
+):
+
+    src_filename = tmp_vsimem / "src.gpkg"
+
+    with gdal.GetDriverByName("GPKG").CreateVector(src_filename) as src_ds:
+        for lyr_name in ("test", "other"):
+            lyr = src_ds.CreateLayer(lyr_name)
+            for name in ("a", "b", "c"):
+                lyr.CreateField(ogr.FieldDefn(name, ogr.OFTInteger))
+            for i in range(10):
+                f = ogr.Feature(lyr.GetLayerDefn())
+                f["a"] = i
+                f["b"] = 10 * i
+                f["c"] = 100 * i
+                f.SetGeometry(ogr.CreateGeometryFromWkt(f"POINT({i} {i})"))
+                lyr.CreateFeature(f)
+
+    pipeline = get_pipeline_alg()
+    assert pipeline.ParseCommandLineArguments(
+        [
+            "read",
+            src_filename,
+            "!",
+            "select",
+            "--active-layer=test",
+            "c,a",
+            "!",
+            "write",
+            "--of=stream",
+            "streamed_dataset",
+        ]
+    )
+    assert pipeline.Run()
+    out_ds = pipeline["output"].GetDataset()
+
+    def get_names(lyr, options=None):
+        stream = lyr.GetArrowStream(options if options else [])
+        schema = stream.GetSchema()
+        names = [
+            schema.GetChild(i).GetName() for i in range(schema.GetChildrenCount())
+        ]
+        batch = stream.GetNextRecordBatch()
+        assert batch.GetChildrenCount() == len(names)
+        return names
+
+    # Successive streams with different source schemas
+    select_lyr = out_ds.GetLayerByName("test")
+    assert get_names(select_lyr) == ["fid", "a", "c"]
+    assert get_names(select_lyr, ["INCLUDE_FID=NO"]) == ["a", "c"]
+    assert get_names(select_lyr) == ["fid", "a", "c"]
+
+    select_lyr.SetIgnoredFields(["c"])
+    assert not select_lyr.TestCapability(ogr.OLCFastGetArrowStream)
+    assert get_names(select_lyr) == ["fid", "a"]
+    select_lyr.SetIgnoredFields([])
+
+    # Pass-through layer
+    other_lyr = out_ds.GetLayerByName("other")
+    assert get_names(other_lyr) == ["fid", "a", "b", "c", "geom"]
+    other_lyr.SetIgnoredFields(["b"])
+    assert get_names(other_lyr) == ["fid", "a", "c", "geom"]
+    other_lyr.SetIgnoredFields([])
+    assert get_names(other_lyr) == ["fid", "a", "b", "c", "geom"]
+
+
+@pytest.mark.require_geos
+def test_gdalalg_vector_pipeline_num_threads():
+
+    src_ds = gdal.GetDriverByName("MEM").CreateVector("")
+    lyr = src_ds.CreateLayer("test")
+    lyr.CreateField(ogr.FieldDefn("id", ogr.OFTInteger))
+    for i in range(1000):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["id"] = i
+        f.SetGeometry(ogr.CreateGeometryFromWkt(f"POINT({i} {i % 7})"))
+        lyr.CreateFeature(f)
+
+    def run():
+        pipeline = get_pipeline_alg()
+        pipeline["input"] = src_ds
+        pipeline["output"] = ""
+        pipeline["output-format"] = "stream"
+        assert pipeline.ParseCommandLineArguments(
+            ["read", "!", "buffer", "--distance=1", "!", "swap-xy", "!", "write"]
+        )
+        assert pipeline.Run()
+        return [
+            (f["id"], f.GetGeometryRef().ExportToWkt())
+            for f in pipeline["output"].GetDataset().GetLayer(0)
+        ]
+
+    expected = run()
+    with gdal.config_option("GDAL_NUM_THREADS", "4"):
+        got = run()
+    assert got == expected
+    assert [x[0] for x in got] == list(range(1000))
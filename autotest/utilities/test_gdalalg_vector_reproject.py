@@ -11,6 +11,7 @@
 # SPDX-License-Identifier: MIT
 ###############################################################################
 
+import gdaltest
 import ogrtest
 import pytest
 
@@ -155,3 +156,55 @@ def test_gdalalg_vector_reproject_polar_projected_to_geographic(input_wkt, outpu
         out_f = out_lyr.GetNextFeature()
         out_g = out_f.GetGeometryRef()
         ogrtest.check_feature_geometry(out_g, output_wkt)
+
+
+@pytest.mark.require_driver("GPKG")
+@pytest.mark.parametrize("num_threads", [None, "4"])
+def test_gdalalg_vector_reproject_arrow_stream(tmp_vsimem, num_threads):
+
+    src_filename = tmp_vsimem / "src.gpkg"
+    with ogr.GetDriverByName("GPKG").CreateDataSource(src_filename) as ds:
+        srs = osr.SpatialReference()
+        srs.ImportFromEPSG(4326)
+        lyr = ds.CreateLayer("test", srs=srs)
+        lyr.CreateField(ogr.FieldDefn("id", ogr.OFTInteger))
+        ds.StartTransaction()
+        for i in range(5000):
+            f = ogr.Feature(lyr.GetLayerDefn())
+            f["id"] = i
+            if i % 100 != 0:
+                f.SetGeometry(
+                    ogr.CreateGeometryFromWkt(
+                        f"LINESTRING({i % 180} {i % 80},{i % 170} {i % 70})"
+                    )
+                )
+            lyr.CreateFeature(f)
+        ds.CommitTransaction()
+
+    alg = get_reproject_alg()
+    alg["input"] = src_filename
+    alg["dst-crs"] = "EPSG:3857"
+    alg["output"] = ""
+    alg["output-format"] = "stream"
+    assert alg.Run()
+    out_lyr = alg["output"].GetDataset().GetLayer(0)
+    assert out_lyr.TestCapability(ogr.OLCFastGetArrowStream)
+
+    expected = [f.GetGeometryRef() for f in out_lyr]
+
+    out_filename = tmp_vsimem / "out.gpkg"
+    with gdaltest.config_options(
+        {"GDAL_NUM_THREADS": num_threads, "OGR2OGR_USE_ARROW_API": "YES"}
+    ):
+        gdal.VectorTranslate(out_filename, alg["output"].GetDataset())
+
+    with ogr.Open(out_filename) as ds:
+        lyr = ds.GetLayer(0)
+        assert lyr.GetSpatialRef().GetAuthorityCode(None) == "3857"
+        got = [f.GetGeometryRef() for f in lyr]
+    assert len(got) == len(expected)
+    for g_got, g_expected in zip(got, expected):
+        if g_expected is None:
+            assert g_got is None
+        else:
+            ogrtest.check_feature_geometry(g_got, g_expected)
@@ -1288,3 +1288,58 @@ def test_gdalbuildvrt_preserve_band_metadata_separate_mode(
 
         assert desc == expected_desc_i
         assert rt_ds.GetRasterBand(i + 1).GetMetadata_Dict() == expected_metadata_i
+
+
+###############################################################################
+# Test -num_threads
+
+
+@pytest.mark.parametrize("strict", [True, False])
+def test_gdalbuildvrt_lib_num_threads(tmp_vsimem, strict):
+
+    filenames = []
+    for j in range(3):
+        for i in range(4):
+            filename = str(tmp_vsimem / f"tile_{i}_{j}.tif")
+            ds = gdal.GetDriverByName("GTiff").Create(filename, 10, 10)
+            ds.SetGeoTransform([i * 10, 1, 0, -j * 10, 0, -1])
+            ds.GetRasterBand(1).Fill(i + j * 4)
+            ds = None
+            filenames.append(filename)
+    filenames.insert(5, str(tmp_vsimem / "non_existing.tif"))
+
+    def build(num_threads):
+        out_filename = str(tmp_vsimem / f"out_{num_threads}.vrt")
+        options = ["-num_threads", str(num_threads)]
+        if strict:
+            options.append("-strict")
+        with gdal.quiet_errors():
+            gdal.ErrorReset()
+            ds = gdal.BuildVRT(out_filename, filenames, options=options)
+            msg = gdal.GetLastErrorMsg()
+        if ds is None:
+            return None, msg
+        ds = None
+        with gdal.VSIFile(out_filename, "rb") as f:
+            return f.read().replace(out_filename.encode(), b""), msg
+
+    ref_content, ref_msg = build(1)
+    content, msg = build(4)
+    assert content == ref_content
+    assert msg == ref_msg
+    assert "non_existing.tif" in msg
+    if strict:
+        assert content is None
+    else:
+        with gdal.Open(str(tmp_vsimem / "out_4.vrt")) as ds:
+            assert ds.RasterXSize == 40
+            assert ds.RasterYSize == 30
+            assert ds.GetRasterBand(1).Checksum() == gdal.Open(
+                str(tmp_vsimem / "out_1.vrt")
+            ).GetRasterBand(1).Checksum()
+
+
+def test_gdalbuildvrt_lib_num_threads_invalid():
+
+    with pytest.raises(Exception, match="Invalid value for -num_threads"):
+        gdal.BuildVRT("", [], options=["-num_threads", "0"])
@@ -458,3 +458,93 @@ def test_gdaltindex_lib_ot(tmp_path, four_tiles):
     ds = ogr.Open(index_filename)
     lyr = ds.GetLayer(0)
     assert lyr.GetMetadataItem("DATA_TYPE") == "UInt16"
+
+
+###############################################################################
+# Test -num_threads
+
+
+def test_gdaltindex_lib_num_threads(tmp_path, four_tiles):
+
+    fnames = (
+        four_tiles
+        + [str(tmp_path / "non_existing.tif")]
+        + [four_tiles[0], four_tiles[1]]
+    )
+
+    def get_index(num_threads):
+        index_filename = str(tmp_path / f"index_{num_threads}.gpkg")
+        with gdal.quiet_errors():
+            gdal.ErrorReset()
+            gdal.TileIndex(
+                index_filename,
+                fnames,
+                options=["-num_threads", str(num_threads)],
+            )
+            msg = gdal.GetLastErrorMsg()
+        ds = ogr.Open(index_filename)
+        lyr = ds.GetLayer(0)
+        return [
+            (f["location"], f.GetGeometryRef().ExportToWkt()) for f in lyr
+        ], msg
+
+    ref_features, ref_msg = get_index(1)
+    assert len(ref_features) == 6
+    features, msg = get_index(4)
+    assert features == ref_features
+    assert msg == ref_msg
+
+
+def test_gdaltindex_lib_num_threads_invalid(tmp_path):
+
+    with pytest.raises(Exception, match="Invalid value for -num_threads"):
+        gdal.TileIndex(
+            str(tmp_path / "index.gpkg"), [], options=["-num_threads", "0"]
+        )
+
+
+###############################################################################
+# Test -incremental
+
+
+@pytest.mark.parametrize("num_threads", [1, 4])
+def test_gdaltindex_lib_incremental(tmp_path, num_threads):
+
+    fnames = [str(tmp_path / f"tile{i}.tif") for i in range(3)]
+    for i, fname in enumerate(fnames):
+        ds = gdal.GetDriverByName("GTiff").Create(fname, 10, 10)
+        ds.SetGeoTransform([i * 10, 1, 0, 0, 0, -1])
+        ds = None
+
+    index_filename = str(tmp_path / "index.gpkg")
+    options = ["-incremental", "-num_threads", str(num_threads)]
+    gdal.TileIndex(index_filename, fnames[0:2], options=options)
+
+    with ogr.Open(index_filename) as ds:
+        lyr = ds.GetLayer(0)
+        assert lyr.GetFeatureCount() == 2
+        f = lyr.GetNextFeature()
+        assert f["file_size"] == os.stat(fnames[0]).st_size
+        assert f["file_mtime"] == int(os.stat(fnames[0]).st_mtime)
+
+    # Modify the second tile (its size changes) and add the third one
+    ds = gdal.GetDriverByName("GTiff").Create(fnames[1], 20, 20)
+    ds.SetGeoTransform([100, 1, 0, 0, 0, -1])
+    ds = None
+
+    gdal.ErrorReset()
+    gdal.TileIndex(index_filename, fnames, options=options)
+    assert gdal.GetLastErrorMsg() == ""
+
+    with ogr.Open(index_filename) as ds:
+        lyr = ds.GetLayer(0)
+        assert [
+            (f.GetFID(), f["location"], f.GetGeometryRef().ExportToWkt())
+            for f in lyr
+        ] == [
+            (1, fnames[0], "POLYGON ((0 0,10 0,10 -10,0 -10,0 0))"),
+            (2, fnames[1], "POLYGON ((100 0,120 0,120 -20,100 -20,100 0))"),
+            (3, fnames[2], "POLYGON ((20 0,30 0,30 -10,20 -10,20 0))"),
+        ]
+        f = lyr.GetFeature(2)
+        assert f["file_size"] == os.stat(fnames[1]).st_size
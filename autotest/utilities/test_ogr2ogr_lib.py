@@ -3420,3 +3420,102 @@ def test_ogr2ogr_lib_wrapdateline_useless():
         f,
         "POLYGON ((273569.876923437 913668.344183491,273568.830352505 913465.374678854,273786.170063323 913461.355034812,273785.056779618 913665.785238482,273569.876923437 913668.344183491))",
     )
+
+
+###############################################################################
+# Test -num_threads
+
+
+@pytest.mark.require_geos
+@pytest.mark.parametrize(
+    "options",
+    [
+        ["-t_srs", "EPSG:32631"],
+        ["-clipsrc", "0 0 50 50"],
+        ["-makevalid", "-simplify", "0.1"],
+        ["-explodecollections", "-t_srs", "EPSG:3857"],
+    ],
+)
+def test_ogr2ogr_lib_num_threads(options):
+
+    src_ds = gdal.GetDriverByName("MEM").CreateVector("")
+    srs = osr.SpatialReference()
+    srs.ImportFromEPSG(4326)
+    srs.SetAxisMappingStrategy(osr.OAMS_TRADITIONAL_GIS_ORDER)
+    src_lyr = src_ds.CreateLayer("test", srs=srs)
+    src_lyr.CreateField(ogr.FieldDefn("id", ogr.OFTInteger))
+    for i in range(1000):
+        f = ogr.Feature(src_lyr.GetLayerDefn())
+        f["id"] = i
+        x = i % 100
+        y = i // 10
+        f.SetGeometry(
+            ogr.CreateGeometryFromWkt(
+                f"MULTIPOLYGON((({x} {y},{x} {y+1},{x+1} {y+1},{x+1} {y},{x} {y})),(({x+2} {y},{x+2} {y+1},{x+3} {y+1},{x+2} {y})))"
+            )
+        )
+        src_lyr.CreateFeature(f)
+
+    with gdal.config_option("OGR2OGR_USE_ARROW_API", "NO"):
+        ref_ds = gdal.VectorTranslate("", src_ds, format="MEM", options=options)
+        with gdal.config_option("OGR2OGR_PIPELINE_BATCH_SIZE", "7"):
+            out_ds = gdal.VectorTranslate(
+                "", src_ds, format="MEM", options=options + ["-num_threads", "4"]
+            )
+
+    ref_lyr = ref_ds.GetLayer(0)
+    out_lyr = out_ds.GetLayer(0)
+    assert out_lyr.GetFeatureCount() == ref_lyr.GetFeatureCount()
+    assert out_lyr.GetFeatureCount() > 0
+    for f_ref, f_out in zip(ref_lyr, out_lyr):
+        assert f_out.GetFID() == f_ref.GetFID()
+        assert f_out["id"] == f_ref["id"]
+        assert f_out.GetGeometryRef().Equals(f_ref.GetGeometryRef())
+
+
+###############################################################################
+# Test -num_threads with -limit and a progress callback
+
+
+def test_ogr2ogr_lib_num_threads_limit():
+
+    src_ds = gdal.GetDriverByName("MEM").CreateVector("")
+    src_lyr = src_ds.CreateLayer("test")
+    for i in range(100):
+        f = ogr.Feature(src_lyr.GetLayerDefn())
+        f.SetGeometry(ogr.CreateGeometryFromWkt(f"POINT({i} 0)"))
+        src_lyr.CreateFeature(f)
+
+    tab = [0]
+
+    def my_progress(pct, msg, user_data):
+        user_data[0] = pct
+        return 1
+
+    with gdal.config_options(
+        {"OGR2OGR_USE_ARROW_API": "NO", "OGR2OGR_PIPELINE_BATCH_SIZE": "3"}
+    ):
+        out_ds = gdal.VectorTranslate(
+            "",
+            src_ds,
+            format="MEM",
+            options="-num_threads 3 -limit 50",
+            callback=my_progress,
+            callback_data=tab,
+        )
+    out_lyr = out_ds.GetLayer(0)
+    assert out_lyr.GetFeatureCount() == 50
+    assert [f.GetGeometryRef().GetX() for f in out_lyr] == list(range(50))
+    assert tab[0] > 0
+
+
+###############################################################################
+# Test invalid value for -num_threads
+
+
+def test_ogr2ogr_lib_num_threads_invalid():
+
+    src_ds = gdal.GetDriverByName("MEM").CreateVector("")
+    src_ds.CreateLayer("test")
+    with pytest.raises(Exception, match="Invalid value for -num_threads"):
+        gdal.VectorTranslate("", src_ds, format="MEM", options="-num_threads 0")
@@ -46,6 +46,7 @@
 #include <algorithm>
 #include <cassert>
 #include <limits>
+#include <vector>
 
 namespace gdal
 {
@@ -183,6 +184,154 @@ static CPLErr FetchIntegerArg(CSLConstList papszArgs, const char *pszName,
     return CE_None;
 }
 
+/************************************************************************/
+/*                           NoDataChecker                              */
+/************************************************************************/
+
+namespace
+{
+/** Tests source values against the NoData value, with the semantics of
+ * IsNoData(), for one value or, with SSE2, for 4 values at once.
+ */
+struct NoDataChecker
+{
+    bool bHasNoData = false;
+    double dfNoData = 0;
+
+    NoDataChecker(bool bHasNoDataIn, double dfNoDataIn)
+        : bHasNoData(bHasNoDataIn), dfNoData(dfNoDataIn)
+    {
+    }
+
+    inline bool IsNoData(double dfVal) const
+    {
+        return bHasNoData && ::IsNoData(dfVal, dfNoData);
+    }
+
+#ifdef USE_SSE2
+    // Returns a mask of the lanes of v that are NoData. Only valid if
+    // bHasNoData is set.
+    inline XMMReg4Double IsNoData4(const XMMReg4Double &v) const
+    {
+        if (std::isnan(dfNoData))
+        {
+            // NaN lanes are the ones that are not equal to themselves
+            const auto zero = XMMReg4Double::Zero();
+            return XMMReg4Double::Ternary(XMMReg4Double::Equals(v, v), zero,
+                                          XMMReg4Double::Equals(zero, zero));
+        }
+        return XMMReg4Double::Equals(v, XMMReg4Double::Set1(dfNoData));
+    }
+
+    // Returns NoData in the lanes where v is NoData, and res elsewhere
+    inline XMMReg4Double Select4(const XMMReg4Double &v,
+                                 const XMMReg4Double &res) const
+    {
+        if (!bHasNoData)
+            return res;
+        return XMMReg4Double::Ternary(IsNoData4(v),
+                                      XMMReg4Double::Set1(dfNoData), res);
+    }
+#endif
+};
+
+#ifdef USE_SSE2
+inline XMMReg4Double Or4(const XMMReg4Double &a, const XMMReg4Double &b)
+{
+    return XMMReg4Double::Ternary(a, a, b);
+}
+#endif
+
+}  // namespace
+
+/************************************************************************/
+/*                          ApplyElementWise()                          */
+/************************************************************************/
+
+// Applies a per-pixel kernel to non-complex sources. Values are converted to
+// double by chunks with GDALCopyWords(), instead of going through GetSrcVal()
+// and a GDALCopyWords() call for each pixel, and the kernel is applied to
+// those packed arrays, 4 values at a time with SSE2 when bVectorized is true.
+// Kernel::Compute() must return for one value the same result as the generic
+// code path of the pixel function, and Kernel::Compute4(), only needed if
+// bVectorized is true, the same results for 4 consecutive values.
+template <bool bVectorized, class Kernel>
+static void ApplyElementWise(const Kernel &kernel,
+                             const void *const *papoSources, int nSources,
+                             void *pData, int nXSize, int nYSize,
+                             GDALDataType eSrcType, GDALDataType eBufType,
+                             int nPixelSpace, int nLineSpace)
+{
+    constexpr int CHUNK_SIZE = 256;
+    const int nSrcTypeSize = GDALGetDataTypeSizeBytes(eSrcType);
+    const bool bSrcIsDouble = eSrcType == GDT_Float64;
+    const bool bDstIsPackedDouble =
+        eBufType == GDT_Float64 &&
+        nPixelSpace == static_cast<int>(sizeof(double));
+
+    std::vector<double> adfSrcChunks(
+        bSrcIsDouble ? 0 : static_cast<size_t>(nSources) * CHUNK_SIZE);
+    std::vector<const double *> apdfSrc(nSources);
+    double adfDst[CHUNK_SIZE];
+
+    for (int iLine = 0; iLine < nYSize; ++iLine)
+    {
+        GByte *const pabyDstLine = static_cast<GByte *>(pData) +
+                                   static_cast<GSpacing>(nLineSpace) * iLine;
+        const size_t iOffsetLine = static_cast<size_t>(iLine) * nXSize;
+
+        for (int iCol = 0; iCol < nXSize; iCol += CHUNK_SIZE)
+        {
+            const int nCount = std::min(CHUNK_SIZE, nXSize - iCol);
+            for (int iSrc = 0; iSrc < nSources; ++iSrc)
+            {
+                if (bSrcIsDouble)
+                {
+                    apdfSrc[iSrc] =
+                        static_cast<const double *>(papoSources[iSrc]) +
+                        iOffsetLine + iCol;
+                }
+                else
+                {
+                    double *pdfChunk = adfSrcChunks.data() +
+                                       static_cast<size_t>(iSrc) * CHUNK_SIZE;
+                    const GByte *pabySrc =
+                        static_cast<const GByte *>(papoSources[iSrc]) +
+                        (iOffsetLine + iCol) * nSrcTypeSize;
+                    GDALCopyWords(pabySrc, eSrcType, nSrcTypeSize, pdfChunk,
+                                  GDT_Float64, static_cast<int>(sizeof(double)),
+                                  nCount);
+                    apdfSrc[iSrc] = pdfChunk;
+                }
+            }
+
+            double *pdfDst =
+                bDstIsPackedDouble
+                    ? reinterpret_cast<double *>(pabyDstLine) + iCol
+                    : adfDst;
+            int i = 0;
+#ifdef USE_SSE2
+            if constexpr (bVectorized)
+            {
+                for (; i + 3 < nCount; i += 4)
+                    kernel.Compute4(apdfSrc.data(), i).Store4Val(pdfDst + i);
+            }
+#endif
+            for (; i < nCount; ++i)
+                pdfDst[i] = kernel.Compute(apdfSrc.data(), i);
+
+            if (!bDstIsPackedDouble)
+            {
+                GDALCopyWords(adfDst, GDT_Float64,
+                              static_cast<int>(sizeof(double)),
+                              pabyDstLine +
+                                  static_cast<GSpacing>(iCol) * nPixelSpace,
+                              eBufType, nPixelSpace, nCount);
+            }
+        }
+    }
+}
+
 static CPLErr RealPixelFunc(void **papoSources, int nSources, void *pData,
                             int nXSize, int nYSize, GDALDataType eSrcType,
                             GDALDataType eBufType, int nPixelSpace,
@@ -1292,22 +1441,25 @@ static CPLErr SumPixelFunc(void **papoSources, int nSources, void *pData,
 
         if (bGeneralCase)
         {
-            size_t ii = 0;
-            for (int iLine = 0; iLine < nYSize; ++iLine)
+            struct Kernel
             {
-                for (int iCol = 0; iCol < nXSize; ++iCol, ++ii)
+                NoDataChecker noData;
+                int nSources;
+                double dfK;
+                bool bPropagateNoData;
+
+                double Compute(const double *const *papdfSrc, int i) const
                 {
                     double dfSum = dfK;
                     for (int iSrc = 0; iSrc < nSources; ++iSrc)
                     {
-                        const double dfVal =
-                            GetSrcVal(papoSources[iSrc], eSrcType, ii);
+                        const double dfVal = papdfSrc[iSrc][i];
 
-                        if (bHasNoData && IsNoData(dfVal, dfNoData))
+                        if (noData.IsNoData(dfVal))
                         {
                             if (bPropagateNoData)
                             {
-                                dfSum = dfNoData;
+                                dfSum = noData.dfNoData;
                                 break;
                             }
                         }
@@ -1316,15 +1468,47 @@ static CPLErr SumPixelFunc(void **papoSources, int nSources, void *pData,
                             dfSum += dfVal;
                         }
                     }
+                    return dfSum;
+                }
 
-                    GDALCopyWords(&dfSum, GDT_Float64, 0,
-                                  static_cast<GByte *>(pData) +
-                                      static_cast<GSpacing>(nLineSpace) *
-                                          iLine +
-                                      iCol * nPixelSpace,
-                                  eBufType, nPixelSpace, 1);
+#ifdef USE_SSE2
+                XMMReg4Double Compute4(const double *const *papdfSrc,
+                                       int i) const
+                {
+                    auto sum = XMMReg4Double::Set1(dfK);
+                    if (!noData.bHasNoData)
+                    {
+                        for (int iSrc = 0; iSrc < nSources; ++iSrc)
+                            sum += XMMReg4Double::Load4Val(papdfSrc[iSrc] + i);
+                        return sum;
+                    }
+
+                    auto anyNoData = XMMReg4Double::Zero();
+                    for (int iSrc = 0; iSrc < nSources; ++iSrc)
+                    {
+                        const auto v =
+                            XMMReg4Double::Load4Val(papdfSrc[iSrc] + i);
+                        const auto isNoData = noData.IsNoData4(v);
+                        // NoData values are skipped
+                        sum = XMMReg4Double::Ternary(isNoData, sum, sum + v);
+                        anyNoData = Or4(anyNoData, isNoData);
+                    }
+                    if (bPropagateNoData)
+                    {
+                        sum = XMMReg4Double::Ternary(
+                            anyNoData, XMMReg4Double::Set1(noData.dfNoData),
+                            sum);
+                    }
+                    return sum;
                 }
-            }
+#endif
+            };
+
+            const Kernel kernel{NoDataChecker(bHasNoData, dfNoData), nSources,
+                                dfK, bPropagateNoData};
+            ApplyElementWise<true>(kernel, papoSources, nSources, pData,
+                                   nXSize, nYSize, eSrcType, eBufType,
+                                   nPixelSpace, nLineSpace);
         }
     }
 
@@ -1383,28 +1567,34 @@ static CPLErr DiffPixelFunc(void **papoSources, int nSources, void *pData,
     }
     else
     {
-        /* ---- Set pixels ---- */
-        size_t ii = 0;
-        for (int iLine = 0; iLine < nYSize; ++iLine)
+        struct Kernel
         {
-            for (int iCol = 0; iCol < nXSize; ++iCol, ++ii)
-            {
-                const double dfA = GetSrcVal(papoSources[0], eSrcType, ii);
-                const double dfB = GetSrcVal(papoSources[1], eSrcType, ii);
+            NoDataChecker noData;
 
-                const double dfPixVal =
-                    bHasNoData &&
-                            (IsNoData(dfA, dfNoData) || IsNoData(dfB, dfNoData))
-                        ? dfNoData
-                        : dfA - dfB;
+            double Compute(const double *const *papdfSrc, int i) const
+            {
+                const double dfA = papdfSrc[0][i];
+                const double dfB = papdfSrc[1][i];
+                return noData.IsNoData(dfA) || noData.IsNoData(dfB)
+                           ? noData.dfNoData
+                           : dfA - dfB;
+            }
 
-                GDALCopyWords(&dfPixVal, GDT_Float64, 0,
-                              static_cast<GByte *>(pData) +
-                                  static_cast<GSpacing>(nLineSpace) * iLine +
-                                  iCol * nPixelSpace,
-                              eBufType, nPixelSpace, 1);
+#ifdef USE_SSE2
+            XMMReg4Double Compute4(const double *const *papdfSrc, int i) const
+            {
+                const auto a = XMMReg4Double::Load4Val(papdfSrc[0] + i);
+                const auto b = XMMReg4Double::Load4Val(papdfSrc[1] + i);
+                return noData.Select4(b, noData.Select4(a, a - b));
             }
-        }
+#endif
+        };
+
+        /* ---- Set pixels ---- */
+        const Kernel kernel{NoDataChecker(bHasNoData, dfNoData)};
+        ApplyElementWise<true>(kernel, papoSources, nSources, pData, nXSize,
+                               nYSize, eSrcType, eBufType, nPixelSpace,
+                               nLineSpace);
     }
 
     /* ---- Return success ---- */
@@ -1487,24 +1677,26 @@ static CPLErr MulPixelFunc(void **papoSources, int nSources, void *pData,
     }
     else
     {
-        /* ---- Set pixels ---- */
-        size_t ii = 0;
-        for (int iLine = 0; iLine < nYSize; ++iLine)
+        struct Kernel
         {
-            for (int iCol = 0; iCol < nXSize; ++iCol, ++ii)
+            NoDataChecker noData;
+            int nSources;
+            double dfK;
+            bool bPropagateNoData;
+
+            double Compute(const double *const *papdfSrc, int i) const
             {
                 double dfPixVal = dfK;  // Not complex.
 
                 for (int iSrc = 0; iSrc < nSources; ++iSrc)
                 {
-                    const double dfVal =
-                        GetSrcVal(papoSources[iSrc], eSrcType, ii);
+                    const double dfVal = papdfSrc[iSrc][i];
 
-                    if (bHasNoData && IsNoData(dfVal, dfNoData))
+                    if (noData.IsNoData(dfVal))
                     {
                         if (bPropagateNoData)
                         {
-                            dfPixVal = dfNoData;
+                            dfPixVal = noData.dfNoData;
                             break;
                         }
                     }
@@ -1513,14 +1705,45 @@ static CPLErr MulPixelFunc(void **papoSources, int nSources, void *pData,
                         dfPixVal *= dfVal;
                     }
                 }
+                return dfPixVal;
+            }
 
-                GDALCopyWords(&dfPixVal, GDT_Float64, 0,
-                              static_cast<GByte *>(pData) +
-                                  static_cast<GSpacing>(nLineSpace) * iLine +
-                                  iCol * nPixelSpace,
-                              eBufType, nPixelSpace, 1);
+#ifdef USE_SSE2
+            XMMReg4Double Compute4(const double *const *papdfSrc, int i) const
+            {
+                auto res = XMMReg4Double::Set1(dfK);
+                if (!noData.bHasNoData)
+                {
+                    for (int iSrc = 0; iSrc < nSources; ++iSrc)
+                        res *= XMMReg4Double::Load4Val(papdfSrc[iSrc] + i);
+                    return res;
+                }
+
+                auto anyNoData = XMMReg4Double::Zero();
+                for (int iSrc = 0; iSrc < nSources; ++iSrc)
+                {
+                    const auto v = XMMReg4Double::Load4Val(papdfSrc[iSrc] + i);
+                    const auto isNoData = noData.IsNoData4(v);
+                    // NoData values are skipped
+                    res = XMMReg4Double::Ternary(isNoData, res, res * v);
+                    anyNoData = Or4(anyNoData, isNoData);
+                }
+                if (bPropagateNoData)
+                {
+                    res = XMMReg4Double::Ternary(
+                        anyNoData, XMMReg4Double::Set1(noData.dfNoData), res);
+                }
+                return res;
             }
-        }
+#endif
+        };
+
+        /* ---- Set pixels ---- */
+        const Kernel kernel{NoDataChecker(bHasNoData, dfNoData), nSources, dfK,
+                            bPropagateNoData};
+        ApplyElementWise<true>(kernel, papoSources, nSources, pData, nXSize,
+                               nYSize, eSrcType, eBufType, nPixelSpace,
+                               nLineSpace);
     }
 
     /* ---- Return success ---- */
@@ -1589,18 +1812,17 @@ static CPLErr DivPixelFunc(void **papoSources, int nSources, void *pData,
     }
     else
     {
-        /* ---- Set pixels ---- */
-        size_t ii = 0;
-        for (int iLine = 0; iLine < nYSize; ++iLine)
+        struct Kernel
         {
-            for (int iCol = 0; iCol < nXSize; ++iCol, ++ii)
+            NoDataChecker noData;
+
+            double Compute(const double *const *papdfSrc, int i) const
             {
-                const double dfNum = GetSrcVal(papoSources[0], eSrcType, ii);
-                const double dfDenom = GetSrcVal(papoSources[1], eSrcType, ii);
+                const double dfNum = papdfSrc[0][i];
+                const double dfDenom = papdfSrc[1][i];
 
-                double dfPixVal = dfNoData;
-                if (!bHasNoData || (!IsNoData(dfNum, dfNoData) &&
-                                    !IsNoData(dfDenom, dfNoData)))
+                double dfPixVal = noData.dfNoData;
+                if (!noData.IsNoData(dfNum) && !noData.IsNoData(dfDenom))
                 {
                     // coverity[divide_by_zero]
                     dfPixVal =
@@ -1614,14 +1836,29 @@ static CPLErr DivPixelFunc(void **papoSources, int nSources, void *pData,
 #endif
                         ;
                 }
+                return dfPixVal;
+            }
 
-                GDALCopyWords(&dfPixVal, GDT_Float64, 0,
-                              static_cast<GByte *>(pData) +
-                                  static_cast<GSpacing>(nLineSpace) * iLine +
-                                  iCol * nPixelSpace,
-                              eBufType, nPixelSpace, 1);
+#ifdef USE_SSE2
+            XMMReg4Double Compute4(const double *const *papdfSrc, int i) const
+            {
+                const auto num = XMMReg4Double::Load4Val(papdfSrc[0] + i);
+                const auto denom = XMMReg4Double::Load4Val(papdfSrc[1] + i);
+                const auto res = XMMReg4Double::Ternary(
+                    XMMReg4Double::Equals(denom, XMMReg4Double::Zero()),
+                    XMMReg4Double::Set1(
+                        std::numeric_limits<double>::infinity()),
+                    num / denom);
+                return noData.Select4(denom, noData.Select4(num, res));
             }
-        }
+#endif
+        };
+
+        /* ---- Set pixels ---- */
+        const Kernel kernel{NoDataChecker(bHasNoData, dfNoData)};
+        ApplyElementWise<true>(kernel, papoSources, nSources, pData, nXSize,
+                               nYSize, eSrcType, eBufType, nPixelSpace,
+                               nLineSpace);
     }
 
     /* ---- Return success ---- */
@@ -1756,18 +1993,18 @@ static CPLErr InvPixelFunc(void **papoSources, int nSources, void *pData,
     }
     else
     {
-        /* ---- Set pixels ---- */
-        size_t ii = 0;
-        for (int iLine = 0; iLine < nYSize; ++iLine)
+        struct Kernel
         {
-            for (int iCol = 0; iCol < nXSize; ++iCol, ++ii)
+            NoDataChecker noData;
+            double dfK;
+
+            double Compute(const double *const *papdfSrc, int i) const
             {
-                // Source raster pixels may be obtained with GetSrcVal macro.
                 // Not complex.
-                const double dfVal = GetSrcVal(papoSources[0], eSrcType, ii);
-                double dfPixVal = dfNoData;
+                const double dfVal = papdfSrc[0][i];
+                double dfPixVal = noData.dfNoData;
 
-                if (!bHasNoData || !IsNoData(dfVal, dfNoData))
+                if (!noData.IsNoData(dfVal))
                 {
                     dfPixVal =
                         dfVal == 0
@@ -1780,14 +2017,28 @@ static CPLErr InvPixelFunc(void **papoSources, int nSources, void *pData,
 #endif
                         ;
                 }
+                return dfPixVal;
+            }
 
-                GDALCopyWords(&dfPixVal, GDT_Float64, 0,
-                              static_cast<GByte *>(pData) +
-                                  static_cast<GSpacing>(nLineSpace) * iLine +
-                                  iCol * nPixelSpace,
-                              eBufType, nPixelSpace, 1);
+#ifdef USE_SSE2
+            XMMReg4Double Compute4(const double *const *papdfSrc, int i) const
+            {
+                const auto v = XMMReg4Double::Load4Val(papdfSrc[0] + i);
+                const auto res = XMMReg4Double::Ternary(
+                    XMMReg4Double::Equals(v, XMMReg4Double::Zero()),
+                    XMMReg4Double::Set1(
+                        std::numeric_limits<double>::infinity()),
+                    XMMReg4Double::Set1(dfK) / v);
+                return noData.Select4(v, res);
             }
-        }
+#endif
+        };
+
+        /* ---- Set pixels ---- */
+        const Kernel kernel{NoDataChecker(bHasNoData, dfNoData), dfK};
+        ApplyElementWise<true>(kernel, papoSources, nSources, pData, nXSize,
+                               nYSize, eSrcType, eBufType, nPixelSpace,
+                               nLineSpace);
     }
 
     /* ---- Return success ---- */
@@ -1958,26 +2209,25 @@ static CPLErr Log10PixelFuncHelper(void **papoSources, int nSources,
     }
     else
     {
-        /* ---- Set pixels ---- */
-        size_t ii = 0;
-        for (int iLine = 0; iLine < nYSize; ++iLine)
+        struct Kernel
         {
-            for (int iCol = 0; iCol < nXSize; ++iCol, ++ii)
-            {
-                // Source raster pixels may be obtained with GetSrcVal macro.
-                const double dfSrcVal = GetSrcVal(papoSources[0], eSrcType, ii);
-                const double dfPixVal =
-                    bHasNoData && IsNoData(dfSrcVal, dfNoData)
-                        ? dfNoData
-                        : fact * std::log10(std::abs(dfSrcVal));
+            NoDataChecker noData;
+            double fact;
 
-                GDALCopyWords(&dfPixVal, GDT_Float64, 0,
-                              static_cast<GByte *>(pData) +
-                                  static_cast<GSpacing>(nLineSpace) * iLine +
-                                  iCol * nPixelSpace,
-                              eBufType, nPixelSpace, 1);
+            double Compute(const double *const *papdfSrc, int i) const
+            {
+                const double dfSrcVal = papdfSrc[0][i];
+                return noData.IsNoData(dfSrcVal)
+                           ? noData.dfNoData
+                           : fact * std::log10(std::abs(dfSrcVal));
             }
-        }
+        };
+
+        /* ---- Set pixels ---- */
+        const Kernel kernel{NoDataChecker(bHasNoData, dfNoData), fact};
+        ApplyElementWise<false>(kernel, papoSources, nSources, pData, nXSize,
+                                nYSize, eSrcType, eBufType, nPixelSpace,
+                                nLineSpace);
     }
 
     /* ---- Return success ---- */
@@ -2037,25 +2287,25 @@ static CPLErr ExpPixelFuncHelper(void **papoSources, int nSources, void *pData,
     if (bHasNoData && FetchDoubleArg(papszArgs, "NoData", &dfNoData) != CE_None)
         return CE_Failure;
 
-    /* ---- Set pixels ---- */
-    size_t ii = 0;
-    for (int iLine = 0; iLine < nYSize; ++iLine)
+    struct Kernel
     {
-        for (int iCol = 0; iCol < nXSize; ++iCol, ++ii)
-        {
-            // Source raster pixels may be obtained with GetSrcVal macro.
-            const double dfVal = GetSrcVal(papoSources[0], eSrcType, ii);
-            const double dfPixVal = bHasNoData && IsNoData(dfVal, dfNoData)
-                                        ? dfNoData
-                                        : pow(base, dfVal * fact);
+        NoDataChecker noData;
+        double base;
+        double fact;
 
-            GDALCopyWords(&dfPixVal, GDT_Float64, 0,
-                          static_cast<GByte *>(pData) +
-                              static_cast<GSpacing>(nLineSpace) * iLine +
-                              iCol * nPixelSpace,
-                          eBufType, nPixelSpace, 1);
+        double Compute(const double *const *papdfSrc, int i) const
+        {
+            const double dfVal = papdfSrc[0][i];
+            return noData.IsNoData(dfVal) ? noData.dfNoData
+                                          : pow(base, dfVal * fact);
         }
-    }
+    };
+
+    /* ---- Set pixels ---- */
+    const Kernel kernel{NoDataChecker(bHasNoData, dfNoData), base, fact};
+    ApplyElementWise<false>(kernel, papoSources, nSources, pData, nXSize,
+                            nYSize, eSrcType, eBufType, nPixelSpace,
+                            nLineSpace);
 
     /* ---- Return success ---- */
     return CE_None;
@@ -2135,25 +2385,24 @@ static CPLErr PowPixelFunc(void **papoSources, int nSources, void *pData,
     if (bHasNoData && FetchDoubleArg(papszArgs, "NoData", &dfNoData) != CE_None)
         return CE_Failure;
 
-    /* ---- Set pixels ---- */
-    size_t ii = 0;
-    for (int iLine = 0; iLine < nYSize; ++iLine)
+    struct Kernel
     {
-        for (int iCol = 0; iCol < nXSize; ++iCol, ++ii)
-        {
-            const double dfVal = GetSrcVal(papoSources[0], eSrcType, ii);
+        NoDataChecker noData;
+        double power;
 
-            const double dfPixVal = bHasNoData && IsNoData(dfVal, dfNoData)
-                                        ? dfNoData
-                                        : std::pow(dfVal, power);
-
-            GDALCopyWords(&dfPixVal, GDT_Float64, 0,
-                          static_cast<GByte *>(pData) +
-                              static_cast<GSpacing>(nLineSpace) * iLine +
-                              iCol * nPixelSpace,
-                          eBufType, nPixelSpace, 1);
+        double Compute(const double *const *papdfSrc, int i) const
+        {
+            const double dfVal = papdfSrc[0][i];
+            return noData.IsNoData(dfVal) ? noData.dfNoData
+                                          : std::pow(dfVal, power);
         }
-    }
+    };
+
+    /* ---- Set pixels ---- */
+    const Kernel kernel{NoDataChecker(bHasNoData, dfNoData), power};
+    ApplyElementWise<false>(kernel, papoSources, nSources, pData, nXSize,
+                            nYSize, eSrcType, eBufType, nPixelSpace,
+                            nLineSpace);
 
     /* ---- Return success ---- */
     return CE_None;
@@ -2311,23 +2560,38 @@ static CPLErr ReplaceNoDataPixelFunc(void **papoSources, int nSources,
         return CE_Failure;
     }
 
-    /* ---- Set pixels ---- */
-    size_t ii = 0;
-    for (int iLine = 0; iLine < nYSize; ++iLine)
+    struct Kernel
     {
-        for (int iCol = 0; iCol < nXSize; ++iCol, ++ii)
+        double dfOldNoData;
+        double dfNewNoData;
+
+        double Compute(const double *const *papdfSrc, int i) const
         {
-            double dfPixVal = GetSrcVal(papoSources[0], eSrcType, ii);
+            double dfPixVal = papdfSrc[0][i];
             if (dfPixVal == dfOldNoData || std::isnan(dfPixVal))
                 dfPixVal = dfNewNoData;
+            return dfPixVal;
+        }
 
-            GDALCopyWords(&dfPixVal, GDT_Float64, 0,
-                          static_cast<GByte *>(pData) +
-                              static_cast<GSpacing>(nLineSpace) * iLine +
-                              iCol * nPixelSpace,
-                          eBufType, nPixelSpace, 1);
+#ifdef USE_SSE2
+        XMMReg4Double Compute4(const double *const *papdfSrc, int i) const
+        {
+            const auto v = XMMReg4Double::Load4Val(papdfSrc[0] + i);
+            const auto newNoData = XMMReg4Double::Set1(dfNewNoData);
+            // NaN lanes are the ones that are not equal to themselves
+            return XMMReg4Double::Ternary(
+                XMMReg4Double::Equals(v, XMMReg4Double::Set1(dfOldNoData)),
+                newNoData,
+                XMMReg4Double::Ternary(XMMReg4Double::Equals(v, v), v,
+                                       newNoData));
         }
-    }
+#endif
+    };
+
+    /* ---- Set pixels ---- */
+    const Kernel kernel{dfOldNoData, dfNewNoData};
+    ApplyElementWise<true>(kernel, papoSources, nSources, pData, nXSize, nYSize,
+                           eSrcType, eBufType, nPixelSpace, nLineSpace);
 
     /* ---- Return success ---- */
     return CE_None;
@@ -2366,25 +2630,34 @@ static CPLErr ScalePixelFunc(void **papoSources, int nSources, void *pData,
     if (FetchDoubleArg(papszArgs, "offset", &dfOffset) != CE_None)
         return CE_Failure;
 
-    /* ---- Set pixels ---- */
-    size_t ii = 0;
-    for (int iLine = 0; iLine < nYSize; ++iLine)
+    struct Kernel
     {
-        for (int iCol = 0; iCol < nXSize; ++iCol, ++ii)
-        {
-            const double dfVal = GetSrcVal(papoSources[0], eSrcType, ii);
+        NoDataChecker noData;
+        double dfScale;
+        double dfOffset;
 
-            const double dfPixVal = bHasNoData && IsNoData(dfVal, dfNoData)
-                                        ? dfNoData
-                                        : dfVal * dfScale + dfOffset;
+        double Compute(const double *const *papdfSrc, int i) const
+        {
+            const double dfVal = papdfSrc[0][i];
+            return noData.IsNoData(dfVal) ? noData.dfNoData
+                                          : dfVal * dfScale + dfOffset;
+        }
 
-            GDALCopyWords(&dfPixVal, GDT_Float64, 0,
-                          static_cast<GByte *>(pData) +
-                              static_cast<GSpacing>(nLineSpace) * iLine +
-                              iCol * nPixelSpace,
-                          eBufType, nPixelSpace, 1);
+#ifdef USE_SSE2
+        XMMReg4Double Compute4(const double *const *papdfSrc, int i) const
+        {
+            const auto v = XMMReg4Double::Load4Val(papdfSrc[0] + i);
+            return noData.Select4(v, v * XMMReg4Double::Set1(dfScale) +
+                                         XMMReg4Double::Set1(dfOffset));
         }
-    }
+#endif
+    };
+
+    /* ---- Set pixels ---- */
+    const Kernel kernel{NoDataChecker(bHasNoData, dfNoData), dfScale,
+                        dfOffset};
+    ApplyElementWise<true>(kernel, papoSources, nSources, pData, nXSize, nYSize,
+                           eSrcType, eBufType, nPixelSpace, nLineSpace);
 
     /* ---- Return success ---- */
     return CE_None;
@@ -2416,19 +2689,18 @@ static CPLErr NormDiffPixelFunc(void **papoSources, int nSources, void *pData,
     if (bHasNoData && FetchDoubleArg(papszArgs, "NoData", &dfNoData) != CE_None)
         return CE_Failure;
 
-    /* ---- Set pixels ---- */
-    size_t ii = 0;
-    for (int iLine = 0; iLine < nYSize; ++iLine)
+    struct Kernel
     {
-        for (int iCol = 0; iCol < nXSize; ++iCol, ++ii)
+        NoDataChecker noData;
+
+        double Compute(const double *const *papdfSrc, int i) const
         {
-            const double dfLeftVal = GetSrcVal(papoSources[0], eSrcType, ii);
-            const double dfRightVal = GetSrcVal(papoSources[1], eSrcType, ii);
+            const double dfLeftVal = papdfSrc[0][i];
+            const double dfRightVal = papdfSrc[1][i];
 
-            double dfPixVal = dfNoData;
+            double dfPixVal = noData.dfNoData;
 
-            if (!bHasNoData || (!IsNoData(dfLeftVal, dfNoData) &&
-                                !IsNoData(dfRightVal, dfNoData)))
+            if (!noData.IsNoData(dfLeftVal) && !noData.IsNoData(dfRightVal))
             {
                 const double dfDenom = (dfLeftVal + dfRightVal);
                 // coverity[divide_by_zero]
@@ -2443,14 +2715,28 @@ static CPLErr NormDiffPixelFunc(void **papoSources, int nSources, void *pData,
 #endif
                     ;
             }
+            return dfPixVal;
+        }
 
-            GDALCopyWords(&dfPixVal, GDT_Float64, 0,
-                          static_cast<GByte *>(pData) +
-                              static_cast<GSpacing>(nLineSpace) * iLine +
-                              iCol * nPixelSpace,
-                          eBufType, nPixelSpace, 1);
+#ifdef USE_SSE2
+        XMMReg4Double Compute4(const double *const *papdfSrc, int i) const
+        {
+            const auto left = XMMReg4Double::Load4Val(papdfSrc[0] + i);
+            const auto right = XMMReg4Double::Load4Val(papdfSrc[1] + i);
+            const auto denom = left + right;
+            const auto res = XMMReg4Double::Ternary(
+                XMMReg4Double::Equals(denom, XMMReg4Double::Zero()),
+                XMMReg4Double::Set1(std::numeric_limits<double>::infinity()),
+                (left - right) / denom);
+            return noData.Select4(right, noData.Select4(left, res));
         }
-    }
+#endif
+    };
+
+    /* ---- Set pixels ---- */
+    const Kernel kernel{NoDataChecker(bHasNoData, dfNoData)};
+    ApplyElementWise<true>(kernel, papoSources, nSources, pData, nXSize, nYSize,
+                           eSrcType, eBufType, nPixelSpace, nLineSpace);
 
     /* ---- Return success ---- */
     return CE_None;
@@ -2924,6 +3210,83 @@ static const char pszExprPixelFuncMetadata[] =
     "   <Argument type='builtin' value='geotransform' />"
     "</PixelFunctionArgumentsList>";
 
+/************************************************************************/
+/*                      ExprPixelFuncVectorized()                       */
+/************************************************************************/
+
+static CPLErr ExprPixelFuncVectorized(
+    const gdal::VectorizedExpression &oExpression, void **papoSources,
+    int nSources, void *pData, int nXSize, int nYSize, GDALDataType eSrcType,
+    GDALDataType eBufType, int nPixelSpace, int nLineSpace,
+    bool bPropagateNoData, double dfNoData)
+{
+    std::unique_ptr<double, VSIFreeReleaser> padfResults(
+        static_cast<double *>(VSI_MALLOC2_VERBOSE(nXSize, sizeof(double))));
+    if (!padfResults)
+        return CE_Failure;
+
+    // Float64 sources can be used in place. Others are converted one line
+    // at a time.
+    std::unique_ptr<double, VSIFreeReleaser> padfSrcLines;
+    if (eSrcType != GDT_Float64)
+    {
+        padfSrcLines.reset(static_cast<double *>(
+            VSI_MALLOC3_VERBOSE(nSources, nXSize, sizeof(double))));
+        if (!padfSrcLines)
+            return CE_Failure;
+    }
+    const int nSrcTypeSize = GDALGetDataTypeSizeBytes(eSrcType);
+    std::vector<const double *> apadfVariables(nSources);
+
+    for (int iLine = 0; iLine < nYSize; ++iLine)
+    {
+        const size_t nLineOffset = static_cast<size_t>(iLine) * nXSize;
+        for (int iSrc = 0; iSrc < nSources; ++iSrc)
+        {
+            if (eSrcType == GDT_Float64)
+            {
+                apadfVariables[iSrc] =
+                    static_cast<const double *>(papoSources[iSrc]) +
+                    nLineOffset;
+            }
+            else
+            {
+                double *padfSrcLine =
+                    padfSrcLines.get() + static_cast<size_t>(iSrc) * nXSize;
+                GDALCopyWords(static_cast<const GByte *>(papoSources[iSrc]) +
+                                  nLineOffset * nSrcTypeSize,
+                              eSrcType, nSrcTypeSize, padfSrcLine,
+                              GDT_Float64, sizeof(double), nXSize);
+                apadfVariables[iSrc] = padfSrcLine;
+            }
+        }
+
+        oExpression.Evaluate(apadfVariables.data(), nXSize,
+                             padfResults.get());
+
+        if (bPropagateNoData)
+        {
+            double *padfLineResults = padfResults.get();
+            for (int iSrc = 0; iSrc < nSources; ++iSrc)
+            {
+                const double *padfSrc = apadfVariables[iSrc];
+                for (int iCol = 0; iCol < nXSize; ++iCol)
+                {
+                    if (IsNoData(padfSrc[iCol], dfNoData))
+                        padfLineResults[iCol] = dfNoData;
+                }
+            }
+        }
+
+        GDALCopyWords(padfResults.get(), GDT_Float64, sizeof(double),
+                      static_cast<GByte *>(pData) +
+                          static_cast<GSpacing>(nLineSpace) * iLine,
+                      eBufType, nPixelSpace, nXSize);
+    }
+
+    return CE_None;
+}
+
 static CPLErr ExprPixelFunc(void **papoSources, int nSources, void *pData,
                             int nXSize, int nYSize, GDALDataType eSrcType,
                             GDALDataType eBufType, int nPixelSpace,
@@ -3023,6 +3386,31 @@ static CPLErr ExprPixelFunc(void **papoSources, int nSources, void *pData,
         }
     }
 
+    // Evaluate whole lines at once when the expression only uses the subset
+    // of the grammar handled by VectorizedExpression, which is much faster
+    // than evaluating it pixel by pixel.
+    if (!includeCenterCoords && !strstr(pszExpression, "BANDS") &&
+        CPLTestBool(
+            CPLGetConfigOption("GDAL_VRT_EXPRESSION_VECTORIZED", "YES")))
+    {
+        std::vector<std::pair<std::string, double>> aoConstants;
+        if (bHasNoData)
+            aoConstants.emplace_back("NODATA", dfNoData);
+        const auto poVectorizedExpression =
+            gdal::VectorizedExpression::Compile(
+                pszExpression, pszDialect,
+                std::vector<std::string>(aosSourceNames.begin(),
+                                         aosSourceNames.end()),
+                aoConstants);
+        if (poVectorizedExpression)
+        {
+            return ExprPixelFuncVectorized(
+                *poVectorizedExpression, papoSources, nSources, pData, nXSize,
+                nYSize, eSrcType, eBufType, nPixelSpace, nLineSpace,
+                bHasNoData && bPropagateNoData, dfNoData);
+        }
+    }
+
     {
         int iSource = 0;
         for (const auto &osName : aosSourceNames)
@@ -14,7 +14,10 @@
 
 #include "cpl_error.h"
 
+#include <memory>
+#include <string>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 namespace gdal
@@ -101,6 +104,67 @@ class MathExpression /* non final */
 
 /*! @cond Doxygen_Suppress */
 
+/**
+ * Class to evaluate an expression on arrays of values.
+ *
+ * The expression is compiled once into a sequence of register-based
+ * instructions, each of them being applied to a chunk of values before
+ * moving to the next one, instead of walking the expression tree for each
+ * pixel.
+ *
+ * Only the subset of the muparser and exprtk grammars whose meaning is
+ * unambiguous is handled: arithmetic, comparison and logical operators,
+ * the muparser ternary operator, and common mathematical functions.
+ * Compile() returns nullptr for other expressions, in which case
+ * MathExpression must be used.
+ *
+ * @since 3.13
+ */
+class VectorizedExpression
+{
+  public:
+    ~VectorizedExpression();
+
+    /**
+     * Compile an expression.
+     *
+     * @param pszExpression The body of the expression, e.g. "X + 3"
+     * @param pszDialect The expression dialect, "muparser" or "exprtk"
+     * @param aosVariables Names of the variables, in the order of the arrays
+     *                     passed to Evaluate()
+     * @param aoConstants Names and values of additional constants
+     * @return a VectorizedExpression, or nullptr if the expression cannot be
+     *         handled. No error is emitted in that case.
+     */
+    static std::unique_ptr<VectorizedExpression>
+    Compile(const char *pszExpression, const char *pszDialect,
+            const std::vector<std::string> &aosVariables,
+            const std::vector<std::pair<std::string, double>> &aoConstants);
+
+    /**
+     * Evaluate the expression on nCount values.
+     *
+     * This method may be called concurrently from several threads.
+     *
+     * @param papadfVariables Array of pointers to nCount values for each
+     *                        variable.
+     * @param nCount Number of values
+     * @param padfResults Array of nCount values receiving the results.
+     */
+    void Evaluate(const double *const *papadfVariables, size_t nCount,
+                  double *padfResults) const;
+
+    class Impl;
+
+  private:
+    VectorizedExpression();
+
+    std::unique_ptr<Impl> m_pImpl;
+
+    VectorizedExpression(const VectorizedExpression &) = delete;
+    VectorizedExpression &operator=(const VectorizedExpression &) = delete;
+};
+
 #if GDAL_VRT_ENABLE_EXPRTK
 
 /**
@@ -0,0 +1,962 @@
+/******************************************************************************
+ *
+ * Project:  Virtual GDAL Datasets
+ * Purpose:  Implementation of VectorizedExpression
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "vrtexpression.h"
+#include "cpl_string.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace gdal
+{
+
+/*! @cond Doxygen_Suppress */
+
+namespace
+{
+
+// Number of values processed by each instruction before moving to the next
+// one. Small enough for the registers of most expressions to fit in L1/L2
+// cache, large enough to amortize the dispatch of instructions.
+constexpr size_t CHUNK_SIZE = 256;
+
+// Maximum nesting level of sub-expressions, to protect against stack
+// overflows. Deeper expressions are left to the interpreter.
+constexpr int MAX_NESTING_DEPTH = 64;
+
+enum class Op
+{
+    ADD,
+    SUB,
+    MUL,
+    DIV,
+    POW,
+    NEG,
+    LT,
+    LE,
+    GT,
+    GE,
+    EQ,
+    NE,
+    AND,
+    OR,
+    SELECT,
+    MIN,
+    MAX,
+    SQRT,
+    ABS,
+    FUNC,
+};
+
+typedef double (*UnaryFunc)(double);
+
+struct Operand
+{
+    bool bIsVariable = false;  // otherwise a register
+    int nIndex = -1;
+};
+
+struct Instruction
+{
+    Op eOp = Op::ADD;
+    int nDst = -1;
+    Operand a{};
+    Operand b{};
+    Operand c{};
+    UnaryFunc pfnFunc = nullptr;
+};
+
+/************************************************************************/
+/*                         ExecuteInstruction()                         */
+/************************************************************************/
+
+// Written as simple loops over contiguous arrays without aliasing
+// restrictions on the destination (which may be one of the sources), so that
+// compilers can vectorize them.
+static void ExecuteInstruction(Op eOp, UnaryFunc pfnFunc, double *out,
+                               const double *a, const double *b,
+                               const double *c, size_t n)
+{
+    switch (eOp)
+    {
+        case Op::ADD:
+            for (size_t i = 0; i < n; ++i)
+                out[i] = a[i] + b[i];
+            break;
+        case Op::SUB:
+            for (size_t i = 0; i < n; ++i)
+                out[i] = a[i] - b[i];
+            break;
+        case Op::MUL:
+            for (size_t i = 0; i < n; ++i)
+                out[i] = a[i] * b[i];
+            break;
+        case Op::DIV:
+            for (size_t i = 0; i < n; ++i)
+                out[i] = a[i] / b[i];
+            break;
+        case Op::POW:
+            for (size_t i = 0; i < n; ++i)
+                out[i] = std::pow(a[i], b[i]);
+            break;
+        case Op::NEG:
+            for (size_t i = 0; i < n; ++i)
+                out[i] = -a[i];
+            break;
+        case Op::LT:
+            for (size_t i = 0; i < n; ++i)
+                out[i] = a[i] < b[i] ? 1.0 : 0.0;
+            break;
+        case Op::LE:
+            for (size_t i = 0; i < n; ++i)
+                out[i] = a[i] <= b[i] ? 1.0 : 0.0;
+            break;
+        case Op::GT:
+            for (size_t i = 0; i < n; ++i)
+                out[i] = a[i] > b[i] ? 1.0 : 0.0;
+            break;
+        case Op::GE:
+            for (size_t i = 0; i < n; ++i)
+                out[i] = a[i] >= b[i] ? 1.0 : 0.0;
+            break;
+        case Op::EQ:
+            for (size_t i = 0; i < n; ++i)
+                out[i] = a[i] == b[i] ? 1.0 : 0.0;
+            break;
+        case Op::NE:
+            for (size_t i = 0; i < n; ++i)
+                out[i] = a[i] != b[i] ? 1.0 : 0.0;
+            break;
+        case Op::AND:
+            for (size_t i = 0; i < n; ++i)
+                out[i] = ((a[i] != 0) & (b[i] != 0)) ? 1.0 : 0.0;
+            break;
+        case Op::OR:
+            for (size_t i = 0; i < n; ++i)
+                out[i] = ((a[i] != 0) | (b[i] != 0)) ? 1.0 : 0.0;
+            break;
+        case Op::SELECT:
+            for (size_t i = 0; i < n; ++i)
+                out[i] = a[i] != 0 ? b[i] : c[i];
+            break;
+        case Op::MIN:
+            // Same argument order as muparser's Min(), which folds its
+            // arguments with std::min(), so that NaN handling matches.
+            for (size_t i = 0; i < n; ++i)
+                out[i] = std::min(a[i], b[i]);
+            break;
+        case Op::MAX:
+            for (size_t i = 0; i < n; ++i)
+                out[i] = std::max(a[i], b[i]);
+            break;
+        case Op::SQRT:
+            for (size_t i = 0; i < n; ++i)
+                out[i] = std::sqrt(a[i]);
+            break;
+        case Op::ABS:
+            for (size_t i = 0; i < n; ++i)
+                out[i] = std::fabs(a[i]);
+            break;
+        case Op::FUNC:
+            for (size_t i = 0; i < n; ++i)
+                out[i] = pfnFunc(a[i]);
+            break;
+    }
+}
+
+static double Sin(double x)
+{
+    return std::sin(x);
+}
+
+static double Cos(double x)
+{
+    return std::cos(x);
+}
+
+static double Tan(double x)
+{
+    return std::tan(x);
+}
+
+static double ASin(double x)
+{
+    return std::asin(x);
+}
+
+static double ACos(double x)
+{
+    return std::acos(x);
+}
+
+static double ATan(double x)
+{
+    return std::atan(x);
+}
+
+static double SinH(double x)
+{
+    return std::sinh(x);
+}
+
+static double CosH(double x)
+{
+    return std::cosh(x);
+}
+
+static double TanH(double x)
+{
+    return std::tanh(x);
+}
+
+static double Exp(double x)
+{
+    return std::exp(x);
+}
+
+static double Log(double x)
+{
+    return std::log(x);
+}
+
+static double Log10(double x)
+{
+    return std::log10(x);
+}
+
+static double Log2(double x)
+{
+    return std::log2(x);
+}
+
+static double Floor(double x)
+{
+    return std::floor(x);
+}
+
+static double Ceil(double x)
+{
+    return std::ceil(x);
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                   VectorizedExpression::Impl                         */
+/************************************************************************/
+
+class VectorizedExpression::Impl
+{
+  public:
+    std::vector<Instruction> m_aoInstructions{};
+    // Registers holding a constant value, filled once per Evaluate() call.
+    std::vector<std::pair<int, double>> m_aoConstantRegisters{};
+    int m_nRegisterCount = 0;
+    Operand m_oResult{};
+};
+
+namespace
+{
+
+/************************************************************************/
+/*                        ExpressionCompiler                            */
+/************************************************************************/
+
+/** Recursive descent parser that emits instructions while parsing.
+ *
+ * Any construct whose meaning is not well established in the target dialect
+ * makes compilation fail, in which case the caller is expected to fall back
+ * to the interpreter of the dialect, which remains the reference
+ * implementation.
+ */
+class ExpressionCompiler
+{
+  public:
+    ExpressionCompiler(const char *pszExpression, bool bMuParser,
+                       const std::vector<std::string> &aosVariables,
+                       const std::vector<std::pair<std::string, double>>
+                           &aoConstants,
+                       VectorizedExpression::Impl &oImpl)
+        : m_pszCur(pszExpression), m_bMuParser(bMuParser),
+          m_aosVariables(aosVariables), m_aoConstants(aoConstants),
+          m_oImpl(oImpl)
+    {
+    }
+
+    bool Compile();
+
+  private:
+    // Value known at compile time, or operand computed at run time
+    struct Value
+    {
+        bool bConstant = false;
+        double dfConstant = 0;
+        Operand oOperand{};
+    };
+
+    const char *m_pszCur;
+    const bool m_bMuParser;
+    const std::vector<std::string> &m_aosVariables;
+    const std::vector<std::pair<std::string, double>> &m_aoConstants;
+    VectorizedExpression::Impl &m_oImpl;
+    std::vector<int> m_anFreeRegisters{};
+    int m_nDepth = 0;
+    bool m_bFailed = false;
+
+    ExpressionCompiler(const ExpressionCompiler &) = delete;
+    ExpressionCompiler &operator=(const ExpressionCompiler &) = delete;
+
+    void SkipSpaces()
+    {
+        while (*m_pszCur == ' ' || *m_pszCur == '\t' || *m_pszCur == '\n' ||
+               *m_pszCur == '\r')
+            ++m_pszCur;
+    }
+
+    bool Accept(const char *pszToken)
+    {
+        SkipSpaces();
+        const size_t nLen = strlen(pszToken);
+        if (strncmp(m_pszCur, pszToken, nLen) != 0)
+            return false;
+        // Do not split '<=' into '<' and '=', or 'order' into 'or' + 'der'
+        const char chNext = m_pszCur[nLen];
+        if (isalpha(static_cast<unsigned char>(pszToken[0])) &&
+            (isalnum(static_cast<unsigned char>(chNext)) || chNext == '_'))
+            return false;
+        if ((pszToken[0] == '<' || pszToken[0] == '>') && nLen == 1 &&
+            chNext == '=')
+            return false;
+        m_pszCur += nLen;
+        return true;
+    }
+
+    bool Peek(char ch)
+    {
+        SkipSpaces();
+        return *m_pszCur == ch;
+    }
+
+    Value Fail()
+    {
+        m_bFailed = true;
+        return Value{};
+    }
+
+    static Value Constant(double dfVal)
+    {
+        Value v;
+        v.bConstant = true;
+        v.dfConstant = dfVal;
+        return v;
+    }
+
+    // Placeholder for operands not used by an instruction
+    static Value Unused()
+    {
+        return Value{};
+    }
+
+    static bool IsKnown(const Value &v)
+    {
+        return v.bConstant || v.oOperand.nIndex < 0;
+    }
+
+    int AllocateRegister()
+    {
+        if (!m_anFreeRegisters.empty())
+        {
+            const int nReg = m_anFreeRegisters.back();
+            m_anFreeRegisters.pop_back();
+            return nReg;
+        }
+        return m_oImpl.m_nRegisterCount++;
+    }
+
+    void Release(const Operand &oOperand)
+    {
+        if (!oOperand.bIsVariable && oOperand.nIndex >= 0 &&
+            !IsConstantRegister(oOperand.nIndex))
+            m_anFreeRegisters.push_back(oOperand.nIndex);
+    }
+
+    bool IsConstantRegister(int nReg) const
+    {
+        for (const auto &[nConstReg, dfVal] : m_oImpl.m_aoConstantRegisters)
+        {
+            if (nConstReg == nReg)
+                return true;
+        }
+        return false;
+    }
+
+    Operand Materialize(const Value &v)
+    {
+        if (!v.bConstant)
+            return v.oOperand;
+        for (const auto &[nReg, dfVal] : m_oImpl.m_aoConstantRegisters)
+        {
+            if (dfVal == v.dfConstant ||
+                (std::isnan(dfVal) && std::isnan(v.dfConstant)))
+            {
+                Operand o;
+                o.nIndex = nReg;
+                return o;
+            }
+        }
+        Operand o;
+        o.nIndex = m_oImpl.m_nRegisterCount++;
+        m_oImpl.m_aoConstantRegisters.emplace_back(o.nIndex, v.dfConstant);
+        return o;
+    }
+
+    Value Emit(Op eOp, const Value &a, const Value &b = Unused(),
+               const Value &c = Unused(), UnaryFunc pfnFunc = nullptr)
+    {
+        if (m_bFailed)
+            return Value{};
+        if (IsKnown(a) && IsKnown(b) && IsKnown(c))
+        {
+            double dfRes = 0;
+            ExecuteInstruction(eOp, pfnFunc, &dfRes, &a.dfConstant,
+                               &b.dfConstant, &c.dfConstant, 1);
+            return Constant(dfRes);
+        }
+
+        Instruction oInstr;
+        oInstr.eOp = eOp;
+        oInstr.pfnFunc = pfnFunc;
+        oInstr.a = Materialize(a);
+        oInstr.b = Materialize(b);
+        oInstr.c = Materialize(c);
+        Release(oInstr.a);
+        Release(oInstr.b);
+        Release(oInstr.c);
+        oInstr.nDst = AllocateRegister();
+        m_oImpl.m_aoInstructions.push_back(oInstr);
+
+        Value v;
+        v.oOperand.nIndex = oInstr.nDst;
+        return v;
+    }
+
+    Value ParseTernary();
+    Value ParseTernaryInternal();
+    Value ParseOr();
+    Value ParseAnd(bool &bHasAnd);
+    Value ParseComparison();
+    Value ParseAdditive();
+    Value ParseMultiplicative();
+    Value ParseUnary();
+    Value ParsePower(bool &bHasPowerOperator);
+    Value ParsePrimary();
+    Value ParseNumber();
+    Value ParseIdentifier();
+    Value ParseFunctionCall(const std::string &osName);
+};
+
+/************************************************************************/
+/*                               Compile()                              */
+/************************************************************************/
+
+bool ExpressionCompiler::Compile()
+{
+    const Value v = ParseTernary();
+    SkipSpaces();
+    if (m_bFailed || *m_pszCur != '\0')
+        return false;
+    m_oImpl.m_oResult = Materialize(v);
+    return true;
+}
+
+/************************************************************************/
+/*                            ParseTernary()                            */
+/************************************************************************/
+
+ExpressionCompiler::Value ExpressionCompiler::ParseTernary()
+{
+    if (m_nDepth == MAX_NESTING_DEPTH)
+        return Fail();
+    ++m_nDepth;
+    const Value v = ParseTernaryInternal();
+    --m_nDepth;
+    return v;
+}
+
+ExpressionCompiler::Value ExpressionCompiler::ParseTernaryInternal()
+{
+    Value oCond = ParseOr();
+    // The ternary operator is specific to muparser. exprtk has its own
+    // if-then-else constructs that we do not handle.
+    if (m_bMuParser && Accept("?"))
+    {
+        const Value oIfTrue = ParseTernary();
+        if (!Accept(":"))
+            return Fail();
+        const Value oIfFalse = ParseTernary();
+        if (oCond.bConstant)
+            return oCond.dfConstant != 0 ? oIfTrue : oIfFalse;
+        return Emit(Op::SELECT, oCond, oIfTrue, oIfFalse);
+    }
+    return oCond;
+}
+
+/************************************************************************/
+/*                               ParseOr()                              */
+/************************************************************************/
+
+ExpressionCompiler::Value ExpressionCompiler::ParseOr()
+{
+    bool bHasAnd = false;
+    Value v = ParseAnd(bHasAnd);
+    while (!m_bFailed && Accept(m_bMuParser ? "||" : "or"))
+    {
+        // exprtk does not give 'and' a higher precedence than 'or', contrary
+        // to muparser. Refuse to guess when they are mixed without
+        // parentheses.
+        if (!m_bMuParser && bHasAnd)
+            return Fail();
+        v = Emit(Op::OR, v, ParseAnd(bHasAnd));
+        if (!m_bMuParser && bHasAnd)
+            return Fail();
+    }
+    return v;
+}
+
+/************************************************************************/
+/*                              ParseAnd()                              */
+/************************************************************************/
+
+ExpressionCompiler::Value ExpressionCompiler::ParseAnd(bool &bHasAnd)
+{
+    bHasAnd = false;
+    Value v = ParseComparison();
+    while (!m_bFailed && Accept(m_bMuParser ? "&&" : "and"))
+    {
+        bHasAnd = true;
+        v = Emit(Op::AND, v, ParseComparison());
+    }
+    return v;
+}
+
+/************************************************************************/
+/*                          ParseComparison()                           */
+/************************************************************************/
+
+ExpressionCompiler::Value ExpressionCompiler::ParseComparison()
+{
+    Value v = ParseAdditive();
+    Op eOp;
+    if (Accept("<="))
+        eOp = Op::LE;
+    else if (Accept(">="))
+        eOp = Op::GE;
+    else if (Accept("=="))
+        eOp = Op::EQ;
+    else if (Accept("!="))
+        eOp = Op::NE;
+    else if (Accept("<"))
+        eOp = Op::LT;
+    else if (Accept(">"))
+        eOp = Op::GT;
+    else
+        return v;
+
+    // exprtk uses an epsilon based comparison for equality
+    if (!m_bMuParser && (eOp == Op::EQ || eOp == Op::NE))
+        return Fail();
+
+    v = Emit(eOp, v, ParseAdditive());
+
+    // Chained comparisons (a < b < c) are a source of confusion. Leave them
+    // to the interpreter.
+    SkipSpaces();
+    if (*m_pszCur == '<' || *m_pszCur == '>' ||
+        (*m_pszCur == '=' && m_pszCur[1] == '=') ||
+        (*m_pszCur == '!' && m_pszCur[1] == '='))
+        return Fail();
+    return v;
+}
+
+/************************************************************************/
+/*                           ParseAdditive()                            */
+/************************************************************************/
+
+ExpressionCompiler::Value ExpressionCompiler::ParseAdditive()
+{
+    Value v = ParseMultiplicative();
+    while (!m_bFailed)
+    {
+        if (Accept("+"))
+            v = Emit(Op::ADD, v, ParseMultiplicative());
+        else if (Accept("-"))
+            v = Emit(Op::SUB, v, ParseMultiplicative());
+        else
+            break;
+    }
+    return v;
+}
+
+/************************************************************************/
+/*                        ParseMultiplicative()                         */
+/************************************************************************/
+
+ExpressionCompiler::Value ExpressionCompiler::ParseMultiplicative()
+{
+    Value v = ParseUnary();
+    while (!m_bFailed)
+    {
+        if (Accept("*"))
+            v = Emit(Op::MUL, v, ParseUnary());
+        else if (Accept("/"))
+            v = Emit(Op::DIV, v, ParseUnary());
+        else
+            break;
+    }
+    return v;
+}
+
+/************************************************************************/
+/*                             ParseUnary()                             */
+/************************************************************************/
+
+ExpressionCompiler::Value ExpressionCompiler::ParseUnary()
+{
+    if (Accept("-"))
+    {
+        bool bHasPowerOperator = false;
+        const Value v = ParsePower(bHasPowerOperator);
+        // Whether -x^2 means -(x^2) or (-x)^2 depends on the parser
+        if (bHasPowerOperator)
+            return Fail();
+        return Emit(Op::NEG, v);
+    }
+    if (Accept("+"))
+    {
+        bool bHasPowerOperator = false;
+        const Value v = ParsePower(bHasPowerOperator);
+        if (bHasPowerOperator)
+            return Fail();
+        return v;
+    }
+    bool bHasPowerOperator = false;
+    return ParsePower(bHasPowerOperator);
+}
+
+/************************************************************************/
+/*                             ParsePower()                             */
+/************************************************************************/
+
+ExpressionCompiler::Value
+ExpressionCompiler::ParsePower(bool &bHasPowerOperator)
+{
+    const Value v = ParsePrimary();
+    if (m_bFailed || !Accept("^"))
+        return v;
+    bHasPowerOperator = true;
+
+    Value oExponent;
+    if (Accept("-"))
+        oExponent = Emit(Op::NEG, ParsePrimary());
+    else
+    {
+        Accept("+");
+        oExponent = ParsePrimary();
+    }
+
+    // Associativity of chained power operators differs between parsers
+    if (Peek('^'))
+        return Fail();
+    return Emit(Op::POW, v, oExponent);
+}
+
+/************************************************************************/
+/*                            ParsePrimary()                            */
+/************************************************************************/
+
+ExpressionCompiler::Value ExpressionCompiler::ParsePrimary()
+{
+    if (m_bFailed)
+        return Value{};
+    SkipSpaces();
+    const char ch = *m_pszCur;
+    if (ch == '(')
+    {
+        ++m_pszCur;
+        const Value v = ParseTernary();
+        if (!Accept(")"))
+            return Fail();
+        return v;
+    }
+    if (isdigit(static_cast<unsigned char>(ch)) || ch == '.')
+        return ParseNumber();
+    if (isalpha(static_cast<unsigned char>(ch)) || ch == '_')
+        return ParseIdentifier();
+    return Fail();
+}
+
+/************************************************************************/
+/*                            ParseNumber()                             */
+/************************************************************************/
+
+ExpressionCompiler::Value ExpressionCompiler::ParseNumber()
+{
+    const char *pszStart = m_pszCur;
+    while (isdigit(static_cast<unsigned char>(*m_pszCur)))
+        ++m_pszCur;
+    if (*m_pszCur == '.')
+    {
+        ++m_pszCur;
+        while (isdigit(static_cast<unsigned char>(*m_pszCur)))
+            ++m_pszCur;
+    }
+    if (m_pszCur == pszStart + 1 && *pszStart == '.')
+        return Fail();
+    if (*m_pszCur == 'e' || *m_pszCur == 'E')
+    {
+        const char *pszExp = m_pszCur + 1;
+        if (*pszExp == '+' || *pszExp == '-')
+            ++pszExp;
+        if (!isdigit(static_cast<unsigned char>(*pszExp)))
+            return Fail();
+        m_pszCur = pszExp;
+        while (isdigit(static_cast<unsigned char>(*m_pszCur)))
+            ++m_pszCur;
+    }
+    // A number immediately followed by letters (e.g. "2x") has a
+    // dialect-specific meaning.
+    if (isalpha(static_cast<unsigned char>(*m_pszCur)) || *m_pszCur == '_')
+        return Fail();
+    return Constant(
+        CPLAtof(std::string(pszStart, m_pszCur - pszStart).c_str()));
+}
+
+/************************************************************************/
+/*                          ParseIdentifier()                           */
+/************************************************************************/
+
+ExpressionCompiler::Value ExpressionCompiler::ParseIdentifier()
+{
+    const char *pszStart = m_pszCur;
+    while (isalnum(static_cast<unsigned char>(*m_pszCur)) || *m_pszCur == '_')
+        ++m_pszCur;
+    // Variables such as X[1], as generated by gdal raster calc
+    if (m_bMuParser && *m_pszCur == '[')
+    {
+        const char *pszEnd = strchr(m_pszCur, ']');
+        if (!pszEnd)
+            return Fail();
+        m_pszCur = pszEnd + 1;
+    }
+    const std::string osName(pszStart, m_pszCur - pszStart);
+
+    if (Peek('('))
+        return ParseFunctionCall(osName);
+
+    for (size_t i = 0; i < m_aosVariables.size(); ++i)
+    {
+        if (m_aosVariables[i] == osName)
+        {
+            Value v;
+            v.oOperand.bIsVariable = true;
+            v.oOperand.nIndex = static_cast<int>(i);
+            return v;
+        }
+    }
+    for (const auto &[osConstName, dfVal] : m_aoConstants)
+    {
+        if (osConstName == osName)
+            return Constant(dfVal);
+    }
+    if (m_bMuParser)
+    {
+        if (osName == "_pi")
+            return Constant(M_PI);
+        if (osName == "_e")
+            return Constant(std::exp(1.0));
+        if (osName == "nan" || osName == "NaN")
+            return Constant(std::numeric_limits<double>::quiet_NaN());
+    }
+    return Fail();
+}
+
+/************************************************************************/
+/*                         ParseFunctionCall()                          */
+/************************************************************************/
+
+ExpressionCompiler::Value
+ExpressionCompiler::ParseFunctionCall(const std::string &osName)
+{
+    if (!Accept("("))
+        return Fail();
+    std::vector<Value> aoArgs;
+    if (!Peek(')'))
+    {
+        do
+        {
+            aoArgs.push_back(ParseTernary());
+            if (m_bFailed)
+                return Value{};
+        } while (Accept(","));
+    }
+    if (!Accept(")"))
+        return Fail();
+
+    const struct
+    {
+        const char *pszName;
+        Op eOp;
+        UnaryFunc pfnFunc;
+    } asUnaryFunctions[] = {
+        {"sqrt", Op::SQRT, nullptr},  {"abs", Op::ABS, nullptr},
+        {"sin", Op::FUNC, Sin},       {"cos", Op::FUNC, Cos},
+        {"tan", Op::FUNC, Tan},       {"asin", Op::FUNC, ASin},
+        {"acos", Op::FUNC, ACos},     {"atan", Op::FUNC, ATan},
+        {"sinh", Op::FUNC, SinH},     {"cosh", Op::FUNC, CosH},
+        {"tanh", Op::FUNC, TanH},     {"exp", Op::FUNC, Exp},
+        {"log10", Op::FUNC, Log10},   {"log2", Op::FUNC, Log2},
+    };
+    for (const auto &sFunc : asUnaryFunctions)
+    {
+        if (osName == sFunc.pszName)
+        {
+            if (aoArgs.size() != 1)
+                return Fail();
+            return Emit(sFunc.eOp, aoArgs[0], Unused(), Unused(),
+                        sFunc.pfnFunc);
+        }
+    }
+
+    // Functions whose name or existence depend on the dialect
+    UnaryFunc pfnDialectFunc = nullptr;
+    if (m_bMuParser)
+    {
+        if (osName == "ln")
+            pfnDialectFunc = Log;
+    }
+    else
+    {
+        if (osName == "log")
+            pfnDialectFunc = Log;
+        else if (osName == "floor")
+            pfnDialectFunc = Floor;
+        else if (osName == "ceil")
+            pfnDialectFunc = Ceil;
+    }
+    if (pfnDialectFunc)
+    {
+        if (aoArgs.size() != 1)
+            return Fail();
+        return Emit(Op::FUNC, aoArgs[0], Unused(), Unused(),
+                    pfnDialectFunc);
+    }
+
+    const bool bMin = osName == "min";
+    const bool bMax = osName == "max";
+    const bool bSum = osName == "sum";
+    const bool bAvg = osName == "avg";
+    if (bMin || bMax || bSum || bAvg)
+    {
+        if (aoArgs.size() < 2)
+            return Fail();
+        const Op eOp = bMin ? Op::MIN : bMax ? Op::MAX : Op::ADD;
+        Value v = aoArgs[0];
+        for (size_t i = 1; i < aoArgs.size(); ++i)
+            v = Emit(eOp, v, aoArgs[i]);
+        if (bAvg)
+            v = Emit(Op::DIV, v, Constant(static_cast<double>(aoArgs.size())));
+        return v;
+    }
+
+    return Fail();
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                         VectorizedExpression()                       */
+/************************************************************************/
+
+VectorizedExpression::VectorizedExpression() : m_pImpl(std::make_unique<Impl>())
+{
+}
+
+VectorizedExpression::~VectorizedExpression() = default;
+
+/************************************************************************/
+/*                    VectorizedExpression::Compile()                   */
+/************************************************************************/
+
+std::unique_ptr<VectorizedExpression> VectorizedExpression::Compile(
+    const char *pszExpression, const char *pszDialect,
+    const std::vector<std::string> &aosVariables,
+    const std::vector<std::pair<std::string, double>> &aoConstants)
+{
+    const bool bMuParser = EQUAL(pszDialect, "muparser");
+    if (!bMuParser && !EQUAL(pszDialect, "exprtk"))
+        return nullptr;
+
+    std::unique_ptr<VectorizedExpression> poExpr(new VectorizedExpression());
+    ExpressionCompiler oCompiler(pszExpression, bMuParser, aosVariables,
+                                 aoConstants, *(poExpr->m_pImpl));
+    if (!oCompiler.Compile())
+        return nullptr;
+    return poExpr;
+}
+
+/************************************************************************/
+/*                   VectorizedExpression::Evaluate()                   */
+/************************************************************************/
+
+void VectorizedExpression::Evaluate(const double *const *papadfVariables,
+                                    size_t nCount, double *padfResults) const
+{
+    const auto &oImpl = *m_pImpl;
+    std::vector<double> adfRegisters(
+        static_cast<size_t>(oImpl.m_nRegisterCount) * CHUNK_SIZE);
+    for (const auto &[nReg, dfVal] : oImpl.m_aoConstantRegisters)
+    {
+        std::fill_n(adfRegisters.data() + nReg * CHUNK_SIZE, CHUNK_SIZE,
+                    dfVal);
+    }
+
+    for (size_t iStart = 0; iStart < nCount; iStart += CHUNK_SIZE)
+    {
+        const size_t n = std::min(CHUNK_SIZE, nCount - iStart);
+        const auto GetOperand = [&adfRegisters, papadfVariables,
+                                 iStart](const Operand &o) -> const double *
+        {
+            if (o.bIsVariable)
+                return papadfVariables[o.nIndex] + iStart;
+            if (o.nIndex < 0)
+                return nullptr;
+            return adfRegisters.data() + o.nIndex * CHUNK_SIZE;
+        };
+
+        for (const auto &oInstr : oImpl.m_aoInstructions)
+        {
+            ExecuteInstruction(oInstr.eOp, oInstr.pfnFunc,
+                               adfRegisters.data() + oInstr.nDst * CHUNK_SIZE,
+                               GetOperand(oInstr.a), GetOperand(oInstr.b),
+                               GetOperand(oInstr.c), n);
+        }
+
+        const double *padfResult = GetOperand(oImpl.m_oResult);
+        std::copy_n(padfResult, n, padfResults + iStart);
+    }
+}
+
+/*! @endcond */
+
+}  // namespace gdal
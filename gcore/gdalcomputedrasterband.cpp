@@ -11,10 +11,488 @@
  ****************************************************************************/
 
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 #include "vrtdataset.h"
 
+#include "cpl_worker_thread_pool.h"
+
+#include <algorithm>
 #include <cmath>
 #include <limits>
+#include <map>
+#include <optional>
+
+/************************************************************************/
+/*                       GDALComputedFusedProgram                       */
+/************************************************************************/
+
+// Evaluation of a whole tree of GDALComputedRasterBand in a single pass.
+//
+// By default, each node of the tree is evaluated by a VRTDerivedRasterBand,
+// which reads the window of interest of each of its inputs in a temporary
+// buffer, and applies its pixel function on them. Leaf bands referenced
+// several times are thus read several times, and the result of each
+// intermediate node is materialized for the whole window.
+// Here, the tree is compiled into a sequence of register-based instructions,
+// each of them being applied to a chunk of values before moving to the next
+// one, similarly to gdal::VectorizedExpression. Leaf bands are read only
+// once, and chunks of lines are evaluated in parallel.
+// The conversions to the data type of the buffers used between nodes of the
+// tree by VRTDerivedRasterBand are replicated, so that results are the same,
+// with one exception: the "mean" pixel function has specialized code paths
+// depending on the source and buffer data types (integer sum for Byte,
+// scaled sum for Float32 and Float64, running mean otherwise), whereas the
+// data type of the buffer is not known when compiling the program. The mean
+// of Byte values is computed as an exact sum divided by the number of
+// values, and the mean of other values with the same running mean as the
+// generic code path. Results may thus differ in the last bits for
+// floating-point buffers, and in rare cases of ties for the mean of Byte
+// values read in an integer buffer of another data type.
+
+class GDALComputedFusedProgram
+{
+  public:
+    enum class Op
+    {
+        CONVERT,
+        ADD,
+        SUB,
+        MUL,
+        DIV,
+        MIN,
+        MAX,
+        GT,
+        GE,
+        LT,
+        LE,
+        EQ,
+        NE,
+        LOGICAL_AND,
+        LOGICAL_OR,
+        SELECT,
+        ABS,
+        SQRT,
+        LOG,
+        LOG10,
+        POW,
+        // Running mean update: a is the mean of the c[i] - 1 previous values,
+        // b the new value.
+        MEAN_UPDATE,
+    };
+
+    int AddLeaf(GDALRasterBand *poBand);
+    int AddConstant(double dfValue);
+    int AddInstruction(Op eOp, int a, int b = -1, int c = -1,
+                       GDALDataType eDT = GDT_Unknown);
+    int AddConversion(int nReg, GDALDataType eValueDT, GDALDataType eDT);
+
+    void SetResult(int nReg)
+    {
+        m_nResultReg = nReg;
+    }
+
+    CPLErr Read(int nXOff, int nYOff, int nXSize, int nYSize, void *pData,
+                GDALDataType eBufType, GSpacing nPixelSpace,
+                GSpacing nLineSpace) const;
+
+  private:
+    // Number of values processed by each instruction before moving to the
+    // next one.
+    static constexpr size_t CHUNK_SIZE = 256;
+
+    struct Instruction
+    {
+        Op eOp = Op::ADD;
+        int nDst = -1;
+        int a = -1;
+        int b = -1;
+        int c = -1;
+        GDALDataType eDT = GDT_Unknown;
+    };
+
+    struct Context
+    {
+        std::vector<double> adfRegs{};
+        std::vector<const double *> apadfRegs{};
+        std::vector<GByte> abyConvert{};
+    };
+
+    std::vector<GDALRasterBand *> m_apoLeaves{};
+    // Pairs of (register, leaf index)
+    std::vector<std::pair<int, int>> m_anLeafRegs{};
+    // Pairs of (register, constant value)
+    std::vector<std::pair<int, double>> m_aoConstantRegs{};
+    std::vector<Instruction> m_aoInstructions{};
+    int m_nRegCount = 0;
+    int m_nResultReg = -1;
+
+    void InitContext(Context &oContext) const;
+    void Execute(const Instruction &oInstr, Context &oContext,
+                 size_t n) const;
+    void EvaluateLines(Context &oContext, const double *padfLeaves,
+                       size_t nLeafStride, int nXSize, int iStartLine,
+                       int iEndLine, GByte *pabyData, GDALDataType eBufType,
+                       GSpacing nPixelSpace, GSpacing nLineSpace) const;
+};
+
+/************************************************************************/
+/*                 GDALComputedFusedProgram::AddLeaf()                  */
+/************************************************************************/
+
+int GDALComputedFusedProgram::AddLeaf(GDALRasterBand *poBand)
+{
+    for (const auto &[nReg, iLeaf] : m_anLeafRegs)
+    {
+        if (m_apoLeaves[iLeaf] == poBand)
+            return nReg;
+    }
+    m_apoLeaves.push_back(poBand);
+    m_anLeafRegs.emplace_back(m_nRegCount,
+                              static_cast<int>(m_apoLeaves.size()) - 1);
+    return m_nRegCount++;
+}
+
+/************************************************************************/
+/*               GDALComputedFusedProgram::AddConstant()                */
+/************************************************************************/
+
+int GDALComputedFusedProgram::AddConstant(double dfValue)
+{
+    m_aoConstantRegs.emplace_back(m_nRegCount, dfValue);
+    return m_nRegCount++;
+}
+
+/************************************************************************/
+/*              GDALComputedFusedProgram::AddInstruction()              */
+/************************************************************************/
+
+int GDALComputedFusedProgram::AddInstruction(Op eOp, int a, int b, int c,
+                                             GDALDataType eDT)
+{
+    Instruction oInstr;
+    oInstr.eOp = eOp;
+    oInstr.nDst = m_nRegCount;
+    oInstr.a = a;
+    oInstr.b = b;
+    oInstr.c = c;
+    oInstr.eDT = eDT;
+    m_aoInstructions.push_back(oInstr);
+    return m_nRegCount++;
+}
+
+/************************************************************************/
+/*              GDALComputedFusedProgram::AddConversion()               */
+/************************************************************************/
+
+/** Convert the values of register nReg, which are known to be exactly
+ * representable in eValueDT, to eDT and back to double.
+ */
+int GDALComputedFusedProgram::AddConversion(int nReg, GDALDataType eValueDT,
+                                            GDALDataType eDT)
+{
+    if (eDT == GDT_Float64 || !GDALDataTypeIsConversionLossy(eValueDT, eDT))
+        return nReg;
+    return AddInstruction(Op::CONVERT, nReg, -1, -1, eDT);
+}
+
+/************************************************************************/
+/*               GDALComputedFusedProgram::InitContext()                */
+/************************************************************************/
+
+void GDALComputedFusedProgram::InitContext(Context &oContext) const
+{
+    oContext.adfRegs.resize(static_cast<size_t>(m_nRegCount) * CHUNK_SIZE);
+    oContext.apadfRegs.resize(m_nRegCount);
+    oContext.abyConvert.resize(CHUNK_SIZE * sizeof(double));
+    for (int i = 0; i < m_nRegCount; ++i)
+        oContext.apadfRegs[i] = oContext.adfRegs.data() + i * CHUNK_SIZE;
+    for (const auto &[nReg, dfValue] : m_aoConstantRegs)
+    {
+        std::fill_n(oContext.adfRegs.data() + nReg * CHUNK_SIZE, CHUNK_SIZE,
+                    dfValue);
+    }
+}
+
+/************************************************************************/
+/*                 GDALComputedFusedProgram::Execute()                  */
+/************************************************************************/
+
+// The semantics of each operation is the one of the pixel function used for
+// it by GDALComputedDataset, in the absence of nodata.
+// Written as simple loops over contiguous arrays, so that compilers can
+// vectorize them.
+void GDALComputedFusedProgram::Execute(const Instruction &oInstr,
+                                       Context &oContext, size_t n) const
+{
+    double *CPL_RESTRICT out =
+        oContext.adfRegs.data() + oInstr.nDst * CHUNK_SIZE;
+    const double *CPL_RESTRICT a = oContext.apadfRegs[oInstr.a];
+    const double *CPL_RESTRICT b =
+        oInstr.b >= 0 ? oContext.apadfRegs[oInstr.b] : nullptr;
+    const double *CPL_RESTRICT c =
+        oInstr.c >= 0 ? oContext.apadfRegs[oInstr.c] : nullptr;
+    constexpr double INF = std::numeric_limits<double>::infinity();
+    constexpr double NaN = std::numeric_limits<double>::quiet_NaN();
+
+    switch (oInstr.eOp)
+    {
+        case Op::CONVERT:
+        {
+            const int nDTSize = GDALGetDataTypeSizeBytes(oInstr.eDT);
+            GByte *pabyTmp = oContext.abyConvert.data();
+            GDALCopyWords64(a, GDT_Float64, sizeof(double), pabyTmp,
+                            oInstr.eDT, nDTSize, n);
+            GDALCopyWords64(pabyTmp, oInstr.eDT, nDTSize, out, GDT_Float64,
+                            sizeof(double), n);
+            break;
+        }
+        case Op::ADD:
+            for (size_t i = 0; i < n; ++i)
+                out[i] = a[i] + b[i];
+            break;
+        case Op::SUB:
+            for (size_t i = 0; i < n; ++i)
+                out[i] = a[i] - b[i];
+            break;
+        case Op::MUL:
+            for (size_t i = 0; i < n; ++i)
+                out[i] = a[i] * b[i];
+            break;
+        case Op::DIV:
+            for (size_t i = 0; i < n; ++i)
+                out[i] = b[i] == 0 ? INF : a[i] / b[i];
+            break;
+        case Op::MIN:
+            for (size_t i = 0; i < n; ++i)
+                out[i] = (std::isnan(a[i]) || std::isnan(b[i])) ? NaN
+                         : b[i] < a[i]                          ? b[i]
+                                                                : a[i];
+            break;
+        case Op::MAX:
+            for (size_t i = 0; i < n; ++i)
+                out[i] = (std::isnan(a[i]) || std::isnan(b[i])) ? NaN
+                         : b[i] > a[i]                          ? b[i]
+                                                                : a[i];
+            break;
+        case Op::GT:
+            for (size_t i = 0; i < n; ++i)
+                out[i] = a[i] > b[i] ? 1.0 : 0.0;
+            break;
+        case Op::GE:
+            for (size_t i = 0; i < n; ++i)
+                out[i] = a[i] >= b[i] ? 1.0 : 0.0;
+            break;
+        case Op::LT:
+            for (size_t i = 0; i < n; ++i)
+                out[i] = a[i] < b[i] ? 1.0 : 0.0;
+            break;
+        case Op::LE:
+            for (size_t i = 0; i < n; ++i)
+                out[i] = a[i] <= b[i] ? 1.0 : 0.0;
+            break;
+        case Op::EQ:
+            for (size_t i = 0; i < n; ++i)
+                out[i] = a[i] == b[i] ? 1.0 : 0.0;
+            break;
+        case Op::NE:
+            for (size_t i = 0; i < n; ++i)
+                out[i] = a[i] != b[i] ? 1.0 : 0.0;
+            break;
+        case Op::LOGICAL_AND:
+            for (size_t i = 0; i < n; ++i)
+                out[i] = ((a[i] != 0) & (b[i] != 0)) ? 1.0 : 0.0;
+            break;
+        case Op::LOGICAL_OR:
+            for (size_t i = 0; i < n; ++i)
+                out[i] = ((a[i] != 0) | (b[i] != 0)) ? 1.0 : 0.0;
+            break;
+        case Op::SELECT:
+            for (size_t i = 0; i < n; ++i)
+                out[i] = a[i] != 0 ? b[i] : c[i];
+            break;
+        case Op::ABS:
+            for (size_t i = 0; i < n; ++i)
+                out[i] = std::fabs(a[i]);
+            break;
+        case Op::SQRT:
+            for (size_t i = 0; i < n; ++i)
+                out[i] = std::sqrt(a[i]);
+            break;
+        case Op::LOG:
+            for (size_t i = 0; i < n; ++i)
+                out[i] = std::log(a[i]);
+            break;
+        case Op::LOG10:
+            for (size_t i = 0; i < n; ++i)
+                out[i] = std::log10(std::fabs(a[i]));
+            break;
+        case Op::POW:
+            for (size_t i = 0; i < n; ++i)
+                out[i] = std::pow(a[i], b[i]);
+            break;
+        case Op::MEAN_UPDATE:
+            // Same as MeanKernel::ProcessPixel() of the "mean" pixel function
+            for (size_t i = 0; i < n; ++i)
+            {
+                const double dfMean = a[i];
+                const double dfVal = b[i];
+                if (std::isinf(dfVal))
+                {
+                    out[i] = dfVal == -dfMean ? NaN : dfMean;
+                }
+                else if (std::isinf(dfMean))
+                {
+                    out[i] = std::isfinite(dfVal) ? dfMean : NaN;
+                }
+                else
+                {
+                    const double delta = dfVal - dfMean;
+                    out[i] = std::isinf(delta)
+                                 ? dfMean + (dfVal / c[i] - dfMean / c[i])
+                                 : dfMean + delta / c[i];
+                }
+            }
+            break;
+    }
+}
+
+/************************************************************************/
+/*              GDALComputedFusedProgram::EvaluateLines()               */
+/************************************************************************/
+
+void GDALComputedFusedProgram::EvaluateLines(
+    Context &oContext, const double *padfLeaves, size_t nLeafStride,
+    int nXSize, int iStartLine, int iEndLine, GByte *pabyData,
+    GDALDataType eBufType, GSpacing nPixelSpace, GSpacing nLineSpace) const
+{
+    for (int iLine = iStartLine; iLine < iEndLine; ++iLine)
+    {
+        for (int iCol = 0; iCol < nXSize; iCol += static_cast<int>(CHUNK_SIZE))
+        {
+            const size_t n =
+                std::min(CHUNK_SIZE, static_cast<size_t>(nXSize - iCol));
+            const size_t nOffset = static_cast<size_t>(iLine) * nXSize + iCol;
+            for (const auto &[nReg, iLeaf] : m_anLeafRegs)
+            {
+                oContext.apadfRegs[nReg] =
+                    padfLeaves + iLeaf * nLeafStride + nOffset;
+            }
+
+            for (const auto &oInstr : m_aoInstructions)
+                Execute(oInstr, oContext, n);
+
+            GDALCopyWords64(oContext.apadfRegs[m_nResultReg], GDT_Float64,
+                            sizeof(double),
+                            pabyData + iLine * nLineSpace + iCol * nPixelSpace,
+                            eBufType, static_cast<int>(nPixelSpace), n);
+        }
+    }
+}
+
+/************************************************************************/
+/*                   GDALComputedFusedProgram::Read()                   */
+/************************************************************************/
+
+CPLErr GDALComputedFusedProgram::Read(int nXOff, int nYOff, int nXSize,
+                                      int nYSize, void *pData,
+                                      GDALDataType eBufType,
+                                      GSpacing nPixelSpace,
+                                      GSpacing nLineSpace) const
+{
+    CPLAssert(m_nResultReg >= 0);
+
+    // Read the leaf bands by strips of lines whose size does not exceed
+    // that amount.
+    constexpr size_t MAX_LEAVES_BUFFER_SIZE = 64 * 1024 * 1024;
+    // Minimum number of pixels evaluated by a thread
+    constexpr size_t MIN_PIXELS_PER_THREAD = 65536;
+
+    const size_t nLeafCount = m_apoLeaves.size();
+    const size_t nBytesPerLine = nLeafCount * nXSize * sizeof(double);
+    const int nStripLines = static_cast<int>(std::clamp<size_t>(
+        MAX_LEAVES_BUFFER_SIZE / std::max<size_t>(1, nBytesPerLine), 1,
+        nYSize));
+
+    const char *pszNumThreads =
+        CPLGetConfigOption("GDAL_NUM_THREADS", "ALL_CPUS");
+    const int nMaxThreads = EQUAL(pszNumThreads, "ALL_CPUS")
+                                ? CPLGetNumCPUs()
+                                : std::clamp(atoi(pszNumThreads), 1,
+                                             CPLGetNumCPUs());
+    const int nThreads = static_cast<int>(std::clamp<size_t>(
+        static_cast<size_t>(nXSize) * nStripLines / MIN_PIXELS_PER_THREAD, 1,
+        std::min(nMaxThreads, nStripLines)));
+    CPLWorkerThreadPool *poThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+
+    const size_t nLeafStride = static_cast<size_t>(nXSize) * nStripLines;
+    std::vector<double> adfLeaves;
+    std::vector<Context> aoContexts;
+    try
+    {
+        adfLeaves.resize(nLeafCount * nLeafStride);
+        aoContexts.resize(poThreadPool ? nThreads : 1);
+        for (auto &oContext : aoContexts)
+            InitContext(oContext);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory in GDALComputedFusedProgram::Read()");
+        return CE_Failure;
+    }
+
+    GByte *pabyData = static_cast<GByte *>(pData);
+    for (int iStartLine = 0; iStartLine < nYSize; iStartLine += nStripLines)
+    {
+        const int nLines = std::min(nStripLines, nYSize - iStartLine);
+        for (size_t iLeaf = 0; iLeaf < nLeafCount; ++iLeaf)
+        {
+            if (m_apoLeaves[iLeaf]->RasterIO(
+                    GF_Read, nXOff, nYOff + iStartLine, nXSize, nLines,
+                    adfLeaves.data() + iLeaf * nLeafStride, nXSize, nLines,
+                    GDT_Float64, 0, 0, nullptr) != CE_None)
+            {
+                return CE_Failure;
+            }
+        }
+
+        GByte *pabyStripData = pabyData + iStartLine * nLineSpace;
+        const int nJobs = std::min(static_cast<int>(aoContexts.size()),
+                                   nLines);
+        if (nJobs > 1)
+        {
+            auto poJobQueue = poThreadPool->CreateJobQueue();
+            for (int iJob = 0; iJob < nJobs; ++iJob)
+            {
+                const int iJobStartLine = static_cast<int>(
+                    static_cast<int64_t>(nLines) * iJob / nJobs);
+                const int iJobEndLine = static_cast<int>(
+                    static_cast<int64_t>(nLines) * (iJob + 1) / nJobs);
+                Context *poContext = &aoContexts[iJob];
+                poJobQueue->SubmitJob(
+                    [this, poContext, &adfLeaves, nLeafStride, nXSize,
+                     iJobStartLine, iJobEndLine, pabyStripData, eBufType,
+                     nPixelSpace, nLineSpace]()
+                    {
+                        EvaluateLines(*poContext, adfLeaves.data(),
+                                      nLeafStride, nXSize, iJobStartLine,
+                                      iJobEndLine, pabyStripData, eBufType,
+                                      nPixelSpace, nLineSpace);
+                    });
+            }
+            poJobQueue->WaitCompletion();
+        }
+        else
+        {
+            EvaluateLines(aoContexts[0], adfLeaves.data(), nLeafStride, nXSize,
+                          0, nLines, pabyStripData, eBufType, nPixelSpace,
+                          nLineSpace);
+        }
+    }
+
+    return CE_None;
+}
 
 /************************************************************************/
 /*                         GDALComputedDataset                          */
@@ -29,10 +507,21 @@ class GDALComputedDataset final : public GDALDataset
     std::vector<std::unique_ptr<GDALDataset, GDALDatasetUniquePtrReleaser>>
         m_bandDS{};
     std::vector<GDALRasterBand *> m_poBands{};
+    std::optional<double> m_oFirstConstant{};
+    std::optional<double> m_oSecondConstant{};
     VRTDataset m_oVRTDS;
+    bool m_bFusedProgramCompiled = false;
+    std::unique_ptr<GDALComputedFusedProgram> m_poFusedProgram{};
 
     void AddSources(GDALComputedRasterBand *poBand);
 
+    int CompileFused(GDALComputedFusedProgram &oProgram, GDALDataType eDT,
+                     int nDepth);
+    static int CompileFusedSource(GDALComputedFusedProgram &oProgram,
+                                  GDALRasterBand *poSrcBand, GDALDataType eDT,
+                                  int nDepth);
+    const GDALComputedFusedProgram *GetFusedProgram();
+
     static const char *
     OperationToFunctionName(GDALComputedRasterBand::Operation op);
 
@@ -116,7 +605,8 @@ static bool IsComparisonOperator(GDALComputedRasterBand::Operation op)
 
 GDALComputedDataset::GDALComputedDataset(const GDALComputedDataset &other)
     : GDALDataset(), m_op(other.m_op), m_aosOptions(other.m_aosOptions),
-      m_poBands(other.m_poBands),
+      m_poBands(other.m_poBands), m_oFirstConstant(other.m_oFirstConstant),
+      m_oSecondConstant(other.m_oSecondConstant),
       m_oVRTDS(other.GetRasterXSize(), other.GetRasterYSize(),
                other.m_oVRTDS.GetBlockXSize(), other.m_oVRTDS.GetBlockYSize())
 {
@@ -164,6 +654,10 @@ GDALComputedDataset::GDALComputedDataset(
         m_poBands.push_back(const_cast<GDALRasterBand *>(firstBand));
     if (secondBand)
         m_poBands.push_back(const_cast<GDALRasterBand *>(secondBand));
+    if (pFirstConstant)
+        m_oFirstConstant = *pFirstConstant;
+    if (pSecondConstant)
+        m_oSecondConstant = *pSecondConstant;
 
     nRasterXSize = nXSize;
     nRasterYSize = nYSize;
@@ -317,6 +811,8 @@ GDALComputedDataset::GDALComputedDataset(
 {
     for (const GDALRasterBand *poIterBand : bands)
         m_poBands.push_back(const_cast<GDALRasterBand *>(poIterBand));
+    if (!std::isnan(constant))
+        m_oSecondConstant = constant;
 
     nRasterXSize = nXSize;
     nRasterYSize = nYSize;
@@ -540,6 +1036,311 @@ void GDALComputedDataset::AddSources(GDALComputedRasterBand *poBand)
     return ret;
 }
 
+/************************************************************************/
+/*              GDALComputedDataset::CompileFusedSource()               */
+/************************************************************************/
+
+/* static */ int GDALComputedDataset::CompileFusedSource(
+    GDALComputedFusedProgram &oProgram, GDALRasterBand *poSrcBand,
+    GDALDataType eDT, int nDepth)
+{
+    if (auto poComputedDS =
+            dynamic_cast<GDALComputedDataset *>(poSrcBand->GetDataset()))
+    {
+        return poComputedDS->CompileFused(oProgram, eDT, nDepth + 1);
+    }
+    const GDALDataType eSrcDT = poSrcBand->GetRasterDataType();
+    if (GDALDataTypeIsComplex(eSrcDT))
+        return -1;
+    return oProgram.AddConversion(oProgram.AddLeaf(poSrcBand), eSrcDT, eDT);
+}
+
+/************************************************************************/
+/*                 GDALComputedDataset::CompileFused()                  */
+/************************************************************************/
+
+/** Append to oProgram the instructions computing the values of the band of
+ * this dataset, as if read in a buffer of type eDT.
+ *
+ * @return the register holding the result, or -1 if the operation cannot be
+ * fused.
+ */
+int GDALComputedDataset::CompileFused(GDALComputedFusedProgram &oProgram,
+                                      GDALDataType eDT, int nDepth)
+{
+    // Same limit as the recursion guard of VRTDerivedRasterBand::IRasterIO()
+    constexpr int MAX_DEPTH = 32;
+    if (nDepth >= MAX_DEPTH)
+        return -1;
+
+    using Op = GDALComputedFusedProgram::Op;
+    const GDALDataType eBandDT =
+        m_oVRTDS.GetRasterBand(1)->GetRasterDataType();
+
+    if (m_op == GDALComputedRasterBand::Operation::OP_CAST)
+    {
+        // VRTSimpleSource::RasterIO() only goes through the data type of the
+        // VRT band if the conversion of the source to it is lossy.
+        GDALRasterBand *poSrcBand = m_poBands[0];
+        if (GDALDataTypeIsConversionLossy(poSrcBand->GetRasterDataType(),
+                                          eBandDT))
+        {
+            const int nReg =
+                CompileFusedSource(oProgram, poSrcBand, eBandDT, nDepth);
+            return nReg < 0 ? -1 : oProgram.AddConversion(nReg, eBandDT, eDT);
+        }
+        return CompileFusedSource(oProgram, poSrcBand, eDT, nDepth);
+    }
+
+    // Data type of the source buffers of VRTDerivedRasterBand::IRasterIO()
+    GDALDataType eSrcDT = GDT_Unknown;
+    for (GDALRasterBand *poSrcBand : m_poBands)
+        eSrcDT = GDALDataTypeUnion(eSrcDT, poSrcBand->GetRasterDataType());
+    eSrcDT = GDALDataTypeUnion(eSrcDT, eBandDT);
+
+    std::vector<int> anSrcRegs;
+    for (GDALRasterBand *poSrcBand : m_poBands)
+    {
+        const int nReg =
+            CompileFusedSource(oProgram, poSrcBand, eSrcDT, nDepth);
+        if (nReg < 0)
+            return -1;
+        anSrcRegs.push_back(nReg);
+    }
+
+    // Operands of binary operations, where one of them may be a constant
+    const auto GetFirstOperand = [this, &oProgram, &anSrcRegs]()
+    {
+        return m_oFirstConstant ? oProgram.AddConstant(*m_oFirstConstant)
+                                : anSrcRegs[0];
+    };
+    const auto GetSecondOperand = [this, &oProgram, &anSrcRegs]()
+    {
+        return m_oSecondConstant ? oProgram.AddConstant(*m_oSecondConstant)
+               : m_oFirstConstant ? anSrcRegs[0]
+                                  : anSrcRegs[1];
+    };
+
+    // The operations below follow the ones of the pixel functions set in
+    // the constructors.
+    int nReg = -1;
+    bool bIsBoolean = false;
+    switch (m_op)
+    {
+        case GDALComputedRasterBand::Operation::OP_ADD:
+        {
+            // sum: k + source1 + source2 + ...
+            nReg = oProgram.AddConstant(m_oSecondConstant.value_or(0.0));
+            for (const int nSrcReg : anSrcRegs)
+                nReg = oProgram.AddInstruction(Op::ADD, nReg, nSrcReg);
+            break;
+        }
+
+        case GDALComputedRasterBand::Operation::OP_SUBTRACT:
+        {
+            if (m_oSecondConstant)
+            {
+                // sum with k = -constant
+                nReg = oProgram.AddInstruction(
+                    Op::ADD, oProgram.AddConstant(-(*m_oSecondConstant)),
+                    anSrcRegs[0]);
+            }
+            else
+            {
+                nReg = oProgram.AddInstruction(Op::SUB, anSrcRegs[0],
+                                               anSrcRegs[1]);
+            }
+            break;
+        }
+
+        case GDALComputedRasterBand::Operation::OP_MULTIPLY:
+        {
+            // mul: k * source1 * source2 * ...
+            nReg = anSrcRegs[0];
+            if (m_oSecondConstant)
+            {
+                nReg = oProgram.AddInstruction(
+                    Op::MUL, oProgram.AddConstant(*m_oSecondConstant), nReg);
+            }
+            for (size_t i = 1; i < anSrcRegs.size(); ++i)
+                nReg = oProgram.AddInstruction(Op::MUL, nReg, anSrcRegs[i]);
+            break;
+        }
+
+        case GDALComputedRasterBand::Operation::OP_DIVIDE:
+        {
+            if (m_oSecondConstant)
+            {
+                // mul with k = 1 / constant
+                nReg = oProgram.AddInstruction(
+                    Op::MUL, oProgram.AddConstant(1.0 / (*m_oSecondConstant)),
+                    anSrcRegs[0]);
+            }
+            else
+            {
+                // div, or inv with k = constant
+                nReg = oProgram.AddInstruction(Op::DIV, GetFirstOperand(),
+                                               GetSecondOperand());
+            }
+            break;
+        }
+
+        case GDALComputedRasterBand::Operation::OP_MIN:
+        case GDALComputedRasterBand::Operation::OP_MAX:
+        {
+            const Op eOp = m_op == GDALComputedRasterBand::Operation::OP_MIN
+                               ? Op::MIN
+                               : Op::MAX;
+            nReg = anSrcRegs[0];
+            for (size_t i = 1; i < anSrcRegs.size(); ++i)
+                nReg = oProgram.AddInstruction(eOp, nReg, anSrcRegs[i]);
+            if (m_oSecondConstant && !std::isnan(*m_oSecondConstant))
+            {
+                nReg = oProgram.AddInstruction(
+                    eOp, nReg, oProgram.AddConstant(*m_oSecondConstant));
+            }
+            break;
+        }
+
+        case GDALComputedRasterBand::Operation::OP_MEAN:
+        {
+            nReg = anSrcRegs[0];
+            if (eSrcDT == GDT_Byte)
+            {
+                // The sum of Byte values is exact, so that the rounding of
+                // the quotient to Byte is the same as the one of the integer
+                // code path of the "mean" pixel function
+                for (size_t i = 1; i < anSrcRegs.size(); ++i)
+                    nReg = oProgram.AddInstruction(Op::ADD, nReg, anSrcRegs[i]);
+                nReg = oProgram.AddInstruction(
+                    Op::DIV, nReg,
+                    oProgram.AddConstant(
+                        static_cast<double>(anSrcRegs.size())));
+            }
+            else
+            {
+                // Same running mean as the generic code path of the "mean"
+                // pixel function
+                for (size_t i = 1; i < anSrcRegs.size(); ++i)
+                {
+                    nReg = oProgram.AddInstruction(
+                        Op::MEAN_UPDATE, nReg, anSrcRegs[i],
+                        oProgram.AddConstant(static_cast<double>(i + 1)));
+                }
+            }
+            break;
+        }
+
+        case GDALComputedRasterBand::Operation::OP_GT:
+        case GDALComputedRasterBand::Operation::OP_GE:
+        case GDALComputedRasterBand::Operation::OP_LT:
+        case GDALComputedRasterBand::Operation::OP_LE:
+        case GDALComputedRasterBand::Operation::OP_EQ:
+        case GDALComputedRasterBand::Operation::OP_NE:
+        case GDALComputedRasterBand::Operation::OP_LOGICAL_AND:
+        case GDALComputedRasterBand::Operation::OP_LOGICAL_OR:
+        {
+            static const std::map<GDALComputedRasterBand::Operation, Op>
+                oMapComparisonOps = {
+                    {GDALComputedRasterBand::Operation::OP_GT, Op::GT},
+                    {GDALComputedRasterBand::Operation::OP_GE, Op::GE},
+                    {GDALComputedRasterBand::Operation::OP_LT, Op::LT},
+                    {GDALComputedRasterBand::Operation::OP_LE, Op::LE},
+                    {GDALComputedRasterBand::Operation::OP_EQ, Op::EQ},
+                    {GDALComputedRasterBand::Operation::OP_NE, Op::NE},
+                    {GDALComputedRasterBand::Operation::OP_LOGICAL_AND,
+                     Op::LOGICAL_AND},
+                    {GDALComputedRasterBand::Operation::OP_LOGICAL_OR,
+                     Op::LOGICAL_OR},
+                };
+            nReg = oProgram.AddInstruction(oMapComparisonOps.at(m_op),
+                                           GetFirstOperand(),
+                                           GetSecondOperand());
+            bIsBoolean = true;
+            break;
+        }
+
+        case GDALComputedRasterBand::Operation::OP_TERNARY:
+        {
+            nReg = oProgram.AddInstruction(Op::SELECT, anSrcRegs[0],
+                                           anSrcRegs[1], anSrcRegs[2]);
+            break;
+        }
+
+        case GDALComputedRasterBand::Operation::OP_ABS:
+            nReg = oProgram.AddInstruction(Op::ABS, anSrcRegs[0]);
+            break;
+
+        case GDALComputedRasterBand::Operation::OP_SQRT:
+            nReg = oProgram.AddInstruction(Op::SQRT, anSrcRegs[0]);
+            break;
+
+        case GDALComputedRasterBand::Operation::OP_LOG:
+            nReg = oProgram.AddInstruction(Op::LOG, anSrcRegs[0]);
+            break;
+
+        case GDALComputedRasterBand::Operation::OP_LOG10:
+            nReg = oProgram.AddInstruction(Op::LOG10, anSrcRegs[0]);
+            break;
+
+        case GDALComputedRasterBand::Operation::OP_POW:
+        {
+            // pow, exp with base = constant, or source1 ^ source2
+            nReg = oProgram.AddInstruction(Op::POW, GetFirstOperand(),
+                                           GetSecondOperand());
+            break;
+        }
+
+        case GDALComputedRasterBand::Operation::OP_CAST:
+            CPLAssert(false);
+            break;
+    }
+
+    // The result of comparisons is 0 or 1, which is not altered by any
+    // conversion.
+    return bIsBoolean || nReg < 0
+               ? nReg
+               : oProgram.AddConversion(nReg, GDT_Float64, eDT);
+}
+
+/************************************************************************/
+/*                GDALComputedDataset::GetFusedProgram()                */
+/************************************************************************/
+
+/** Return the program evaluating the band of this dataset in a single pass,
+ * or nullptr if it cannot be used.
+ */
+const GDALComputedFusedProgram *GDALComputedDataset::GetFusedProgram()
+{
+    if (!CPLTestBool(
+            CPLGetConfigOption("GDAL_COMPUTED_RASTER_BAND_FUSED", "YES")))
+    {
+        return nullptr;
+    }
+
+    if (!m_bFusedProgramCompiled)
+    {
+        m_bFusedProgramCompiled = true;
+
+        // The handling of nodata by VRTComplexSource and pixel functions is
+        // not replicated. Given that a band has a nodata value as soon as
+        // one of its sources has one, checking this band is enough.
+        int bHasNoData = false;
+        m_oVRTDS.GetRasterBand(1)->GetNoDataValue(&bHasNoData);
+        if (!bHasNoData)
+        {
+            auto poProgram = std::make_unique<GDALComputedFusedProgram>();
+            const int nReg = CompileFused(*poProgram, GDT_Float64, 0);
+            if (nReg >= 0)
+            {
+                poProgram->SetResult(nReg);
+                m_poFusedProgram = std::move(poProgram);
+            }
+        }
+    }
+    return m_poFusedProgram.get();
+}
+
 /************************************************************************/
 /*                       GDALComputedRasterBand()                       */
 /************************************************************************/
@@ -798,6 +1599,16 @@ CPLErr GDALComputedRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff,
                                           void *pData)
 {
     auto l_poDS = cpl::down_cast<GDALComputedDataset *>(poDS);
+    if (const auto *poProgram = l_poDS->GetFusedProgram())
+    {
+        const int nXOff = nBlockXOff * nBlockXSize;
+        const int nYOff = nBlockYOff * nBlockYSize;
+        const int nDTSize = GDALGetDataTypeSizeBytes(eDataType);
+        return poProgram->Read(
+            nXOff, nYOff, std::min(nBlockXSize, nRasterXSize - nXOff),
+            std::min(nBlockYSize, nRasterYSize - nYOff), pData, eDataType,
+            nDTSize, static_cast<GSpacing>(nDTSize) * nBlockXSize);
+    }
     return l_poDS->m_oVRTDS.GetRasterBand(1)->ReadBlock(nBlockXOff, nBlockYOff,
                                                         pData);
 }
@@ -812,6 +1623,14 @@ CPLErr GDALComputedRasterBand::IRasterIO(
     GSpacing nPixelSpace, GSpacing nLineSpace, GDALRasterIOExtraArg *psExtraArg)
 {
     auto l_poDS = cpl::down_cast<GDALComputedDataset *>(poDS);
+    if (eRWFlag == GF_Read && nBufXSize == nXSize && nBufYSize == nYSize)
+    {
+        if (const auto *poProgram = l_poDS->GetFusedProgram())
+        {
+            return poProgram->Read(nXOff, nYOff, nXSize, nYSize, pData,
+                                   eBufType, nPixelSpace, nLineSpace);
+        }
+    }
     return l_poDS->m_oVRTDS.GetRasterBand(1)->RasterIO(
         eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize, nBufYSize,
         eBufType, nPixelSpace, nLineSpace, psExtraArg);
@@ -15,9 +15,16 @@
 #include "gdal_proxy.h"
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -29,17 +36,20 @@
 
 //! @cond Doxygen_Suppress
 
-/* We *must* share the same mutex as the gdaldataset.cpp file, as we are */
-/* doing GDALOpen() calls that can indirectly call GDALOpenShared() on */
-/* an auxiliary dataset ... */
-/* Then we could get dead-locks in multi-threaded use case */
+/* The life-time of the pool singleton (Ref(), Unref(), etc.) is protected by */
+/* the same mutex as the gdaldataset.cpp file. The content of the pool is */
+/* spread over several shards, each one protected by its own mutex, so that */
+/* threads reading from different datasets do not contend on a single lock. */
+/* Datasets are never opened or closed while holding a shard mutex, as this */
+/* can indirectly call GDALOpenShared() on an auxiliary dataset, or */
+/* re-enter the pool when the dataset is itself made of proxy datasets. */
 
 /* ******************************************************************** */
 /*                         GDALDatasetPool                              */
 /* ******************************************************************** */
 
 /* This class is a singleton that maintains a pool of opened datasets */
-/* The cache uses a LRU strategy */
+/* The cache uses a LRU strategy within each shard */
 
 class GDALDatasetPool;
 static GDALDatasetPool *singleton = nullptr;
@@ -60,6 +70,9 @@ struct _GDALProxyPoolCacheEntry
     /* Ref count of the cached dataset */
     int refCount;
 
+    /* Index of the shard the entry belongs to */
+    int iShard;
+
     GDALProxyPoolCacheEntry *prev;
     GDALProxyPoolCacheEntry *next;
 };
@@ -78,7 +91,23 @@ static thread_local int refCountOfDisabledRefCount = 0;
 class GDALDatasetPool
 {
   private:
-    bool bInDestruction = false;
+    static constexpr int NUM_SHARDS = 16;
+
+    /* Linked list of entries, in most recently used order, whose */
+    /* file name hashes to the shard */
+    struct Shard
+    {
+        std::mutex oMutex{};
+        GDALProxyPoolCacheEntry *firstEntry = nullptr;
+        GDALProxyPoolCacheEntry *lastEntry = nullptr;
+        int currentSize = 0;
+    };
+
+    /* Datasets detached from their entry, to be closed once the shard */
+    /* mutex is released. Second member is the responsible PID. */
+    using DatasetsToClose = std::vector<std::pair<GDALDataset *, GIntBig>>;
+
+    std::atomic<bool> bInDestruction{false};
 
     /* Ref count of the pool singleton */
     /* Taken by "toplevel" GDALProxyPoolDataset in its constructor and released
@@ -88,16 +117,23 @@ class GDALDatasetPool
     /* between toplevel and inner GDALProxyPoolDataset */
     int refCount = 0;
 
-    int maxSize = 0;
-    int currentSize = 0;
-    int64_t nMaxRAMUsage = 0;
-    int64_t nRAMUsage = 0;
-    GDALProxyPoolCacheEntry *firstEntry = nullptr;
-    GDALProxyPoolCacheEntry *lastEntry = nullptr;
+    /* Maximum number of entries with an associated dataset, across all */
+    /* shards */
+    const int maxSize;
+    std::atomic<int> nOpenedEntries{0};
+    const int64_t nMaxRAMUsage;
+    std::atomic<int64_t> nRAMUsage{0};
+
+    /* Whether datasets opened in read-only mode are opened with */
+    /* GDAL_OF_THREAD_SAFE, and can thus be shared by all threads. */
+    const bool bThreadSafeDatasets;
+
+    std::array<Shard, NUM_SHARDS> aoShards{};
 
     /* Caution : to be sure that we don't run out of entries, size must be at */
     /* least greater or equal than the maximum number of threads */
-    explicit GDALDatasetPool(int maxSize, int64_t nMaxRAMUsage);
+    GDALDatasetPool(int maxSize, int64_t nMaxRAMUsage,
+                    bool bThreadSafeDatasets);
     ~GDALDatasetPool();
     GDALProxyPoolCacheEntry *_RefDataset(const char *pszFileName,
                                          GDALAccess eAccess,
@@ -108,10 +144,21 @@ class GDALDatasetPool
                                      CSLConstList papszOpenOptions,
                                      GDALAccess eAccess, const char *pszOwner);
 
+    static int GetShardIndex(const std::string &osFilenameAndOO);
+    static void MoveToFront(Shard &oShard, GDALProxyPoolCacheEntry *cur);
+    GDALProxyPoolCacheEntry *GetFreeEntry(int iShard);
+    bool EvictEntryWithZeroRefCount(Shard &oShard,
+                                    bool evictEntryWithOpenedDataset,
+                                    DatasetsToClose &aoDatasetsToClose);
+    bool EvictEntryWithZeroRefCountFromOtherShards(
+        int iShard, bool evictEntryWithOpenedDataset,
+        DatasetsToClose &aoDatasetsToClose);
+    static void CloseDatasets(const DatasetsToClose &aoDatasetsToClose);
+
 #ifdef DEBUG_PROXY_POOL
     // cppcheck-suppress unusedPrivateFunction
     void ShowContent();
-    void CheckLinks();
+    static void CheckLinks(const Shard &oShard);
 #endif
 
     CPL_DISALLOW_COPY_ASSIGN(GDALDatasetPool)
@@ -138,8 +185,10 @@ class GDALDatasetPool
 /*                          GDALDatasetPool()                           */
 /************************************************************************/
 
-GDALDatasetPool::GDALDatasetPool(int maxSizeIn, int64_t nMaxRAMUsageIn)
-    : maxSize(maxSizeIn), nMaxRAMUsage(nMaxRAMUsageIn)
+GDALDatasetPool::GDALDatasetPool(int maxSizeIn, int64_t nMaxRAMUsageIn,
+                                 bool bThreadSafeDatasetsIn)
+    : maxSize(maxSizeIn), nMaxRAMUsage(nMaxRAMUsageIn),
+      bThreadSafeDatasets(bThreadSafeDatasetsIn)
 {
 }
 
@@ -150,21 +199,24 @@ GDALDatasetPool::GDALDatasetPool(int maxSizeIn, int64_t nMaxRAMUsageIn)
 GDALDatasetPool::~GDALDatasetPool()
 {
     bInDestruction = true;
-    GDALProxyPoolCacheEntry *cur = firstEntry;
     GIntBig responsiblePID = GDALGetResponsiblePIDForCurrentThread();
-    while (cur)
+    for (auto &oShard : aoShards)
     {
-        GDALProxyPoolCacheEntry *next = cur->next;
-        CPLFree(cur->pszFileNameAndOpenOptions);
-        CPLFree(cur->pszOwner);
-        CPLAssert(cur->refCount == 0);
-        if (cur->poDS)
+        GDALProxyPoolCacheEntry *cur = oShard.firstEntry;
+        while (cur)
         {
-            GDALSetResponsiblePIDForCurrentThread(cur->responsiblePID);
-            GDALClose(cur->poDS);
+            GDALProxyPoolCacheEntry *next = cur->next;
+            CPLFree(cur->pszFileNameAndOpenOptions);
+            CPLFree(cur->pszOwner);
+            CPLAssert(cur->refCount == 0);
+            if (cur->poDS)
+            {
+                GDALSetResponsiblePIDForCurrentThread(cur->responsiblePID);
+                GDALClose(cur->poDS);
+            }
+            CPLFree(cur);
+            cur = next;
         }
-        CPLFree(cur);
-        cur = next;
     }
     GDALSetResponsiblePIDForCurrentThread(responsiblePID);
 }
@@ -176,19 +228,23 @@ GDALDatasetPool::~GDALDatasetPool()
 
 void GDALDatasetPool::ShowContent()
 {
-    GDALProxyPoolCacheEntry *cur = firstEntry;
-    int i = 0;
-    while (cur)
+    for (int iShard = 0; iShard < NUM_SHARDS; ++iShard)
     {
-        printf("[%d] pszFileName=%s, owner=%s, refCount=%d, " /*ok*/
-               "responsiblePID=%d\n",
-               i,
-               cur->pszFileNameAndOpenOptions ? cur->pszFileNameAndOpenOptions
-                                              : "(null)",
-               cur->pszOwner ? cur->pszOwner : "(null)", cur->refCount,
-               (int)cur->responsiblePID);
-        i++;
-        cur = cur->next;
+        GDALProxyPoolCacheEntry *cur = aoShards[iShard].firstEntry;
+        int i = 0;
+        while (cur)
+        {
+            printf("[%d/%d] pszFileName=%s, owner=%s, refCount=%d, " /*ok*/
+                   "responsiblePID=%d\n",
+                   iShard, i,
+                   cur->pszFileNameAndOpenOptions
+                       ? cur->pszFileNameAndOpenOptions
+                       : "(null)",
+                   cur->pszOwner ? cur->pszOwner : "(null)", cur->refCount,
+                   (int)cur->responsiblePID);
+            i++;
+            cur = cur->next;
+        }
     }
 }
 
@@ -196,20 +252,20 @@ void GDALDatasetPool::ShowContent()
 /*                             CheckLinks()                             */
 /************************************************************************/
 
-void GDALDatasetPool::CheckLinks()
+void GDALDatasetPool::CheckLinks(const Shard &oShard)
 {
-    GDALProxyPoolCacheEntry *cur = firstEntry;
+    GDALProxyPoolCacheEntry *cur = oShard.firstEntry;
     int i = 0;
     while (cur)
     {
-        CPLAssert(cur == firstEntry || cur->prev->next == cur);
-        CPLAssert(cur == lastEntry || cur->next->prev == cur);
+        CPLAssert(cur == oShard.firstEntry || cur->prev->next == cur);
+        CPLAssert(cur == oShard.lastEntry || cur->next->prev == cur);
         ++i;
-        CPLAssert(cur->next != nullptr || cur == lastEntry);
+        CPLAssert(cur->next != nullptr || cur == oShard.lastEntry);
         cur = cur->next;
     }
     (void)i;
-    CPLAssert(i == currentSize);
+    CPLAssert(i == oShard.currentSize);
 }
 #endif
 
@@ -230,209 +286,325 @@ static std::string GetFilenameAndOpenOptions(const char *pszFileName,
 }
 
 /************************************************************************/
-/*                            _RefDataset()                             */
+/*                           GetShardIndex()                            */
 /************************************************************************/
 
-GDALProxyPoolCacheEntry *
-GDALDatasetPool::_RefDataset(const char *pszFileName, GDALAccess eAccess,
-                             CSLConstList papszOpenOptions, int bShared,
-                             bool bForceOpen, const char *pszOwner)
+int GDALDatasetPool::GetShardIndex(const std::string &osFilenameAndOO)
 {
-    CPLMutex **pMutex = GDALGetphDLMutex();
-    CPLMutexHolderD(pMutex);
+    return static_cast<int>(std::hash<std::string>()(osFilenameAndOO) %
+                            NUM_SHARDS);
+}
 
-    if (bInDestruction)
-        return nullptr;
+/************************************************************************/
+/*                            MoveToFront()                             */
+/************************************************************************/
 
-    const GIntBig responsiblePID = GDALGetResponsiblePIDForCurrentThread();
+/* Should be called with the mutex of oShard held */
+void GDALDatasetPool::MoveToFront(Shard &oShard, GDALProxyPoolCacheEntry *cur)
+{
+    if (cur == oShard.firstEntry)
+        return;
+
+    if (cur->next)
+        cur->next->prev = cur->prev;
+    else
+        oShard.lastEntry = cur->prev;
+    cur->prev->next = cur->next;
+    cur->prev = nullptr;
+    oShard.firstEntry->prev = cur;
+    cur->next = oShard.firstEntry;
+    oShard.firstEntry = cur;
+
+#ifdef DEBUG_PROXY_POOL
+    CheckLinks(oShard);
+#endif
+}
+
+/************************************************************************/
+/*                            GetFreeEntry()                            */
+/************************************************************************/
 
-    const auto EvictEntryWithZeroRefCount =
-        [this, responsiblePID](bool evictEntryWithOpenedDataset)
+/* Return an entry not associated with any dataset, either by recycling one */
+/* or by creating a new one, and put it at the top of the list. */
+/* Should be called with the mutex of the shard held */
+GDALProxyPoolCacheEntry *GDALDatasetPool::GetFreeEntry(int iShard)
+{
+    Shard &oShard = aoShards[iShard];
+    for (GDALProxyPoolCacheEntry *cur = oShard.lastEntry; cur;
+         cur = cur->prev)
     {
-        GDALProxyPoolCacheEntry *cur = firstEntry;
-        GDALProxyPoolCacheEntry *candidate = nullptr;
-        while (cur)
+        if (cur->refCount == 0 && cur->pszFileNameAndOpenOptions == nullptr)
         {
-            GDALProxyPoolCacheEntry *next = cur->next;
+            MoveToFront(oShard, cur);
+            return cur;
+        }
+    }
 
-            if (cur->refCount == 0 &&
-                (!evictEntryWithOpenedDataset || cur->nRAMUsage > 0))
-            {
-                candidate = cur;
-            }
+    /* Prepend */
+    auto cur = static_cast<GDALProxyPoolCacheEntry *>(
+        CPLCalloc(1, sizeof(GDALProxyPoolCacheEntry)));
+    cur->iShard = iShard;
+    if (oShard.lastEntry == nullptr)
+        oShard.lastEntry = cur;
+    cur->prev = nullptr;
+    cur->next = oShard.firstEntry;
+    if (oShard.firstEntry)
+        oShard.firstEntry->prev = cur;
+    oShard.firstEntry = cur;
+    oShard.currentSize++;
+#ifdef DEBUG_PROXY_POOL
+    CheckLinks(oShard);
+#endif
+    return cur;
+}
 
-            cur = next;
+/************************************************************************/
+/*                     EvictEntryWithZeroRefCount()                     */
+/************************************************************************/
+
+/* Dissociate the least recently used entry of oShard with a zero reference */
+/* count from its dataset, which is added to aoDatasetsToClose. */
+/* Should be called with the mutex of oShard held */
+bool GDALDatasetPool::EvictEntryWithZeroRefCount(
+    Shard &oShard, bool evictEntryWithOpenedDataset,
+    DatasetsToClose &aoDatasetsToClose)
+{
+    GDALProxyPoolCacheEntry *candidate = nullptr;
+    for (GDALProxyPoolCacheEntry *cur = oShard.lastEntry; cur;
+         cur = cur->prev)
+    {
+        if (cur->refCount == 0 && cur->pszFileNameAndOpenOptions &&
+            (!evictEntryWithOpenedDataset || cur->nRAMUsage > 0))
+        {
+            candidate = cur;
+            break;
         }
-        if (candidate == nullptr)
-            return false;
+    }
+    if (candidate == nullptr)
+        return false;
 
-        nRAMUsage -= candidate->nRAMUsage;
-        candidate->nRAMUsage = 0;
+    nRAMUsage -= candidate->nRAMUsage;
+    candidate->nRAMUsage = 0;
 
-        CPLFree(candidate->pszFileNameAndOpenOptions);
-        candidate->pszFileNameAndOpenOptions = nullptr;
+    CPLFree(candidate->pszFileNameAndOpenOptions);
+    candidate->pszFileNameAndOpenOptions = nullptr;
 
-        if (candidate->poDS)
-        {
-            /* Close by pretending we are the thread that GDALOpen'ed this */
-            /* dataset */
-            GDALSetResponsiblePIDForCurrentThread(candidate->responsiblePID);
+    if (candidate->poDS)
+    {
+        aoDatasetsToClose.emplace_back(candidate->poDS,
+                                       candidate->responsiblePID);
+        candidate->poDS = nullptr;
+    }
+    CPLFree(candidate->pszOwner);
+    candidate->pszOwner = nullptr;
 
-            refCountOfDisabledRefCount++;
-            GDALClose(candidate->poDS);
-            refCountOfDisabledRefCount--;
+    nOpenedEntries--;
 
-            candidate->poDS = nullptr;
-            GDALSetResponsiblePIDForCurrentThread(responsiblePID);
-        }
-        CPLFree(candidate->pszOwner);
-        candidate->pszOwner = nullptr;
+    return true;
+}
 
-        if (!evictEntryWithOpenedDataset && candidate != firstEntry)
-        {
-            /* Recycle this entry for the to-be-opened dataset and */
-            /* moves it to the top of the list */
-            if (candidate->prev)
-                candidate->prev->next = candidate->next;
-
-            if (candidate->next)
-                candidate->next->prev = candidate->prev;
-            else
-            {
-                CPLAssert(candidate == lastEntry);
-                lastEntry->prev->next = nullptr;
-                lastEntry = lastEntry->prev;
-            }
-            candidate->prev = nullptr;
-            candidate->next = firstEntry;
-            firstEntry->prev = candidate;
-            firstEntry = candidate;
+/************************************************************************/
+/*             EvictEntryWithZeroRefCountFromOtherShards()              */
+/************************************************************************/
 
-#ifdef DEBUG_PROXY_POOL
-            CheckLinks();
-#endif
+/* Should be called without any shard mutex held */
+bool GDALDatasetPool::EvictEntryWithZeroRefCountFromOtherShards(
+    int iShard, bool evictEntryWithOpenedDataset,
+    DatasetsToClose &aoDatasetsToClose)
+{
+    for (int i = 1; i < NUM_SHARDS; ++i)
+    {
+        Shard &oOtherShard = aoShards[(iShard + i) % NUM_SHARDS];
+        std::lock_guard<std::mutex> oLock(oOtherShard.oMutex);
+        if (EvictEntryWithZeroRefCount(oOtherShard,
+                                       evictEntryWithOpenedDataset,
+                                       aoDatasetsToClose))
+        {
+            return true;
         }
+    }
+    return false;
+}
 
-        return true;
-    };
+/************************************************************************/
+/*                           CloseDatasets()                            */
+/************************************************************************/
+
+/* Should be called without any shard mutex held */
+void GDALDatasetPool::CloseDatasets(const DatasetsToClose &aoDatasetsToClose)
+{
+    if (aoDatasetsToClose.empty())
+        return;
+
+    const GIntBig responsiblePID = GDALGetResponsiblePIDForCurrentThread();
+    for (const auto &[poDS, nResponsiblePID] : aoDatasetsToClose)
+    {
+        /* Close by pretending we are the thread that GDALOpen'ed this */
+        /* dataset */
+        GDALSetResponsiblePIDForCurrentThread(nResponsiblePID);
 
-    GDALProxyPoolCacheEntry *cur = firstEntry;
+        refCountOfDisabledRefCount++;
+        GDALClose(poDS);
+        refCountOfDisabledRefCount--;
+    }
+    GDALSetResponsiblePIDForCurrentThread(responsiblePID);
+}
+
+/************************************************************************/
+/*                            _RefDataset()                             */
+/************************************************************************/
+
+GDALProxyPoolCacheEntry *
+GDALDatasetPool::_RefDataset(const char *pszFileName, GDALAccess eAccess,
+                             CSLConstList papszOpenOptions, int bShared,
+                             bool bForceOpen, const char *pszOwner)
+{
+    if (bInDestruction)
+        return nullptr;
+
+    const GIntBig responsiblePID = GDALGetResponsiblePIDForCurrentThread();
 
     const std::string osFilenameAndOO =
         GetFilenameAndOpenOptions(pszFileName, papszOpenOptions);
+    const int iShard = GetShardIndex(osFilenameAndOO);
+    Shard &oShard = aoShards[iShard];
 
-    while (cur)
+    DatasetsToClose aoDatasetsToClose;
+    GDALProxyPoolCacheEntry *cur = nullptr;
+    bool bSlotReserved = false;
     {
-        GDALProxyPoolCacheEntry *next = cur->next;
-
-        if (cur->refCount >= 0 && cur->pszFileNameAndOpenOptions &&
-            osFilenameAndOO == cur->pszFileNameAndOpenOptions &&
-            ((bShared && cur->responsiblePID == responsiblePID &&
-              ((cur->pszOwner == nullptr && pszOwner == nullptr) ||
-               (cur->pszOwner != nullptr && pszOwner != nullptr &&
-                strcmp(cur->pszOwner, pszOwner) == 0))) ||
-             (!bShared && cur->refCount == 0)))
+        std::unique_lock<std::mutex> oLock(oShard.oMutex);
+        while (true)
         {
-            if (cur != firstEntry)
+            for (cur = oShard.firstEntry; cur; cur = cur->next)
             {
-                /* Move to begin */
-                if (cur->next)
-                    cur->next->prev = cur->prev;
-                else
-                    lastEntry = cur->prev;
-                cur->prev->next = cur->next;
-                cur->prev = nullptr;
-                firstEntry->prev = cur;
-                cur->next = firstEntry;
-                firstEntry = cur;
-
-#ifdef DEBUG_PROXY_POOL
-                CheckLinks();
-#endif
+                if (cur->refCount >= 0 && cur->pszFileNameAndOpenOptions &&
+                    osFilenameAndOO == cur->pszFileNameAndOpenOptions &&
+                    ((bShared && cur->responsiblePID == responsiblePID &&
+                      ((cur->pszOwner == nullptr && pszOwner == nullptr) ||
+                       (cur->pszOwner != nullptr && pszOwner != nullptr &&
+                        strcmp(cur->pszOwner, pszOwner) == 0))) ||
+                     (!bShared && cur->refCount == 0) ||
+                     // Thread-safe datasets can be shared with anyone
+                     (eAccess == GA_ReadOnly && cur->poDS != nullptr &&
+                      cur->poDS->IsThreadSafe(GDAL_OF_RASTER))))
+                {
+                    break;
+                }
             }
 
-            cur->refCount++;
-            return cur;
-        }
-
-        cur = next;
-    }
+            if (cur)
+            {
+                MoveToFront(oShard, cur);
+                cur->refCount++;
+                if (bSlotReserved)
+                    nOpenedEntries--;
+                oLock.unlock();
+                CloseDatasets(aoDatasetsToClose);
+                return cur;
+            }
 
-    if (!bForceOpen)
-        return nullptr;
+            if (!bForceOpen)
+                return nullptr;
 
-    if (currentSize == maxSize)
-    {
-        if (!EvictEntryWithZeroRefCount(false))
-        {
-            CPLError(
-                CE_Failure, CPLE_AppDefined,
-                "Too many threads are running for the current value of the "
-                "dataset pool size (%d).\n"
-                "or too many proxy datasets are opened in a cascaded way.\n"
-                "Try increasing GDAL_MAX_DATASET_POOL_SIZE.",
-                maxSize);
-            return nullptr;
+            if (!bSlotReserved)
+            {
+                if (++nOpenedEntries <= maxSize)
+                {
+                    bSlotReserved = true;
+                }
+                else
+                {
+                    nOpenedEntries--;
+                    if (EvictEntryWithZeroRefCount(oShard, false,
+                                                   aoDatasetsToClose))
+                    {
+                        nOpenedEntries++;
+                        bSlotReserved = true;
+                    }
+                }
+            }
+            if (bSlotReserved)
+                break;
+
+            // No room in this shard: try to make some in the other ones,
+            // and then check again if another thread has not opened our
+            // dataset in the meantime.
+            oLock.unlock();
+            const bool bEvicted = EvictEntryWithZeroRefCountFromOtherShards(
+                iShard, false, aoDatasetsToClose);
+            if (bEvicted)
+                nOpenedEntries++;
+            oLock.lock();
+            if (!bEvicted)
+            {
+                oLock.unlock();
+                CloseDatasets(aoDatasetsToClose);
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Too many threads are running for the current value "
+                         "of the dataset pool size (%d).\n"
+                         "or too many proxy datasets are opened in a cascaded "
+                         "way.\n"
+                         "Try increasing GDAL_MAX_DATASET_POOL_SIZE.",
+                         maxSize);
+                return nullptr;
+            }
+            bSlotReserved = true;
         }
 
-        CPLAssert(firstEntry);
-        cur = firstEntry;
-    }
-    else
-    {
-        /* Prepend */
-        cur = static_cast<GDALProxyPoolCacheEntry *>(
-            CPLCalloc(1, sizeof(GDALProxyPoolCacheEntry)));
-        if (lastEntry == nullptr)
-            lastEntry = cur;
-        cur->prev = nullptr;
-        cur->next = firstEntry;
-        if (firstEntry)
-            firstEntry->prev = cur;
-        firstEntry = cur;
-        currentSize++;
-#ifdef DEBUG_PROXY_POOL
-        CheckLinks();
-#endif
+        cur = GetFreeEntry(iShard);
+        cur->pszFileNameAndOpenOptions = CPLStrdup(osFilenameAndOO.c_str());
+        cur->pszOwner = (pszOwner) ? CPLStrdup(pszOwner) : nullptr;
+        cur->responsiblePID = responsiblePID;
+        cur->refCount = -1;  // to mark loading of dataset in progress
+        cur->nRAMUsage = 0;
     }
 
-    cur->pszFileNameAndOpenOptions = CPLStrdup(osFilenameAndOO.c_str());
-    cur->pszOwner = (pszOwner) ? CPLStrdup(pszOwner) : nullptr;
-    cur->responsiblePID = responsiblePID;
-    cur->refCount = -1;  // to mark loading of dataset in progress
-    cur->nRAMUsage = 0;
+    CloseDatasets(aoDatasetsToClose);
+    aoDatasetsToClose.clear();
 
     refCountOfDisabledRefCount++;
-    const int nFlag =
-        ((eAccess == GA_Update) ? GDAL_OF_UPDATE : GDAL_OF_READONLY) |
-        GDAL_OF_RASTER | GDAL_OF_VERBOSE_ERROR;
+    int nFlag = ((eAccess == GA_Update) ? GDAL_OF_UPDATE : GDAL_OF_READONLY) |
+                GDAL_OF_RASTER | GDAL_OF_VERBOSE_ERROR;
+    if (bThreadSafeDatasets && eAccess == GA_ReadOnly)
+        nFlag |= GDAL_OF_THREAD_SAFE;
     CPLConfigOptionSetter oSetter("CPL_ALLOW_VSISTDIN", "NO", true);
 
-    // Release mutex while opening dataset to avoid lock contention.
-    CPLReleaseMutex(*pMutex);
+    // Open the dataset without holding the shard mutex to avoid lock
+    // contention.
     auto poDS = GDALDataset::Open(pszFileName, nFlag, nullptr, papszOpenOptions,
                                   nullptr);
-    CPLAcquireMutex(*pMutex, 1000.0);
-
-    cur->poDS = poDS;
-    cur->refCount = 1;
+    const GIntBig nDSRAMUsage =
+        poDS ? std::max<GIntBig>(0, poDS->GetEstimatedRAMUsage()) : 0;
 
     refCountOfDisabledRefCount--;
 
-    if (cur->poDS)
     {
-        cur->nRAMUsage =
-            std::max<GIntBig>(0, cur->poDS->GetEstimatedRAMUsage());
-        nRAMUsage += cur->nRAMUsage;
+        std::lock_guard<std::mutex> oLock(oShard.oMutex);
+        cur->poDS = poDS;
+        cur->refCount = 1;
+        cur->nRAMUsage = nDSRAMUsage;
     }
+    nRAMUsage += nDSRAMUsage;
 
-    if (nMaxRAMUsage > 0 && cur->nRAMUsage > 0)
+    if (nMaxRAMUsage > 0 && nDSRAMUsage > 0)
     {
-        while (nRAMUsage > nMaxRAMUsage && nRAMUsage != cur->nRAMUsage &&
-               EvictEntryWithZeroRefCount(true))
+        while (nRAMUsage > nMaxRAMUsage && nRAMUsage != nDSRAMUsage)
         {
-            // ok
+            bool bEvicted;
+            {
+                std::lock_guard<std::mutex> oLock(oShard.oMutex);
+                bEvicted =
+                    EvictEntryWithZeroRefCount(oShard, true, aoDatasetsToClose);
+            }
+            if (!bEvicted &&
+                !EvictEntryWithZeroRefCountFromOtherShards(iShard, true,
+                                                           aoDatasetsToClose))
+            {
+                break;
+            }
         }
+        CloseDatasets(aoDatasetsToClose);
     }
 
     return cur;
@@ -451,48 +623,41 @@ void GDALDatasetPool::_CloseDatasetIfZeroRefCount(const char *pszFileName,
     if (bInDestruction)
         return;
 
-    GDALProxyPoolCacheEntry *cur = firstEntry;
-    GIntBig responsiblePID = GDALGetResponsiblePIDForCurrentThread();
-
     const std::string osFilenameAndOO =
         GetFilenameAndOpenOptions(pszFileName, papszOpenOptions);
+    Shard &oShard = aoShards[GetShardIndex(osFilenameAndOO)];
 
-    while (cur)
+    DatasetsToClose aoDatasetsToClose;
     {
-        GDALProxyPoolCacheEntry *next = cur->next;
-
-        if (cur->refCount == 0 && cur->pszFileNameAndOpenOptions &&
-            osFilenameAndOO == cur->pszFileNameAndOpenOptions &&
-            ((pszOwner == nullptr && cur->pszOwner == nullptr) ||
-             (pszOwner != nullptr && cur->pszOwner != nullptr &&
-              strcmp(cur->pszOwner, pszOwner) == 0)) &&
-            cur->poDS != nullptr)
+        std::lock_guard<std::mutex> oLock(oShard.oMutex);
+        for (GDALProxyPoolCacheEntry *cur = oShard.firstEntry; cur;
+             cur = cur->next)
         {
-            /* Close by pretending we are the thread that GDALOpen'ed this */
-            /* dataset */
-            GDALSetResponsiblePIDForCurrentThread(cur->responsiblePID);
-
-            GDALDataset *poDS = cur->poDS;
-
-            nRAMUsage -= cur->nRAMUsage;
-            cur->nRAMUsage = 0;
+            if (cur->refCount == 0 && cur->pszFileNameAndOpenOptions &&
+                osFilenameAndOO == cur->pszFileNameAndOpenOptions &&
+                ((pszOwner == nullptr && cur->pszOwner == nullptr) ||
+                 (pszOwner != nullptr && cur->pszOwner != nullptr &&
+                  strcmp(cur->pszOwner, pszOwner) == 0)) &&
+                cur->poDS != nullptr)
+            {
+                aoDatasetsToClose.emplace_back(cur->poDS, cur->responsiblePID);
 
-            cur->poDS = nullptr;
-            CPLFree(cur->pszFileNameAndOpenOptions);
-            cur->pszFileNameAndOpenOptions = nullptr;
-            CPLFree(cur->pszOwner);
-            cur->pszOwner = nullptr;
+                nRAMUsage -= cur->nRAMUsage;
+                cur->nRAMUsage = 0;
 
-            refCountOfDisabledRefCount++;
-            GDALClose(poDS);
-            refCountOfDisabledRefCount--;
+                cur->poDS = nullptr;
+                CPLFree(cur->pszFileNameAndOpenOptions);
+                cur->pszFileNameAndOpenOptions = nullptr;
+                CPLFree(cur->pszOwner);
+                cur->pszOwner = nullptr;
 
-            GDALSetResponsiblePIDForCurrentThread(responsiblePID);
-            break;
+                nOpenedEntries--;
+                break;
+            }
         }
-
-        cur = next;
     }
+
+    CloseDatasets(aoDatasetsToClose);
 }
 
 /************************************************************************/
@@ -536,8 +701,10 @@ void GDALDatasetPool::Ref()
                 l_nMaxRAMUsage *= 1024 * 1024 * 1024;
         }
 
-        singleton =
-            new GDALDatasetPool(GDALGetMaxDatasetPoolSize(), l_nMaxRAMUsage);
+        singleton = new GDALDatasetPool(
+            GDALGetMaxDatasetPoolSize(), l_nMaxRAMUsage,
+            CPLTestBool(CPLGetConfigOption("GDAL_DATASET_POOL_THREAD_SAFE",
+                                           "NO")));
     }
     if (refCountOfDisabledRefCount == 0)
         singleton->refCount++;
@@ -623,7 +790,8 @@ GDALDatasetPool::RefDataset(const char *pszFileName, GDALAccess eAccess,
 
 void GDALDatasetPool::UnrefDataset(GDALProxyPoolCacheEntry *cacheEntry)
 {
-    CPLMutexHolderD(GDALGetphDLMutex());
+    std::lock_guard<std::mutex> oLock(
+        singleton->aoShards[cacheEntry->iShard].oMutex);
     cacheEntry->refCount--;
 }
 
@@ -636,7 +804,6 @@ void GDALDatasetPool::CloseDatasetIfZeroRefCount(const char *pszFileName,
                                                  GDALAccess eAccess,
                                                  const char *pszOwner)
 {
-    CPLMutexHolderD(GDALGetphDLMutex());
     singleton->_CloseDatasetIfZeroRefCount(pszFileName, papszOpenOptions,
                                            eAccess, pszOwner);
 }
@@ -29,6 +29,7 @@
 #include <vector>
 
 #include "cpl_conv.h"
+#include "cpl_cpu_features.h"
 #include "cpl_error.h"
 #include "cpl_float.h"
 #include "cpl_progress.h"
@@ -76,6 +77,8 @@
 // to avoid build issue on Windows x86
 #include "gdal_priv_templates.hpp"
 
+#include "overview_avx2.h"
+
 /************************************************************************/
 /*                       GDALResampleChunk_Near()                       */
 /************************************************************************/
@@ -2112,6 +2115,25 @@ static CPLErr GDALResampleChunk_Gauss(const GDALOverviewResampleArgs &args,
     const int nChunkBottomYOff = nChunkYOff + nChunkYSize;
     const int nDstXWidth = nDstXOff2 - nDstXOff;
 
+#ifdef HAVE_OVERVIEW_AVX2
+    // Gauss matrix as doubles, with lines padded to 8 values.
+    const bool bUseAVX2 = poColorTable == nullptr &&
+                          pabyChunkNodataMask == nullptr &&
+                          CPLHaveRuntimeAVX2();
+    double adfGaussMatrixPadded[8 * 8] = {0};
+    if (bUseAVX2)
+    {
+        for (int j = 0; j < nGaussMatrixDim; ++j)
+        {
+            for (int i = 0; i < nGaussMatrixDim; ++i)
+            {
+                adfGaussMatrixPadded[j * 8 + i] =
+                    panGaussMatrix[j * nGaussMatrixDim + i];
+            }
+        }
+    }
+#endif
+
     /* ==================================================================== */
     /*      Loop over destination scanlines.                                */
     /* ==================================================================== */
@@ -2188,6 +2210,21 @@ static CPLErr GDALResampleChunk_Gauss(const GDALOverviewResampleArgs &args,
                 nSrcXOff = nChunkXOff;
             }
 
+#ifdef HAVE_OVERVIEW_AVX2
+            if (bUseAVX2)
+            {
+                double dfCount = 0;
+                const double dfTotal = GDALGaussWeightedSum_AVX2(
+                    padfSrcScanline + (nSrcXOff - nChunkXOff), nChunkXSize,
+                    adfGaussMatrixPadded + nYShiftGaussMatrix * 8 +
+                        nXShiftGaussMatrix,
+                    nSrcYOff2 - nSrcYOff, nSrcXOff2 - nSrcXOff, &dfCount);
+                padfDstScanline[iDstPixel - nDstXOff] =
+                    dfCount == 0 ? dfNoDataValue : dfTotal / dfCount;
+                continue;
+            }
+#endif
+
             if (poColorTable == nullptr)
             {
                 double dfTotal = 0.0;
@@ -2401,6 +2438,12 @@ static CPLErr GDALResampleChunk_ModeT(const GDALOverviewResampleArgs &args,
     const int nChunkBottomYOff = nChunkYOff + nChunkYSize;
     std::vector<int> anVals(256, 0);
 
+#ifdef HAVE_OVERVIEW_AVX2
+    constexpr bool bHasAVX2Kernel =
+        std::is_same<T, GByte>::value || std::is_same<T, GUInt16>::value;
+    const bool bUseAVX2 = bHasAVX2Kernel && CPLHaveRuntimeAVX2();
+#endif
+
     /* ==================================================================== */
     /*      Loop over destination scanlines.                                */
     /* ==================================================================== */
@@ -2484,6 +2527,49 @@ static CPLErr GDALResampleChunk_ModeT(const GDALOverviewResampleArgs &args,
             else if (poColorTable && poColorTable->GetColorEntryCount() > 256)
                 bRegularProcessing = true;
 
+#ifdef HAVE_OVERVIEW_AVX2
+            if constexpr (bHasAVX2Kernel)
+            {
+                // Small windows: gather the valid values and compute their
+                // mode with AVX2, with the same tie rule as below.
+                if (bUseAVX2 && nSrcYOff2 > nSrcYOff && nSrcXOff2 > nSrcXOff &&
+                    (nSrcYOff2 - nSrcYOff) * (nSrcXOff2 - nSrcXOff) <=
+                        GDAL_MODE_AVX2_MAX_VALUES)
+                {
+                    T aValues[GDAL_MODE_AVX2_MAX_VALUES];
+                    int nValues = 0;
+                    for (int iY = nSrcYOff; iY < nSrcYOff2; ++iY)
+                    {
+                        const GPtrDiff_t iTotYOff =
+                            static_cast<GPtrDiff_t>(iY - nSrcYOff) *
+                                nChunkXSize -
+                            nChunkXOff;
+                        for (int iX = nSrcXOff; iX < nSrcXOff2; ++iX)
+                        {
+                            const T val = paSrcScanline[iX + iTotYOff];
+                            if (bRegularProcessing
+                                    ? (pabySrcScanlineNodataMask == nullptr ||
+                                       pabySrcScanlineNodataMask[iX + iTotYOff])
+                                    : (!bHasNoData || val != tNoDataValue))
+                            {
+                                aValues[nValues++] = val;
+                            }
+                        }
+                    }
+
+                    if (nValues == 0)
+                        paDstScanline[iDstPixel - nDstXOff] = tNoDataValue;
+                    else if constexpr (std::is_same<T, GByte>::value)
+                        paDstScanline[iDstPixel - nDstXOff] =
+                            GDALModeByte_AVX2(aValues, nValues);
+                    else
+                        paDstScanline[iDstPixel - nDstXOff] =
+                            GDALModeUInt16_AVX2(aValues, nValues);
+                    continue;
+                }
+            }
+#endif
+
             if (bRegularProcessing)
             {
                 // Sanity check to make sure the allocation of paVals and
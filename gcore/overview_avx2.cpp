@@ -0,0 +1,265 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  AVX2 specializations of overview resampling kernels
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_port.h"
+#include "cpl_error.h"
+
+#include "overview_avx2.h"
+
+#ifdef HAVE_OVERVIEW_AVX2
+
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+#include <algorithm>
+#include <cstring>
+
+/************************************************************************/
+/*                         CountTrailingZeros()                         */
+/************************************************************************/
+
+static inline int CountTrailingZeros(unsigned nMask)
+{
+    CPLAssert(nMask != 0);
+#if defined(__GNUC__)
+    return __builtin_ctz(nMask);
+#elif defined(_MSC_VER)
+    unsigned long nIdx = 0;
+    _BitScanForward(&nIdx, nMask);
+    return static_cast<int>(nIdx);
+#else
+    int nIdx = 0;
+    while ((nMask & 1) == 0)
+    {
+        nMask >>= 1;
+        ++nIdx;
+    }
+    return nIdx;
+#endif
+}
+
+/************************************************************************/
+/*                         HorizontalMaxEpu8()                          */
+/************************************************************************/
+
+static inline int HorizontalMaxEpu8(__m256i v)
+{
+    __m128i m = _mm_max_epu8(_mm256_castsi256_si128(v),
+                             _mm256_extracti128_si256(v, 1));
+    m = _mm_max_epu8(m, _mm_srli_si128(m, 8));
+    m = _mm_max_epu8(m, _mm_srli_si128(m, 4));
+    m = _mm_max_epu8(m, _mm_srli_si128(m, 2));
+    m = _mm_max_epu8(m, _mm_srli_si128(m, 1));
+    return _mm_cvtsi128_si32(m) & 0xFF;
+}
+
+/************************************************************************/
+/*                         HorizontalMaxEpu16()                         */
+/************************************************************************/
+
+static inline int HorizontalMaxEpu16(__m256i v)
+{
+    __m128i m = _mm_max_epu16(_mm256_castsi256_si128(v),
+                              _mm256_extracti128_si256(v, 1));
+    m = _mm_max_epu16(m, _mm_srli_si128(m, 8));
+    m = _mm_max_epu16(m, _mm_srli_si128(m, 4));
+    m = _mm_max_epu16(m, _mm_srli_si128(m, 2));
+    return _mm_cvtsi128_si32(m) & 0xFFFF;
+}
+
+/************************************************************************/
+/*                         GDALModeByte_AVX2()                          */
+/************************************************************************/
+
+// For each position p, we compute the number of values at positions <= p
+// that are equal to the value at p. The mode is the value at the first
+// position where that count reaches its maximum, which is what the scalar
+// code in GDALResampleChunk_ModeT() returns.
+
+GByte GDALModeByte_AVX2(const GByte *pabyValues, int nValues)
+{
+    constexpr int LANES = 32;
+    constexpr int BLOCKS = GDAL_MODE_AVX2_MAX_VALUES / LANES;
+    CPLAssert(nValues >= 1 && nValues <= GDAL_MODE_AVX2_MAX_VALUES);
+
+    GByte abyValues[GDAL_MODE_AVX2_MAX_VALUES] = {0};
+    memcpy(abyValues, pabyValues, nValues);
+    const int nBlocks = (nValues + LANES - 1) / LANES;
+
+    __m256i aValues[BLOCKS];
+    __m256i aIndices[BLOCKS];
+    __m256i aCounts[BLOCKS];
+    for (int b = 0; b < nBlocks; ++b)
+    {
+        aValues[b] = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i *>(abyValues + b * LANES));
+        aIndices[b] = _mm256_add_epi8(
+            _mm256_set1_epi8(static_cast<char>(b * LANES)),
+            _mm256_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+                             15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26,
+                             27, 28, 29, 30, 31));
+        aCounts[b] = _mm256_setzero_si256();
+    }
+
+    for (int q = 0; q < nValues; ++q)
+    {
+        const __m256i vq = _mm256_set1_epi8(static_cast<char>(abyValues[q]));
+        const __m256i vqMinus1 = _mm256_set1_epi8(static_cast<char>(q - 1));
+        for (int b = q / LANES; b < nBlocks; ++b)
+        {
+            // Lanes p such that p >= q and value[p] == value[q]
+            const __m256i eq =
+                _mm256_and_si256(_mm256_cmpeq_epi8(aValues[b], vq),
+                                 _mm256_cmpgt_epi8(aIndices[b], vqMinus1));
+            // eq is -1 where true
+            aCounts[b] = _mm256_sub_epi8(aCounts[b], eq);
+        }
+    }
+
+    // Zero counts of padding lanes
+    const __m256i vNValues = _mm256_set1_epi8(static_cast<char>(nValues));
+    int nMaxCount = 0;
+    for (int b = 0; b < nBlocks; ++b)
+    {
+        aCounts[b] = _mm256_and_si256(
+            aCounts[b], _mm256_cmpgt_epi8(vNValues, aIndices[b]));
+        nMaxCount = std::max(nMaxCount, HorizontalMaxEpu8(aCounts[b]));
+    }
+
+    const __m256i vMaxCount = _mm256_set1_epi8(static_cast<char>(nMaxCount));
+    for (int b = 0; b < nBlocks; ++b)
+    {
+        const unsigned nMask = static_cast<unsigned>(
+            _mm256_movemask_epi8(_mm256_cmpeq_epi8(aCounts[b], vMaxCount)));
+        if (nMask)
+            return abyValues[b * LANES + CountTrailingZeros(nMask)];
+    }
+
+    CPLAssert(false);
+    return abyValues[0];
+}
+
+/************************************************************************/
+/*                        GDALModeUInt16_AVX2()                         */
+/************************************************************************/
+
+GUInt16 GDALModeUInt16_AVX2(const GUInt16 *panValues, int nValues)
+{
+    constexpr int LANES = 16;
+    constexpr int BLOCKS = GDAL_MODE_AVX2_MAX_VALUES / LANES;
+    CPLAssert(nValues >= 1 && nValues <= GDAL_MODE_AVX2_MAX_VALUES);
+
+    GUInt16 anValues[GDAL_MODE_AVX2_MAX_VALUES] = {0};
+    memcpy(anValues, panValues, nValues * sizeof(GUInt16));
+    const int nBlocks = (nValues + LANES - 1) / LANES;
+
+    __m256i aValues[BLOCKS];
+    __m256i aIndices[BLOCKS];
+    __m256i aCounts[BLOCKS];
+    for (int b = 0; b < nBlocks; ++b)
+    {
+        aValues[b] = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i *>(anValues + b * LANES));
+        aIndices[b] = _mm256_add_epi16(
+            _mm256_set1_epi16(static_cast<short>(b * LANES)),
+            _mm256_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+                              15));
+        aCounts[b] = _mm256_setzero_si256();
+    }
+
+    for (int q = 0; q < nValues; ++q)
+    {
+        const __m256i vq = _mm256_set1_epi16(static_cast<short>(anValues[q]));
+        const __m256i vqMinus1 = _mm256_set1_epi16(static_cast<short>(q - 1));
+        for (int b = q / LANES; b < nBlocks; ++b)
+        {
+            const __m256i eq =
+                _mm256_and_si256(_mm256_cmpeq_epi16(aValues[b], vq),
+                                 _mm256_cmpgt_epi16(aIndices[b], vqMinus1));
+            aCounts[b] = _mm256_sub_epi16(aCounts[b], eq);
+        }
+    }
+
+    const __m256i vNValues = _mm256_set1_epi16(static_cast<short>(nValues));
+    int nMaxCount = 0;
+    for (int b = 0; b < nBlocks; ++b)
+    {
+        aCounts[b] = _mm256_and_si256(
+            aCounts[b], _mm256_cmpgt_epi16(vNValues, aIndices[b]));
+        nMaxCount = std::max(nMaxCount, HorizontalMaxEpu16(aCounts[b]));
+    }
+
+    const __m256i vMaxCount = _mm256_set1_epi16(static_cast<short>(nMaxCount));
+    for (int b = 0; b < nBlocks; ++b)
+    {
+        // 2 bits per matching 16-bit lane
+        const unsigned nMask = static_cast<unsigned>(
+            _mm256_movemask_epi8(_mm256_cmpeq_epi16(aCounts[b], vMaxCount)));
+        if (nMask)
+            return anValues[b * LANES + CountTrailingZeros(nMask) / 2];
+    }
+
+    CPLAssert(false);
+    return anValues[0];
+}
+
+/************************************************************************/
+/*                     GDALGaussWeightedSum_AVX2()                      */
+/************************************************************************/
+
+double GDALGaussWeightedSum_AVX2(const double *padfSrc,
+                                 GPtrDiff_t nSrcLineStride,
+                                 const double *padfWeights, int nRows,
+                                 int nCols, double *pdfSumWeights)
+{
+    CPLAssert(nCols <= 8);
+
+    // Lane masks for the first 4 columns and the next 4 ones
+    const __m256i vLanes = _mm256_setr_epi64x(0, 1, 2, 3);
+    const __m256i vMask0 =
+        _mm256_cmpgt_epi64(_mm256_set1_epi64x(nCols), vLanes);
+    const __m256i vMask1 =
+        _mm256_cmpgt_epi64(_mm256_set1_epi64x(nCols - 4), vLanes);
+
+    __m256d vSum = _mm256_setzero_pd();
+    __m256d vSumWeights = _mm256_setzero_pd();
+    for (int j = 0; j < nRows; ++j)
+    {
+        const double *padfSrcLine = padfSrc + j * nSrcLineStride;
+        const double *padfWeightsLine = padfWeights + j * 8;
+
+        // Masked loads do not access masked-out elements, so they do not
+        // read beyond the end of the source line.
+        const __m256d vWeights0 = _mm256_maskload_pd(padfWeightsLine, vMask0);
+        const __m256d vWeights1 =
+            _mm256_maskload_pd(padfWeightsLine + 4, vMask1);
+        const __m256d vSrc0 = _mm256_maskload_pd(padfSrcLine, vMask0);
+        const __m256d vSrc1 = _mm256_maskload_pd(padfSrcLine + 4, vMask1);
+
+        vSum = _mm256_add_pd(vSum, _mm256_mul_pd(vSrc0, vWeights0));
+        vSum = _mm256_add_pd(vSum, _mm256_mul_pd(vSrc1, vWeights1));
+        vSumWeights = _mm256_add_pd(vSumWeights, vWeights0);
+        vSumWeights = _mm256_add_pd(vSumWeights, vWeights1);
+    }
+
+    double adfSum[4];
+    _mm256_storeu_pd(adfSum, vSum);
+    double adfSumWeights[4];
+    _mm256_storeu_pd(adfSumWeights, vSumWeights);
+    *pdfSumWeights =
+        (adfSumWeights[0] + adfSumWeights[1]) +
+        (adfSumWeights[2] + adfSumWeights[3]);
+    return (adfSum[0] + adfSum[1]) + (adfSum[2] + adfSum[3]);
+}
+
+#endif  // HAVE_OVERVIEW_AVX2
@@ -0,0 +1,42 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  AVX2 specializations of overview resampling kernels
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef OVERVIEW_AVX2_H_INCLUDED
+#define OVERVIEW_AVX2_H_INCLUDED
+
+#include "cpl_port.h"
+
+#if defined(HAVE_AVX2_AT_COMPILE_TIME) && (defined(__x86_64) || defined(_M_X64))
+
+#define HAVE_OVERVIEW_AVX2
+
+//! Maximum number of values accepted by GDALModeByte_AVX2() and
+//! GDALModeUInt16_AVX2()
+constexpr int GDAL_MODE_AVX2_MAX_VALUES = 64;
+
+// Return the most frequent value among the nValues values (with
+// 1 <= nValues <= GDAL_MODE_AVX2_MAX_VALUES). In case of ties, the value whose
+// count reaches the maximum count first, in the order of the values, wins.
+GByte GDALModeByte_AVX2(const GByte *pabyValues, int nValues);
+
+GUInt16 GDALModeUInt16_AVX2(const GUInt16 *panValues, int nValues);
+
+// Return the sum of padfSrc[j * nSrcLineStride + i] * padfWeights[j * 8 + i]
+// for 0 <= j < nRows and 0 <= i < nCols (nCols <= 8), and set *pdfSumWeights
+// to the sum of the weights.
+double GDALGaussWeightedSum_AVX2(const double *padfSrc,
+                                 GPtrDiff_t nSrcLineStride,
+                                 const double *padfWeights, int nRows,
+                                 int nCols, double *pdfSumWeights);
+
+#endif
+
+#endif /* OVERVIEW_AVX2_H_INCLUDED */
@@ -25,18 +25,23 @@
 #include <cstring>
 
 #include <algorithm>
+#include <functional>
 #include <limits>
+#include <memory>
 #include <stdexcept>
 #include <type_traits>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_cpu_features.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_float.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
 #include "gdal_priv_templates.hpp"
+#include "gdal_thread_pool.h"
 #include "gdal_vrt.h"
 #include "gdalwarper.h"
 #include "memdataset.h"
@@ -5248,6 +5253,13 @@ static void GDALCopyWholeRasterGetSwathSize(GDALRasterBand *poSrcPrototypeBand,
  * </ul>
  * More options may be supported in the future.
  *
+ * Since GDAL 3.13, when the GDAL_NUM_THREADS configuration option is set to
+ * a value greater than 1 (or ALL_CPUS), the next swath is read from the source
+ * dataset by a job of the global thread pool while the current one is written
+ * to the destination dataset. Progress is then only reported after each swath
+ * has been written. This can be disabled by setting the
+ * GDAL_COPY_WHOLE_RASTER_OVERLAP_IO configuration option to NO.
+ *
  * @param hSrcDS the source dataset
  * @param hDstDS the destination dataset
  * @param papszOptions transfer hints in "StringList" Name=Value format.
@@ -5380,175 +5392,259 @@ CPLErr CPL_STDCALL GDALDatasetCopyWholeRaster(GDALDatasetH hSrcDS,
     poSrcDS->AdviseRead(0, 0, nXSize, nYSize, nXSize, nYSize, eDT, nBandCount,
                         nullptr, nullptr);
 
-    /* ==================================================================== */
-    /*      Band oriented (uninterleaved) case.                             */
-    /* ==================================================================== */
-    CPLErr eErr = CE_None;
-    const bool bCheckHoles =
-        CPLTestBool(CSLFetchNameValueDef(papszOptions, "SKIP_HOLES", "NO"));
-
-    if (!bInterleave)
+    /* -------------------------------------------------------------------- */
+    /*      Build the list of swaths to process. In the band oriented       */
+    /*      (uninterleaved) case, a swath concerns a single band, whereas   */
+    /*      it concerns all bands in the pixel interleaved case.            */
+    /* -------------------------------------------------------------------- */
+    struct Swath
     {
-        GDALRasterIOExtraArg sExtraArg;
-        INIT_RASTERIO_EXTRA_ARG(sExtraArg);
-        CPL_IGNORE_RET_VAL(sExtraArg.pfnProgress);  // to make cppcheck happy
-
-        const GIntBig nTotalBlocks = static_cast<GIntBig>(nBandCount) *
-                                     DIV_ROUND_UP(nYSize, nSwathLines) *
-                                     DIV_ROUND_UP(nXSize, nSwathCols);
-        GIntBig nBlocksDone = 0;
+        int nBand;  // 0 for all bands
+        int iX;
+        int iY;
+        int nCols;
+        int nLines;
+    };
 
-        for (int iBand = 0; iBand < nBandCount && eErr == CE_None; iBand++)
+    std::vector<Swath> aoSwaths;
+    for (int iBand = 0; iBand < (bInterleave ? 1 : nBandCount); iBand++)
+    {
+        for (int iY = 0; iY < nYSize; iY += nSwathLines)
         {
-            int nBand = iBand + 1;
-
-            for (int iY = 0; iY < nYSize && eErr == CE_None; iY += nSwathLines)
+            const int nThisLines = std::min(nSwathLines, nYSize - iY);
+            for (int iX = 0; iX < nXSize; iX += nSwathCols)
             {
-                int nThisLines = nSwathLines;
-
-                if (iY + nThisLines > nYSize)
-                    nThisLines = nYSize - iY;
+                const int nThisCols = std::min(nSwathCols, nXSize - iX);
+                aoSwaths.push_back(
+                    {bInterleave ? 0 : iBand + 1, iX, iY, nThisCols,
+                     nThisLines});
+            }
+        }
+    }
+    const GIntBig nTotalBlocks = static_cast<GIntBig>(aoSwaths.size());
 
-                for (int iX = 0; iX < nXSize && eErr == CE_None;
-                     iX += nSwathCols)
-                {
-                    int nThisCols = nSwathCols;
+    const bool bCheckHoles =
+        CPLTestBool(CSLFetchNameValueDef(papszOptions, "SKIP_HOLES", "NO"));
 
-                    if (iX + nThisCols > nXSize)
-                        nThisCols = nXSize - iX;
+    // Return whether the swath contains data, that is whether it must be
+    // copied.
+    const auto SwathHasData = [poSrcDS, nBandCount,
+                               bCheckHoles](const Swath &oSwath)
+    {
+        if (!bCheckHoles)
+            return true;
+        int nStatus = 0;
+        for (int iBand = 0; iBand < nBandCount; iBand++)
+        {
+            if (oSwath.nBand != 0 && oSwath.nBand != iBand + 1)
+                continue;
+            nStatus |=
+                poSrcDS->GetRasterBand(iBand + 1)->GetDataCoverageStatus(
+                    oSwath.iX, oSwath.iY, oSwath.nCols, oSwath.nLines,
+                    GDAL_DATA_COVERAGE_STATUS_DATA);
+            if (nStatus & GDAL_DATA_COVERAGE_STATUS_DATA)
+                break;
+        }
+        return (nStatus & GDAL_DATA_COVERAGE_STATUS_DATA) != 0;
+    };
 
-                    int nStatus = GDAL_DATA_COVERAGE_STATUS_DATA;
-                    if (bCheckHoles)
-                    {
-                        nStatus = poSrcDS->GetRasterBand(nBand)
-                                      ->GetDataCoverageStatus(
-                                          iX, iY, nThisCols, nThisLines,
-                                          GDAL_DATA_COVERAGE_STATUS_DATA);
-                    }
-                    if (nStatus & GDAL_DATA_COVERAGE_STATUS_DATA)
-                    {
-                        sExtraArg.pfnProgress = GDALScaledProgress;
-                        sExtraArg.pProgressData = GDALCreateScaledProgress(
-                            nBlocksDone / static_cast<double>(nTotalBlocks),
-                            (nBlocksDone + 0.5) /
-                                static_cast<double>(nTotalBlocks),
-                            pfnProgress, pProgressData);
-                        if (sExtraArg.pProgressData == nullptr)
-                            sExtraArg.pfnProgress = nullptr;
-
-                        eErr = poSrcDS->RasterIO(GF_Read, iX, iY, nThisCols,
-                                                 nThisLines, pSwathBuf,
-                                                 nThisCols, nThisLines, eDT, 1,
-                                                 &nBand, 0, 0, 0, &sExtraArg);
-
-                        GDALDestroyScaledProgress(sExtraArg.pProgressData);
+    const auto ReadSwath =
+        [poSrcDS, eDT, nBandCount](const Swath &oSwath, void *pBuf,
+                                   GDALRasterIOExtraArg *psExtraArg)
+    {
+        return poSrcDS->RasterIO(
+            GF_Read, oSwath.iX, oSwath.iY, oSwath.nCols, oSwath.nLines, pBuf,
+            oSwath.nCols, oSwath.nLines, eDT,
+            oSwath.nBand == 0 ? nBandCount : 1,
+            oSwath.nBand == 0 ? nullptr : &oSwath.nBand, 0, 0, 0, psExtraArg);
+    };
 
-                        if (eErr == CE_None)
-                            eErr = poDstDS->RasterIO(
-                                GF_Write, iX, iY, nThisCols, nThisLines,
-                                pSwathBuf, nThisCols, nThisLines, eDT, 1,
-                                &nBand, 0, 0, 0, nullptr);
-                    }
+    const auto WriteSwath =
+        [poDstDS, eDT, nBandCount](const Swath &oSwath, void *pBuf)
+    {
+        return poDstDS->RasterIO(
+            GF_Write, oSwath.iX, oSwath.iY, oSwath.nCols, oSwath.nLines, pBuf,
+            oSwath.nCols, oSwath.nLines, eDT,
+            oSwath.nBand == 0 ? nBandCount : 1,
+            oSwath.nBand == 0 ? nullptr : &oSwath.nBand, 0, 0, 0, nullptr);
+    };
 
-                    nBlocksDone++;
-                    if (eErr == CE_None &&
-                        !pfnProgress(nBlocksDone /
-                                         static_cast<double>(nTotalBlocks),
-                                     nullptr, pProgressData))
-                    {
-                        eErr = CE_Failure;
-                        CPLError(CE_Failure, CPLE_UserInterrupt,
-                                 "User terminated CreateCopy()");
-                    }
-                }
-            }
+    /* -------------------------------------------------------------------- */
+    /*      Do we want to read the next swath from the source in a          */
+    /*      worker thread, while the current one is written to the          */
+    /*      destination? This overlaps decompression of the source with     */
+    /*      compression of the destination.                                 */
+    /* -------------------------------------------------------------------- */
+    const size_t nSwathBufSize =
+        static_cast<size_t>(nSwathCols) * nSwathLines * nPixelSize;
+    void *pSwathBuf2 = nullptr;
+    const char *pszThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+    const int nThreads = std::max(1, std::min(128, EQUAL(pszThreads, "ALL_CPUS")
+                                                       ? CPLGetNumCPUs()
+                                                       : atoi(pszThreads)));
+    CPLWorkerThreadPool *poThreadPool = nullptr;
+    if (aoSwaths.size() >= 2 && poSrcDS != poDstDS && nThreads > 1 &&
+        CPLTestBool(CPLGetConfigOption("GDAL_COPY_WHOLE_RASTER_OVERLAP_IO",
+                                       "YES")))
+    {
+        // When the destination is compressed, the swath being read must not
+        // cause the blocks of the swath being written to be evicted from
+        // the block cache before they are complete.
+        if (bDstIsCompressed &&
+            GDALGetCacheMax64() < 3 * static_cast<GIntBig>(nSwathBufSize))
+        {
+            CPLDebug("GDAL",
+                     "GDALDatasetCopyWholeRaster(): block cache too small to "
+                     "overlap reading and writing");
+        }
+        else
+        {
+            poThreadPool = GDALGetGlobalThreadPool(nThreads);
+            if (poThreadPool)
+                pSwathBuf2 = VSI_MALLOC_VERBOSE(nSwathBufSize);
         }
     }
 
-    /* ==================================================================== */
-    /*      Pixel interleaved case.                                         */
-    /* ==================================================================== */
-    else /* if( bInterleave ) */
+    CPLErr eErr = CE_None;
+    if (pSwathBuf2 == nullptr)
     {
         GDALRasterIOExtraArg sExtraArg;
         INIT_RASTERIO_EXTRA_ARG(sExtraArg);
         CPL_IGNORE_RET_VAL(sExtraArg.pfnProgress);  // to make cppcheck happy
 
-        const GIntBig nTotalBlocks =
-            static_cast<GIntBig>(DIV_ROUND_UP(nYSize, nSwathLines)) *
-            DIV_ROUND_UP(nXSize, nSwathCols);
         GIntBig nBlocksDone = 0;
-
-        for (int iY = 0; iY < nYSize && eErr == CE_None; iY += nSwathLines)
+        for (const auto &oSwath : aoSwaths)
         {
-            int nThisLines = nSwathLines;
-
-            if (iY + nThisLines > nYSize)
-                nThisLines = nYSize - iY;
-
-            for (int iX = 0; iX < nXSize && eErr == CE_None; iX += nSwathCols)
+            if (SwathHasData(oSwath))
             {
-                int nThisCols = nSwathCols;
+                sExtraArg.pfnProgress = GDALScaledProgress;
+                sExtraArg.pProgressData = GDALCreateScaledProgress(
+                    nBlocksDone / static_cast<double>(nTotalBlocks),
+                    (nBlocksDone + 0.5) / static_cast<double>(nTotalBlocks),
+                    pfnProgress, pProgressData);
+                if (sExtraArg.pProgressData == nullptr)
+                    sExtraArg.pfnProgress = nullptr;
 
-                if (iX + nThisCols > nXSize)
-                    nThisCols = nXSize - iX;
+                eErr = ReadSwath(oSwath, pSwathBuf, &sExtraArg);
 
-                int nStatus = GDAL_DATA_COVERAGE_STATUS_DATA;
-                if (bCheckHoles)
-                {
-                    nStatus = 0;
-                    for (int iBand = 0; iBand < nBandCount; iBand++)
-                    {
-                        nStatus |= poSrcDS->GetRasterBand(iBand + 1)
-                                       ->GetDataCoverageStatus(
-                                           iX, iY, nThisCols, nThisLines,
-                                           GDAL_DATA_COVERAGE_STATUS_DATA);
-                        if (nStatus & GDAL_DATA_COVERAGE_STATUS_DATA)
-                            break;
-                    }
-                }
-                if (nStatus & GDAL_DATA_COVERAGE_STATUS_DATA)
-                {
-                    sExtraArg.pfnProgress = GDALScaledProgress;
-                    sExtraArg.pProgressData = GDALCreateScaledProgress(
-                        nBlocksDone / static_cast<double>(nTotalBlocks),
-                        (nBlocksDone + 0.5) / static_cast<double>(nTotalBlocks),
-                        pfnProgress, pProgressData);
-                    if (sExtraArg.pProgressData == nullptr)
-                        sExtraArg.pfnProgress = nullptr;
+                GDALDestroyScaledProgress(sExtraArg.pProgressData);
 
-                    eErr = poSrcDS->RasterIO(GF_Read, iX, iY, nThisCols,
-                                             nThisLines, pSwathBuf, nThisCols,
-                                             nThisLines, eDT, nBandCount,
-                                             nullptr, 0, 0, 0, &sExtraArg);
-
-                    GDALDestroyScaledProgress(sExtraArg.pProgressData);
-
-                    if (eErr == CE_None)
-                        eErr = poDstDS->RasterIO(
-                            GF_Write, iX, iY, nThisCols, nThisLines, pSwathBuf,
-                            nThisCols, nThisLines, eDT, nBandCount, nullptr, 0,
-                            0, 0, nullptr);
-                }
+                if (eErr == CE_None)
+                    eErr = WriteSwath(oSwath, pSwathBuf);
+            }
 
-                nBlocksDone++;
-                if (eErr == CE_None &&
-                    !pfnProgress(nBlocksDone /
-                                     static_cast<double>(nTotalBlocks),
-                                 nullptr, pProgressData))
+            nBlocksDone++;
+            if (eErr == CE_None &&
+                !pfnProgress(nBlocksDone / static_cast<double>(nTotalBlocks),
+                             nullptr, pProgressData))
+            {
+                eErr = CE_Failure;
+                CPLError(CE_Failure, CPLE_UserInterrupt,
+                         "User terminated CreateCopy()");
+            }
+            if (eErr != CE_None)
+                break;
+        }
+    }
+    else
+    {
+        CPLDebug("GDAL",
+                 "GDALDatasetCopyWholeRaster(): overlapping reading and "
+                 "writing");
+
+        // The reader thread must see the same thread-local configuration
+        // options as the calling thread.
+        const CPLStringList aosTLConfigOptions(
+            CPLGetThreadLocalConfigOptions());
+
+        struct ReadResult
+        {
+            bool bHasData = true;
+            CPLErr eErr = CE_None;
+            CPLErrorAccumulator oErrorAccumulator{};
+        };
+
+        // Only one read is pending at a time, so waiting for the completion
+        // of the queue waits for that read.
+        auto poJobQueue = poThreadPool->CreateJobQueue();
+
+        // Read swath iSwath in a worker thread. Progress is only reported
+        // from the calling thread, as progress callbacks are not expected to
+        // be thread-safe.
+        const auto SubmitRead =
+            [&aoSwaths, &aosTLConfigOptions, &SwathHasData, &ReadSwath,
+             &poJobQueue, poSrcDS, eDT, nBandCount](size_t iSwath, void *pBuf)
+        {
+            auto poResult = std::make_shared<ReadResult>();
+            std::function<void()> oTask =
+                [&aoSwaths, &aosTLConfigOptions, &SwathHasData, &ReadSwath,
+                 poSrcDS, eDT, nBandCount, poResult, iSwath, pBuf]()
+            {
+                CPLSetThreadLocalConfigOptions(aosTLConfigOptions.List());
+                auto oAccumulator =
+                    poResult->oErrorAccumulator.InstallForCurrentScope();
+                CPL_IGNORE_RET_VAL(oAccumulator);
+                const Swath &oSwath = aoSwaths[iSwath];
+                poResult->bHasData = SwathHasData(oSwath);
+                if (poResult->bHasData)
                 {
-                    eErr = CE_Failure;
-                    CPLError(CE_Failure, CPLE_UserInterrupt,
-                             "User terminated CreateCopy()");
+                    // Let drivers, typically network based ones, merge
+                    // the requests of the swath.
+                    poSrcDS->AdviseRead(
+                        oSwath.iX, oSwath.iY, oSwath.nCols, oSwath.nLines,
+                        oSwath.nCols, oSwath.nLines, eDT,
+                        oSwath.nBand == 0 ? nBandCount : 1,
+                        oSwath.nBand == 0 ? nullptr
+                                          : const_cast<int *>(&oSwath.nBand),
+                        nullptr);
+                    poResult->eErr = ReadSwath(oSwath, pBuf, nullptr);
                 }
+                CPLSetThreadLocalConfigOptions(nullptr);
+            };
+            if (!poJobQueue->SubmitJob(oTask))
+                oTask();
+            return poResult;
+        };
+
+        void *apBufs[] = {pSwathBuf, pSwathBuf2};
+        auto poPendingResult = SubmitRead(0, apBufs[0]);
+        for (size_t iSwath = 0; iSwath < aoSwaths.size(); ++iSwath)
+        {
+            poJobQueue->WaitCompletion();
+            const auto poResult = std::move(poPendingResult);
+            void *pBuf = apBufs[iSwath % 2];
+
+            // Start reading the next swath, while this one is written.
+            if (poResult->eErr == CE_None && iSwath + 1 < aoSwaths.size())
+                poPendingResult =
+                    SubmitRead(iSwath + 1, apBufs[(iSwath + 1) % 2]);
+
+            poResult->oErrorAccumulator.ReplayErrors();
+            eErr = poResult->eErr;
+            if (eErr == CE_None && poResult->bHasData)
+                eErr = WriteSwath(aoSwaths[iSwath], pBuf);
+
+            if (eErr == CE_None &&
+                !pfnProgress((iSwath + 1) / static_cast<double>(nTotalBlocks),
+                             nullptr, pProgressData))
+            {
+                eErr = CE_Failure;
+                CPLError(CE_Failure, CPLE_UserInterrupt,
+                         "User terminated CreateCopy()");
             }
+            if (eErr != CE_None)
+                break;
         }
+
+        // Do not leave a pending read running on our buffers
+        poJobQueue->WaitCompletion();
     }
 
     /* -------------------------------------------------------------------- */
     /*      Cleanup                                                         */
     /* -------------------------------------------------------------------- */
     CPLFree(pSwathBuf);
+    CPLFree(pSwathBuf2);
 
     return eErr;
 }
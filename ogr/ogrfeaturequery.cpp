@@ -18,6 +18,8 @@
 
 #include <cstddef>
 #include <algorithm>
+#include <climits>
+#include <cmath>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -331,6 +333,176 @@ int OGRFeatureQuery::Evaluate(OGRFeature *poFeature)
     return bLogicalResult;
 }
 
+/************************************************************************/
+/*                     OGRGetIndexRangeQueryBound()                     */
+/*                                                                      */
+/*      Convert a constant used as a bound of a range comparison on     */
+/*      an indexed field into an OGRField of the type of the field.     */
+/*      Bounds on integer fields are made inclusive.                    */
+/************************************************************************/
+
+static bool OGRGetIndexRangeQueryBound(const swq_expr_node *poValue,
+                                       const OGRFieldDefn *poFieldDefn,
+                                       bool bIsMin, bool &bIncluded,
+                                       OGRField &sBound)
+{
+    if (poValue->eNodeType != SNT_CONSTANT || poValue->is_null)
+        return false;
+
+    const bool bNumericValue = poValue->field_type == SWQ_INTEGER ||
+                               poValue->field_type == SWQ_INTEGER64 ||
+                               poValue->field_type == SWQ_FLOAT;
+
+    switch (poFieldDefn->GetType())
+    {
+        case OFTInteger:
+        case OFTInteger64:
+        {
+            if (!bNumericValue)
+                return false;
+            GIntBig nVal = poValue->int_value;
+            if (poValue->field_type == SWQ_FLOAT)
+            {
+                const double dfVal = poValue->float_value;
+                // x > d <==> x >= floor(d) + 1, x >= d <==> x >= ceil(d)
+                // x < d <==> x <= ceil(d) - 1, x <= d <==> x <= floor(d)
+                double dfBound;
+                if (bIsMin)
+                    dfBound =
+                        bIncluded ? std::ceil(dfVal) : std::floor(dfVal) + 1;
+                else
+                    dfBound =
+                        bIncluded ? std::floor(dfVal) : std::ceil(dfVal) - 1;
+                if (!(dfBound >= -9.0e18 && dfBound <= 9.0e18))
+                    return false;
+                nVal = static_cast<GIntBig>(dfBound);
+                bIncluded = true;
+            }
+            if (poFieldDefn->GetType() == OFTInteger)
+            {
+                if (nVal < INT_MIN || nVal > INT_MAX)
+                    return false;
+                sBound.Integer = static_cast<int>(nVal);
+            }
+            else
+            {
+                sBound.Integer64 = nVal;
+            }
+            return true;
+        }
+
+        case OFTReal:
+        {
+            if (!bNumericValue)
+                return false;
+            sBound.Real = poValue->field_type == SWQ_FLOAT
+                              ? poValue->float_value
+                              : static_cast<double>(poValue->int_value);
+            return !std::isnan(sBound.Real);
+        }
+
+        case OFTString:
+        {
+            if (poValue->field_type != SWQ_STRING ||
+                poValue->string_value == nullptr)
+                return false;
+            sBound.String = poValue->string_value;
+            return true;
+        }
+
+        default:
+            break;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                      OGRGetIndexRangeQuery()                         */
+/*                                                                      */
+/*      Check if the expression is a comparison (<, <=, >, >= or        */
+/*      BETWEEN) of a field with a range capable attribute index        */
+/*      against constants, and if so return the index and bounds.       */
+/************************************************************************/
+
+namespace
+{
+struct OGRIndexRangeQuery
+{
+    OGRAttrIndex *poIndex = nullptr;
+    OGRField sMin{};
+    bool bHasMin = false;
+    bool bMinIncluded = false;
+    OGRField sMax{};
+    bool bHasMax = false;
+    bool bMaxIncluded = false;
+};
+}  // namespace
+
+static bool OGRGetIndexRangeQuery(const swq_expr_node *psExpr,
+                                  OGRLayer *poLayer, OGRIndexRangeQuery &sQuery)
+{
+    int nOperation = psExpr->nOperation;
+    if (!(nOperation == SWQ_GT || nOperation == SWQ_GE ||
+          nOperation == SWQ_LT || nOperation == SWQ_LE ||
+          nOperation == SWQ_BETWEEN))
+        return false;
+    if (psExpr->nSubExprCount != (nOperation == SWQ_BETWEEN ? 3 : 2))
+        return false;
+
+    const swq_expr_node *poColumn = psExpr->papoSubExpr[0];
+    const swq_expr_node *poValue = psExpr->papoSubExpr[1];
+    if (nOperation != SWQ_BETWEEN && poColumn->eNodeType == SNT_CONSTANT &&
+        poValue->eNodeType == SNT_COLUMN)
+    {
+        // constant OP column: flip the comparison
+        std::swap(poColumn, poValue);
+        nOperation = nOperation == SWQ_GT   ? SWQ_LT
+                     : nOperation == SWQ_GE ? SWQ_LE
+                     : nOperation == SWQ_LT ? SWQ_GT
+                                            : SWQ_GE;
+    }
+    if (poColumn->eNodeType != SNT_COLUMN || poColumn->table_index != 0)
+        return false;
+
+    OGRFeatureDefn *poDefn = poLayer->GetLayerDefn();
+    const int nIdx =
+        OGRFeatureFetcherFixFieldIndex(poDefn, poColumn->field_index);
+    if (nIdx < 0 || nIdx >= poDefn->GetFieldCount())
+        return false;
+
+    sQuery.poIndex = poLayer->GetIndex()->GetFieldIndex(nIdx);
+    if (sQuery.poIndex == nullptr || !sQuery.poIndex->SupportsRangeQueries())
+        return false;
+
+    const OGRFieldDefn *poFieldDefn = poDefn->GetFieldDefn(nIdx);
+    if (nOperation == SWQ_BETWEEN)
+    {
+        sQuery.bHasMin = true;
+        sQuery.bMinIncluded = true;
+        sQuery.bHasMax = true;
+        sQuery.bMaxIncluded = true;
+        return OGRGetIndexRangeQueryBound(poValue, poFieldDefn, true,
+                                          sQuery.bMinIncluded, sQuery.sMin) &&
+               OGRGetIndexRangeQueryBound(psExpr->papoSubExpr[2], poFieldDefn,
+                                          false, sQuery.bMaxIncluded,
+                                          sQuery.sMax);
+    }
+    else if (nOperation == SWQ_GT || nOperation == SWQ_GE)
+    {
+        sQuery.bHasMin = true;
+        sQuery.bMinIncluded = nOperation == SWQ_GE;
+        return OGRGetIndexRangeQueryBound(poValue, poFieldDefn, true,
+                                          sQuery.bMinIncluded, sQuery.sMin);
+    }
+    else
+    {
+        sQuery.bHasMax = true;
+        sQuery.bMaxIncluded = nOperation == SWQ_LE;
+        return OGRGetIndexRangeQueryBound(poValue, poFieldDefn, false,
+                                          sQuery.bMaxIncluded, sQuery.sMax);
+    }
+}
+
 /************************************************************************/
 /*                            CanUseIndex()                             */
 /************************************************************************/
@@ -359,6 +531,10 @@ int OGRFeatureQuery::CanUseIndex(const swq_expr_node *psExpr, OGRLayer *poLayer)
                CanUseIndex(psExpr->papoSubExpr[1], poLayer);
     }
 
+    OGRIndexRangeQuery sRangeQuery;
+    if (OGRGetIndexRangeQuery(psExpr, poLayer, sRangeQuery))
+        return TRUE;
+
     if (!(psExpr->nOperation == SWQ_EQ || psExpr->nOperation == SWQ_IN) ||
         psExpr->nSubExprCount < 2)
         return FALSE;
@@ -388,9 +564,9 @@ int OGRFeatureQuery::CanUseIndex(const swq_expr_node *psExpr, OGRLayer *poLayer)
 /*      available indices, or an "OGRNullFID" terminated list of        */
 /*      FIDs if it can.                                                 */
 /*                                                                      */
-/*      For now we only support equality tests on a single indexed      */
-/*      attribute field.  Eventually we should make this support        */
-/*      multi-part queries with ranges.                                 */
+/*      Equality tests, IN lists and, for indexes that support it,     */
+/*      range comparisons on indexed attribute fields are supported,    */
+/*      as well as AND / OR combinations of them.                       */
 /************************************************************************/
 
 GIntBig *OGRFeatureQuery::EvaluateAgainstIndices(OGRLayer *poLayer,
@@ -570,6 +746,27 @@ GIntBig *OGRFeatureQuery::EvaluateAgainstIndices(const swq_expr_node *psExpr,
         return panFIDList;
     }
 
+    OGRIndexRangeQuery sRangeQuery;
+    if (OGRGetIndexRangeQuery(psExpr, poLayer, sRangeQuery))
+    {
+        int nLength = 0;
+        int nFIDCount32 = 0;
+        GIntBig *panFIDs = sRangeQuery.poIndex->GetRangeMatches(
+            sRangeQuery.bHasMin ? &sRangeQuery.sMin : nullptr,
+            sRangeQuery.bMinIncluded,
+            sRangeQuery.bHasMax ? &sRangeQuery.sMax : nullptr,
+            sRangeQuery.bMaxIncluded, nullptr, &nFIDCount32, &nLength);
+        if (panFIDs == nullptr)
+            return nullptr;
+        nFIDCount = nFIDCount32;
+        if (nFIDCount > 1)
+        {
+            // The returned FIDs are expected to be sorted.
+            std::sort(panFIDs, panFIDs + nFIDCount);
+        }
+        return panFIDs;
+    }
+
     if (!(psExpr->nOperation == SWQ_EQ || psExpr->nOperation == SWQ_IN) ||
         psExpr->nSubExprCount < 2)
         return nullptr;
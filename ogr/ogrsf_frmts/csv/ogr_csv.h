@@ -15,6 +15,7 @@
 #define OGR_CSV_H_INCLUDED
 
 #include "ogrsf_frmts.h"
+#include "ogr_attrind.h"
 
 #include <set>
 
@@ -91,6 +92,7 @@ class OGRCSVLayer final : public IOGRCSVLayer, public OGRLayer
 
     char *pszFilename = nullptr;
     std::string m_osCSVTFilename{};
+    OGRAttrIndexFIDCursor m_oAttrIndexCursor{};
     bool bCreateCSVT = false;
     bool bWriteBOM = false;
     char szDelimiter[2] = {0};
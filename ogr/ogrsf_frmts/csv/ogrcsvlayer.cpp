@@ -65,6 +65,12 @@ OGRCSVLayer::OGRCSVLayer(GDALDataset *poDS, const char *pszLayerNameIn,
     SetDescription(poFeatureDefn->GetName());
     poFeatureDefn->Reference();
     poFeatureDefn->SetGeomType(wkbNone);
+
+    // Attribute indexes are looked for in a .oidx sidecar file, only
+    // when an attribute filter is set or CREATE INDEX is issued.
+    if (!bNew && !STARTS_WITH(pszFilename, "/vsistdin") &&
+        !STARTS_WITH(pszFilename, "/vsistdout"))
+        SetDeferredIndexPath(pszFilename);
 }
 
 /************************************************************************/
@@ -1275,6 +1281,8 @@ void OGRCSVLayer::ResetReading()
     bNeedRewindBeforeRead = false;
 
     m_nNextFID = FID_INITIAL_VALUE;
+
+    m_oAttrIndexCursor.Reset();
 }
 
 /************************************************************************/
@@ -1738,11 +1746,20 @@ OGRFeature *OGRCSVLayer::GetNextFeature()
     if (bNeedRewindBeforeRead)
         ResetReading();
 
+    // If the attribute filter can be resolved with an attribute index,
+    // only read the selected features. As their FIDs are sorted,
+    // GetFeature() only needs to skip lines forward.
+    const bool bUseAttrIndex =
+        m_poAttrQuery != nullptr && !bInWriteMode &&
+        m_oAttrIndexCursor.Evaluate(this, m_poAttrQuery);
+
     // Read features till we find one that satisfies our current
     // spatial criteria.
     while (true)
     {
-        OGRFeature *poFeature = GetNextUnfilteredFeature();
+        OGRFeature *poFeature = bUseAttrIndex
+                                    ? m_oAttrIndexCursor.GetNextFeature(this)
+                                    : GetNextUnfilteredFeature();
         if (poFeature == nullptr)
             return nullptr;
 
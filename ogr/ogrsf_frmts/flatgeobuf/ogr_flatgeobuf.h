@@ -14,6 +14,7 @@
 #define OGR_FLATGEOBUF_H_INCLUDED
 
 #include "ogrsf_frmts.h"
+#include "ogr_attrind.h"
 #include "ogr_p.h"
 #include "ogreditablelayer.h"
 
@@ -68,6 +69,8 @@ class OGRFlatGeobufLayer final : public OGRLayer,
     std::string m_osFilename;
     std::string m_osLayerName;
 
+    OGRAttrIndexFIDCursor m_oAttrIndexCursor{};
+
     VSILFILE *m_poFp = nullptr;
     vsi_l_offset m_nFileSize = 0;
 
@@ -178,6 +178,11 @@ OGRFlatGeobufLayer::OGRFlatGeobufLayer(const Header *poHeader, GByte *headerBuf,
     m_poFeatureDefn->AddGeomFieldDefn(std::move(poGeomFieldDefn));
     readColumns();
     m_poFeatureDefn->Reference();
+
+    // Attribute indexes (.oidx sidecar) are only worth using when features
+    // can be fetched by their FID, that is when there is a spatial index.
+    if (m_indexNodeSize > 0)
+        SetDeferredIndexPath(m_osFilename.c_str());
 }
 
 OGRFlatGeobufLayer::OGRFlatGeobufLayer(
@@ -989,6 +994,22 @@ OGRFeature *OGRFlatGeobufLayer::GetNextFeature()
     if (m_create)
         return nullptr;
 
+    if (m_poAttrQuery != nullptr && !m_ignoreAttributeFilter &&
+        m_indexNodeSize > 0 &&
+        m_oAttrIndexCursor.Evaluate(this, m_poAttrQuery))
+    {
+        while (OGRFeature *poFeature =
+                   m_oAttrIndexCursor.GetNextFeature(this))
+        {
+            if ((m_poFilterGeom == nullptr ||
+                 FilterGeometry(poFeature->GetGeometryRef())) &&
+                m_poAttrQuery->Evaluate(poFeature))
+                return poFeature;
+            delete poFeature;
+        }
+        return nullptr;
+    }
+
     while (true)
     {
         if (m_featuresCount > 0 && m_featuresPos >= m_featuresCount)
@@ -2453,6 +2474,7 @@ void OGRFlatGeobufLayer::ResetReading()
     m_queriedSpatialIndex = false;
     m_ignoreSpatialFilter = false;
     m_ignoreAttributeFilter = false;
+    m_oAttrIndexCursor.Reset();
     return;
 }
 
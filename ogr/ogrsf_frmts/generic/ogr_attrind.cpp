@@ -62,4 +62,113 @@ OGRAttrIndex::~OGRAttrIndex()
 {
 }
 
+/************************************************************************/
+/*                        SupportsRangeQueries()                        */
+/************************************************************************/
+
+bool OGRAttrIndex::SupportsRangeQueries() const
+{
+    return false;
+}
+
+/************************************************************************/
+/*                          GetRangeMatches()                           */
+/************************************************************************/
+
+GIntBig *OGRAttrIndex::GetRangeMatches(const OGRField * /* psMin */,
+                                       bool /* bMinIncluded */,
+                                       const OGRField * /* psMax */,
+                                       bool /* bMaxIncluded */,
+                                       GIntBig * /* panFIDList */,
+                                       int * /* nFIDCount */,
+                                       int * /* nLength */)
+{
+    return nullptr;
+}
+
+/************************************************************************/
+/* ==================================================================== */
+/*                        OGRAttrIndexFIDCursor                         */
+/* ==================================================================== */
+/************************************************************************/
+
+/************************************************************************/
+/*                       ~OGRAttrIndexFIDCursor()                       */
+/************************************************************************/
+
+OGRAttrIndexFIDCursor::~OGRAttrIndexFIDCursor()
+{
+    CPLFree(m_panFIDs);
+}
+
+/************************************************************************/
+/*                               Reset()                                */
+/*                                                                      */
+/*      To be called from the ResetReading() method of the layer.       */
+/*      This is a no-op while we are fetching a feature, as the         */
+/*      GetFeature() implementation of some drivers calls               */
+/*      ResetReading() itself.                                          */
+/************************************************************************/
+
+void OGRAttrIndexFIDCursor::Reset()
+{
+    if (m_bFetching)
+        return;
+    CPLFree(m_panFIDs);
+    m_panFIDs = nullptr;
+    m_nFIDCount = 0;
+    m_iNextFID = 0;
+    m_bEvaluated = false;
+}
+
+/************************************************************************/
+/*                              Evaluate()                              */
+/*                                                                      */
+/*      Returns true if the attribute filter could be resolved from     */
+/*      the attribute indexes of the layer, in which case               */
+/*      GetNextFeature() must be used to iterate over the candidates.   */
+/************************************************************************/
+
+bool OGRAttrIndexFIDCursor::Evaluate(OGRLayer *poLayer,
+                                     OGRFeatureQuery *poAttrQuery)
+{
+    if (m_bEvaluated)
+        return m_panFIDs != nullptr;
+    m_bEvaluated = true;
+
+    if (poAttrQuery == nullptr || m_bFetching)
+        return false;
+
+    m_panFIDs = poAttrQuery->EvaluateAgainstIndices(poLayer, nullptr);
+    if (m_panFIDs == nullptr)
+        return false;
+    while (m_panFIDs[m_nFIDCount] != OGRNullFID)
+        ++m_nFIDCount;
+    CPLDebug("OGR", "Attribute index of layer %s selected " CPL_FRMT_GIB
+             " candidate features",
+             poLayer->GetDescription(), m_nFIDCount);
+    return true;
+}
+
+/************************************************************************/
+/*                           GetNextFeature()                           */
+/*                                                                      */
+/*      Returns the next candidate feature, without applying the        */
+/*      spatial or attribute filters.                                   */
+/************************************************************************/
+
+OGRFeature *OGRAttrIndexFIDCursor::GetNextFeature(OGRLayer *poLayer)
+{
+    while (m_iNextFID < m_nFIDCount)
+    {
+        const GIntBig nFID = m_panFIDs[m_iNextFID++];
+        m_bFetching = true;
+        OGRFeature *poFeature = poLayer->GetFeature(nFID);
+        m_bFetching = false;
+        if (poFeature != nullptr)
+            return poFeature;
+    }
+    return nullptr;
+}
+
 //! @endcond
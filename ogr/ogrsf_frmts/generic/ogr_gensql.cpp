@@ -19,9 +19,12 @@
 #include "ogr_recordbatch.h"
 #include "ogrlayerarrow.h"
 #include "cpl_time.h"
+#include "cpl_vsi_virtual.h"
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <map>
+#include <numeric>
 #include <set>
 #include <vector>
 
@@ -90,6 +93,7 @@ OGRGenSQLResultsLayer::OGRGenSQLResultsLayer(
     /*      Identify all the layers involved in the SELECT.                 */
     /* -------------------------------------------------------------------- */
     m_apoTableLayers.reserve(psSelectInfo->table_count);
+    m_aoJoinHashTables.resize(psSelectInfo->join_count);
 
     for (int iTable = 0; iTable < psSelectInfo->table_count; iTable++)
     {
@@ -487,6 +491,9 @@ OGRGenSQLResultsLayer::~OGRGenSQLResultsLayer()
                  m_nFeaturesRead, m_poDefn->GetName());
     }
 
+    // Must be done while the source layer definition is still valid
+    m_poExternalSort.reset();
+
     OGRGenSQLResultsLayer::ClearFilters();
 
     if (m_poDefn != nullptr)
@@ -644,7 +651,8 @@ OGRErr OGRGenSQLResultsLayer::SetNextByIndex(GIntBig nIndex)
         return OGRERR_NON_EXISTING_FEATURE;
     }
     if (psSelectInfo->query_mode == SWQM_SUMMARY_RECORD ||
-        psSelectInfo->query_mode == SWQM_DISTINCT_LIST || !m_anFIDIndex.empty())
+        psSelectInfo->query_mode == SWQM_DISTINCT_LIST ||
+        !m_anFIDIndex.empty() || m_poExternalSort)
     {
         m_nNextIndexFID = nIndex + psSelectInfo->offset;
         return OGRERR_NONE;
@@ -733,6 +741,10 @@ int OGRGenSQLResultsLayer::TestCapability(const char *pszCap) const
 
     if (EQUAL(pszCap, OLCFastSetNextByIndex))
     {
+        // Reaching a given index of an external sort requires merging its
+        // runs up to that index
+        if (m_poExternalSort)
+            return FALSE;
         if (psSelectInfo->query_mode == SWQM_SUMMARY_RECORD ||
             psSelectInfo->query_mode == SWQM_DISTINCT_LIST ||
             !m_anFIDIndex.empty())
@@ -1482,6 +1494,309 @@ static CPLString GetFilterForJoin(swq_expr_node *poExpr, OGRFeature *poSrcFeat,
     return "";
 }
 
+/************************************************************************/
+/*                   EstimateJoinFeatureMemoryUsage()                   */
+/************************************************************************/
+
+static size_t EstimateJoinFeatureMemoryUsage(const OGRFeature *poFeature)
+{
+    const OGRFeatureDefn *poDefn = poFeature->GetDefnRef();
+    size_t nSize = sizeof(OGRFeature) +
+                   poDefn->GetFieldCount() * sizeof(OGRField) +
+                   poDefn->GetGeomFieldCount() * sizeof(OGRGeometry *);
+    for (int iField = 0; iField < poDefn->GetFieldCount(); iField++)
+    {
+        if (!poFeature->IsFieldSetAndNotNull(iField))
+            continue;
+        const OGRField *psField = poFeature->GetRawFieldRef(iField);
+        switch (poDefn->GetFieldDefn(iField)->GetType())
+        {
+            case OFTString:
+                nSize += strlen(psField->String) + 1;
+                break;
+            case OFTIntegerList:
+                nSize += psField->IntegerList.nCount * sizeof(int);
+                break;
+            case OFTInteger64List:
+                nSize += psField->Integer64List.nCount * sizeof(GIntBig);
+                break;
+            case OFTRealList:
+                nSize += psField->RealList.nCount * sizeof(double);
+                break;
+            case OFTStringList:
+                for (int i = 0; i < psField->StringList.nCount; i++)
+                    nSize += sizeof(char *) +
+                             strlen(psField->StringList.paList[i]) + 1;
+                break;
+            case OFTBinary:
+                nSize += psField->Binary.nCount;
+                break;
+            default:
+                break;
+        }
+    }
+    for (int iGeom = 0; iGeom < poDefn->GetGeomFieldCount(); iGeom++)
+    {
+        const OGRGeometry *poGeom = poFeature->GetGeomFieldRef(iGeom);
+        if (poGeom)
+            nSize += poGeom->WkbSize();
+    }
+    return nSize;
+}
+
+/************************************************************************/
+/*                           GetJoinHashKey()                           */
+/************************************************************************/
+
+bool OGRGenSQLResultsLayer::GetJoinHashKey(const OGRFeature *poFeature,
+                                           int iField,
+                                           JoinHashTable::KeyType eKeyType,
+                                           std::string &osKey)
+{
+    // if key is null, we can't do join.
+    if (!poFeature->IsFieldSetAndNotNull(iField))
+        return false;
+
+    using KeyType = JoinHashTable::KeyType;
+    switch (eKeyType)
+    {
+        case KeyType::INTEGER:
+        {
+            osKey = std::to_string(poFeature->GetFieldAsInteger64(iField));
+            break;
+        }
+
+        case KeyType::REAL:
+        {
+            double dfVal = poFeature->GetFieldAsDouble(iField);
+            if (std::isnan(dfVal))
+                return false;
+            // Make sure that -0 and +0 hash to the same key
+            if (dfVal == 0)
+                dfVal = 0;
+            osKey.assign(reinterpret_cast<const char *>(&dfVal),
+                         sizeof(dfVal));
+            break;
+        }
+
+        case KeyType::STRING:
+        {
+            // OGR SQL string equality is case insensitive
+            osKey = CPLString(poFeature->GetFieldAsString(iField)).toupper();
+            break;
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                        PrepareJoinHashTable()                        */
+/*                                                                      */
+/*      For a join whose ON clause is a simple equality between a       */
+/*      field of the primary table and a field of the secondary         */
+/*      table, scan the secondary layer once and index its features     */
+/*      by key, instead of issuing an attribute filter on the           */
+/*      secondary layer for each primary feature.                       */
+/************************************************************************/
+
+bool OGRGenSQLResultsLayer::PrepareJoinHashTable(int iJoin)
+{
+    JoinHashTable &oHT = m_aoJoinHashTables[iJoin];
+    if (oHT.bBuilt)
+        return oHT.bUsable;
+    oHT.bBuilt = true;
+
+    if (!CPLTestBool(CPLGetConfigOption("OGR_SQL_JOIN_HASH", "YES")))
+        return false;
+
+    const swq_join_def *psJoinInfo = m_pSelectInfo->join_defs + iJoin;
+    const swq_expr_node *poExpr = psJoinInfo->poExpr;
+    if (poExpr->eNodeType != SNT_OPERATION || poExpr->nOperation != SWQ_EQ ||
+        poExpr->nSubExprCount != 2 ||
+        poExpr->papoSubExpr[0]->eNodeType != SNT_COLUMN ||
+        poExpr->papoSubExpr[1]->eNodeType != SNT_COLUMN)
+    {
+        return false;
+    }
+
+    const swq_expr_node *poPrimaryCol = poExpr->papoSubExpr[0];
+    const swq_expr_node *poSecondaryCol = poExpr->papoSubExpr[1];
+    if (poPrimaryCol->table_index != 0)
+        std::swap(poPrimaryCol, poSecondaryCol);
+    if (poPrimaryCol->table_index != 0 ||
+        poSecondaryCol->table_index != psJoinInfo->secondary_table)
+    {
+        return false;
+    }
+
+    OGRLayer *poJoinLayer = m_apoTableLayers[psJoinInfo->secondary_table];
+    // Scanning the secondary layer would interfere with the reading of
+    // the primary one.
+    if (poJoinLayer == m_poSrcLayer)
+        return false;
+
+    // Special fields are not handled
+    const OGRFeatureDefn *poSrcFDefn = m_poSrcLayer->GetLayerDefn();
+    const OGRFeatureDefn *poJoinFDefn = poJoinLayer->GetLayerDefn();
+    if (poPrimaryCol->field_index < 0 ||
+        poPrimaryCol->field_index >= poSrcFDefn->GetFieldCount() ||
+        poSecondaryCol->field_index < 0 ||
+        poSecondaryCol->field_index >= poJoinFDefn->GetFieldCount())
+    {
+        return false;
+    }
+
+    const auto IsIntegerType = [](OGRFieldType eType)
+    { return eType == OFTInteger || eType == OFTInteger64; };
+    const auto IsNumericType = [&IsIntegerType](OGRFieldType eType)
+    { return IsIntegerType(eType) || eType == OFTReal; };
+
+    const OGRFieldType ePrimaryType =
+        poSrcFDefn->GetFieldDefn(poPrimaryCol->field_index)->GetType();
+    const OGRFieldType eSecondaryType =
+        poJoinFDefn->GetFieldDefn(poSecondaryCol->field_index)->GetType();
+    if (IsIntegerType(ePrimaryType) && IsIntegerType(eSecondaryType))
+        oHT.eKeyType = JoinHashTable::KeyType::INTEGER;
+    else if (IsNumericType(ePrimaryType) && IsNumericType(eSecondaryType))
+        oHT.eKeyType = JoinHashTable::KeyType::REAL;
+    else if (ePrimaryType == OFTString && eSecondaryType == OFTString)
+        oHT.eKeyType = JoinHashTable::KeyType::STRING;
+    else
+        return false;
+
+    oHT.iPrimaryField = poPrimaryCol->field_index;
+    oHT.iSecondaryField = poSecondaryCol->field_index;
+
+    GIntBig nMaxMemory = 0;
+    if (CPLParseMemorySize(
+            CPLGetConfigOption("OGR_SQL_JOIN_HASH_MAX_MEMORY", "10%"),
+            &nMaxMemory, nullptr) != CE_None)
+    {
+        nMaxMemory = 100 * 1024 * 1024;
+    }
+    const bool bCanRandomRead =
+        CPL_TO_BOOL(poJoinLayer->TestCapability(OLCRandomRead));
+
+    // Rough per-entry overhead of the hash map nodes
+    constexpr size_t ENTRY_OVERHEAD = 64;
+
+    const auto Abort = [&oHT, poJoinLayer](const char *pszReason)
+    {
+        CPLDebug("GenSQL",
+                 "Not using hash join on layer %s: %s. Falling back to "
+                 "attribute filter based join.",
+                 poJoinLayer->GetDescription(), pszReason);
+        oHT.oMapKeyToFeature.clear();
+        oHT.oMapKeyToFID.clear();
+        poJoinLayer->ResetReading();
+        return false;
+    };
+
+    poJoinLayer->SetAttributeFilter(nullptr);
+    poJoinLayer->ResetReading();
+
+    GIntBig nMemUsage = 0;
+    std::string osKey;
+    while (auto poFeature =
+               std::unique_ptr<OGRFeature>(poJoinLayer->GetNextFeature()))
+    {
+        if (!GetJoinHashKey(poFeature.get(), oHT.iSecondaryField,
+                            oHT.eKeyType, osKey))
+        {
+            continue;
+        }
+
+        if (!oHT.bStoreFIDs)
+        {
+            // Only the first matching feature is used
+            if (oHT.oMapKeyToFeature.find(osKey) !=
+                oHT.oMapKeyToFeature.end())
+                continue;
+
+            nMemUsage += static_cast<GIntBig>(
+                EstimateJoinFeatureMemoryUsage(poFeature.get()) +
+                osKey.size() + ENTRY_OVERHEAD);
+            if (nMemUsage <= nMaxMemory)
+            {
+                oHT.oMapKeyToFeature.emplace(osKey, std::move(poFeature));
+                continue;
+            }
+
+            if (!bCanRandomRead)
+                return Abort("memory budget exceeded");
+
+            CPLDebug("GenSQL",
+                     "Hash join on layer %s exceeds memory budget. "
+                     "Only storing FIDs.",
+                     poJoinLayer->GetDescription());
+            oHT.bStoreFIDs = true;
+            nMemUsage = 0;
+            for (const auto &[osExistingKey, poExistingFeature] :
+                 oHT.oMapKeyToFeature)
+            {
+                oHT.oMapKeyToFID.emplace(osExistingKey,
+                                         poExistingFeature->GetFID());
+                nMemUsage += static_cast<GIntBig>(osExistingKey.size() +
+                                                  ENTRY_OVERHEAD);
+            }
+            oHT.oMapKeyToFeature.clear();
+        }
+
+        if (oHT.oMapKeyToFID.emplace(osKey, poFeature->GetFID()).second)
+        {
+            nMemUsage += static_cast<GIntBig>(osKey.size() + ENTRY_OVERHEAD);
+            if (nMemUsage > nMaxMemory)
+                return Abort("memory budget exceeded, even for FIDs");
+        }
+    }
+
+    poJoinLayer->ResetReading();
+
+    CPLDebug("GenSQL", "Hash join on layer %s built with %u keys%s.",
+             poJoinLayer->GetDescription(),
+             static_cast<unsigned>(oHT.bStoreFIDs
+                                       ? oHT.oMapKeyToFID.size()
+                                       : oHT.oMapKeyToFeature.size()),
+             oHT.bStoreFIDs ? " (FIDs only)" : "");
+
+    oHT.bUsable = true;
+    return true;
+}
+
+/************************************************************************/
+/*                   FetchJoinFeatureFromHashTable()                    */
+/************************************************************************/
+
+std::unique_ptr<OGRFeature>
+OGRGenSQLResultsLayer::FetchJoinFeatureFromHashTable(
+    int iJoin, const OGRFeature *poSrcFeat, bool &bUsedHashTable)
+{
+    bUsedHashTable = PrepareJoinHashTable(iJoin);
+    if (!bUsedHashTable)
+        return nullptr;
+
+    const JoinHashTable &oHT = m_aoJoinHashTables[iJoin];
+    std::string osKey;
+    if (!GetJoinHashKey(poSrcFeat, oHT.iPrimaryField, oHT.eKeyType, osKey))
+        return nullptr;
+
+    if (oHT.bStoreFIDs)
+    {
+        const auto oIter = oHT.oMapKeyToFID.find(osKey);
+        if (oIter == oHT.oMapKeyToFID.end())
+            return nullptr;
+        OGRLayer *poJoinLayer =
+            m_apoTableLayers[m_pSelectInfo->join_defs[iJoin].secondary_table];
+        return std::unique_ptr<OGRFeature>(
+            poJoinLayer->GetFeature(oIter->second));
+    }
+
+    const auto oIter = oHT.oMapKeyToFeature.find(osKey);
+    if (oIter == oHT.oMapKeyToFeature.end())
+        return nullptr;
+    return std::unique_ptr<OGRFeature>(oIter->second->Clone());
+}
+
 /************************************************************************/
 /*                          TranslateFeature()                          */
 /************************************************************************/
@@ -1513,6 +1828,15 @@ std::unique_ptr<OGRFeature> OGRGenSQLResultsLayer::TranslateFeature(
         /* we have taken care of this */
         CPLAssert(psJoinInfo->secondary_table == iJoin + 1);
 
+        bool bUsedHashTable = false;
+        auto poHashJoinFeature =
+            FetchJoinFeatureFromHashTable(iJoin, poSrcFeat, bUsedHashTable);
+        if (bUsedHashTable)
+        {
+            apoFeatures.push_back(std::move(poHashJoinFeature));
+            continue;
+        }
+
         OGRLayer *poJoinLayer = m_apoTableLayers[psJoinInfo->secondary_table];
 
         const std::string osFilter =
@@ -1870,8 +2194,9 @@ OGRFeature *OGRGenSQLResultsLayer::GetNextFeature()
         return nullptr;
 
     CreateOrderByIndex();
-    if (m_anFIDIndex.empty() && m_nIteratedFeatures < 0 &&
-        psSelectInfo->offset > 0 && psSelectInfo->query_mode == SWQM_RECORDSET)
+    if (m_anFIDIndex.empty() && !m_poExternalSort &&
+        m_nIteratedFeatures < 0 && psSelectInfo->offset > 0 &&
+        psSelectInfo->query_mode == SWQM_RECORDSET)
     {
         m_poSrcLayer->SetNextByIndex(psSelectInfo->offset);
     }
@@ -1896,7 +2221,12 @@ OGRFeature *OGRGenSQLResultsLayer::GetNextFeature()
     while (true)
     {
         std::unique_ptr<OGRFeature> poSrcFeat;
-        if (!m_anFIDIndex.empty())
+        if (m_poExternalSort)
+        {
+            poSrcFeat = GetExternalSortFeature(m_nNextIndexFID);
+            m_nNextIndexFID++;
+        }
+        else if (!m_anFIDIndex.empty())
         {
             /* --------------------------------------------------------------------
              */
@@ -2202,8 +2532,11 @@ void OGRGenSQLResultsLayer::ReadIndexFields(OGRFeature *poSrcFeat,
 /*      this in memory copy of the order-by fields to create the        */
 /*      required index.                                                 */
 /*                                                                      */
-/*      Keeping all the key values in memory will *not* scale up to     */
-/*      very large input datasets.                                      */
+/*      When the key values do not fit within the memory budget set     */
+/*      by OGR_SQL_ORDER_BY_MAX_MEMORY, or when the source layer does   */
+/*      not support random reading, an external merge sort of the       */
+/*      whole source features is used instead (see                      */
+/*      CreateExternalSort()).                                          */
 /************************************************************************/
 
 void OGRGenSQLResultsLayer::CreateOrderByIndex()
@@ -2220,6 +2553,7 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
 
     m_bOrderByValid = true;
     m_anFIDIndex.clear();
+    m_poExternalSort.reset();
 
     ResetReading();
 
@@ -2263,6 +2597,27 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
         return;
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      Determine whether an external merge sort must be used.          */
+    /* -------------------------------------------------------------------- */
+    const char *pszExternalSort =
+        CPLGetConfigOption("OGR_SQL_ORDER_BY_EXTERNAL_SORT", "AUTO");
+    const bool bAutoExternalSort = EQUAL(pszExternalSort, "AUTO");
+    GIntBig nMaxMemory = 0;
+    if (CPLParseMemorySize(
+            CPLGetConfigOption("OGR_SQL_ORDER_BY_MAX_MEMORY", "10%"),
+            &nMaxMemory, nullptr) != CE_None)
+    {
+        nMaxMemory = 100 * 1024 * 1024;
+    }
+
+    if ((!bAutoExternalSort && CPLTestBool(pszExternalSort)) ||
+        (bAutoExternalSort && !m_poSrcLayer->TestCapability(OLCRandomRead)))
+    {
+        CreateExternalSort(nMaxMemory);
+        return;
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Allocate set of key values, and the output index.               */
     /* -------------------------------------------------------------------- */
@@ -2302,6 +2657,8 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
     /* -------------------------------------------------------------------- */
     /*      Read in all the key values.                                     */
     /* -------------------------------------------------------------------- */
+    GIntBig nMemUsage = 0;
+    bool bSwitchToExternalSort = false;
 
     for (auto &&poSrcFeat : *m_poSrcLayer)
     {
@@ -2349,7 +2706,34 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
 
         anFIDList.push_back(poSrcFeat->GetFID());
 
+        if (bAutoExternalSort)
+        {
+            nMemUsage += static_cast<GIntBig>(
+                sizeof(OGRField) * nOrderItems + sizeof(GIntBig) +
+                GetIndexFieldsMemoryUsage(asIndexFields.data() +
+                                          nIndexSize * nOrderItems));
+        }
+
         nIndexSize++;
+
+        if (bAutoExternalSort && nMemUsage > nMaxMemory)
+        {
+            bSwitchToExternalSort = true;
+            break;
+        }
+    }
+
+    if (bSwitchToExternalSort)
+    {
+        CPLDebug("GenSQL",
+                 "ORDER BY keys exceed OGR_SQL_ORDER_BY_MAX_MEMORY. "
+                 "Switching to external merge sort.");
+        FreeIndexFields(asIndexFields.data(), nIndexSize);
+        nIndexSize = 0;
+        asIndexFields = std::vector<OGRField>();
+        anFIDList = std::vector<GIntBig>();
+        CreateExternalSort(nMaxMemory);
+        return;
     }
 
     // CPLDebug("GenSQL", "CreateOrderByIndex() = %zu features", nIndexSize);
@@ -2410,6 +2794,527 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
     ResetReading();
 }
 
+/************************************************************************/
+/*                     GetIndexFieldsMemoryUsage()                      */
+/*                                                                      */
+/*      Return the memory allocated for the string key values of a     */
+/*      row of index fields filled by ReadIndexFields().                */
+/************************************************************************/
+
+size_t OGRGenSQLResultsLayer::GetIndexFieldsMemoryUsage(
+    const OGRField *pasIndexFields) const
+{
+    const swq_select *psSelectInfo = m_pSelectInfo.get();
+    size_t nSize = 0;
+    for (int iKey = 0; iKey < psSelectInfo->order_specs; iKey++)
+    {
+        const swq_order_def *psKeyDef = psSelectInfo->order_defs + iKey;
+        const OGRField *psField = pasIndexFields + iKey;
+
+        bool bIsString;
+        if (psKeyDef->field_index >= m_iFIDFieldIndex)
+            bIsString = SpecialFieldTypes[psKeyDef->field_index -
+                                          m_iFIDFieldIndex] == SWQ_STRING;
+        else
+            bIsString = m_poSrcLayer->GetLayerDefn()
+                            ->GetFieldDefn(psKeyDef->field_index)
+                            ->GetType() == OFTString;
+        if (bIsString && !OGR_RawField_IsUnset(psField) &&
+            !OGR_RawField_IsNull(psField))
+        {
+            nSize += strlen(psField->String) + 1;
+        }
+    }
+    return nSize;
+}
+
+/************************************************************************/
+/*                          ExternalSortState                           */
+/*                                                                      */
+/*      Sorted runs of serialized source features are written to a      */
+/*      temporary file, and then merged with a k-way merge when         */
+/*      iterating over the result.                                      */
+/*                                                                      */
+/*      Each record of a run is made of its size (uint32), followed by  */
+/*      the size (uint32) and the content of the feature serialized     */
+/*      with OGRFeature::SerializeToBinary(), followed by the style     */
+/*      string, native data and native media type, each of them being   */
+/*      a length (uint32, UINT32_MAX for null) and its characters.      */
+/************************************************************************/
+
+struct OGRGenSQLResultsLayer::ExternalSortState
+{
+    OGRGenSQLResultsLayer &m_oLayer;
+    std::string m_osFilename{};
+    VSIVirtualHandleUniquePtr m_fp{};
+
+    struct Run
+    {
+        vsi_l_offset nStart = 0;
+        vsi_l_offset nEnd = 0;
+    };
+
+    std::vector<Run> m_aoRuns{};
+
+    struct Cursor
+    {
+        vsi_l_offset nFileOffset = 0;
+        vsi_l_offset nEnd = 0;
+        std::vector<GByte> abyBuffer{};
+        size_t nBufferPos = 0;
+        size_t nBufferSize = 0;
+        std::unique_ptr<OGRFeature> poFeature{};
+        std::vector<OGRField> asKeys{};
+    };
+
+    std::vector<Cursor> m_aoCursors{};
+    // Min-heap of indices into m_aoCursors
+    std::vector<size_t> m_anHeap{};
+    bool m_bStarted = false;
+    GIntBig m_nNextIndex = 0;
+
+    static constexpr size_t READ_BUFFER_SIZE = 64 * 1024;
+
+    explicit ExternalSortState(OGRGenSQLResultsLayer &oLayer) : m_oLayer(oLayer)
+    {
+    }
+
+    ~ExternalSortState()
+    {
+        ReleaseCursors();
+        m_fp.reset();
+        if (!m_osFilename.empty())
+            VSIUnlink(m_osFilename.c_str());
+    }
+
+    void ReleaseCursors()
+    {
+        for (auto &oCursor : m_aoCursors)
+        {
+            if (oCursor.poFeature)
+                m_oLayer.FreeIndexFields(oCursor.asKeys.data(), 1);
+        }
+        m_aoCursors.clear();
+        m_anHeap.clear();
+    }
+
+    static void AppendString(std::vector<GByte> &abyRecord, const char *psz)
+    {
+        const uint32_t nLen = psz ? static_cast<uint32_t>(strlen(psz))
+                                  : std::numeric_limits<uint32_t>::max();
+        const GByte *pabyLen = reinterpret_cast<const GByte *>(&nLen);
+        abyRecord.insert(abyRecord.end(), pabyLen, pabyLen + sizeof(nLen));
+        if (psz)
+            abyRecord.insert(abyRecord.end(), psz, psz + nLen);
+    }
+
+    static bool SerializeRecord(const OGRFeature *poFeature,
+                                std::vector<GByte> &abyRecord)
+    {
+        std::vector<GByte> abyFeature;
+        if (!poFeature->SerializeToBinary(abyFeature))
+            return false;
+        try
+        {
+            abyRecord.clear();
+            const uint32_t nFeatureSize =
+                static_cast<uint32_t>(abyFeature.size());
+            const GByte *pabySize =
+                reinterpret_cast<const GByte *>(&nFeatureSize);
+            abyRecord.insert(abyRecord.end(), pabySize,
+                             pabySize + sizeof(nFeatureSize));
+            abyRecord.insert(abyRecord.end(), abyFeature.begin(),
+                             abyFeature.end());
+            AppendString(abyRecord, poFeature->GetStyleString());
+            AppendString(abyRecord, poFeature->GetNativeData());
+            AppendString(abyRecord, poFeature->GetNativeMediaType());
+        }
+        catch (const std::exception &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Out of memory in external sort");
+            return false;
+        }
+        return true;
+    }
+
+    static bool ReadString(const GByte *&pabyData, const GByte *pabyEnd,
+                           std::string &osStr, bool &bIsNull)
+    {
+        uint32_t nLen = 0;
+        if (pabyEnd - pabyData < static_cast<ptrdiff_t>(sizeof(nLen)))
+            return false;
+        memcpy(&nLen, pabyData, sizeof(nLen));
+        pabyData += sizeof(nLen);
+        bIsNull = nLen == std::numeric_limits<uint32_t>::max();
+        if (bIsNull)
+            return true;
+        if (static_cast<size_t>(pabyEnd - pabyData) < nLen)
+            return false;
+        osStr.assign(reinterpret_cast<const char *>(pabyData), nLen);
+        pabyData += nLen;
+        return true;
+    }
+
+    static bool DeserializeRecord(const GByte *pabyData, size_t nSize,
+                                  OGRFeature *poFeature)
+    {
+        const GByte *pabyEnd = pabyData + nSize;
+        uint32_t nFeatureSize = 0;
+        if (nSize < sizeof(nFeatureSize))
+            return false;
+        memcpy(&nFeatureSize, pabyData, sizeof(nFeatureSize));
+        pabyData += sizeof(nFeatureSize);
+        if (static_cast<size_t>(pabyEnd - pabyData) < nFeatureSize ||
+            !poFeature->DeserializeFromBinary(pabyData, nFeatureSize))
+        {
+            return false;
+        }
+        pabyData += nFeatureSize;
+
+        std::string osStr;
+        bool bIsNull = false;
+        if (!ReadString(pabyData, pabyEnd, osStr, bIsNull))
+            return false;
+        if (!bIsNull)
+            poFeature->SetStyleString(osStr.c_str());
+        if (!ReadString(pabyData, pabyEnd, osStr, bIsNull))
+            return false;
+        if (!bIsNull)
+            poFeature->SetNativeData(osStr.c_str());
+        if (!ReadString(pabyData, pabyEnd, osStr, bIsNull))
+            return false;
+        if (!bIsNull)
+            poFeature->SetNativeMediaType(osStr.c_str());
+        return true;
+    }
+
+    // Make sure that at least nBytes are available in the cursor buffer
+    bool FillBuffer(Cursor &oCursor, size_t nBytes)
+    {
+        const size_t nRemaining = oCursor.nBufferSize - oCursor.nBufferPos;
+        if (nRemaining >= nBytes)
+            return true;
+        if (oCursor.nBufferPos > 0)
+        {
+            memmove(oCursor.abyBuffer.data(),
+                    oCursor.abyBuffer.data() + oCursor.nBufferPos, nRemaining);
+            oCursor.nBufferPos = 0;
+            oCursor.nBufferSize = nRemaining;
+        }
+        const size_t nToRead = static_cast<size_t>(
+            std::min<vsi_l_offset>(std::max(nBytes, READ_BUFFER_SIZE),
+                                   oCursor.nEnd - oCursor.nFileOffset));
+        if (nRemaining + nToRead < nBytes)
+            return false;
+        try
+        {
+            if (oCursor.abyBuffer.size() < nRemaining + nToRead)
+                oCursor.abyBuffer.resize(nRemaining + nToRead);
+        }
+        catch (const std::exception &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Out of memory in external sort");
+            return false;
+        }
+        if (m_fp->Seek(oCursor.nFileOffset, SEEK_SET) != 0 ||
+            m_fp->Read(oCursor.abyBuffer.data() + nRemaining, 1, nToRead) !=
+                nToRead)
+        {
+            CPLError(CE_Failure, CPLE_FileIO,
+                     "Cannot read from temporary file %s",
+                     m_osFilename.c_str());
+            return false;
+        }
+        oCursor.nFileOffset += nToRead;
+        oCursor.nBufferSize = nRemaining + nToRead;
+        return true;
+    }
+
+    // Load the next record of a run into its cursor. Returns false on error.
+    bool ReadNextRecord(Cursor &oCursor)
+    {
+        if (oCursor.poFeature)
+        {
+            m_oLayer.FreeIndexFields(oCursor.asKeys.data(), 1);
+            oCursor.poFeature.reset();
+        }
+        std::fill(oCursor.asKeys.begin(), oCursor.asKeys.end(), OGRField());
+
+        if (oCursor.nBufferPos == oCursor.nBufferSize &&
+            oCursor.nFileOffset == oCursor.nEnd)
+        {
+            // End of run
+            return true;
+        }
+
+        uint32_t nRecordSize = 0;
+        if (!FillBuffer(oCursor, sizeof(nRecordSize)))
+            return false;
+        memcpy(&nRecordSize, oCursor.abyBuffer.data() + oCursor.nBufferPos,
+               sizeof(nRecordSize));
+        oCursor.nBufferPos += sizeof(nRecordSize);
+        if (!FillBuffer(oCursor, nRecordSize))
+            return false;
+
+        auto poFeature = std::make_unique<OGRFeature>(
+            m_oLayer.m_poSrcLayer->GetLayerDefn());
+        if (!DeserializeRecord(oCursor.abyBuffer.data() + oCursor.nBufferPos,
+                               nRecordSize, poFeature.get()))
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Corrupted record in temporary file %s",
+                     m_osFilename.c_str());
+            return false;
+        }
+        oCursor.nBufferPos += nRecordSize;
+
+        m_oLayer.ReadIndexFields(poFeature.get(),
+                                 static_cast<int>(oCursor.asKeys.size()),
+                                 oCursor.asKeys.data());
+        oCursor.poFeature = std::move(poFeature);
+        return true;
+    }
+
+    // Comparison function for a min-heap: returns true if the current
+    // record of cursor i must be returned after the one of cursor j.
+    // Records of earlier runs come first on ties, so that the sort is
+    // stable.
+    bool IsAfter(size_t i, size_t j)
+    {
+        const int nRes = m_oLayer.Compare(m_aoCursors[i].asKeys.data(),
+                                          m_aoCursors[j].asKeys.data());
+        return nRes > 0 || (nRes == 0 && i > j);
+    }
+
+    bool Restart()
+    {
+        ReleaseCursors();
+        m_bStarted = true;
+        m_nNextIndex = 0;
+        const int nOrderItems = m_oLayer.m_pSelectInfo->order_specs;
+        try
+        {
+            m_aoCursors.resize(m_aoRuns.size());
+        }
+        catch (const std::exception &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Out of memory in external sort");
+            return false;
+        }
+        const auto IsAfterLambda = [this](size_t i, size_t j)
+        { return IsAfter(i, j); };
+        for (size_t i = 0; i < m_aoRuns.size(); ++i)
+        {
+            auto &oCursor = m_aoCursors[i];
+            oCursor.nFileOffset = m_aoRuns[i].nStart;
+            oCursor.nEnd = m_aoRuns[i].nEnd;
+            oCursor.asKeys.resize(nOrderItems);
+            if (!ReadNextRecord(oCursor))
+                return false;
+            if (oCursor.poFeature)
+            {
+                m_anHeap.push_back(i);
+                std::push_heap(m_anHeap.begin(), m_anHeap.end(),
+                               IsAfterLambda);
+            }
+        }
+        return true;
+    }
+
+    std::unique_ptr<OGRFeature> Next()
+    {
+        if (m_anHeap.empty())
+            return nullptr;
+        const auto IsAfterLambda = [this](size_t i, size_t j)
+        { return IsAfter(i, j); };
+        std::pop_heap(m_anHeap.begin(), m_anHeap.end(), IsAfterLambda);
+        const size_t iCursor = m_anHeap.back();
+        m_anHeap.pop_back();
+
+        auto &oCursor = m_aoCursors[iCursor];
+        m_oLayer.FreeIndexFields(oCursor.asKeys.data(), 1);
+        auto poFeature = std::move(oCursor.poFeature);
+        if (!ReadNextRecord(oCursor))
+        {
+            m_anHeap.clear();
+            return nullptr;
+        }
+        if (oCursor.poFeature)
+        {
+            m_anHeap.push_back(iCursor);
+            std::push_heap(m_anHeap.begin(), m_anHeap.end(), IsAfterLambda);
+        }
+        ++m_nNextIndex;
+        return poFeature;
+    }
+
+    CPL_DISALLOW_COPY_ASSIGN(ExternalSortState)
+};
+
+/************************************************************************/
+/*                         CreateExternalSort()                         */
+/*                                                                      */
+/*      Read all the eligible source features, and write them into      */
+/*      sorted runs of at most nMaxMemory bytes in a temporary file.    */
+/*      When everything fits in a single run, the "temporary file" is   */
+/*      a /vsimem/ one.                                                 */
+/************************************************************************/
+
+bool OGRGenSQLResultsLayer::CreateExternalSort(GIntBig nMaxMemory)
+{
+    const int nOrderItems = m_pSelectInfo->order_specs;
+    auto poState = std::make_unique<ExternalSortState>(*this);
+
+    std::vector<OGRField> asKeys;
+    std::vector<std::vector<GByte>> aabyRecords;
+    GIntBig nMemUsage = 0;
+
+    const auto FlushRun = [this, nOrderItems, &poState, &asKeys, &aabyRecords,
+                           &nMemUsage](bool bLastRun)
+    {
+        if (aabyRecords.empty())
+            return true;
+        if (!poState->m_fp)
+        {
+            poState->m_osFilename =
+                bLastRun
+                    ? std::string(
+                          VSIMemGenerateHiddenFilename("ogr_gensql_sort.bin"))
+                    : CPLGenerateTempFilenameSafe("ogr_gensql_sort") + ".bin";
+            poState->m_fp.reset(
+                VSIFOpenL(poState->m_osFilename.c_str(), "wb+"));
+            if (!poState->m_fp)
+            {
+                CPLError(CE_Failure, CPLE_FileIO,
+                         "Cannot create temporary file %s",
+                         poState->m_osFilename.c_str());
+                poState->m_osFilename.clear();
+                return false;
+            }
+        }
+
+        std::vector<size_t> anOrder(aabyRecords.size());
+        std::iota(anOrder.begin(), anOrder.end(), 0);
+        std::stable_sort(anOrder.begin(), anOrder.end(),
+                         [this, nOrderItems, &asKeys](size_t i, size_t j)
+                         {
+                             return Compare(asKeys.data() + i * nOrderItems,
+                                            asKeys.data() + j * nOrderItems) <
+                                    0;
+                         });
+
+        ExternalSortState::Run oRun;
+        oRun.nStart = poState->m_fp->Tell();
+        bool bOK = true;
+        for (size_t i : anOrder)
+        {
+            const auto &abyRecord = aabyRecords[i];
+            const uint32_t nSize = static_cast<uint32_t>(abyRecord.size());
+            bOK = bOK &&
+                  poState->m_fp->Write(&nSize, sizeof(nSize), 1) == 1 &&
+                  poState->m_fp->Write(abyRecord.data(), 1,
+                                       abyRecord.size()) == abyRecord.size();
+        }
+        oRun.nEnd = poState->m_fp->Tell();
+
+        FreeIndexFields(asKeys.data(), aabyRecords.size());
+        asKeys.clear();
+        aabyRecords.clear();
+        nMemUsage = 0;
+
+        if (!bOK)
+        {
+            CPLError(CE_Failure, CPLE_FileIO,
+                     "Cannot write into temporary file %s",
+                     poState->m_osFilename.c_str());
+            return false;
+        }
+        poState->m_aoRuns.push_back(oRun);
+        return true;
+    };
+
+    bool bOK = true;
+    std::vector<GByte> abyRecord;
+    for (auto &&poSrcFeat : *m_poSrcLayer)
+    {
+        if (!ExternalSortState::SerializeRecord(poSrcFeat.get(), abyRecord))
+        {
+            bOK = false;
+            break;
+        }
+
+        const size_t nKeysOffset = asKeys.size();
+        try
+        {
+            asKeys.resize(nKeysOffset + nOrderItems);
+            aabyRecords.push_back(abyRecord);
+        }
+        catch (const std::exception &)
+        {
+            asKeys.resize(nKeysOffset);
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "CreateExternalSort(): out of memory");
+            bOK = false;
+            break;
+        }
+        ReadIndexFields(poSrcFeat.get(), nOrderItems,
+                        asKeys.data() + nKeysOffset);
+
+        nMemUsage += static_cast<GIntBig>(
+            abyRecord.size() + sizeof(std::vector<GByte>) +
+            sizeof(OGRField) * nOrderItems +
+            GetIndexFieldsMemoryUsage(asKeys.data() + nKeysOffset));
+        if (nMemUsage > nMaxMemory && !FlushRun(false))
+        {
+            bOK = false;
+            break;
+        }
+    }
+
+    if (bOK)
+        bOK = FlushRun(true);
+    else
+        FreeIndexFields(asKeys.data(), aabyRecords.size());
+
+    ResetReading();
+
+    if (!bOK)
+        return false;
+
+    CPLDebug("GenSQL", "ORDER BY using external merge sort with %d run(s)",
+             static_cast<int>(poState->m_aoRuns.size()));
+    m_poExternalSort = std::move(poState);
+    return true;
+}
+
+/************************************************************************/
+/*                       GetExternalSortFeature()                       */
+/*                                                                      */
+/*      Return the source feature at index nIndex in the sorted         */
+/*      sequence. Sequential access is efficient, going backwards       */
+/*      requires restarting the merge.                                  */
+/************************************************************************/
+
+std::unique_ptr<OGRFeature>
+OGRGenSQLResultsLayer::GetExternalSortFeature(GIntBig nIndex)
+{
+    auto &oState = *m_poExternalSort;
+    if (!oState.m_bStarted || nIndex < oState.m_nNextIndex)
+    {
+        if (!oState.Restart())
+            return nullptr;
+    }
+    while (oState.m_nNextIndex < nIndex)
+    {
+        if (!oState.Next())
+            return nullptr;
+    }
+    return oState.Next();
+}
+
 /************************************************************************/
 /*                          SortIndexSection()                          */
 /*                                                                      */
@@ -2734,6 +3639,7 @@ void OGRGenSQLResultsLayer::FindAndSetIgnoredFields()
 void OGRGenSQLResultsLayer::InvalidateOrderByIndex()
 {
     m_anFIDIndex.clear();
+    m_poExternalSort.reset();
     m_bOrderByValid = false;
 }
 
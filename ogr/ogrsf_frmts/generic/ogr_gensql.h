@@ -19,6 +19,9 @@
 #include "cpl_hash_set.h"
 #include "cpl_string.h"
 
+#include <memory>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 /*! @cond Doxygen_Suppress */
@@ -65,6 +68,12 @@ class OGRGenSQLResultsLayer final : public OGRLayer
     std::vector<GIntBig> m_anFIDIndex{};
     bool m_bOrderByValid = false;
 
+    // State of the external merge sort used by ORDER BY when the sort keys
+    // do not fit in memory, or when the source layer has no random read
+    // capability.
+    struct ExternalSortState;
+    std::unique_ptr<ExternalSortState> m_poExternalSort{};
+
     GIntBig m_nNextIndexFID = 0;
     mutable std::unique_ptr<OGRFeature> m_poSummaryFeature{};
 
@@ -73,10 +82,46 @@ class OGRGenSQLResultsLayer final : public OGRLayer
     GIntBig m_nIteratedFeatures = -1;
     std::vector<std::string> m_aosDistinctList{};
 
+    /** In-memory hash table built on the secondary layer of an equi-join */
+    struct JoinHashTable
+    {
+        enum class KeyType
+        {
+            INTEGER,
+            REAL,
+            STRING
+        };
+
+        bool bBuilt = false;
+        bool bUsable = false;
+        int iPrimaryField = -1;
+        int iSecondaryField = -1;
+        KeyType eKeyType = KeyType::STRING;
+
+        // Either the features themselves, when they fit within the memory
+        // budget, or only their FID when the secondary layer supports
+        // random reading.
+        bool bStoreFIDs = false;
+        std::unordered_map<std::string, std::unique_ptr<OGRFeature>>
+            oMapKeyToFeature{};
+        std::unordered_map<std::string, GIntBig> oMapKeyToFID{};
+    };
+
+    std::vector<JoinHashTable> m_aoJoinHashTables{};
+
     bool PrepareSummary() const;
 
     std::unique_ptr<OGRFeature> TranslateFeature(std::unique_ptr<OGRFeature>);
+    static bool GetJoinHashKey(const OGRFeature *poFeature, int iField,
+                               JoinHashTable::KeyType eKeyType,
+                               std::string &osKey);
+    bool PrepareJoinHashTable(int iJoin);
+    std::unique_ptr<OGRFeature> FetchJoinFeatureFromHashTable(
+        int iJoin, const OGRFeature *poSrcFeat, bool &bUsedHashTable);
     void CreateOrderByIndex();
+    bool CreateExternalSort(GIntBig nMaxMemory);
+    std::unique_ptr<OGRFeature> GetExternalSortFeature(GIntBig nIndex);
+    size_t GetIndexFieldsMemoryUsage(const OGRField *pasIndexFields) const;
     void ReadIndexFields(OGRFeature *poSrcFeat, int nOrderItems,
                          OGRField *pasIndexFields);
     void SortIndexSection(const OGRField *pasIndexFields, GIntBig *panMerged,
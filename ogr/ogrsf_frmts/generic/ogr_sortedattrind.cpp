@@ -0,0 +1,1454 @@
+/******************************************************************************
+ *
+ * Project:  OpenGIS Simple Features Reference Implementation
+ * Purpose:  Implements a sorted, block-compressed attribute index stored
+ *           in a .oidx sidecar file.
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "ogr_attrind.h"
+#include "cpl_conv.h"
+#include "cpl_vsi_virtual.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+//! @cond Doxygen_Suppress
+
+/*
+ * Layout of a .oidx file (all numbers are little-endian):
+ *
+ * - magic: "OGRSIDX1" (8 bytes)
+ * - uint64: offset of the directory
+ * - compressed blocks, referenced from the directory
+ * - directory:
+ *   - string: file name of the indexed dataset
+ *   - uint32: number of data files
+ *   - for each data file:
+ *     - string: file name
+ *     - uint64: file size
+ *     - int64: modification time
+ *   - uint32: number of field indexes
+ *   - for each field index:
+ *     - string: field name
+ *     - uint32: key type (0=integer, 1=real, 2=string)
+ *     - uint64: number of entries
+ *     - uint32: number of blocks
+ *     - for each block:
+ *       - key: first key of the block
+ *       - uint64: offset of the block
+ *       - uint32: compressed size
+ *       - uint32: uncompressed size
+ *       - uint32: number of entries
+ *
+ * Strings are encoded as a uint32 length followed by their bytes. Keys are
+ * encoded as a int64 for integer fields, a double for real fields and a
+ * string for string fields. Blocks are DEFLATE compressed, and contain
+ * a sequence of (key, int64 FID) entries, sorted by increasing key and then
+ * increasing FID. The directory acts as the (single) inner node of a B-tree
+ * whose leaves are the blocks.
+ *
+ * String keys are lower-cased, for consistency with the case insensitive
+ * string comparisons of the OGR SQL dialect.
+ *
+ * Drivers do not update the index when features are written, so the size
+ * and modification time of the data files are recorded when the index is
+ * saved, and the index is ignored if they no longer match. As modification
+ * times have a granularity of one second, the index is also ignored if a
+ * data file has been modified in the same second as the index was written,
+ * or later.
+ */
+
+namespace
+{
+constexpr const char SORTED_INDEX_MAGIC[] = "OGRSIDX1";
+constexpr size_t SORTED_INDEX_MAGIC_SIZE = 8;
+constexpr size_t ENTRIES_PER_BLOCK = 1024;
+constexpr size_t MAX_DIRECTORY_SIZE = 1024 * 1024 * 1024;
+
+enum class SortedIndexKeyType : uint32_t
+{
+    INTEGER = 0,
+    REAL = 1,
+    STRING = 2,
+};
+
+struct SortedIndexKey
+{
+    GIntBig nVal = 0;
+    double dfVal = 0;
+    std::string osVal{};
+};
+
+struct SortedIndexEntry
+{
+    SortedIndexKey sKey{};
+    GIntBig nFID = 0;
+};
+
+struct SortedIndexBlock
+{
+    SortedIndexKey sFirstKey{};
+    uint64_t nOffset = 0;
+    uint32_t nCompressedSize = 0;
+    uint32_t nUncompressedSize = 0;
+    uint32_t nEntryCount = 0;
+};
+
+/************************************************************************/
+/*                         SortedIndexWriter                            */
+/************************************************************************/
+
+class SortedIndexWriter
+{
+    std::vector<GByte> m_abyBuffer{};
+
+  public:
+    void WriteUInt32(uint32_t nVal)
+    {
+        CPL_LSBPTR32(&nVal);
+        Write(&nVal, sizeof(nVal));
+    }
+
+    void WriteUInt64(uint64_t nVal)
+    {
+        CPL_LSBPTR64(&nVal);
+        Write(&nVal, sizeof(nVal));
+    }
+
+    void WriteDouble(double dfVal)
+    {
+        CPL_LSBPTR64(&dfVal);
+        Write(&dfVal, sizeof(dfVal));
+    }
+
+    void WriteString(const std::string &osVal)
+    {
+        WriteUInt32(static_cast<uint32_t>(osVal.size()));
+        Write(osVal.data(), osVal.size());
+    }
+
+    void WriteKey(SortedIndexKeyType eType, const SortedIndexKey &sKey)
+    {
+        switch (eType)
+        {
+            case SortedIndexKeyType::INTEGER:
+                WriteUInt64(static_cast<uint64_t>(sKey.nVal));
+                break;
+            case SortedIndexKeyType::REAL:
+                WriteDouble(sKey.dfVal);
+                break;
+            case SortedIndexKeyType::STRING:
+                WriteString(sKey.osVal);
+                break;
+        }
+    }
+
+    void Write(const void *pData, size_t nSize)
+    {
+        const GByte *pabyData = static_cast<const GByte *>(pData);
+        m_abyBuffer.insert(m_abyBuffer.end(), pabyData, pabyData + nSize);
+    }
+
+    std::vector<GByte> &GetBuffer()
+    {
+        return m_abyBuffer;
+    }
+};
+
+/************************************************************************/
+/*                         SortedIndexReader                            */
+/************************************************************************/
+
+class SortedIndexReader
+{
+    const GByte *m_pabyData;
+    size_t m_nSize;
+    size_t m_nPos = 0;
+    bool m_bError = false;
+
+    bool Read(void *pData, size_t nSize)
+    {
+        if (m_bError || nSize > m_nSize - m_nPos)
+        {
+            m_bError = true;
+            memset(pData, 0, nSize);
+            return false;
+        }
+        memcpy(pData, m_pabyData + m_nPos, nSize);
+        m_nPos += nSize;
+        return true;
+    }
+
+  public:
+    SortedIndexReader(const GByte *pabyData, size_t nSize)
+        : m_pabyData(pabyData), m_nSize(nSize)
+    {
+    }
+
+    bool HasError() const
+    {
+        return m_bError;
+    }
+
+    bool IsAtEnd() const
+    {
+        return m_nPos == m_nSize;
+    }
+
+    uint32_t ReadUInt32()
+    {
+        uint32_t nVal = 0;
+        Read(&nVal, sizeof(nVal));
+        CPL_LSBPTR32(&nVal);
+        return nVal;
+    }
+
+    uint64_t ReadUInt64()
+    {
+        uint64_t nVal = 0;
+        Read(&nVal, sizeof(nVal));
+        CPL_LSBPTR64(&nVal);
+        return nVal;
+    }
+
+    double ReadDouble()
+    {
+        double dfVal = 0;
+        Read(&dfVal, sizeof(dfVal));
+        CPL_LSBPTR64(&dfVal);
+        return dfVal;
+    }
+
+    std::string ReadString()
+    {
+        const uint32_t nLen = ReadUInt32();
+        if (m_bError || nLen > m_nSize - m_nPos)
+        {
+            m_bError = true;
+            return std::string();
+        }
+        std::string osVal(reinterpret_cast<const char *>(m_pabyData + m_nPos),
+                          nLen);
+        m_nPos += nLen;
+        return osVal;
+    }
+
+    void ReadKey(SortedIndexKeyType eType, SortedIndexKey &sKey)
+    {
+        switch (eType)
+        {
+            case SortedIndexKeyType::INTEGER:
+                sKey.nVal = static_cast<GIntBig>(ReadUInt64());
+                break;
+            case SortedIndexKeyType::REAL:
+                sKey.dfVal = ReadDouble();
+                break;
+            case SortedIndexKeyType::STRING:
+                sKey.osVal = ReadString();
+                break;
+        }
+    }
+};
+
+class OGRSortedLayerAttrIndex;
+
+/************************************************************************/
+/*                          OGRSortedAttrIndex                          */
+/*                                                                      */
+/*      Sorted index of the values of one field.                        */
+/************************************************************************/
+
+class OGRSortedAttrIndex final : public OGRAttrIndex
+{
+    CPL_DISALLOW_COPY_ASSIGN(OGRSortedAttrIndex)
+
+  public:
+    OGRSortedLayerAttrIndex *const m_poLIndex;
+    const int m_iField;
+    const OGRFieldType m_eFieldType;
+    const SortedIndexKeyType m_eKeyType;
+
+    // Set when the index has been read from an existing file. Entries are
+    // then fetched from the file on demand, until a modification forces
+    // them to be loaded in m_asEntries.
+    GIntBig m_nEntryCount = 0;
+    std::vector<SortedIndexBlock> m_asBlocks{};
+
+    bool m_bInMemory = true;
+    bool m_bSorted = true;
+    std::vector<SortedIndexEntry> m_asEntries{};
+
+    int m_iCachedBlock = -1;
+    std::vector<SortedIndexEntry> m_asCachedBlockEntries{};
+
+    OGRSortedAttrIndex(OGRSortedLayerAttrIndex *poLIndex, int iField,
+                       OGRFieldType eFieldType, SortedIndexKeyType eKeyType);
+    ~OGRSortedAttrIndex() override;
+
+    static bool GetKeyType(OGRFieldType eFieldType,
+                           SortedIndexKeyType &eKeyType);
+    bool BuildKey(const OGRField *psKey, SortedIndexKey &sKey) const;
+    int CompareKeys(const SortedIndexKey &sKey1,
+                    const SortedIndexKey &sKey2) const;
+    bool LoadAllEntries();
+    void SortEntries();
+    const std::vector<SortedIndexEntry> *GetBlockEntries(int iBlock);
+    GIntBig *CollectMatches(const SortedIndexKey *psMin, bool bMinIncluded,
+                            const SortedIndexKey *psMax, bool bMaxIncluded,
+                            GIntBig *panFIDList, int *nFIDCount, int *nLength,
+                            bool bStopAtFirst);
+
+    GIntBig GetFirstMatch(OGRField *psKey) override;
+    GIntBig *GetAllMatches(OGRField *psKey) override;
+    GIntBig *GetAllMatches(OGRField *psKey, GIntBig *panFIDList, int *nFIDCount,
+                           int *nLength) override;
+    bool SupportsRangeQueries() const override;
+    GIntBig *GetRangeMatches(const OGRField *psMin, bool bMinIncluded,
+                             const OGRField *psMax, bool bMaxIncluded,
+                             GIntBig *panFIDList, int *nFIDCount,
+                             int *nLength) override;
+
+    OGRErr AddEntry(OGRField *psKey, GIntBig nFID) override;
+    OGRErr RemoveEntry(OGRField *psKey, GIntBig nFID) override;
+
+    OGRErr Clear() override;
+};
+
+/************************************************************************/
+/*                           GetDataFiles()                             */
+/************************************************************************/
+
+// Return the files whose content the index reflects.
+std::vector<std::string> GetDataFiles(const char *pszIndexPath)
+{
+    std::vector<std::string> aosFiles{pszIndexPath};
+    // Attributes of shapefiles are stored in the .dbf file
+    if (EQUAL(CPLGetExtensionSafe(pszIndexPath).c_str(), "shp"))
+        aosFiles.push_back(CPLResetExtensionSafe(pszIndexPath, "dbf"));
+    return aosFiles;
+}
+
+/************************************************************************/
+/* ==================================================================== */
+/*                       OGRSortedLayerAttrIndex                        */
+/* ==================================================================== */
+/************************************************************************/
+
+class OGRSortedLayerAttrIndex final : public OGRLayerAttrIndex
+{
+    CPL_DISALLOW_COPY_ASSIGN(OGRSortedLayerAttrIndex)
+
+  public:
+    std::string m_osFilename{};
+    VSIVirtualHandleUniquePtr m_fp{};
+    std::vector<std::unique_ptr<OGRSortedAttrIndex>> m_apoIndexes{};
+    bool m_bDirty = false;
+
+    OGRSortedLayerAttrIndex() = default;
+    ~OGRSortedLayerAttrIndex() override;
+
+    /* base class virtual methods */
+    OGRErr Initialize(const char *pszIndexPath, OGRLayer *) override;
+    OGRErr CreateIndex(int iField) override;
+    OGRErr DropIndex(int iField) override;
+    OGRErr IndexAllFeatures(int iField = -1) override;
+
+    OGRErr AddToIndex(OGRFeature *poFeature, int iField = -1) override;
+    OGRErr RemoveFromIndex(OGRFeature *poFeature) override;
+
+    OGRAttrIndex *GetFieldIndex(int iField) override;
+
+    /* custom to OGRSortedLayerAttrIndex */
+    OGRErr ReadDirectory();
+    OGRErr Save();
+    bool ReadBlock(const SortedIndexBlock &sBlock, SortedIndexKeyType eKeyType,
+                   std::vector<SortedIndexEntry> &asEntries);
+};
+
+}  // namespace
+
+/************************************************************************/
+/*                      ~OGRSortedLayerAttrIndex()                      */
+/************************************************************************/
+
+OGRSortedLayerAttrIndex::~OGRSortedLayerAttrIndex()
+
+{
+    if (m_bDirty)
+        Save();
+}
+
+/************************************************************************/
+/*                             Initialize()                             */
+/************************************************************************/
+
+OGRErr OGRSortedLayerAttrIndex::Initialize(const char *pszIndexPathIn,
+                                           OGRLayer *poLayerIn)
+
+{
+    if (poLayerIn == poLayer)
+        return OGRERR_NONE;
+
+    poLayer = poLayerIn;
+    pszIndexPath = CPLStrdup(pszIndexPathIn);
+    m_osFilename = CPLResetExtensionSafe(pszIndexPathIn, "oidx");
+
+    /* -------------------------------------------------------------------- */
+    /*      If an index file already exists, load its directory.            */
+    /* -------------------------------------------------------------------- */
+    VSIStatBufL sStat;
+    if (VSIStatL(m_osFilename.c_str(), &sStat) == 0)
+        return ReadDirectory();
+
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                           ReadDirectory()                            */
+/************************************************************************/
+
+OGRErr OGRSortedLayerAttrIndex::ReadDirectory()
+
+{
+    m_fp.reset(VSIFOpenL(m_osFilename.c_str(), "rb"));
+    if (!m_fp)
+    {
+        CPLError(CE_Failure, CPLE_OpenFailed, "Failed to open index file %s.",
+                 m_osFilename.c_str());
+        return OGRERR_FAILURE;
+    }
+
+    GByte abyHeader[SORTED_INDEX_MAGIC_SIZE + sizeof(uint64_t)];
+    if (m_fp->Read(abyHeader, sizeof(abyHeader), 1) != 1 ||
+        memcmp(abyHeader, SORTED_INDEX_MAGIC, SORTED_INDEX_MAGIC_SIZE) != 0)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "%s is not a valid index file.",
+                 m_osFilename.c_str());
+        m_fp.reset();
+        return OGRERR_FAILURE;
+    }
+
+    uint64_t nDirectoryOffset;
+    memcpy(&nDirectoryOffset, abyHeader + SORTED_INDEX_MAGIC_SIZE,
+           sizeof(nDirectoryOffset));
+    CPL_LSBPTR64(&nDirectoryOffset);
+
+    if (m_fp->Seek(0, SEEK_END) != 0)
+    {
+        m_fp.reset();
+        return OGRERR_FAILURE;
+    }
+    const vsi_l_offset nFileSize = m_fp->Tell();
+    if (nDirectoryOffset < sizeof(abyHeader) ||
+        nDirectoryOffset >= nFileSize ||
+        nFileSize - nDirectoryOffset > MAX_DIRECTORY_SIZE)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "%s: invalid directory offset.", m_osFilename.c_str());
+        m_fp.reset();
+        return OGRERR_FAILURE;
+    }
+
+    std::vector<GByte> abyDirectory;
+    try
+    {
+        abyDirectory.resize(
+            static_cast<size_t>(nFileSize - nDirectoryOffset));
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate memory for index directory");
+        m_fp.reset();
+        return OGRERR_FAILURE;
+    }
+    if (m_fp->Seek(nDirectoryOffset, SEEK_SET) != 0 ||
+        m_fp->Read(abyDirectory.data(), abyDirectory.size(), 1) != 1)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "%s: cannot read directory.",
+                 m_osFilename.c_str());
+        m_fp.reset();
+        return OGRERR_FAILURE;
+    }
+
+    SortedIndexReader oReader(abyDirectory.data(), abyDirectory.size());
+
+    /* -------------------------------------------------------------------- */
+    /*      Refuse to use an index that was built for another dataset       */
+    /*      sharing the same basename.                                      */
+    /* -------------------------------------------------------------------- */
+    const std::string osIndexedFilename = oReader.ReadString();
+    if (!oReader.HasError() &&
+        !EQUAL(osIndexedFilename.c_str(), CPLGetFilename(pszIndexPath)))
+    {
+        CPLDebug("OGR", "Ignoring %s which indexes %s, not %s",
+                 m_osFilename.c_str(), osIndexedFilename.c_str(),
+                 CPLGetFilename(pszIndexPath));
+        m_fp.reset();
+        return OGRERR_NONE;
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Refuse to use an index whose data files have been modified      */
+    /*      since it was written.                                           */
+    /* -------------------------------------------------------------------- */
+    VSIStatBufL sIndexStat;
+    const GIntBig nIndexMTime =
+        VSIStatL(m_osFilename.c_str(), &sIndexStat) == 0
+            ? static_cast<GIntBig>(sIndexStat.st_mtime)
+            : 0;
+    const std::string osDataPath = CPLGetPathSafe(pszIndexPath);
+    const uint32_t nDataFileCount = oReader.ReadUInt32();
+    for (uint32_t i = 0; i < nDataFileCount && !oReader.HasError(); ++i)
+    {
+        const std::string osDataFilename = oReader.ReadString();
+        const uint64_t nSize = oReader.ReadUInt64();
+        const GIntBig nMTime = static_cast<GIntBig>(oReader.ReadUInt64());
+        if (oReader.HasError())
+            break;
+
+        const std::string osDataFile = CPLFormFilenameSafe(
+            osDataPath.c_str(), osDataFilename.c_str(), nullptr);
+        VSIStatBufL sStat;
+        if (VSIStatL(osDataFile.c_str(), &sStat) != 0 ||
+            static_cast<uint64_t>(sStat.st_size) != nSize ||
+            static_cast<GIntBig>(sStat.st_mtime) != nMTime ||
+            nMTime >= nIndexMTime)
+        {
+            CPLDebug("OGR",
+                     "Ignoring %s as %s has been modified since the index "
+                     "was written",
+                     m_osFilename.c_str(), osDataFile.c_str());
+            m_fp.reset();
+            return OGRERR_NONE;
+        }
+    }
+
+    const OGRFeatureDefn *poFDefn = poLayer->GetLayerDefn();
+    const uint32_t nIndexCount = oReader.ReadUInt32();
+    for (uint32_t i = 0; i < nIndexCount && !oReader.HasError(); ++i)
+    {
+        const std::string osFieldName = oReader.ReadString();
+        const uint32_t nKeyType = oReader.ReadUInt32();
+        const GIntBig nEntryCount = static_cast<GIntBig>(oReader.ReadUInt64());
+        const uint32_t nBlockCount = oReader.ReadUInt32();
+        if (nKeyType > static_cast<uint32_t>(SortedIndexKeyType::STRING))
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "%s: invalid key type for field %s.",
+                     m_osFilename.c_str(), osFieldName.c_str());
+            m_apoIndexes.clear();
+            m_fp.reset();
+            return OGRERR_FAILURE;
+        }
+        const auto eKeyType = static_cast<SortedIndexKeyType>(nKeyType);
+
+        std::vector<SortedIndexBlock> asBlocks;
+        for (uint32_t j = 0; j < nBlockCount && !oReader.HasError(); ++j)
+        {
+            SortedIndexBlock sBlock;
+            oReader.ReadKey(eKeyType, sBlock.sFirstKey);
+            sBlock.nOffset = oReader.ReadUInt64();
+            sBlock.nCompressedSize = oReader.ReadUInt32();
+            sBlock.nUncompressedSize = oReader.ReadUInt32();
+            sBlock.nEntryCount = oReader.ReadUInt32();
+            asBlocks.push_back(std::move(sBlock));
+        }
+        if (oReader.HasError())
+            break;
+
+        // Field indexes are matched by name, so that the index remains
+        // usable if fields are added or reordered.
+        const int iField = poFDefn->GetFieldIndex(osFieldName.c_str());
+        SortedIndexKeyType eExpectedKeyType = SortedIndexKeyType::INTEGER;
+        if (iField < 0 ||
+            !OGRSortedAttrIndex::GetKeyType(
+                poFDefn->GetFieldDefn(iField)->GetType(), eExpectedKeyType) ||
+            eExpectedKeyType != eKeyType || GetFieldIndex(iField) != nullptr)
+        {
+            CPLDebug("OGR", "%s: ignoring index on field %s",
+                     m_osFilename.c_str(), osFieldName.c_str());
+            continue;
+        }
+
+        auto poIndex = std::make_unique<OGRSortedAttrIndex>(
+            this, iField, poFDefn->GetFieldDefn(iField)->GetType(), eKeyType);
+        poIndex->m_nEntryCount = nEntryCount;
+        poIndex->m_asBlocks = std::move(asBlocks);
+        poIndex->m_bInMemory = false;
+        m_apoIndexes.push_back(std::move(poIndex));
+    }
+
+    if (oReader.HasError())
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "%s: corrupted directory.",
+                 m_osFilename.c_str());
+        m_apoIndexes.clear();
+        m_fp.reset();
+        return OGRERR_FAILURE;
+    }
+
+    CPLDebug("OGR", "Restored %d field indexes for layer %s from %s.",
+             static_cast<int>(m_apoIndexes.size()), poFDefn->GetName(),
+             m_osFilename.c_str());
+
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                             ReadBlock()                              */
+/************************************************************************/
+
+bool OGRSortedLayerAttrIndex::ReadBlock(
+    const SortedIndexBlock &sBlock, SortedIndexKeyType eKeyType,
+    std::vector<SortedIndexEntry> &asEntries)
+
+{
+    asEntries.clear();
+    if (!m_fp)
+        return false;
+
+    std::vector<GByte> abyCompressed;
+    std::vector<GByte> abyUncompressed;
+    try
+    {
+        abyCompressed.resize(sBlock.nCompressedSize);
+        abyUncompressed.resize(sBlock.nUncompressedSize);
+        asEntries.reserve(sBlock.nEntryCount);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate memory for index block");
+        return false;
+    }
+
+    size_t nOutBytes = 0;
+    if (m_fp->Seek(sBlock.nOffset, SEEK_SET) != 0 ||
+        m_fp->Read(abyCompressed.data(), abyCompressed.size(), 1) != 1 ||
+        CPLZLibInflate(abyCompressed.data(), abyCompressed.size(),
+                       abyUncompressed.data(), abyUncompressed.size(),
+                       &nOutBytes) == nullptr ||
+        nOutBytes != abyUncompressed.size())
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "%s: cannot read index block.",
+                 m_osFilename.c_str());
+        return false;
+    }
+
+    SortedIndexReader oReader(abyUncompressed.data(), abyUncompressed.size());
+    for (uint32_t i = 0; i < sBlock.nEntryCount && !oReader.HasError(); ++i)
+    {
+        SortedIndexEntry sEntry;
+        oReader.ReadKey(eKeyType, sEntry.sKey);
+        sEntry.nFID = static_cast<GIntBig>(oReader.ReadUInt64());
+        asEntries.push_back(std::move(sEntry));
+    }
+    if (oReader.HasError() || !oReader.IsAtEnd())
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "%s: corrupted index block.",
+                 m_osFilename.c_str());
+        asEntries.clear();
+        return false;
+    }
+
+    return true;
+}
+
+/************************************************************************/
+/*                                Save()                                */
+/*                                                                      */
+/*      Rewrite the whole index file from the in-memory entries.        */
+/************************************************************************/
+
+OGRErr OGRSortedLayerAttrIndex::Save()
+
+{
+    m_bDirty = false;
+
+    if (m_apoIndexes.empty())
+    {
+        m_fp.reset();
+        VSIStatBufL sStat;
+        if (VSIStatL(m_osFilename.c_str(), &sStat) == 0)
+            VSIUnlink(m_osFilename.c_str());
+        return OGRERR_NONE;
+    }
+
+    // All entries must be in memory before we overwrite the file they
+    // may come from.
+    for (auto &poIndex : m_apoIndexes)
+    {
+        if (!poIndex->LoadAllEntries())
+            return OGRERR_FAILURE;
+        poIndex->SortEntries();
+    }
+    m_fp.reset();
+
+    VSIVirtualHandleUniquePtr fp(VSIFOpenL(m_osFilename.c_str(), "wb"));
+    if (!fp)
+    {
+        CPLError(CE_Failure, CPLE_OpenFailed, "Failed to open %s for write.",
+                 m_osFilename.c_str());
+        return OGRERR_FAILURE;
+    }
+
+    bool bOK = fp->Write(SORTED_INDEX_MAGIC, SORTED_INDEX_MAGIC_SIZE, 1) == 1;
+    uint64_t nDirectoryOffset = 0;
+    bOK &= fp->Write(&nDirectoryOffset, sizeof(nDirectoryOffset), 1) == 1;
+    uint64_t nOffset = SORTED_INDEX_MAGIC_SIZE + sizeof(nDirectoryOffset);
+
+    SortedIndexWriter oDirectory;
+    oDirectory.WriteString(CPLGetFilename(pszIndexPath));
+
+    std::vector<std::pair<std::string, VSIStatBufL>> asDataFiles;
+    for (const std::string &osDataFile : GetDataFiles(pszIndexPath))
+    {
+        VSIStatBufL sStat;
+        if (VSIStatL(osDataFile.c_str(), &sStat) == 0)
+            asDataFiles.emplace_back(CPLGetFilename(osDataFile.c_str()),
+                                     sStat);
+    }
+    oDirectory.WriteUInt32(static_cast<uint32_t>(asDataFiles.size()));
+    for (const auto &[osDataFilename, sStat] : asDataFiles)
+    {
+        oDirectory.WriteString(osDataFilename);
+        oDirectory.WriteUInt64(static_cast<uint64_t>(sStat.st_size));
+        oDirectory.WriteUInt64(
+            static_cast<uint64_t>(static_cast<GIntBig>(sStat.st_mtime)));
+    }
+
+    oDirectory.WriteUInt32(static_cast<uint32_t>(m_apoIndexes.size()));
+
+    const OGRFeatureDefn *poFDefn = poLayer->GetLayerDefn();
+    for (const auto &poIndex : m_apoIndexes)
+    {
+        const auto &asEntries = poIndex->m_asEntries;
+        const size_t nBlockCount =
+            (asEntries.size() + ENTRIES_PER_BLOCK - 1) / ENTRIES_PER_BLOCK;
+
+        oDirectory.WriteString(
+            poFDefn->GetFieldDefn(poIndex->m_iField)->GetNameRef());
+        oDirectory.WriteUInt32(static_cast<uint32_t>(poIndex->m_eKeyType));
+        oDirectory.WriteUInt64(static_cast<uint64_t>(asEntries.size()));
+        oDirectory.WriteUInt32(static_cast<uint32_t>(nBlockCount));
+
+        for (size_t iBlock = 0; bOK && iBlock < nBlockCount; ++iBlock)
+        {
+            const size_t iStart = iBlock * ENTRIES_PER_BLOCK;
+            const size_t iEnd =
+                std::min(asEntries.size(), iStart + ENTRIES_PER_BLOCK);
+
+            SortedIndexWriter oBlock;
+            for (size_t i = iStart; i < iEnd; ++i)
+            {
+                oBlock.WriteKey(poIndex->m_eKeyType, asEntries[i].sKey);
+                oBlock.WriteUInt64(static_cast<uint64_t>(asEntries[i].nFID));
+            }
+            const auto &abyBlock = oBlock.GetBuffer();
+
+            size_t nCompressedSize = 0;
+            void *pCompressed =
+                CPLZLibDeflate(abyBlock.data(), abyBlock.size(), -1, nullptr, 0,
+                               &nCompressedSize);
+            if (pCompressed == nullptr)
+            {
+                bOK = false;
+                break;
+            }
+            bOK = fp->Write(pCompressed, nCompressedSize, 1) == 1;
+            VSIFree(pCompressed);
+
+            oDirectory.WriteKey(poIndex->m_eKeyType, asEntries[iStart].sKey);
+            oDirectory.WriteUInt64(nOffset);
+            oDirectory.WriteUInt32(static_cast<uint32_t>(nCompressedSize));
+            oDirectory.WriteUInt32(static_cast<uint32_t>(abyBlock.size()));
+            oDirectory.WriteUInt32(static_cast<uint32_t>(iEnd - iStart));
+            nOffset += nCompressedSize;
+        }
+    }
+
+    nDirectoryOffset = nOffset;
+    CPL_LSBPTR64(&nDirectoryOffset);
+    const auto &abyDirectory = oDirectory.GetBuffer();
+    bOK = bOK &&
+          fp->Write(abyDirectory.data(), abyDirectory.size(), 1) == 1 &&
+          fp->Seek(SORTED_INDEX_MAGIC_SIZE, SEEK_SET) == 0 &&
+          fp->Write(&nDirectoryOffset, sizeof(nDirectoryOffset), 1) == 1;
+    bOK = fp->Close() == 0 && bOK;
+
+    if (!bOK)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Failed to write %s.",
+                 m_osFilename.c_str());
+        return OGRERR_FAILURE;
+    }
+
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                          IndexAllFeatures()                          */
+/************************************************************************/
+
+OGRErr OGRSortedLayerAttrIndex::IndexAllFeatures(int iField)
+
+{
+    // Make sure that all features are indexed, whatever the current filters.
+    const std::string osOldFilter = poLayer->GetAttrQueryString()
+                                        ? poLayer->GetAttrQueryString()
+                                        : "";
+    std::unique_ptr<OGRGeometry> poOldFilterGeom(
+        poLayer->GetSpatialFilter() ? poLayer->GetSpatialFilter()->clone()
+                                    : nullptr);
+    const int iOldGeomFieldFilter = poLayer->GetGeomFieldFilter();
+    if (!osOldFilter.empty())
+        poLayer->SetAttributeFilter(nullptr);
+    if (poOldFilterGeom)
+        poLayer->SetSpatialFilter(iOldGeomFieldFilter, nullptr);
+
+    for (auto &poIndex : m_apoIndexes)
+    {
+        if (iField == -1 || poIndex->m_iField == iField)
+            poIndex->Clear();
+    }
+
+    OGRErr eErr = OGRERR_NONE;
+    for (auto &&poFeature : *poLayer)
+    {
+        eErr = AddToIndex(poFeature.get(), iField);
+        if (eErr != OGRERR_NONE)
+            break;
+    }
+
+    if (!osOldFilter.empty())
+        poLayer->SetAttributeFilter(osOldFilter.c_str());
+    if (poOldFilterGeom)
+        poLayer->SetSpatialFilter(iOldGeomFieldFilter, poOldFilterGeom.get());
+    poLayer->ResetReading();
+
+    if (eErr != OGRERR_NONE)
+        return eErr;
+
+    return Save();
+}
+
+/************************************************************************/
+/*                            CreateIndex()                             */
+/*                                                                      */
+/*      Create an index corresponding to the indicated field, but do    */
+/*      not populate it.  Use IndexAllFeatures() for that.              */
+/************************************************************************/
+
+OGRErr OGRSortedLayerAttrIndex::CreateIndex(int iField)
+
+{
+    const OGRFieldDefn *poFldDefn =
+        poLayer->GetLayerDefn()->GetFieldDefn(iField);
+
+    if (GetFieldIndex(iField) != nullptr)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "It seems we already have an index for field %d/%s\n"
+                 "of layer %s.",
+                 iField, poFldDefn->GetNameRef(),
+                 poLayer->GetLayerDefn()->GetName());
+        return OGRERR_FAILURE;
+    }
+
+    SortedIndexKeyType eKeyType = SortedIndexKeyType::INTEGER;
+    if (!OGRSortedAttrIndex::GetKeyType(poFldDefn->GetType(), eKeyType))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Indexing not support for the field type of field %s.",
+                 poFldDefn->GetNameRef());
+        return OGRERR_FAILURE;
+    }
+
+    m_apoIndexes.push_back(std::make_unique<OGRSortedAttrIndex>(
+        this, iField, poFldDefn->GetType(), eKeyType));
+    m_bDirty = true;
+
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                             DropIndex()                              */
+/************************************************************************/
+
+OGRErr OGRSortedLayerAttrIndex::DropIndex(int iField)
+
+{
+    const auto oIter =
+        std::find_if(m_apoIndexes.begin(), m_apoIndexes.end(),
+                     [iField](const std::unique_ptr<OGRSortedAttrIndex> &poIdx)
+                     { return poIdx->m_iField == iField; });
+    if (oIter == m_apoIndexes.end())
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "DROP INDEX on field (%s) that doesn't have an index.",
+                 poLayer->GetLayerDefn()->GetFieldDefn(iField)->GetNameRef());
+        return OGRERR_FAILURE;
+    }
+
+    m_apoIndexes.erase(oIter);
+
+    return Save();
+}
+
+/************************************************************************/
+/*                           GetFieldIndex()                            */
+/************************************************************************/
+
+OGRAttrIndex *OGRSortedLayerAttrIndex::GetFieldIndex(int iField)
+
+{
+    for (auto &poIndex : m_apoIndexes)
+    {
+        if (poIndex->m_iField == iField)
+            return poIndex.get();
+    }
+
+    return nullptr;
+}
+
+/************************************************************************/
+/*                             AddToIndex()                             */
+/************************************************************************/
+
+OGRErr OGRSortedLayerAttrIndex::AddToIndex(OGRFeature *poFeature,
+                                           int iTargetField)
+
+{
+    if (poFeature->GetFID() == OGRNullFID)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Attempt to index feature with no FID.");
+        return OGRERR_FAILURE;
+    }
+
+    OGRErr eErr = OGRERR_NONE;
+    for (size_t i = 0; i < m_apoIndexes.size() && eErr == OGRERR_NONE; i++)
+    {
+        const int iField = m_apoIndexes[i]->m_iField;
+
+        if (iTargetField != -1 && iTargetField != iField)
+            continue;
+
+        if (!poFeature->IsFieldSetAndNotNull(iField))
+            continue;
+
+        eErr = m_apoIndexes[i]->AddEntry(poFeature->GetRawFieldRef(iField),
+                                         poFeature->GetFID());
+    }
+
+    return eErr;
+}
+
+/************************************************************************/
+/*                          RemoveFromIndex()                           */
+/************************************************************************/
+
+OGRErr OGRSortedLayerAttrIndex::RemoveFromIndex(OGRFeature *poFeature)
+
+{
+    OGRErr eErr = OGRERR_NONE;
+    for (size_t i = 0; i < m_apoIndexes.size() && eErr == OGRERR_NONE; i++)
+    {
+        const int iField = m_apoIndexes[i]->m_iField;
+        if (!poFeature->IsFieldSetAndNotNull(iField))
+            continue;
+
+        eErr = m_apoIndexes[i]->RemoveEntry(poFeature->GetRawFieldRef(iField),
+                                            poFeature->GetFID());
+    }
+
+    return eErr;
+}
+
+/************************************************************************/
+/*                     OGRCreateSortedLayerIndex()                      */
+/************************************************************************/
+
+OGRLayerAttrIndex *OGRCreateSortedLayerIndex()
+
+{
+    return new OGRSortedLayerAttrIndex();
+}
+
+/************************************************************************/
+/* ==================================================================== */
+/*                          OGRSortedAttrIndex                          */
+/* ==================================================================== */
+/************************************************************************/
+
+/************************************************************************/
+/*                         OGRSortedAttrIndex()                         */
+/************************************************************************/
+
+OGRSortedAttrIndex::OGRSortedAttrIndex(OGRSortedLayerAttrIndex *poLIndex,
+                                       int iField, OGRFieldType eFieldType,
+                                       SortedIndexKeyType eKeyType)
+    : m_poLIndex(poLIndex), m_iField(iField), m_eFieldType(eFieldType),
+      m_eKeyType(eKeyType)
+{
+}
+
+/************************************************************************/
+/*                        ~OGRSortedAttrIndex()                         */
+/************************************************************************/
+
+OGRSortedAttrIndex::~OGRSortedAttrIndex()
+{
+}
+
+/************************************************************************/
+/*                             GetKeyType()                             */
+/************************************************************************/
+
+bool OGRSortedAttrIndex::GetKeyType(OGRFieldType eFieldType,
+                                    SortedIndexKeyType &eKeyType)
+{
+    switch (eFieldType)
+    {
+        case OFTInteger:
+        case OFTInteger64:
+            eKeyType = SortedIndexKeyType::INTEGER;
+            return true;
+
+        case OFTReal:
+            eKeyType = SortedIndexKeyType::REAL;
+            return true;
+
+        case OFTString:
+            eKeyType = SortedIndexKeyType::STRING;
+            return true;
+
+        default:
+            break;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                              BuildKey()                              */
+/************************************************************************/
+
+bool OGRSortedAttrIndex::BuildKey(const OGRField *psKey,
+                                  SortedIndexKey &sKey) const
+
+{
+    switch (m_eFieldType)
+    {
+        case OFTInteger:
+            sKey.nVal = psKey->Integer;
+            return true;
+
+        case OFTInteger64:
+            sKey.nVal = psKey->Integer64;
+            return true;
+
+        case OFTReal:
+            // NaN never compares equal to anything.
+            sKey.dfVal = psKey->Real;
+            return !std::isnan(sKey.dfVal);
+
+        case OFTString:
+            if (psKey->String == nullptr)
+                return false;
+            sKey.osVal = CPLString(psKey->String).tolower();
+            return true;
+
+        default:
+            break;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                            CompareKeys()                             */
+/************************************************************************/
+
+int OGRSortedAttrIndex::CompareKeys(const SortedIndexKey &sKey1,
+                                    const SortedIndexKey &sKey2) const
+
+{
+    switch (m_eKeyType)
+    {
+        case SortedIndexKeyType::INTEGER:
+            return sKey1.nVal < sKey2.nVal ? -1
+                   : sKey1.nVal > sKey2.nVal ? 1
+                                             : 0;
+
+        case SortedIndexKeyType::REAL:
+            return sKey1.dfVal < sKey2.dfVal ? -1
+                   : sKey1.dfVal > sKey2.dfVal ? 1
+                                               : 0;
+
+        case SortedIndexKeyType::STRING:
+        {
+            // Unsigned byte comparison, as done by strcasecmp()
+            const int nCmp = sKey1.osVal.compare(sKey2.osVal);
+            return nCmp < 0 ? -1 : nCmp > 0 ? 1 : 0;
+        }
+    }
+    return 0;
+}
+
+/************************************************************************/
+/*                           LoadAllEntries()                           */
+/************************************************************************/
+
+bool OGRSortedAttrIndex::LoadAllEntries()
+
+{
+    if (m_bInMemory)
+        return true;
+
+    std::vector<SortedIndexEntry> asEntries;
+    try
+    {
+        asEntries.reserve(static_cast<size_t>(m_nEntryCount));
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate memory for index entries");
+        return false;
+    }
+
+    for (int iBlock = 0; iBlock < static_cast<int>(m_asBlocks.size());
+         ++iBlock)
+    {
+        const auto *pasBlockEntries = GetBlockEntries(iBlock);
+        if (pasBlockEntries == nullptr)
+            return false;
+        asEntries.insert(asEntries.end(), pasBlockEntries->begin(),
+                         pasBlockEntries->end());
+    }
+
+    m_asEntries = std::move(asEntries);
+    m_asBlocks.clear();
+    m_asCachedBlockEntries.clear();
+    m_iCachedBlock = -1;
+    m_bInMemory = true;
+    m_bSorted = true;
+    return true;
+}
+
+/************************************************************************/
+/*                            SortEntries()                             */
+/************************************************************************/
+
+void OGRSortedAttrIndex::SortEntries()
+
+{
+    if (m_bSorted)
+        return;
+
+    std::sort(m_asEntries.begin(), m_asEntries.end(),
+              [this](const SortedIndexEntry &a, const SortedIndexEntry &b)
+              {
+                  const int nCmp = CompareKeys(a.sKey, b.sKey);
+                  return nCmp < 0 || (nCmp == 0 && a.nFID < b.nFID);
+              });
+    m_bSorted = true;
+}
+
+/************************************************************************/
+/*                          GetBlockEntries()                           */
+/************************************************************************/
+
+const std::vector<SortedIndexEntry> *
+OGRSortedAttrIndex::GetBlockEntries(int iBlock)
+
+{
+    if (iBlock != m_iCachedBlock)
+    {
+        m_iCachedBlock = -1;
+        if (!m_poLIndex->ReadBlock(m_asBlocks[iBlock], m_eKeyType,
+                                   m_asCachedBlockEntries))
+            return nullptr;
+        m_iCachedBlock = iBlock;
+    }
+    return &m_asCachedBlockEntries;
+}
+
+/************************************************************************/
+/*                           CollectMatches()                           */
+/*                                                                      */
+/*      Append to panFIDList the FIDs of the entries whose key is in    */
+/*      the [psMin, psMax] range (bounds being optionally excluded).    */
+/************************************************************************/
+
+GIntBig *OGRSortedAttrIndex::CollectMatches(
+    const SortedIndexKey *psMin, bool bMinIncluded, const SortedIndexKey *psMax,
+    bool bMaxIncluded, GIntBig *panFIDList, int *nFIDCount, int *nLength,
+    bool bStopAtFirst)
+
+{
+    if (panFIDList == nullptr)
+    {
+        panFIDList = static_cast<GIntBig *>(CPLMalloc(sizeof(GIntBig) * 2));
+        *nFIDCount = 0;
+        *nLength = 2;
+    }
+
+    const auto IsBeforeMin = [this, psMin, bMinIncluded](const SortedIndexKey &k)
+    {
+        if (psMin == nullptr)
+            return false;
+        const int nCmp = CompareKeys(k, *psMin);
+        return nCmp < 0 || (nCmp == 0 && !bMinIncluded);
+    };
+
+    const auto IsAfterMax = [this, psMax, bMaxIncluded](const SortedIndexKey &k)
+    {
+        if (psMax == nullptr)
+            return false;
+        const int nCmp = CompareKeys(k, *psMax);
+        return nCmp > 0 || (nCmp == 0 && !bMaxIncluded);
+    };
+
+    // Returns false when the end of the range has been reached.
+    const auto AddEntries = [&](const std::vector<SortedIndexEntry> &asEntries,
+                                size_t iStart)
+    {
+        for (size_t i = iStart; i < asEntries.size(); ++i)
+        {
+            const auto &sEntry = asEntries[i];
+            if (IsAfterMax(sEntry.sKey))
+                return false;
+            if (*nFIDCount >= *nLength - 1)
+            {
+                if (*nLength > INT_MAX / 2 - 10)
+                {
+                    CPLError(CE_Failure, CPLE_AppDefined,
+                             "Too many features matching the index query");
+                    return false;
+                }
+                *nLength = (*nLength) * 2 + 10;
+                panFIDList = static_cast<GIntBig *>(
+                    CPLRealloc(panFIDList, sizeof(GIntBig) * (*nLength)));
+            }
+            panFIDList[(*nFIDCount)++] = sEntry.nFID;
+            if (bStopAtFirst)
+                return false;
+        }
+        return true;
+    };
+
+    if (m_bInMemory)
+    {
+        SortEntries();
+        const auto oIter = std::partition_point(
+            m_asEntries.begin(), m_asEntries.end(),
+            [&IsBeforeMin](const SortedIndexEntry &sEntry)
+            { return IsBeforeMin(sEntry.sKey); });
+        AddEntries(m_asEntries,
+                   static_cast<size_t>(oIter - m_asEntries.begin()));
+    }
+    else if (!m_asBlocks.empty())
+    {
+        // Find the last block whose first key is strictly before the
+        // minimum: as a key may be repeated over several blocks, entries
+        // matching the minimum may start in that block.
+        const auto oIter = std::partition_point(
+            m_asBlocks.begin(), m_asBlocks.end(),
+            [this, psMin](const SortedIndexBlock &sBlock)
+            {
+                return psMin != nullptr &&
+                       CompareKeys(sBlock.sFirstKey, *psMin) < 0;
+            });
+        int iBlock = std::max(
+            0, static_cast<int>(oIter - m_asBlocks.begin()) - 1);
+        for (; iBlock < static_cast<int>(m_asBlocks.size()); ++iBlock)
+        {
+            if (IsAfterMax(m_asBlocks[iBlock].sFirstKey))
+                break;
+            const auto *pasEntries = GetBlockEntries(iBlock);
+            if (pasEntries == nullptr)
+                break;
+            const auto oIterEntry = std::partition_point(
+                pasEntries->begin(), pasEntries->end(),
+                [&IsBeforeMin](const SortedIndexEntry &sEntry)
+                { return IsBeforeMin(sEntry.sKey); });
+            if (!AddEntries(*pasEntries, static_cast<size_t>(
+                                             oIterEntry - pasEntries->begin())))
+                break;
+        }
+    }
+
+    panFIDList[*nFIDCount] = OGRNullFID;
+
+    return panFIDList;
+}
+
+/************************************************************************/
+/*                           GetFirstMatch()                            */
+/************************************************************************/
+
+GIntBig OGRSortedAttrIndex::GetFirstMatch(OGRField *psKey)
+
+{
+    SortedIndexKey sKey;
+    if (!BuildKey(psKey, sKey))
+        return OGRNullFID;
+
+    int nFIDCount = 0;
+    int nLength = 0;
+    GIntBig *panFIDs = CollectMatches(&sKey, true, &sKey, true, nullptr,
+                                      &nFIDCount, &nLength, true);
+    const GIntBig nFID = panFIDs[0];
+    CPLFree(panFIDs);
+    return nFID;
+}
+
+/************************************************************************/
+/*                           GetAllMatches()                            */
+/************************************************************************/
+
+GIntBig *OGRSortedAttrIndex::GetAllMatches(OGRField *psKey,
+                                           GIntBig *panFIDList, int *nFIDCount,
+                                           int *nLength)
+{
+    SortedIndexKey sKey;
+    if (!BuildKey(psKey, sKey))
+    {
+        // Return an empty (or unmodified) list.
+        return CollectMatches(&sKey, false, &sKey, false, panFIDList,
+                              nFIDCount, nLength, false);
+    }
+    return CollectMatches(&sKey, true, &sKey, true, panFIDList, nFIDCount,
+                          nLength, false);
+}
+
+GIntBig *OGRSortedAttrIndex::GetAllMatches(OGRField *psKey)
+{
+    int nFIDCount, nLength;
+    return GetAllMatches(psKey, nullptr, &nFIDCount, &nLength);
+}
+
+/************************************************************************/
+/*                        SupportsRangeQueries()                        */
+/************************************************************************/
+
+bool OGRSortedAttrIndex::SupportsRangeQueries() const
+{
+    return true;
+}
+
+/************************************************************************/
+/*                          GetRangeMatches()                           */
+/************************************************************************/
+
+GIntBig *OGRSortedAttrIndex::GetRangeMatches(const OGRField *psMin,
+                                             bool bMinIncluded,
+                                             const OGRField *psMax,
+                                             bool bMaxIncluded,
+                                             GIntBig *panFIDList,
+                                             int *nFIDCount, int *nLength)
+{
+    SortedIndexKey sMin;
+    SortedIndexKey sMax;
+    if ((psMin != nullptr && !BuildKey(psMin, sMin)) ||
+        (psMax != nullptr && !BuildKey(psMax, sMax)))
+    {
+        return nullptr;
+    }
+    return CollectMatches(psMin ? &sMin : nullptr, bMinIncluded,
+                          psMax ? &sMax : nullptr, bMaxIncluded, panFIDList,
+                          nFIDCount, nLength, false);
+}
+
+/************************************************************************/
+/*                              AddEntry()                              */
+/************************************************************************/
+
+OGRErr OGRSortedAttrIndex::AddEntry(OGRField *psKey, GIntBig nFID)
+
+{
+    if (psKey == nullptr)
+        return OGRERR_FAILURE;
+
+    SortedIndexEntry sEntry;
+    if (!BuildKey(psKey, sEntry.sKey))
+        return OGRERR_NONE;
+    sEntry.nFID = nFID;
+
+    if (!LoadAllEntries())
+        return OGRERR_FAILURE;
+
+    if (m_bSorted && !m_asEntries.empty())
+    {
+        const auto &sLast = m_asEntries.back();
+        const int nCmp = CompareKeys(sLast.sKey, sEntry.sKey);
+        m_bSorted = nCmp < 0 || (nCmp == 0 && sLast.nFID < nFID);
+    }
+    m_asEntries.push_back(std::move(sEntry));
+    m_poLIndex->m_bDirty = true;
+
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                            RemoveEntry()                             */
+/************************************************************************/
+
+OGRErr OGRSortedAttrIndex::RemoveEntry(OGRField *psKey, GIntBig nFID)
+
+{
+    SortedIndexKey sKey;
+    if (psKey == nullptr || !BuildKey(psKey, sKey))
+        return OGRERR_NONE;
+
+    if (!LoadAllEntries())
+        return OGRERR_FAILURE;
+    SortEntries();
+
+    const auto oIter = std::lower_bound(
+        m_asEntries.begin(), m_asEntries.end(), nFID,
+        [this, &sKey](const SortedIndexEntry &sEntry, GIntBig nOtherFID)
+        {
+            const int nCmp = CompareKeys(sEntry.sKey, sKey);
+            return nCmp < 0 || (nCmp == 0 && sEntry.nFID < nOtherFID);
+        });
+    if (oIter != m_asEntries.end() && oIter->nFID == nFID &&
+        CompareKeys(oIter->sKey, sKey) == 0)
+    {
+        m_asEntries.erase(oIter);
+        m_poLIndex->m_bDirty = true;
+    }
+
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                               Clear()                                */
+/************************************************************************/
+
+OGRErr OGRSortedAttrIndex::Clear()
+
+{
+    m_asBlocks.clear();
+    m_asCachedBlockEntries.clear();
+    m_iCachedBlock = -1;
+    m_asEntries.clear();
+    m_bInMemory = true;
+    m_bSorted = true;
+    m_poLIndex->m_bDirty = true;
+
+    return OGRERR_NONE;
+}
+
+//! @endcond
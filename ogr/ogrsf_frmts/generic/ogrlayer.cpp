@@ -4374,19 +4374,66 @@ void OGR_L_ResetReading(OGRLayerH hLayer)
 /************************************************************************/
 
 //! @cond Doxygen_Suppress
-OGRErr
-OGRLayer::InitializeIndexSupport([[maybe_unused]] const char *pszFilename)
+OGRErr OGRLayer::InitializeIndexSupport(const char *pszFilename)
 
 {
-#ifdef HAVE_MITAB
-    OGRErr eErr;
-
     if (m_poAttrIndex != nullptr)
         return OGRERR_NONE;
 
-    m_poAttrIndex = OGRCreateDefaultLayerIndex();
+    // Drivers may pass the serialized MapInfo index configuration directly.
+    const bool bMIConfig =
+        STARTS_WITH_CI(pszFilename, "<OGRMILayerAttrIndex>");
 
-    eErr = m_poAttrIndex->Initialize(pszFilename, this);
+    /* -------------------------------------------------------------------- */
+    /*      Select the index format. In AUTO mode, existing indexes are     */
+    /*      opened in their own format, and new ones are created in the    */
+    /*      sorted .oidx format.                                            */
+    /* -------------------------------------------------------------------- */
+    const char *pszFormat =
+        CPLGetConfigOption("OGR_ATTR_INDEX_FORMAT", "AUTO");
+    bool bUseSorted = false;
+    if (bMIConfig)
+    {
+        bUseSorted = false;
+    }
+    else if (EQUAL(pszFormat, "SORTED"))
+    {
+        bUseSorted = true;
+    }
+    else if (EQUAL(pszFormat, "MAPINFO"))
+    {
+        bUseSorted = false;
+    }
+    else
+    {
+        if (!EQUAL(pszFormat, "AUTO"))
+        {
+            CPLError(CE_Warning, CPLE_NotSupported,
+                     "Unhandled value for OGR_ATTR_INDEX_FORMAT: %s",
+                     pszFormat);
+        }
+        VSIStatBufL sStat;
+        bUseSorted =
+            VSIStatL(CPLResetExtensionSafe(pszFilename, "oidx").c_str(),
+                     &sStat) == 0 ||
+            VSIStatL(CPLResetExtensionSafe(pszFilename, "idm").c_str(),
+                     &sStat) != 0;
+    }
+
+    if (bUseSorted)
+    {
+        m_poAttrIndex = OGRCreateSortedLayerIndex();
+    }
+    else
+    {
+#ifdef HAVE_MITAB
+        m_poAttrIndex = OGRCreateDefaultLayerIndex();
+#else
+        return OGRERR_FAILURE;
+#endif
+    }
+
+    const OGRErr eErr = m_poAttrIndex->Initialize(pszFilename, this);
     if (eErr != OGRERR_NONE)
     {
         delete m_poAttrIndex;
@@ -4394,9 +4441,36 @@ OGRLayer::InitializeIndexSupport([[maybe_unused]] const char *pszFilename)
     }
 
     return eErr;
-#else
-    return OGRERR_FAILURE;
-#endif
+}
+
+/************************************************************************/
+/*                      SetDeferredIndexPath()                          */
+/*                                                                      */
+/*      Record the path from which attribute indexes should be          */
+/*      looked for or created, without doing any I/O.  Index support    */
+/*      is then initialized on the first call to GetIndex().            */
+/************************************************************************/
+
+void OGRLayer::SetDeferredIndexPath(const char *pszFilename)
+{
+    m_poPrivate->m_osDeferredIndexPath = pszFilename ? pszFilename : "";
+}
+
+/************************************************************************/
+/*                              GetIndex()                              */
+/************************************************************************/
+
+OGRLayerAttrIndex *OGRLayer::GetIndex()
+{
+    if (m_poAttrIndex == nullptr &&
+        !m_poPrivate->m_osDeferredIndexPath.empty())
+    {
+        const std::string osPath =
+            std::move(m_poPrivate->m_osDeferredIndexPath);
+        m_poPrivate->m_osDeferredIndexPath.clear();
+        InitializeIndexSupport(osPath.c_str());
+    }
+    return m_poAttrIndex;
 }
 
 //! @endcond
@@ -40,6 +40,9 @@ struct OGRLayer::Private
 
     //! Whether OGRGeometry::SetPrecision() should be applied. Only valid after ConvertGeomsIfNecessary() has been called.
     bool m_bApplyGeomSetPrecision = false;
+
+    //! Path set by SetDeferredIndexPath(), until GetIndex() is called.
+    std::string m_osDeferredIndexPath{};
 };
 
 //! @endcond
@@ -5029,6 +5029,619 @@ static bool SetFieldForOtherFormats(OGRFeature &oFeature,
     return true;
 }
 
+/************************************************************************/
+/*                       ArrowColumnarFilter                            */
+/************************************************************************/
+
+namespace
+{
+
+/** Column-at-a-time evaluator of a subset of OGR SQL expressions
+ * (comparisons, AND/OR/NOT, IN, BETWEEN, LIKE, ILIKE, IS NULL) directly on
+ * the columns of an ArrowArray, without materializing OGRFeature objects.
+ *
+ * The logical value and null flag of each node are computed for all rows at
+ * once, following the same rules as SWQGeneralEvaluator().
+ * Evaluate() returns false if the expression contains constructs that are
+ * not handled, in which case the caller must fall back to the feature-based
+ * evaluation.
+ */
+class ArrowColumnarFilter
+{
+  public:
+    ArrowColumnarFilter(
+        const OGRFeatureDefn *poFeatureDefn,
+        const std::map<std::string, std::vector<int>> &oMapFieldNameToArrowPath,
+        const struct ArrowSchema *schema, const struct ArrowArray *array,
+        bool bUTF8Strings)
+        : m_poFeatureDefn(poFeatureDefn),
+          m_oMapFieldNameToArrowPath(oMapFieldNameToArrowPath),
+          m_schema(schema), m_array(array),
+          m_nLength(static_cast<size_t>(array->length)),
+          m_bUTF8Strings(bUTF8Strings)
+    {
+    }
+
+    //! Values are 0 or 1 for each row
+    struct Result
+    {
+        std::vector<uint8_t> abyValue{};
+        std::vector<uint8_t> abyNull{};
+    };
+
+    bool Evaluate(const swq_expr_node *poNode, Result &oRes);
+
+  private:
+    const OGRFeatureDefn *m_poFeatureDefn;
+    const std::map<std::string, std::vector<int>> &m_oMapFieldNameToArrowPath;
+    const struct ArrowSchema *m_schema;
+    const struct ArrowArray *m_array;
+    const size_t m_nLength;
+    const bool m_bUTF8Strings;
+
+    struct Column
+    {
+        const struct ArrowSchema *psSchema = nullptr;
+        const struct ArrowArray *psArray = nullptr;
+    };
+
+    bool GetColumn(const swq_expr_node *poNode, Column &oCol) const;
+    void FillNullFromValidity(const Column &oCol,
+                              std::vector<uint8_t> &abyNull) const;
+    bool GetColumnAsInt64(const Column &oCol,
+                          std::vector<int64_t> &anValues) const;
+    bool GetColumnAsDouble(const Column &oCol,
+                           std::vector<double> &adfValues) const;
+    bool EvaluateNumericPredicate(const swq_expr_node *poNode,
+                                  const Column &oCol, int nOp,
+                                  const std::vector<const swq_expr_node *> &,
+                                  Result &oRes) const;
+    bool EvaluateStringPredicate(const swq_expr_node *poNode,
+                                 const Column &oCol, int nOp,
+                                 const std::vector<const swq_expr_node *> &,
+                                 Result &oRes) const;
+
+    CPL_DISALLOW_COPY_ASSIGN(ArrowColumnarFilter)
+};
+
+/************************************************************************/
+/*                   ArrowColumnarFilter::GetColumn()                   */
+/************************************************************************/
+
+bool ArrowColumnarFilter::GetColumn(const swq_expr_node *poNode,
+                                    Column &oCol) const
+{
+    if (poNode->eNodeType != SNT_COLUMN || poNode->table_index > 0 ||
+        poNode->field_index < 0 ||
+        poNode->field_index >= m_poFeatureDefn->GetFieldCount())
+    {
+        // Special fields, geometry fields, etc. are not handled
+        return false;
+    }
+    const auto oIter = m_oMapFieldNameToArrowPath.find(
+        m_poFeatureDefn->GetFieldDefn(poNode->field_index)->GetNameRef());
+    if (oIter == m_oMapFieldNameToArrowPath.end())
+        return false;
+
+    const struct ArrowSchema *psSchema = m_schema;
+    const struct ArrowArray *psArray = m_array;
+    for (size_t i = 0; i < oIter->second.size(); ++i)
+    {
+        // Nulls in parent structures would require extra handling
+        if (i > 0 && psArray->null_count != 0)
+            return false;
+        psSchema = psSchema->children[oIter->second[i]];
+        psArray = psArray->children[oIter->second[i]];
+    }
+    if (psSchema->dictionary)
+        return false;
+    oCol.psSchema = psSchema;
+    oCol.psArray = psArray;
+    return true;
+}
+
+/************************************************************************/
+/*             ArrowColumnarFilter::FillNullFromValidity()              */
+/************************************************************************/
+
+void ArrowColumnarFilter::FillNullFromValidity(
+    const Column &oCol, std::vector<uint8_t> &abyNull) const
+{
+    abyNull.assign(m_nLength, 0);
+    const struct ArrowArray *psArray = oCol.psArray;
+    if (psArray->null_count == 0 || !psArray->buffers[0])
+        return;
+    const uint8_t *pabyValidity =
+        static_cast<const uint8_t *>(psArray->buffers[0]);
+    const size_t nOffset = static_cast<size_t>(psArray->offset);
+    for (size_t i = 0; i < m_nLength; ++i)
+        abyNull[i] = !TestBit(pabyValidity, i + nOffset);
+}
+
+/************************************************************************/
+/*                         CopyArrowValues()                            */
+/************************************************************************/
+
+template <class ArrowType, class DstType>
+static void CopyArrowValues(const struct ArrowArray *psArray, size_t nLength,
+                            std::vector<DstType> &aValues)
+{
+    const ArrowType *paValues =
+        static_cast<const ArrowType *>(psArray->buffers[1]) + psArray->offset;
+    aValues.resize(nLength);
+    for (size_t i = 0; i < nLength; ++i)
+        aValues[i] = static_cast<DstType>(paValues[i]);
+}
+
+/************************************************************************/
+/*               ArrowColumnarFilter::GetColumnAsInt64()                */
+/************************************************************************/
+
+bool ArrowColumnarFilter::GetColumnAsInt64(
+    const Column &oCol, std::vector<int64_t> &anValues) const
+{
+    const char *format = oCol.psSchema->format;
+    if (IsInt8(format))
+        CopyArrowValues<int8_t>(oCol.psArray, m_nLength, anValues);
+    else if (IsUInt8(format))
+        CopyArrowValues<uint8_t>(oCol.psArray, m_nLength, anValues);
+    else if (IsInt16(format))
+        CopyArrowValues<int16_t>(oCol.psArray, m_nLength, anValues);
+    else if (IsUInt16(format))
+        CopyArrowValues<uint16_t>(oCol.psArray, m_nLength, anValues);
+    else if (IsInt32(format))
+        CopyArrowValues<int32_t>(oCol.psArray, m_nLength, anValues);
+    else if (IsUInt32(format))
+        CopyArrowValues<uint32_t>(oCol.psArray, m_nLength, anValues);
+    else if (IsInt64(format))
+        CopyArrowValues<int64_t>(oCol.psArray, m_nLength, anValues);
+    else
+        return false;
+    return true;
+}
+
+/************************************************************************/
+/*               ArrowColumnarFilter::GetColumnAsDouble()               */
+/************************************************************************/
+
+bool ArrowColumnarFilter::GetColumnAsDouble(
+    const Column &oCol, std::vector<double> &adfValues) const
+{
+    const char *format = oCol.psSchema->format;
+    if (IsFloat32(format))
+        CopyArrowValues<float>(oCol.psArray, m_nLength, adfValues);
+    else if (IsFloat64(format))
+        CopyArrowValues<double>(oCol.psArray, m_nLength, adfValues);
+    else
+    {
+        std::vector<int64_t> anValues;
+        if (!GetColumnAsInt64(oCol, anValues))
+            return false;
+        adfValues.resize(m_nLength);
+        for (size_t i = 0; i < m_nLength; ++i)
+            adfValues[i] = static_cast<double>(anValues[i]);
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                        ComparePredicate()                            */
+/************************************************************************/
+
+template <class T>
+static void ComparePredicate(const std::vector<T> &aValues, int nOp,
+                             const std::vector<T> &aConstants,
+                             std::vector<uint8_t> &abyValue)
+{
+    const size_t nLength = aValues.size();
+    abyValue.resize(nLength);
+    const T *CPL_RESTRICT paValues = aValues.data();
+    uint8_t *CPL_RESTRICT pabyValue = abyValue.data();
+    switch (nOp)
+    {
+        case SWQ_EQ:
+        {
+            const T c = aConstants[0];
+            for (size_t i = 0; i < nLength; ++i)
+                pabyValue[i] = paValues[i] == c;
+            break;
+        }
+        case SWQ_NE:
+        {
+            const T c = aConstants[0];
+            for (size_t i = 0; i < nLength; ++i)
+                pabyValue[i] = paValues[i] != c;
+            break;
+        }
+        case SWQ_LT:
+        {
+            const T c = aConstants[0];
+            for (size_t i = 0; i < nLength; ++i)
+                pabyValue[i] = paValues[i] < c;
+            break;
+        }
+        case SWQ_LE:
+        {
+            const T c = aConstants[0];
+            for (size_t i = 0; i < nLength; ++i)
+                pabyValue[i] = paValues[i] <= c;
+            break;
+        }
+        case SWQ_GT:
+        {
+            const T c = aConstants[0];
+            for (size_t i = 0; i < nLength; ++i)
+                pabyValue[i] = paValues[i] > c;
+            break;
+        }
+        case SWQ_GE:
+        {
+            const T c = aConstants[0];
+            for (size_t i = 0; i < nLength; ++i)
+                pabyValue[i] = paValues[i] >= c;
+            break;
+        }
+        case SWQ_BETWEEN:
+        {
+            const T lo = aConstants[0];
+            const T hi = aConstants[1];
+            for (size_t i = 0; i < nLength; ++i)
+                pabyValue[i] = paValues[i] >= lo && paValues[i] <= hi;
+            break;
+        }
+        case SWQ_IN:
+        {
+            std::fill(abyValue.begin(), abyValue.end(), 0);
+            for (const T c : aConstants)
+            {
+                for (size_t i = 0; i < nLength; ++i)
+                    pabyValue[i] |= paValues[i] == c;
+            }
+            break;
+        }
+        default:
+            CPLAssert(false);
+            break;
+    }
+}
+
+/************************************************************************/
+/*           ArrowColumnarFilter::EvaluateNumericPredicate()            */
+/************************************************************************/
+
+bool ArrowColumnarFilter::EvaluateNumericPredicate(
+    const swq_expr_node *poNode, const Column &oCol, int nOp,
+    const std::vector<const swq_expr_node *> &apoConstants,
+    Result &oRes) const
+{
+    const swq_expr_node *poColNode = poNode->papoSubExpr[0];
+    if (poColNode->eNodeType != SNT_COLUMN)
+        poColNode = poNode->papoSubExpr[1];
+
+    bool bUseDouble = poColNode->field_type == SWQ_FLOAT;
+    for (const auto *poConstant : apoConstants)
+    {
+        if (poConstant->field_type == SWQ_FLOAT)
+            bUseDouble = true;
+        else if (!SWQ_IS_INTEGER(poConstant->field_type))
+            return false;
+    }
+
+    if (bUseDouble)
+    {
+        std::vector<double> adfConstants;
+        for (const auto *poConstant : apoConstants)
+        {
+            const double dfVal =
+                poConstant->field_type == SWQ_FLOAT
+                    ? poConstant->float_value
+                    : static_cast<double>(poConstant->int_value);
+            adfConstants.push_back(dfVal);
+        }
+        std::vector<double> adfValues;
+        if (!GetColumnAsDouble(oCol, adfValues))
+            return false;
+        ComparePredicate(adfValues, nOp, adfConstants, oRes.abyValue);
+    }
+    else
+    {
+        std::vector<int64_t> anConstants;
+        for (const auto *poConstant : apoConstants)
+            anConstants.push_back(poConstant->int_value);
+        std::vector<int64_t> anValues;
+        if (!GetColumnAsInt64(oCol, anValues))
+            return false;
+        ComparePredicate(anValues, nOp, anConstants, oRes.abyValue);
+    }
+    return true;
+}
+
+/************************************************************************/
+/*           ArrowColumnarFilter::EvaluateStringPredicate()             */
+/************************************************************************/
+
+bool ArrowColumnarFilter::EvaluateStringPredicate(
+    const swq_expr_node *poNode, const Column &oCol, int nOp,
+    const std::vector<const swq_expr_node *> &apoConstants,
+    Result &oRes) const
+{
+    const char *format = oCol.psSchema->format;
+    const bool bLargeString = IsLargeString(format);
+    if (!bLargeString && !IsString(format))
+        return false;
+
+    for (const auto *poConstant : apoConstants)
+    {
+        if (poConstant->field_type != SWQ_STRING ||
+            poConstant->string_value == nullptr)
+            return false;
+        // SWQGeneralEvaluator() has special rules to compare timestamps
+        // with and without explicit +00 timezone. Do not try to mimic them.
+        const size_t nLen = strlen(poConstant->string_value);
+        if (nOp == SWQ_EQ && nLen > 3 &&
+            (strcmp(poConstant->string_value + nLen - 3, "+00") == 0 ||
+             poConstant->string_value[nLen - 3] == ':'))
+        {
+            return false;
+        }
+    }
+
+    char chEscape = '\0';
+    bool bInsensitive = false;
+    if (nOp == SWQ_LIKE || nOp == SWQ_ILIKE)
+    {
+        if (poNode->nSubExprCount == 3)
+        {
+            if (poNode->papoSubExpr[2]->eNodeType != SNT_CONSTANT ||
+                poNode->papoSubExpr[2]->string_value == nullptr)
+                return false;
+            chEscape = poNode->papoSubExpr[2]->string_value[0];
+        }
+        bInsensitive =
+            nOp == SWQ_ILIKE ||
+            CPLTestBool(CPLGetConfigOption("OGR_SQL_LIKE_AS_ILIKE", "FALSE"));
+    }
+
+    const struct ArrowArray *psArray = oCol.psArray;
+    const size_t nOffset = static_cast<size_t>(psArray->offset);
+    const char *pachData = static_cast<const char *>(psArray->buffers[2]);
+    const uint32_t *panOffsets =
+        bLargeString ? nullptr
+                     : static_cast<const uint32_t *>(psArray->buffers[1]);
+    const uint64_t *panLargeOffsets =
+        bLargeString ? static_cast<const uint64_t *>(psArray->buffers[1])
+                     : nullptr;
+
+    oRes.abyValue.assign(m_nLength, 0);
+    std::string osVal;
+    for (size_t i = 0; i < m_nLength; ++i)
+    {
+        if (oRes.abyNull[i])
+            continue;
+        const size_t iRow = i + nOffset;
+        const size_t nStart = bLargeString
+                                  ? static_cast<size_t>(panLargeOffsets[iRow])
+                                  : panOffsets[iRow];
+        const size_t nEnd = bLargeString
+                                ? static_cast<size_t>(panLargeOffsets[iRow + 1])
+                                : panOffsets[iRow + 1];
+        // Use a nul-terminated string, as done by the feature-based path
+        osVal.assign(pachData + nStart, nEnd - nStart);
+        const char *pszVal = osVal.c_str();
+
+        bool bRes = false;
+        switch (nOp)
+        {
+            case SWQ_EQ:
+                bRes = strcasecmp(pszVal, apoConstants[0]->string_value) == 0;
+                break;
+            case SWQ_NE:
+                bRes = strcasecmp(pszVal, apoConstants[0]->string_value) != 0;
+                break;
+            case SWQ_LT:
+                bRes = strcasecmp(pszVal, apoConstants[0]->string_value) < 0;
+                break;
+            case SWQ_LE:
+                bRes = strcasecmp(pszVal, apoConstants[0]->string_value) <= 0;
+                break;
+            case SWQ_GT:
+                bRes = strcasecmp(pszVal, apoConstants[0]->string_value) > 0;
+                break;
+            case SWQ_GE:
+                bRes = strcasecmp(pszVal, apoConstants[0]->string_value) >= 0;
+                break;
+            case SWQ_BETWEEN:
+                bRes =
+                    strcasecmp(pszVal, apoConstants[0]->string_value) >= 0 &&
+                    strcasecmp(pszVal, apoConstants[1]->string_value) <= 0;
+                break;
+            case SWQ_IN:
+                for (const auto *poConstant : apoConstants)
+                {
+                    if (strcasecmp(pszVal, poConstant->string_value) == 0)
+                    {
+                        bRes = true;
+                        break;
+                    }
+                }
+                break;
+            case SWQ_LIKE:
+            case SWQ_ILIKE:
+                bRes = swq_test_like(pszVal, apoConstants[0]->string_value,
+                                     chEscape, bInsensitive,
+                                     m_bUTF8Strings) != 0;
+                break;
+            default:
+                return false;
+        }
+        oRes.abyValue[i] = bRes;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                  ArrowColumnarFilter::Evaluate()                     */
+/************************************************************************/
+
+bool ArrowColumnarFilter::Evaluate(const swq_expr_node *poNode, Result &oRes)
+{
+    if (poNode->eNodeType != SNT_OPERATION)
+        return false;
+
+    const int nOp = poNode->nOperation;
+    switch (nOp)
+    {
+        case SWQ_AND:
+        case SWQ_OR:
+        {
+            if (poNode->nSubExprCount != 2)
+                return false;
+            Result oOther;
+            if (!Evaluate(poNode->papoSubExpr[0], oRes) ||
+                !Evaluate(poNode->papoSubExpr[1], oOther))
+            {
+                return false;
+            }
+            uint8_t *CPL_RESTRICT pabyValue = oRes.abyValue.data();
+            uint8_t *CPL_RESTRICT pabyNull = oRes.abyNull.data();
+            const uint8_t *CPL_RESTRICT pabyOtherValue =
+                oOther.abyValue.data();
+            const uint8_t *CPL_RESTRICT pabyOtherNull = oOther.abyNull.data();
+            if (nOp == SWQ_AND)
+            {
+                for (size_t i = 0; i < m_nLength; ++i)
+                {
+                    pabyValue[i] &= pabyOtherValue[i];
+                    pabyNull[i] &= pabyOtherNull[i];
+                }
+            }
+            else
+            {
+                for (size_t i = 0; i < m_nLength; ++i)
+                {
+                    pabyValue[i] |= pabyOtherValue[i];
+                    pabyNull[i] |= pabyOtherNull[i];
+                }
+            }
+            return true;
+        }
+
+        case SWQ_NOT:
+        {
+            if (poNode->nSubExprCount != 1 ||
+                !Evaluate(poNode->papoSubExpr[0], oRes))
+            {
+                return false;
+            }
+            for (size_t i = 0; i < m_nLength; ++i)
+                oRes.abyValue[i] = !oRes.abyValue[i] && !oRes.abyNull[i];
+            return true;
+        }
+
+        case SWQ_ISNULL:
+        {
+            Column oCol;
+            if (poNode->nSubExprCount != 1 ||
+                !GetColumn(poNode->papoSubExpr[0], oCol))
+            {
+                return false;
+            }
+            FillNullFromValidity(oCol, oRes.abyValue);
+            oRes.abyNull.assign(m_nLength, 0);
+            return true;
+        }
+
+        case SWQ_EQ:
+        case SWQ_NE:
+        case SWQ_LT:
+        case SWQ_LE:
+        case SWQ_GT:
+        case SWQ_GE:
+        case SWQ_BETWEEN:
+        case SWQ_IN:
+        case SWQ_LIKE:
+        case SWQ_ILIKE:
+            break;
+
+        default:
+            return false;
+    }
+
+    if (poNode->nSubExprCount < 2)
+        return false;
+
+    // Identify the column and constant operands
+    int nEffectiveOp = nOp;
+    Column oCol;
+    const swq_expr_node *poColNode = poNode->papoSubExpr[0];
+    std::vector<const swq_expr_node *> apoConstants;
+    if (poColNode->eNodeType != SNT_COLUMN)
+    {
+        // "constant op column" comparisons
+        if (poNode->nSubExprCount != 2 || nOp == SWQ_IN || nOp == SWQ_LIKE ||
+            nOp == SWQ_ILIKE)
+            return false;
+        poColNode = poNode->papoSubExpr[1];
+        apoConstants.push_back(poNode->papoSubExpr[0]);
+        if (nOp == SWQ_LT)
+            nEffectiveOp = SWQ_GT;
+        else if (nOp == SWQ_LE)
+            nEffectiveOp = SWQ_GE;
+        else if (nOp == SWQ_GT)
+            nEffectiveOp = SWQ_LT;
+        else if (nOp == SWQ_GE)
+            nEffectiveOp = SWQ_LE;
+    }
+    else
+    {
+        // LIKE may have an extra ESCAPE operand
+        const int nConstants = nOp == SWQ_IN        ? poNode->nSubExprCount - 1
+                               : nOp == SWQ_BETWEEN ? 2
+                                                    : 1;
+        if (nOp != SWQ_IN && nOp != SWQ_LIKE && nOp != SWQ_ILIKE &&
+            poNode->nSubExprCount != nConstants + 1)
+            return false;
+        for (int i = 1; i <= nConstants; ++i)
+            apoConstants.push_back(poNode->papoSubExpr[i]);
+    }
+    for (const auto *poConstant : apoConstants)
+    {
+        if (poConstant->eNodeType != SNT_CONSTANT || poConstant->is_null)
+            return false;
+    }
+    if (!GetColumn(poColNode, oCol))
+        return false;
+
+    FillNullFromValidity(oCol, oRes.abyNull);
+
+    bool bOK;
+    if (poColNode->field_type == SWQ_STRING)
+    {
+        bOK = EvaluateStringPredicate(poNode, oCol, nEffectiveOp, apoConstants,
+                                      oRes);
+    }
+    else if ((SWQ_IS_INTEGER(poColNode->field_type) ||
+              poColNode->field_type == SWQ_FLOAT) &&
+             nOp != SWQ_LIKE && nOp != SWQ_ILIKE)
+    {
+        bOK = EvaluateNumericPredicate(poNode, oCol, nEffectiveOp,
+                                       apoConstants, oRes);
+    }
+    else
+    {
+        return false;
+    }
+    if (!bOK)
+        return false;
+
+    // Null operands result in a false value
+    for (size_t i = 0; i < m_nLength; ++i)
+        oRes.abyValue[i] &= static_cast<uint8_t>(!oRes.abyNull[i]);
+    return true;
+}
+
+}  // namespace
+
 /************************************************************************/
 /*                   FillValidityArrayFromAttrQuery()                   */
 /************************************************************************/
@@ -5047,6 +5660,33 @@ static size_t FillValidityArrayFromAttrQuery(
     BuildMapFieldNameToArrowPath(schema, oMapFieldNameToArrowPath,
                                  std::string(), anArrowPathTmp);
 
+    const size_t nLength = abyValidityFromFilters.size();
+
+    // Try first column-at-a-time evaluation of the expression.
+    // OGR_ARROW_COLUMNAR_FILTER=NO is mostly for testing purposes.
+    if (CPLTestBool(CPLGetConfigOption("OGR_ARROW_COLUMNAR_FILTER", "YES")))
+    {
+        ArrowColumnarFilter oFilter(
+            poFeatureDefn, oMapFieldNameToArrowPath, schema, array,
+            CPL_TO_BOOL(poLayer->TestCapability(OLCStringsAsUTF8)));
+        ArrowColumnarFilter::Result oRes;
+        if (oFilter.Evaluate(
+                static_cast<const swq_expr_node *>(poAttrQuery->GetSWQExpr()),
+                oRes))
+        {
+            for (size_t iRow = 0; iRow < nLength; ++iRow)
+            {
+                if (!abyValidityFromFilters[iRow])
+                    continue;
+                if (oRes.abyValue[iRow])
+                    nCountIntersecting++;
+                else
+                    abyValidityFromFilters[iRow] = false;
+            }
+            return nCountIntersecting;
+        }
+    }
+
     struct UsedFieldsInfo
     {
         int iOGRFieldIndex{};
@@ -5087,8 +5727,6 @@ static size_t FillValidityArrayFromAttrQuery(
         }
     }
 
-    const size_t nLength = abyValidityFromFilters.size();
-
     GIntBig nBaseSeqFID = -1;
     std::vector<int> anArrowPathToFIDColumn;
     if (bNeedsFID)
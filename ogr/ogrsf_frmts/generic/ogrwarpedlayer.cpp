@@ -12,9 +12,14 @@
 
 #ifndef DOXYGEN_SKIP
 
+#include <algorithm>
+#include <cerrno>
 #include <cmath>
 
 #include "ogrwarpedlayer.h"
+#include "ogrlayerarrow.h"
+#include "ogr_wkb.h"
+#include "cpl_worker_thread_pool.h"
 
 /************************************************************************/
 /*                           OGRWarpedLayer()                           */
@@ -543,7 +548,7 @@ int OGRWarpedLayer::TestCapability(const char *pszCapability) const
     int bVal = m_poDecoratedLayer->TestCapability(pszCapability);
 
     if (EQUAL(pszCapability, OLCFastGetArrowStream))
-        return false;
+        return CanUseFastArrowStream();
 
     if (EQUAL(pszCapability, OLCFastSpatialFilter) ||
         EQUAL(pszCapability, OLCRandomWrite) ||
@@ -574,6 +579,265 @@ void OGRWarpedLayer::SetExtent(double dfXMin, double dfYMin, double dfXMax,
     sStaticEnvelope.MaxY = dfYMax;
 }
 
+/************************************************************************/
+/*                       CanUseFastArrowStream()                        */
+/************************************************************************/
+
+// Whether GetArrowStream() can reproject the batches of the fast
+// GetArrowStream() implementation of the decorated layer, instead of
+// going through GetNextFeature().
+bool OGRWarpedLayer::CanUseFastArrowStream() const
+{
+    return m_poFilterGeom == nullptr && m_poAttrQuery == nullptr &&
+           m_iGeomField <
+               m_poDecoratedLayer->GetLayerDefn()->GetGeomFieldCount() &&
+           m_poDecoratedLayer->TestCapability(OLCFastGetArrowStream) &&
+           OGRGeometryFactory::isTransformWithOptionsRegularTransform(
+               m_poCT->GetSourceCS(), m_poCT->GetTargetCS(), nullptr);
+}
+
+namespace
+{
+
+/************************************************************************/
+/*                     OGRWarpedLayerGeomArrayData                      */
+/************************************************************************/
+
+// Private data of a WKB geometry ArrowArray whose data buffer, and
+// possibly validity buffer, have been substituted with reprojected ones.
+struct OGRWarpedLayerGeomArrayData
+{
+    const void *m_pOriValidity = nullptr;
+    const void *m_pOriData = nullptr;
+    void *m_pOriPrivateData = nullptr;
+    void (*m_pfnOriRelease)(struct ArrowArray *) = nullptr;
+    std::vector<GByte> m_abyValidity{};
+    std::vector<GByte> m_abyWKB{};
+
+    static void Release(struct ArrowArray *psArray)
+    {
+        auto poData =
+            static_cast<OGRWarpedLayerGeomArrayData *>(psArray->private_data);
+        psArray->buffers[0] = poData->m_pOriValidity;
+        psArray->buffers[2] = poData->m_pOriData;
+        psArray->private_data = poData->m_pOriPrivateData;
+        psArray->release = poData->m_pfnOriRelease;
+        delete poData;
+        if (psArray->release)
+            psArray->release(psArray);
+    }
+};
+
+/************************************************************************/
+/*                      OGRWarpedLayerArrowStream                       */
+/************************************************************************/
+
+// Private data of the ArrowArrayStream returned by
+// OGRWarpedLayer::GetArrowStream() when the decorated layer has a fast
+// implementation of it. Each batch is reprojected by transforming in place
+// a copy of its WKB geometry column, possibly with several threads.
+struct OGRWarpedLayerArrowStream
+{
+    OGRArrowArrayStream m_oSrcStream{};
+    OGRCoordinateTransformation *m_poCT = nullptr;
+    int m_iArrowGeomField = -1;
+    int m_nNumThreads = 1;
+    std::unique_ptr<CPLWorkerThreadPool> m_poThreadPool{};
+    std::vector<std::unique_ptr<OGRCoordinateTransformation>> m_apoCT{};
+    std::string m_osLastError{};
+
+    bool Reproject(struct ArrowArray *psGeomArray);
+
+    static int GetSchema(struct ArrowArrayStream *stream,
+                         struct ArrowSchema *out_schema)
+    {
+        auto poThis =
+            static_cast<OGRWarpedLayerArrowStream *>(stream->private_data);
+        return poThis->m_oSrcStream.get_schema(out_schema);
+    }
+
+    static int GetNext(struct ArrowArrayStream *stream,
+                       struct ArrowArray *out_array)
+    {
+        auto poThis =
+            static_cast<OGRWarpedLayerArrowStream *>(stream->private_data);
+        poThis->m_osLastError.clear();
+        const int ret = poThis->m_oSrcStream.get_next(out_array);
+        if (ret != 0 || out_array->release == nullptr)
+            return ret;
+        if (poThis->m_iArrowGeomField >= out_array->n_children ||
+            !poThis->Reproject(out_array->children[poThis->m_iArrowGeomField]))
+        {
+            if (poThis->m_osLastError.empty())
+                poThis->m_osLastError = "Reprojection failed";
+            out_array->release(out_array);
+            return EIO;
+        }
+        return 0;
+    }
+
+    static const char *GetLastError(struct ArrowArrayStream *stream)
+    {
+        auto poThis =
+            static_cast<OGRWarpedLayerArrowStream *>(stream->private_data);
+        if (!poThis->m_osLastError.empty())
+            return poThis->m_osLastError.c_str();
+        auto psSrcStream = poThis->m_oSrcStream.get();
+        return psSrcStream->get_last_error(psSrcStream);
+    }
+
+    static void Release(struct ArrowArrayStream *stream)
+    {
+        delete static_cast<OGRWarpedLayerArrowStream *>(stream->private_data);
+        stream->private_data = nullptr;
+        stream->release = nullptr;
+    }
+};
+
+/************************************************************************/
+/*                 OGRWarpedLayerArrowStream::Reproject()               */
+/************************************************************************/
+
+bool OGRWarpedLayerArrowStream::Reproject(struct ArrowArray *psGeomArray)
+{
+    const size_t nLength = static_cast<size_t>(psGeomArray->length);
+    if (nLength == 0)
+        return true;
+    const size_t nOffset = static_cast<size_t>(psGeomArray->offset);
+    const GByte *pabyValidity =
+        static_cast<const GByte *>(psGeomArray->buffers[0]);
+    const uint32_t *panOffsets =
+        static_cast<const uint32_t *>(psGeomArray->buffers[1]) + nOffset;
+
+    auto poData = std::make_unique<OGRWarpedLayerGeomArrayData>();
+    std::vector<GByte> abyFailed;
+    try
+    {
+        const GByte *pabySrcWKB =
+            static_cast<const GByte *>(psGeomArray->buffers[2]);
+        poData->m_abyWKB.assign(pabySrcWKB, pabySrcWKB + panOffsets[nLength]);
+        abyFailed.resize(nLength);
+    }
+    catch (const std::exception &)
+    {
+        m_osLastError = "Out of memory";
+        return false;
+    }
+
+    const auto Transform =
+        [pabyValidity, panOffsets, nOffset, &poData,
+         &abyFailed](size_t iStart, size_t iEnd,
+                     OGRCoordinateTransformation *poCT)
+    {
+        OGRWKBTransformCache oCache;
+        OGREnvelope3D sEnv3D;
+        for (size_t i = iStart; i < iEnd; ++i)
+        {
+            const size_t iShifted = i + nOffset;
+            if (pabyValidity &&
+                (pabyValidity[iShifted / 8] & (1 << (iShifted % 8))) == 0)
+            {
+                continue;
+            }
+            if (!OGRWKBTransform(poData->m_abyWKB.data() + panOffsets[i],
+                                 panOffsets[i + 1] - panOffsets[i], poCT,
+                                 oCache, sEnv3D))
+            {
+                abyFailed[i] = true;
+            }
+        }
+    };
+
+    // Somewhat arbitrary threshold below which threading is not worth it
+    constexpr size_t MIN_FEATURES_PER_THREAD = 1000;
+    const int nThreads = static_cast<int>(std::min<size_t>(
+        m_nNumThreads, nLength / MIN_FEATURES_PER_THREAD));
+    if (nThreads >= 2)
+    {
+        if (!m_poThreadPool)
+        {
+            m_poThreadPool = std::make_unique<CPLWorkerThreadPool>();
+            if (!m_poThreadPool->Setup(m_nNumThreads, nullptr, nullptr))
+            {
+                m_osLastError = "Cannot create thread pool";
+                return false;
+            }
+        }
+        while (static_cast<int>(m_apoCT.size()) < nThreads)
+        {
+            m_apoCT.emplace_back(m_poCT->Clone());
+            if (!m_apoCT.back())
+            {
+                m_apoCT.pop_back();
+                m_osLastError = "Cannot clone OGRCoordinateTransformation";
+                return false;
+            }
+        }
+        auto poJobQueue = m_poThreadPool->CreateJobQueue();
+        for (int iThread = 0; iThread < nThreads; ++iThread)
+        {
+            const size_t iStart = iThread * nLength / nThreads;
+            const size_t iEnd = (iThread + 1) * nLength / nThreads;
+            auto poCT = m_apoCT[iThread].get();
+            poJobQueue->SubmitJob([&Transform, iStart, iEnd, poCT]()
+                                  { Transform(iStart, iEnd, poCT); });
+        }
+        poJobQueue->WaitCompletion();
+    }
+    else
+    {
+        Transform(0, nLength, m_poCT);
+    }
+
+    // As in SrcFeatureToWarpedFeature(), geometries that cannot be
+    // reprojected are set to null.
+    size_t nFailed = 0;
+    for (size_t i = 0; i < nLength; ++i)
+    {
+        if (abyFailed[i])
+        {
+            const size_t iShifted = i + nOffset;
+            if (nFailed == 0)
+            {
+                const size_t nValiditySize = (nOffset + nLength + 7) / 8;
+                try
+                {
+                    if (pabyValidity)
+                        poData->m_abyValidity.assign(
+                            pabyValidity, pabyValidity + nValiditySize);
+                    else
+                        poData->m_abyValidity.resize(nValiditySize, 0xFF);
+                }
+                catch (const std::exception &)
+                {
+                    m_osLastError = "Out of memory";
+                    return false;
+                }
+            }
+            poData->m_abyValidity[iShifted / 8] &=
+                static_cast<GByte>(~(1 << (iShifted % 8)));
+            ++nFailed;
+        }
+    }
+
+    poData->m_pOriValidity = psGeomArray->buffers[0];
+    poData->m_pOriData = psGeomArray->buffers[2];
+    poData->m_pOriPrivateData = psGeomArray->private_data;
+    poData->m_pfnOriRelease = psGeomArray->release;
+    if (nFailed)
+    {
+        psGeomArray->buffers[0] = poData->m_abyValidity.data();
+        if (psGeomArray->null_count >= 0)
+            psGeomArray->null_count += static_cast<int64_t>(nFailed);
+    }
+    psGeomArray->buffers[2] = poData->m_abyWKB.data();
+    psGeomArray->private_data = poData.release();
+    psGeomArray->release = OGRWarpedLayerGeomArrayData::Release;
+    return true;
+}
+
+}  // namespace
+
 /************************************************************************/
 /*                           GetArrowStream()                           */
 /************************************************************************/
@@ -581,6 +845,75 @@ void OGRWarpedLayer::SetExtent(double dfXMin, double dfYMin, double dfXMax,
 bool OGRWarpedLayer::GetArrowStream(struct ArrowArrayStream *out_stream,
                                     CSLConstList papszOptions)
 {
+    const char *pszGeomEncoding =
+        CSLFetchNameValueDef(papszOptions, "GEOMETRY_ENCODING", "WKB");
+    if (EQUAL(pszGeomEncoding, "WKB") && CanUseFastArrowStream())
+    {
+        auto poStream = std::make_unique<OGRWarpedLayerArrowStream>();
+        if (!m_poDecoratedLayer->GetArrowStream(poStream->m_oSrcStream.get(),
+                                                papszOptions))
+        {
+            return false;
+        }
+
+        // Identify the geometry column to reproject, and check that it is
+        // encoded as WKB with 32-bit offsets.
+        const char *pszGeomFieldName = m_poDecoratedLayer->GetLayerDefn()
+                                           ->GetGeomFieldDefn(m_iGeomField)
+                                           ->GetNameRef();
+        if (pszGeomFieldName[0] == '\0')
+            pszGeomFieldName = DEFAULT_ARROW_GEOMETRY_NAME;
+        struct ArrowSchema sSchema;
+        if (poStream->m_oSrcStream.get_schema(&sSchema) == 0)
+        {
+            for (int i = 0; i < static_cast<int>(sSchema.n_children); ++i)
+            {
+                const auto psChild = sSchema.children[i];
+                if (strcmp(psChild->name, pszGeomFieldName) == 0)
+                {
+                    if (strcmp(psChild->format, "z") == 0 &&
+                        psChild->metadata)
+                    {
+                        const auto oMetadata =
+                            OGRParseArrowMetadata(psChild->metadata);
+                        const auto oIter =
+                            oMetadata.find(ARROW_EXTENSION_NAME_KEY);
+                        if (oIter != oMetadata.end() &&
+                            oIter->second == EXTENSION_NAME_OGC_WKB)
+                        {
+                            poStream->m_iArrowGeomField = i;
+                        }
+                    }
+                    break;
+                }
+            }
+            sSchema.release(&sSchema);
+        }
+
+        if (poStream->m_iArrowGeomField >= 0)
+        {
+            poStream->m_poCT = m_poCT.get();
+            const char *pszNumThreads =
+                CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+            if (pszNumThreads)
+            {
+                poStream->m_nNumThreads =
+                    EQUAL(pszNumThreads, "ALL_CPUS")
+                        ? CPLGetNumCPUs()
+                        : std::clamp(atoi(pszNumThreads), 1, 1024);
+            }
+
+            memset(out_stream, 0, sizeof(*out_stream));
+            out_stream->get_schema = OGRWarpedLayerArrowStream::GetSchema;
+            out_stream->get_next = OGRWarpedLayerArrowStream::GetNext;
+            out_stream->get_last_error =
+                OGRWarpedLayerArrowStream::GetLastError;
+            out_stream->release = OGRWarpedLayerArrowStream::Release;
+            out_stream->private_data = poStream.release();
+            return true;
+        }
+    }
+
     return OGRLayer::GetArrowStream(out_stream, papszOptions);
 }
 
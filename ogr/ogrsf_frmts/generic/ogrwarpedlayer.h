@@ -56,6 +56,8 @@ class CPL_DLL OGRWarpedLayer final : public OGRLayerDecorator,
     std::unique_ptr<OGRFeature>
     WarpedFeatureToSrcFeature(std::unique_ptr<OGRFeature> poFeature);
 
+    bool CanUseFastArrowStream() const;
+
   public:
     OGRWarpedLayer(OGRLayer *poDecoratedLayer, int iGeomField,
                    int bTakeLayerOwnership,
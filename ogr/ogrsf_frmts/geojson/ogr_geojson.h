@@ -16,6 +16,7 @@
 
 #include "cpl_port.h"
 #include "ogrsf_frmts.h"
+#include "ogr_attrind.h"
 #include "memdataset.h"
 
 #include <cstdio>
@@ -145,6 +146,7 @@ class OGRGeoJSONLayer final : public OGRMemLayer
     bool bOriginalIdModified_;
     GIntBig nTotalFeatureCount_;
     GIntBig nFeatureReadSinceReset_ = 0;
+    OGRAttrIndexFIDCursor m_oAttrIndexCursor{};
     bool m_bSupportsMGeometries = false;
     bool m_bSupportsZGeometries = true;
 
@@ -218,6 +218,14 @@ int OGRGeoJSONDataSource::Open(GDALOpenInfo *poOpenInfo,
     SetDescription(poOpenInfo->pszFilename);
     LoadLayers(poOpenInfo, nSrcType, pszUnprefixed, pszJSonFlavor);
 
+    // Attribute indexes are looked for in a .oidx sidecar file, only
+    // when an attribute filter is set or CREATE INDEX is issued.
+    if (eGeoJSONSourceFile == nSrcType && nLayers_ == 1 &&
+        !STARTS_WITH(pszUnprefixed, "/vsistdin/"))
+    {
+        papoLayers_[0]->SetDeferredIndexPath(pszUnprefixed);
+    }
+
     if (!DealWithOgrSchemaOpenOption(poOpenInfo))
     {
         Clear();
@@ -114,6 +114,7 @@ void OGRGeoJSONLayer::SetFIDColumn(const char *pszFIDColumn)
 void OGRGeoJSONLayer::ResetReading()
 {
     nFeatureReadSinceReset_ = 0;
+    m_oAttrIndexCursor.Reset();
     if (poReader_)
     {
         TerminateAppendSession();
@@ -129,6 +130,29 @@ void OGRGeoJSONLayer::ResetReading()
 
 OGRFeature *OGRGeoJSONLayer::GetNextFeature()
 {
+    // Use the attribute index (.oidx sidecar) if there is one that can
+    // resolve the attribute filter. This requires GetFeature() not to
+    // alter the filters, which is the case unless we are in update mode
+    // with the streaming reader.
+    if (m_poAttrQuery != nullptr && (!poReader_ || !IsUpdatable()) &&
+        m_oAttrIndexCursor.Evaluate(this, m_poAttrQuery))
+    {
+        while (OGRFeature *poFeature =
+                   m_oAttrIndexCursor.GetNextFeature(this))
+        {
+            if ((m_poFilterGeom == nullptr ||
+                 FilterGeometry(
+                     poFeature->GetGeomFieldRef(m_iGeomFieldFilter))) &&
+                m_poAttrQuery->Evaluate(poFeature))
+            {
+                nFeatureReadSinceReset_++;
+                return poFeature;
+            }
+            delete poFeature;
+        }
+        return nullptr;
+    }
+
     if (poReader_)
     {
         if (bHasAppendedFeatures_)
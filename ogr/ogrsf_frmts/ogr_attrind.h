@@ -40,6 +40,14 @@ class CPL_DLL OGRAttrIndex
     virtual OGRErr RemoveEntry(OGRField *psKey, GIntBig nFID) = 0;
 
     virtual OGRErr Clear() = 0;
+
+    virtual bool SupportsRangeQueries() const;
+
+    // psMin and/or psMax may be null for an unbounded range.
+    virtual GIntBig *GetRangeMatches(const OGRField *psMin, bool bMinIncluded,
+                                     const OGRField *psMax, bool bMaxIncluded,
+                                     GIntBig *panFIDList, int *nFIDCount,
+                                     int *nLength);
 };
 
 /************************************************************************/
@@ -74,6 +82,34 @@ class CPL_DLL OGRLayerAttrIndex
 };
 
 OGRLayerAttrIndex CPL_DLL *OGRCreateDefaultLayerIndex();
+OGRLayerAttrIndex CPL_DLL *OGRCreateSortedLayerIndex();
+
+/************************************************************************/
+/*                        OGRAttrIndexFIDCursor                         */
+/*                                                                      */
+/*      Helper for drivers whose GetFeature() is cheap (or at least     */
+/*      cheap when called with increasing FIDs) to iterate over the     */
+/*      features selected by an attribute index.                        */
+/************************************************************************/
+
+class CPL_DLL OGRAttrIndexFIDCursor
+{
+    GIntBig *m_panFIDs = nullptr;
+    GIntBig m_nFIDCount = 0;
+    GIntBig m_iNextFID = 0;
+    bool m_bEvaluated = false;
+    bool m_bFetching = false;
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRAttrIndexFIDCursor)
+
+  public:
+    OGRAttrIndexFIDCursor() = default;
+    ~OGRAttrIndexFIDCursor();
+
+    void Reset();
+    bool Evaluate(OGRLayer *poLayer, OGRFeatureQuery *poAttrQuery);
+    OGRFeature *GetNextFeature(OGRLayer *poLayer);
+};
 
 //! @endcond
 
@@ -368,11 +368,9 @@ class CPL_DLL OGRLayer : public GDALMajorObject
 
     /* consider these private */
     OGRErr InitializeIndexSupport(const char *);
+    void SetDeferredIndexPath(const char *);
 
-    OGRLayerAttrIndex *GetIndex()
-    {
-        return m_poAttrIndex;
-    }
+    OGRLayerAttrIndex *GetIndex();
 
     int GetGeomFieldFilter() const
     {
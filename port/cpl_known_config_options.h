@@ -140,6 +140,8 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "CPL_VSIL_CURL_AUTHORIZATION_HEADER_ALLOWED_IF_REDIRECT", // from cpl_http.cpp, cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_CACHE_SIZE", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_CHUNK_SIZE", // from cpl_vsil_curl.cpp
+   "CPL_VSIL_CURL_DISK_CACHE_DIR", // from cpl_vsil_curl_disk_cache.cpp
+   "CPL_VSIL_CURL_DISK_CACHE_SIZE", // from cpl_vsil_curl_disk_cache.cpp
    "CPL_VSIL_CURL_HONOR_CACHE_CONTROL", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_IGNORE_GLACIER_STORAGE", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_IGNORE_STORAGE_CLASSES", // from cpl_vsil_curl.cpp
@@ -165,6 +167,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "CPL_VSISTDIN_FILE", // from cpl_vsil_stdin.cpp
    "CPL_VSISTDIN_FILE_CLOSE", // from cpl_vsil_stdin.cpp
    "CPL_VSISTDIN_RESET_POSITION", // from cpl_vsil_stdin.cpp
+   "CPL_WORKER_THREAD_POOL_WORK_STEALING", // from cpl_worker_thread_pool.cpp
    "CPL_ZIP_ENCODING", // from cpl_minizip_unzip.cpp, cpl_minizip_zip.cpp
    "CREATE_GEOMETRY_COLUMNS", // from ogrgeopackagedatasource.cpp
    "CREATE_RASTER_TABLES", // from ogrgeopackagedatasource.cpp
@@ -238,7 +241,9 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GDAL_BAND_BLOCK_CACHE", // from gdalrasterband.cpp
    "GDAL_CACHE_DIRECTORY", // from gdal_misc.cpp
    "GDAL_CACHEMAX", // from gdalrasterblock.cpp, nearblack_bin.cpp
+   "GDAL_COMPUTED_RASTER_BAND_FUSED", // from gdalcomputedrasterband.cpp
    "GDAL_CONFIG_FILE", // from cpl_conv.cpp
+   "GDAL_COPY_WHOLE_RASTER_OVERLAP_IO", // from rasterio.cpp
    "GDAL_CURL_CA_BUNDLE", // from cpl_http.cpp
    "GDAL_DAAS_ACCESS_TOKEN", // from daasdataset.cpp
    "GDAL_DAAS_API_KEY", // from daasdataset.cpp
@@ -251,6 +256,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GDAL_DAAS_SERVER_BYTE_LIMIT", // from daasdataset.cpp
    "GDAL_DAAS_X_FORWARDED_USER", // from daasdataset.cpp
    "GDAL_DATA", // from cpl_csv.cpp, cpl_findfile.cpp, gdaldrivermanager.cpp
+   "GDAL_DATASET_POOL_THREAD_SAFE", // from gdalproxypool.cpp
    "GDAL_DEBUG_BLOCK_CACHE", // from gdalrasterblock.cpp
    "GDAL_DEBUG_CPU_COUNT", // from gdalalgorithm.cpp
    "GDAL_DEBUG_PROCESS_DYNAMIC_METADATA", // from gdaljp2metadata.cpp
@@ -278,6 +284,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GDAL_FORCE_CACHING", // from gdaldataset.cpp, gdalrasterband.cpp
    "GDAL_GCPS_TO_GEOTRANSFORM_APPROX_OK", // from gdal_misc.cpp
    "GDAL_GCPS_TO_GEOTRANSFORM_APPROX_THRESHOLD", // from gdal_misc.cpp
+   "GDAL_GEOLOC_BACKMAP_CACHE_DIR", // from gdalgeoloc.cpp
    "GDAL_GEOLOC_BACKMAP_OVERSAMPLE_FACTOR", // from gdalgeoloc.cpp
    "GDAL_GEOLOC_INVERSE_METHOD", // from gdalgeoloc.cpp
    "GDAL_GEOLOC_USE_MAX_ACCURACY", // from gdalgeoloc.cpp
@@ -350,7 +357,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GDAL_NETCDF_REPORT_EXTRA_DIM_VALUES", // from netcdfdataset.cpp
    "GDAL_NETCDF_VERIFY_DIMS", // from netcdfdataset.cpp
    "GDAL_NO_COSTLY_OVERVIEW", // from rasterio.cpp
-   "GDAL_NUM_THREADS", // from avifdataset.cpp, common.cpp, cpl_vsil_gzip.cpp, gdal_tps.cpp, gdalalgorithm.cpp, gdaldataset.cpp, gdalgrid.cpp, gdalpansharpen.cpp, gdalrasterband.cpp, gdaltileindexdataset.cpp, gdalwarpkernel.cpp, gtiffdataset_write.cpp, jpegxl.cpp, libertiffdataset.cpp, ogr2ogr_lib.cpp, ogrmvtdataset.cpp, ogrparquetlayer.cpp, osm_parser.cpp, overview.cpp, rmfdataset.cpp, vrtdataset.cpp, zarr_array.cpp
+   "GDAL_NUM_THREADS", // from avifdataset.cpp, common.cpp, contour.cpp, cpl_vsil_gzip.cpp, gdal_tps.cpp, gdalalg_vector_pipeline.cpp, gdalalgorithm.cpp, gdalcomputedrasterband.cpp, gdaldataset.cpp, gdalgeoloc.cpp, gdalgrid.cpp, gdalpansharpen.cpp, gdalrasterband.cpp, gdaltileindexdataset.cpp, gdalwarpkernel.cpp, gtiffdataset_write.cpp, jpegxl.cpp, libertiffdataset.cpp, ogr2ogr_lib.cpp, ogrmvtdataset.cpp, ogrparquetlayer.cpp, ogrwarpedlayer.cpp, osm_parser.cpp, overview.cpp, rasterio.cpp, rmfdataset.cpp, viewshed.cpp, vrtdataset.cpp, zarr_array.cpp
    "GDAL_OGCAPI_TILEMATRIXSET_LIMITS", // from gdalogcapidataset.cpp
    "GDAL_ONE_BIG_READ", // from jp2kakdataset.cpp, jpipkakdataset.cpp, mrsiddataset.cpp, rawdataset.cpp, wcsdataset.cpp
    "GDAL_OPEN_AFTER_COPY", // from jpgdataset.cpp, pngdataset.cpp
@@ -422,6 +429,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GDAL_TIFF_OVR_BLOCKSIZE", // from geotiff.cpp
    "GDAL_TRY_PDS3_WITH_VICAR", // from pdsdrivercore.cpp
    "GDAL_USE_AVX", // from gdalgrid.cpp
+   "GDAL_USE_AVX2", // from cpl_cpu_features.cpp
    "GDAL_USE_GEOJP2", // from gdaljp2metadata.cpp
    "GDAL_USE_GMLJP2", // from gdaljp2metadata.cpp
    "GDAL_USE_SSE", // from gdalgrid.cpp
@@ -430,6 +438,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GDAL_VECTOR_CONCAT_MAX_OPENED_DATASETS", // from gdalalg_vector_concat.cpp
    "GDAL_VRT_ENABLE_PYTHON", // from vrtderivedrasterband.cpp
    "GDAL_VRT_ENABLE_RAWRASTERBAND", // from vrtdataset.cpp
+   "GDAL_VRT_EXPRESSION_VECTORIZED", // from pixelfunctions.cpp
    "GDAL_VRT_PYTHON_EXCLUSIVE_LOCK", // from vrtderivedrasterband.cpp
    "GDAL_VRT_PYTHON_TRUSTED_MODULES", // from vrtderivedrasterband.cpp
    "GDAL_VRT_RAWRASTERBAND_ALLOWED_SOURCE", // from vrtrawrasterband.cpp
@@ -695,6 +704,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "ODBC_OGR_FID", // from ogrodbclayer.cpp
    "ODS_RESOLVE_FORMULAS", // from ogrodsdatasource.cpp
    "OGR2OGR_MIN_FEATURES_FOR_THREADED_REPROJ", // from ogr2ogr_lib.cpp
+   "OGR2OGR_PIPELINE_BATCH_SIZE", // from ogr2ogr_lib.cpp
    "OGR2OGR_USE_ARROW_API", // from ogr2ogr_lib.cpp
    "OGR_ADBC_AUTO_LOAD_DUCKDB_SPATIAL", // from ogradbcdataset.cpp
    "OGR_API_SPY_FILE", // from ograpispy.cpp
@@ -702,6 +712,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "OGR_APPLY_GEOM_SET_PRECISION", // from ogr2ogr_lib.cpp, ogrlayer.cpp
    "OGR_ARC_MAX_GAP", // from ogrgeometryfactory.cpp
    "OGR_ARC_STEPSIZE", // from ogrgeometryfactory.cpp
+   "OGR_ARROW_COLUMNAR_FILTER", // from ogrlayerarrow.cpp
    "OGR_ARROW_COMPUTE_GEOMETRY_TYPE", // from ogrfeatherlayer.cpp
    "OGR_ARROW_LOAD_FILE_SYSTEM_FACTORIES", // from ogrfeatherdriver.cpp
    "OGR_ARROW_MEM_LIMIT", // from ograrrowarrayhelper.cpp
@@ -712,6 +723,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "OGR_ARROW_WRITE_GDAL_FOOTER", // from ogrfeatherwriterlayer.cpp
    "OGR_ARROW_WRITE_GDAL_GEOMETRY_TYPE", // from ogrfeatherwriterlayer.cpp
    "OGR_ARROW_WRITE_GEO", // from ogrfeatherwriterlayer.cpp
+   "OGR_ATTR_INDEX_FORMAT", // from ogrlayer.cpp
    "OGR_CSV_MAX_FIELD_COUNT", // from ogrcsvlayer.cpp
    "OGR_CSV_MAX_LINE_SIZE", // from ogrcsvdatasource.cpp
    "OGR_CSV_SIMULATE_VSISTDIN", // from ogrcsvlayer.cpp
@@ -824,7 +836,11 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "OGR_SHAPE_PACK_IN_PLACE", // from ogrshapedatasource.cpp, ogrshapelayer.cpp
    "OGR_SHAPE_USE_VSIMEM_FOR_TEMP", // from ogrshapedatasource.cpp
    "OGR_SKIP", // from gdaldrivermanager.cpp
-   "OGR_SQL_LIKE_AS_ILIKE", // from ogrwfsfilter.cpp, swq_op_general.cpp
+   "OGR_SQL_JOIN_HASH", // from ogr_gensql.cpp
+   "OGR_SQL_JOIN_HASH_MAX_MEMORY", // from ogr_gensql.cpp
+   "OGR_SQL_LIKE_AS_ILIKE", // from ogrlayerarrow.cpp, ogrwfsfilter.cpp, swq_op_general.cpp
+   "OGR_SQL_ORDER_BY_EXTERNAL_SORT", // from ogr_gensql.cpp
+   "OGR_SQL_ORDER_BY_MAX_MEMORY", // from ogr_gensql.cpp
    "OGR_SQL_STRICT", // from swq.cpp
    "OGR_SQLITE_ALLOW_EXTERNAL_ACCESS", // from ogrsqlitesqlfunctionscommon.cpp
    "OGR_SQLITE_CACHE", // from ogrgmldatasource.cpp, ogrsqlitedatasource.cpp
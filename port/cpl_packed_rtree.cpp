@@ -0,0 +1,642 @@
+/******************************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Packed static R-tree, bulk loaded with the Sort-Tile-Recursive
+ *           algorithm
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_port.h"
+#include "cpl_packed_rtree.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "cpl_conv.h"
+#include "cpl_error.h"
+#include "cpl_worker_thread_pool.h"
+
+constexpr int DEFAULT_NODE_CAPACITY = 16;
+
+namespace
+{
+// Only used while building the tree
+struct CPLPackedRTreeItem
+{
+    CPLRectObj sBounds;
+    void *hFeature;
+};
+
+// Bounds rounded outwards to single precision
+struct CPLPackedRTreeFloatRect
+{
+    float minx;
+    float miny;
+    float maxx;
+    float maxy;
+};
+
+struct CPLPackedRTreeNode
+{
+    CPLRectObj sBounds;
+    size_t nFirstChild;
+    size_t nChildCount;
+};
+}  // namespace
+
+struct _CPLPackedRTree
+{
+    CPLQuadTreeGetBoundsFunc pfnGetBounds = nullptr;
+    int nNodeCapacity = DEFAULT_NODE_CAPACITY;
+
+    // Features, in STR order once the tree is built
+    std::vector<void *> ahFeatures{};
+    // Bounds of the features, when there is no pfnGetBounds callback.
+    std::vector<CPLRectObj> asBounds{};
+    // Otherwise, to save memory, only approximate bounds are stored, which
+    // contain the exact ones. The exact bounds of candidate features are
+    // retrieved with pfnGetBounds.
+    std::vector<CPLPackedRTreeFloatRect> asApproxBounds{};
+
+    // aaoLevels[0] are the leaf nodes, whose children are in ahFeatures, and
+    // the children of aaoLevels[i] are in aaoLevels[i - 1]. The last level
+    // has a single node.
+    std::vector<std::vector<CPLPackedRTreeNode>> aaoLevels{};
+
+    std::atomic<bool> bBuilt{false};
+    std::mutex oMutex{};
+};
+
+/*
+** Returns TRUE if rectangles a and b overlap
+*/
+static CPL_INLINE bool CPLPackedRTreeRectOverlap(const CPLRectObj &a,
+                                                 const CPLRectObj &b)
+{
+    return !(a.minx > b.maxx || a.maxx < b.minx || a.miny > b.maxy ||
+             a.maxy < b.miny);
+}
+
+/************************************************************************/
+/*                      CPLPackedRTreeRoundDown()                       */
+/************************************************************************/
+
+static float CPLPackedRTreeRoundDown(double dfVal)
+{
+    constexpr double dfFloatMax =
+        static_cast<double>(std::numeric_limits<float>::max());
+    if (!(dfVal <= dfFloatMax))
+        return std::isnan(dfVal) ? std::numeric_limits<float>::quiet_NaN()
+                                 : std::numeric_limits<float>::max();
+    if (dfVal < -dfFloatMax)
+        return -std::numeric_limits<float>::infinity();
+    const float fVal = static_cast<float>(dfVal);
+    return static_cast<double>(fVal) > dfVal
+               ? std::nextafter(fVal, -std::numeric_limits<float>::infinity())
+               : fVal;
+}
+
+/************************************************************************/
+/*                       CPLPackedRTreeRoundUp()                        */
+/************************************************************************/
+
+static float CPLPackedRTreeRoundUp(double dfVal)
+{
+    return -CPLPackedRTreeRoundDown(-dfVal);
+}
+
+/************************************************************************/
+/*                        CPLPackedRTreeCreate()                        */
+/************************************************************************/
+
+/**
+ * Create a new packed R-tree.
+ *
+ * @param pfnGetBounds a user provided function to get the bounding box of
+ *                     the inserted elements. If it is set to NULL, then
+ *                     CPLPackedRTreeInsertWithBounds() must be used, and
+ *                     CPLPackedRTreeInsert() must not be called. Otherwise,
+ *                     the bounds are not stored in the tree, and the
+ *                     function is called during searches.
+ *
+ * @return a newly allocated R-tree, to free with CPLPackedRTreeDestroy()
+ *
+ * @since 3.13
+ */
+CPLPackedRTree *CPLPackedRTreeCreate(CPLQuadTreeGetBoundsFunc pfnGetBounds)
+{
+    CPLPackedRTree *hTree = new CPLPackedRTree();
+    hTree->pfnGetBounds = pfnGetBounds;
+    return hTree;
+}
+
+/************************************************************************/
+/*                       CPLPackedRTreeDestroy()                        */
+/************************************************************************/
+
+/**
+ * Destroy a packed R-tree.
+ *
+ * The inserted features are not freed.
+ *
+ * @param hTree the R-tree, or NULL
+ *
+ * @since 3.13
+ */
+void CPLPackedRTreeDestroy(CPLPackedRTree *hTree)
+{
+    delete hTree;
+}
+
+/************************************************************************/
+/*                   CPLPackedRTreeSetNodeCapacity()                    */
+/************************************************************************/
+
+/**
+ * Set the maximum number of children of a node (default is 16).
+ *
+ * Must be called before the tree is built.
+ *
+ * @param hTree the R-tree
+ * @param nNodeCapacity the node capacity, at least 2
+ *
+ * @since 3.13
+ */
+void CPLPackedRTreeSetNodeCapacity(CPLPackedRTree *hTree, int nNodeCapacity)
+{
+    CPLAssert(hTree);
+    hTree->nNodeCapacity = std::max(2, nNodeCapacity);
+    hTree->bBuilt = false;
+}
+
+/************************************************************************/
+/*                        CPLPackedRTreeInsert()                        */
+/************************************************************************/
+
+/**
+ * Insert a feature into a packed R-tree.
+ *
+ * The bounds of the feature are retrieved with the function passed to
+ * CPLPackedRTreeCreate(). The tree will be (re)built by the next search.
+ *
+ * @param hTree the R-tree
+ * @param hFeature the feature to insert
+ *
+ * @since 3.13
+ */
+void CPLPackedRTreeInsert(CPLPackedRTree *hTree, void *hFeature)
+{
+    CPLAssert(hTree);
+    CPLAssert(hTree->pfnGetBounds);
+    hTree->ahFeatures.push_back(hFeature);
+    hTree->bBuilt = false;
+}
+
+/************************************************************************/
+/*                   CPLPackedRTreeInsertWithBounds()                   */
+/************************************************************************/
+
+/**
+ * Insert a feature into a packed R-tree, with its bounds.
+ *
+ * The tree will be (re)built by the next search. If a function to get the
+ * bounds of features was passed to CPLPackedRTreeCreate(), psBounds is
+ * ignored, and that function is used instead.
+ *
+ * @param hTree the R-tree
+ * @param hFeature the feature to insert
+ * @param psBounds bounds of the feature
+ *
+ * @since 3.13
+ */
+void CPLPackedRTreeInsertWithBounds(CPLPackedRTree *hTree, void *hFeature,
+                                    const CPLRectObj *psBounds)
+{
+    CPLAssert(hTree);
+    CPLAssert(psBounds);
+    hTree->ahFeatures.push_back(hFeature);
+    if (!hTree->pfnGetBounds)
+        hTree->asBounds.push_back(*psBounds);
+    hTree->bBuilt = false;
+}
+
+/************************************************************************/
+/*                       CPLPackedRTreeSTRSort()                        */
+/************************************************************************/
+
+/** Sort elements in Sort-Tile-Recursive order: by the X coordinate of their
+ * center, and then by the Y coordinate of their center within each vertical
+ * slice of sqrt(number of parent nodes) parent nodes.
+ */
+template <class T>
+static void CPLPackedRTreeSTRSort(std::vector<T> &aoElts, int nNodeCapacity)
+{
+    // Sort NaN bounds first, to keep a strict weak ordering
+    const auto CenterX = [](const T &oElt)
+    {
+        const double dfVal = oElt.sBounds.minx + oElt.sBounds.maxx;
+        return std::isnan(dfVal) ? -std::numeric_limits<double>::infinity()
+                                 : dfVal;
+    };
+    const auto CenterY = [](const T &oElt)
+    {
+        const double dfVal = oElt.sBounds.miny + oElt.sBounds.maxy;
+        return std::isnan(dfVal) ? -std::numeric_limits<double>::infinity()
+                                 : dfVal;
+    };
+
+    const size_t nElts = aoElts.size();
+    const size_t nParents =
+        cpl::div_round_up(nElts, static_cast<size_t>(nNodeCapacity));
+    const size_t nSlices = static_cast<size_t>(
+        std::ceil(std::sqrt(static_cast<double>(nParents))));
+    const size_t nSliceSize =
+        cpl::div_round_up(nParents, nSlices) * nNodeCapacity;
+
+    std::sort(aoElts.begin(), aoElts.end(),
+              [&CenterX](const T &a, const T &b)
+              { return CenterX(a) < CenterX(b); });
+    for (size_t i = 0; i < nElts; i += nSliceSize)
+    {
+        std::sort(aoElts.begin() + i,
+                  aoElts.begin() + std::min(nElts, i + nSliceSize),
+                  [&CenterY](const T &a, const T &b)
+                  { return CenterY(a) < CenterY(b); });
+    }
+}
+
+/************************************************************************/
+/*                     CPLPackedRTreeMakeParents()                      */
+/************************************************************************/
+
+template <class T>
+static std::vector<CPLPackedRTreeNode>
+CPLPackedRTreeMakeParents(const std::vector<T> &aoChildren, int nNodeCapacity)
+{
+    std::vector<CPLPackedRTreeNode> aoParents;
+    aoParents.reserve(cpl::div_round_up(aoChildren.size(),
+                                        static_cast<size_t>(nNodeCapacity)));
+    for (size_t i = 0; i < aoChildren.size(); i += nNodeCapacity)
+    {
+        CPLPackedRTreeNode oNode;
+        oNode.nFirstChild = i;
+        oNode.nChildCount =
+            std::min(aoChildren.size() - i, static_cast<size_t>(nNodeCapacity));
+        oNode.sBounds = aoChildren[i].sBounds;
+        for (size_t j = i + 1; j < i + oNode.nChildCount; ++j)
+        {
+            const CPLRectObj &sBounds = aoChildren[j].sBounds;
+            oNode.sBounds.minx = std::min(oNode.sBounds.minx, sBounds.minx);
+            oNode.sBounds.miny = std::min(oNode.sBounds.miny, sBounds.miny);
+            oNode.sBounds.maxx = std::max(oNode.sBounds.maxx, sBounds.maxx);
+            oNode.sBounds.maxy = std::max(oNode.sBounds.maxy, sBounds.maxy);
+        }
+        aoParents.push_back(oNode);
+    }
+    return aoParents;
+}
+
+/************************************************************************/
+/*                        CPLPackedRTreeBuild()                         */
+/************************************************************************/
+
+/**
+ * Bulk load the tree from the inserted features.
+ *
+ * Calling this function is optional: the first search builds the tree if
+ * needed. It may be called after all features have been inserted, to
+ * control when the build occurs.
+ *
+ * @param hTree the R-tree
+ *
+ * @since 3.13
+ */
+void CPLPackedRTreeBuild(CPLPackedRTree *hTree)
+{
+    CPLAssert(hTree);
+    if (hTree->bBuilt.load(std::memory_order_acquire))
+        return;
+
+    std::lock_guard oLock(hTree->oMutex);
+    if (hTree->bBuilt.load(std::memory_order_relaxed))
+        return;
+
+    hTree->aaoLevels.clear();
+    const size_t nFeatures = hTree->ahFeatures.size();
+    if (nFeatures > 0)
+    {
+        {
+            std::vector<CPLPackedRTreeItem> aoItems(nFeatures);
+            for (size_t i = 0; i < nFeatures; ++i)
+            {
+                aoItems[i].hFeature = hTree->ahFeatures[i];
+                if (hTree->pfnGetBounds)
+                    hTree->pfnGetBounds(aoItems[i].hFeature,
+                                        &aoItems[i].sBounds);
+                else
+                    aoItems[i].sBounds = hTree->asBounds[i];
+            }
+
+            CPLPackedRTreeSTRSort(aoItems, hTree->nNodeCapacity);
+            if (hTree->pfnGetBounds)
+                hTree->asApproxBounds.resize(nFeatures);
+            for (size_t i = 0; i < nFeatures; ++i)
+            {
+                hTree->ahFeatures[i] = aoItems[i].hFeature;
+                const CPLRectObj &sBounds = aoItems[i].sBounds;
+                if (hTree->pfnGetBounds)
+                {
+                    auto &sApproxBounds = hTree->asApproxBounds[i];
+                    sApproxBounds.minx = CPLPackedRTreeRoundDown(sBounds.minx);
+                    sApproxBounds.miny = CPLPackedRTreeRoundDown(sBounds.miny);
+                    sApproxBounds.maxx = CPLPackedRTreeRoundUp(sBounds.maxx);
+                    sApproxBounds.maxy = CPLPackedRTreeRoundUp(sBounds.maxy);
+                }
+                else
+                {
+                    hTree->asBounds[i] = sBounds;
+                }
+            }
+            hTree->aaoLevels.push_back(
+                CPLPackedRTreeMakeParents(aoItems, hTree->nNodeCapacity));
+        }
+        while (hTree->aaoLevels.back().size() > 1)
+        {
+            // Reordering the nodes of a level is fine, as each node refers
+            // to its own children.
+            CPLPackedRTreeSTRSort(hTree->aaoLevels.back(),
+                                  hTree->nNodeCapacity);
+            auto aoParents = CPLPackedRTreeMakeParents(hTree->aaoLevels.back(),
+                                                       hTree->nNodeCapacity);
+            hTree->aaoLevels.push_back(std::move(aoParents));
+        }
+    }
+
+    hTree->bBuilt.store(true, std::memory_order_release);
+}
+
+/************************************************************************/
+/*                   CPLPackedRTreeGetFeatureCount()                    */
+/************************************************************************/
+
+/**
+ * Return the number of features inserted in the tree.
+ *
+ * @param hTree the R-tree
+ * @return the number of features.
+ *
+ * @since 3.13
+ */
+int CPLPackedRTreeGetFeatureCount(const CPLPackedRTree *hTree)
+{
+    CPLAssert(hTree);
+    return static_cast<int>(hTree->ahFeatures.size());
+}
+
+/************************************************************************/
+/*                        CPLPackedRTreeVisit()                         */
+/************************************************************************/
+
+/** Call f() on each feature overlapping sAoi under the node iNode of level
+ * iLevel, until it returns false.
+ */
+template <class F>
+static bool CPLPackedRTreeVisit(const CPLPackedRTree *hTree, size_t iLevel,
+                                size_t iNode, const CPLRectObj &sAoi, F &f)
+{
+    const CPLPackedRTreeNode &oNode = hTree->aaoLevels[iLevel][iNode];
+    const size_t nEnd = oNode.nFirstChild + oNode.nChildCount;
+    if (iLevel == 0)
+    {
+        if (hTree->pfnGetBounds)
+        {
+            CPLRectObj sBounds;
+            for (size_t i = oNode.nFirstChild; i < nEnd; ++i)
+            {
+                const auto &sApproxBounds = hTree->asApproxBounds[i];
+                if (static_cast<double>(sApproxBounds.minx) > sAoi.maxx ||
+                    static_cast<double>(sApproxBounds.maxx) < sAoi.minx ||
+                    static_cast<double>(sApproxBounds.miny) > sAoi.maxy ||
+                    static_cast<double>(sApproxBounds.maxy) < sAoi.miny)
+                {
+                    continue;
+                }
+                void *hFeature = hTree->ahFeatures[i];
+                hTree->pfnGetBounds(hFeature, &sBounds);
+                if (CPLPackedRTreeRectOverlap(sBounds, sAoi) && !f(hFeature))
+                    return false;
+            }
+        }
+        else
+        {
+            for (size_t i = oNode.nFirstChild; i < nEnd; ++i)
+            {
+                if (CPLPackedRTreeRectOverlap(hTree->asBounds[i], sAoi) &&
+                    !f(hTree->ahFeatures[i]))
+                {
+                    return false;
+                }
+            }
+        }
+    }
+    else
+    {
+        const auto &aoChildren = hTree->aaoLevels[iLevel - 1];
+        for (size_t i = oNode.nFirstChild; i < nEnd; ++i)
+        {
+            if (CPLPackedRTreeRectOverlap(aoChildren[i].sBounds, sAoi) &&
+                !CPLPackedRTreeVisit(hTree, iLevel - 1, i, sAoi, f))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+template <class F>
+static void CPLPackedRTreeVisit(const CPLPackedRTree *hTree,
+                                const CPLRectObj &sAoi, F &&f)
+{
+    // The first search builds the tree. This is thread-safe.
+    CPLPackedRTreeBuild(const_cast<CPLPackedRTree *>(hTree));
+
+    if (hTree->aaoLevels.empty())
+        return;
+    const size_t iRootLevel = hTree->aaoLevels.size() - 1;
+    if (CPLPackedRTreeRectOverlap(hTree->aaoLevels[iRootLevel][0].sBounds,
+                                  sAoi))
+    {
+        CPLPackedRTreeVisit(hTree, iRootLevel, 0, sAoi, f);
+    }
+}
+
+/************************************************************************/
+/*                        CPLPackedRTreeSearch()                        */
+/************************************************************************/
+
+/**
+ * Return the features whose bounds overlap the area of interest, into a
+ * vector.
+ *
+ * Features are returned in an unspecified, but deterministic, order.
+ *
+ * @param hTree the R-tree
+ * @param sAoi the area of interest
+ * @param apahFeatures vector receiving the features. It is cleared first.
+ *
+ * @since 3.13
+ */
+void CPLPackedRTreeSearch(const CPLPackedRTree *hTree, const CPLRectObj &sAoi,
+                          std::vector<void *> &apahFeatures)
+{
+    CPLAssert(hTree);
+    apahFeatures.clear();
+    CPLPackedRTreeVisit(hTree, sAoi,
+                        [&apahFeatures](void *hFeature)
+                        {
+                            apahFeatures.push_back(hFeature);
+                            return true;
+                        });
+}
+
+/**
+ * Return the features whose bounds overlap the area of interest.
+ *
+ * Features are returned in an unspecified, but deterministic, order.
+ *
+ * @param hTree the R-tree
+ * @param pAoi the area of interest
+ * @param pnFeatureCount pointer to the number of features found. May be NULL
+ * @return an array of features, to free with CPLFree(), or NULL if no
+ *         feature is found.
+ *
+ * @since 3.13
+ */
+void **CPLPackedRTreeSearch(const CPLPackedRTree *hTree,
+                            const CPLRectObj *pAoi, int *pnFeatureCount)
+{
+    CPLAssert(hTree);
+    CPLAssert(pAoi);
+
+    // Matches are written directly in the returned array, grown as in
+    // CPLQuadTreeSearch()
+    void **ppFeatureList = nullptr;
+    int nFeatureCount = 0;
+    int nMaxFeatures = 0;
+    CPLPackedRTreeVisit(
+        hTree, *pAoi,
+        [&ppFeatureList, &nFeatureCount, &nMaxFeatures](void *hFeature)
+        {
+            if (nFeatureCount == nMaxFeatures)
+            {
+                nMaxFeatures = nMaxFeatures * 2 + 20;
+                ppFeatureList = static_cast<void **>(
+                    CPLRealloc(ppFeatureList, sizeof(void *) * nMaxFeatures));
+            }
+            ppFeatureList[nFeatureCount++] = hFeature;
+            return true;
+        });
+
+    if (pnFeatureCount)
+        *pnFeatureCount = nFeatureCount;
+    return ppFeatureList;
+}
+
+/************************************************************************/
+/*                       CPLPackedRTreeHasMatch()                       */
+/************************************************************************/
+
+/**
+ * Return whether at least one feature overlaps the area of interest.
+ *
+ * @param hTree the R-tree
+ * @param pAoi the area of interest
+ *
+ * @since 3.13
+ */
+bool CPLPackedRTreeHasMatch(const CPLPackedRTree *hTree,
+                            const CPLRectObj *pAoi)
+{
+    CPLAssert(hTree);
+    CPLAssert(pAoi);
+
+    bool bFound = false;
+    CPLPackedRTreeVisit(hTree, *pAoi,
+                        [&bFound](void *)
+                        {
+                            bFound = true;
+                            return false;
+                        });
+    return bFound;
+}
+
+/************************************************************************/
+/*                     CPLPackedRTreeSearchBatch()                      */
+/************************************************************************/
+
+/**
+ * Search the features overlapping each of several areas of interest.
+ *
+ * When a thread pool is provided, searches are distributed over its
+ * threads.
+ *
+ * @param hTree the R-tree
+ * @param asAois the areas of interest
+ * @param poThreadPool thread pool, or nullptr
+ * @return a vector with, for each area of interest, the overlapping features,
+ *         in the same order as CPLPackedRTreeSearch().
+ *
+ * @since 3.13
+ */
+std::vector<std::vector<void *>>
+CPLPackedRTreeSearchBatch(const CPLPackedRTree *hTree,
+                          const std::vector<CPLRectObj> &asAois,
+                          CPLWorkerThreadPool *poThreadPool)
+{
+    CPLAssert(hTree);
+
+    // Build before the searches are distributed
+    CPLPackedRTreeBuild(const_cast<CPLPackedRTree *>(hTree));
+
+    std::vector<std::vector<void *>> aapahFeatures(asAois.size());
+
+    // Minimum number of searches per job
+    constexpr size_t MIN_SEARCHES_PER_JOB = 256;
+    const size_t nJobs =
+        poThreadPool
+            ? std::min(static_cast<size_t>(poThreadPool->GetThreadCount()) * 4,
+                       asAois.size() / MIN_SEARCHES_PER_JOB)
+            : 0;
+    if (nJobs <= 1)
+    {
+        for (size_t i = 0; i < asAois.size(); ++i)
+            CPLPackedRTreeSearch(hTree, asAois[i], aapahFeatures[i]);
+        return aapahFeatures;
+    }
+
+    auto poJobQueue = poThreadPool->CreateJobQueue();
+    for (size_t iJob = 0; iJob < nJobs; ++iJob)
+    {
+        const size_t iStart = asAois.size() * iJob / nJobs;
+        const size_t iEnd = asAois.size() * (iJob + 1) / nJobs;
+        poJobQueue->SubmitJob(
+            [hTree, &asAois, &aapahFeatures, iStart, iEnd]()
+            {
+                for (size_t i = iStart; i < iEnd; ++i)
+                    CPLPackedRTreeSearch(hTree, asAois[i], aapahFeatures[i]);
+            });
+    }
+    poJobQueue->WaitCompletion();
+
+    return aapahFeatures;
+}
@@ -0,0 +1,86 @@
+/******************************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Packed static R-tree, bulk loaded with the Sort-Tile-Recursive
+ *           algorithm
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef CPL_PACKED_RTREE_H_INCLUDED
+#define CPL_PACKED_RTREE_H_INCLUDED
+
+#include "cpl_port.h"
+#include "cpl_quad_tree.h"
+
+#include <stdbool.h>
+
+/**
+ * \file cpl_packed_rtree.h
+ *
+ * Packed static R-tree implementation.
+ *
+ * This is an alternative to CPLQuadTree for indexes that are built once and
+ * then only queried. Features are accumulated by CPLPackedRTreeInsert() or
+ * CPLPackedRTreeInsertWithBounds(), and the tree is bulk loaded with the
+ * Sort-Tile-Recursive (STR) algorithm when CPLPackedRTreeBuild() is called,
+ * or at the latest by the first search. Nodes are stored in contiguous
+ * arrays, level by level, which uses less memory than a quad tree and makes
+ * searches more cache friendly. As with CPLQuadTree, when a function to get
+ * the bounds of features is provided, only feature pointers are stored.
+ *
+ * Once built, the tree may be searched concurrently from several threads.
+ *
+ * @since 3.13
+ */
+
+CPL_C_START
+
+/** Opaque type for a packed R-tree */
+typedef struct _CPLPackedRTree CPLPackedRTree;
+
+CPLPackedRTree CPL_DLL *
+CPLPackedRTreeCreate(CPLQuadTreeGetBoundsFunc pfnGetBounds);
+void CPL_DLL CPLPackedRTreeDestroy(CPLPackedRTree *hTree);
+
+void CPL_DLL CPLPackedRTreeSetNodeCapacity(CPLPackedRTree *hTree,
+                                           int nNodeCapacity);
+
+void CPL_DLL CPLPackedRTreeInsert(CPLPackedRTree *hTree, void *hFeature);
+void CPL_DLL CPLPackedRTreeInsertWithBounds(CPLPackedRTree *hTree,
+                                            void *hFeature,
+                                            const CPLRectObj *psBounds);
+
+void CPL_DLL CPLPackedRTreeBuild(CPLPackedRTree *hTree);
+
+int CPL_DLL CPLPackedRTreeGetFeatureCount(const CPLPackedRTree *hTree);
+
+void CPL_DLL **CPLPackedRTreeSearch(const CPLPackedRTree *hTree,
+                                    const CPLRectObj *pAoi,
+                                    int *pnFeatureCount);
+
+bool CPL_DLL CPLPackedRTreeHasMatch(const CPLPackedRTree *hTree,
+                                    const CPLRectObj *pAoi);
+
+CPL_C_END
+
+#if defined(__cplusplus) && !defined(CPL_SUPRESS_CPLUSPLUS)
+
+#include <vector>
+
+class CPLWorkerThreadPool;
+
+void CPL_DLL CPLPackedRTreeSearch(const CPLPackedRTree *hTree,
+                                  const CPLRectObj &sAoi,
+                                  std::vector<void *> &apahFeatures);
+
+std::vector<std::vector<void *>> CPL_DLL CPLPackedRTreeSearchBatch(
+    const CPLPackedRTree *hTree, const std::vector<CPLRectObj> &asAois,
+    CPLWorkerThreadPool *poThreadPool = nullptr);
+
+#endif
+
+#endif
@@ -1493,7 +1493,8 @@ retry:
                             std::min<size_t>(sWriteFuncData.nSize - nOffset,
                                              knDOWNLOAD_CHUNK_SIZE);
                         poFS->AddRegion(m_pszURL, nOffset, nToCache,
-                                        sWriteFuncData.pBuffer + nOffset);
+                                        sWriteFuncData.pBuffer + nOffset,
+                                        &oFileProp);
                         nOffset += nToCache;
                     }
                 }
@@ -3923,6 +3924,48 @@ VSICurlFilesystemHandlerBase::GetRegionCache()
     return m_poRegionCacheDoNotUseDirectly.get();
 }
 
+/************************************************************************/
+/*                       VSICurlGetDiskCacheKey()                       */
+/************************************************************************/
+
+// Return the key of a region in the disk cache, or an empty string if the
+// region cannot be cached on disk. Only content identified by a ETag
+// is cached, so that modifications of the remote file invalidate it.
+static std::string VSICurlGetDiskCacheKey(const char *pszURL,
+                                          const FileProp *poFileProp,
+                                          vsi_l_offset nFileOffsetStart,
+                                          size_t nSize)
+{
+    FileProp oFileProp;
+    if (poFileProp == nullptr)
+    {
+        if (!VSICURLGetCachedFileProp(pszURL, oFileProp))
+            return std::string();
+        poFileProp = &oFileProp;
+    }
+    if (poFileProp->ETag.empty())
+        return std::string();
+
+    // Only full chunks, or the last chunk of the file, can be cached,
+    // as a short region is interpreted as the end of file by readers.
+    const int knDOWNLOAD_CHUNK_SIZE = VSICURLGetDownloadChunkSize();
+    if (nSize != 0 && nSize != static_cast<size_t>(knDOWNLOAD_CHUNK_SIZE) &&
+        !(poFileProp->bHasComputedFileSize &&
+          nFileOffsetStart + nSize == poFileProp->fileSize))
+    {
+        return std::string();
+    }
+
+    std::string osKey(pszURL);
+    osKey += '\n';
+    osKey += poFileProp->ETag;
+    osKey += '\n';
+    osKey += std::to_string(nFileOffsetStart);
+    osKey += '\n';
+    osKey += std::to_string(knDOWNLOAD_CHUNK_SIZE);
+    return osKey;
+}
+
 /************************************************************************/
 /*                             GetRegion()                              */
 /************************************************************************/
@@ -3931,37 +3974,83 @@ std::shared_ptr<std::string>
 VSICurlFilesystemHandlerBase::GetRegion(const char *pszURL,
                                         vsi_l_offset nFileOffsetStart)
 {
-    CPLMutexHolder oHolder(&hMutex);
-
     const int knDOWNLOAD_CHUNK_SIZE = VSICURLGetDownloadChunkSize();
     nFileOffsetStart =
         (nFileOffsetStart / knDOWNLOAD_CHUNK_SIZE) * knDOWNLOAD_CHUNK_SIZE;
 
-    std::shared_ptr<std::string> out;
-    if (GetRegionCache()->tryGet(
-            FilenameOffsetPair(std::string(pszURL), nFileOffsetStart), out))
     {
-        return out;
+        CPLMutexHolder oHolder(&hMutex);
+
+        std::shared_ptr<std::string> out;
+        if (GetRegionCache()->tryGet(
+                FilenameOffsetPair(std::string(pszURL), nFileOffsetStart),
+                out))
+        {
+            return out;
+        }
+    }
+
+    if (auto poDiskCache = GetDiskCache())
+    {
+        const std::string osKey =
+            VSICurlGetDiskCacheKey(pszURL, nullptr, nFileOffsetStart, 0);
+        auto value = std::make_shared<std::string>();
+        if (!osKey.empty() && poDiskCache->Read(osKey, *value))
+        {
+            CPLMutexHolder oHolder(&hMutex);
+            GetRegionCache()->insert(
+                FilenameOffsetPair(std::string(pszURL), nFileOffsetStart),
+                value);
+            return value;
+        }
     }
 
     return nullptr;
 }
 
+/************************************************************************/
+/*                            GetDiskCache()                            */
+/************************************************************************/
+
+std::shared_ptr<VSICurlDiskCache> VSICurlFilesystemHandlerBase::GetDiskCache()
+{
+    CPLMutexHolder oHolder(&hMutex);
+    if (!m_bDiskCacheResolved)
+    {
+        m_bDiskCacheResolved = true;
+        m_poDiskCache = VSICurlDiskCache::Create();
+    }
+    return m_poDiskCache;
+}
+
 /************************************************************************/
 /*                             AddRegion()                              */
 /************************************************************************/
 
 void VSICurlFilesystemHandlerBase::AddRegion(const char *pszURL,
                                              vsi_l_offset nFileOffsetStart,
-                                             size_t nSize, const char *pData)
+                                             size_t nSize, const char *pData,
+                                             const FileProp *poFileProp)
 {
-    CPLMutexHolder oHolder(&hMutex);
+    {
+        CPLMutexHolder oHolder(&hMutex);
+
+        auto value = std::make_shared<std::string>();
+        value->assign(pData, nSize);
+        GetRegionCache()->insert(
+            FilenameOffsetPair(std::string(pszURL), nFileOffsetStart),
+            std::move(value));
+    }
 
-    auto value = std::make_shared<std::string>();
-    value->assign(pData, nSize);
-    GetRegionCache()->insert(
-        FilenameOffsetPair(std::string(pszURL), nFileOffsetStart),
-        std::move(value));
+    if (nSize == 0)
+        return;
+    if (auto poDiskCache = GetDiskCache())
+    {
+        const std::string osKey = VSICurlGetDiskCacheKey(
+            pszURL, poFileProp, nFileOffsetStart, nSize);
+        if (!osKey.empty())
+            poDiskCache->Write(osKey, pData, nSize);
+    }
 }
 
 /************************************************************************/
@@ -4103,6 +4192,9 @@ void VSICurlFilesystemHandlerBase::ClearCache()
 
     GetRegionCache()->clear();
 
+    m_poDiskCache.reset();
+    m_bDiskCacheResolved = false;
+
     {
         const auto lambda = [](const lru11::KeyValuePair<std::string, bool> &kv)
         { VSICURLInvalidateCachedFileProp(kv.key.c_str()); };
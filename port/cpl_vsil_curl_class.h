@@ -135,6 +135,39 @@ struct PutData
     }
 };
 
+/************************************************************************/
+/*                           VSICurlDiskCache                           */
+/************************************************************************/
+
+// Persistent and size-bounded cache of downloaded regions, that can be shared
+// by several processes. Enabled with CPL_VSIL_CURL_DISK_CACHE_DIR.
+// Entries are evicted in least recently used order: their modification time
+// is refreshed (at most once per minute) when they are read.
+class VSICurlDiskCache
+{
+    CPL_DISALLOW_COPY_ASSIGN(VSICurlDiskCache)
+
+    const std::string m_osDir;
+    const GIntBig m_nMaxSize;
+
+    std::mutex m_oMutex{};
+    GIntBig m_nEstimatedSize = -1;  // unknown until first directory scan
+    GIntBig m_nWrittenSinceLastScan = 0;
+    std::atomic<int> m_nTmpCounter{0};
+    std::atomic<bool> m_bWarningEmitted{false};
+
+    std::string GetEntryPath(const std::string &osKey) const;
+    void Trim();
+
+  public:
+    VSICurlDiskCache(const std::string &osDir, GIntBig nMaxSize);
+
+    static std::shared_ptr<VSICurlDiskCache> Create();
+
+    bool Read(const std::string &osKey, std::string &osData);
+    void Write(const std::string &osKey, const char *pData, size_t nSize);
+};
+
 /************************************************************************/
 /*                       VSICurlFilesystemHandler                       */
 /************************************************************************/
@@ -183,6 +216,12 @@ class VSICurlFilesystemHandlerBase : public VSIFilesystemHandler
                                             // GetRegionCache();
     RegionCacheType *GetRegionCache();
 
+    // Resolved from configuration options on first use, and after
+    // ClearCache(). Protected by hMutex.
+    std::shared_ptr<VSICurlDiskCache> m_poDiskCache{};
+    bool m_bDiskCacheResolved = false;
+    std::shared_ptr<VSICurlDiskCache> GetDiskCache();
+
     // LRU cache that just keeps in memory if this file system handler is
     // spposed to know the file properties of a file. The actual cache is a
     // shared one among all network file systems.
@@ -294,7 +333,8 @@ class VSICurlFilesystemHandlerBase : public VSIFilesystemHandler
                                            vsi_l_offset nFileOffsetStart);
 
     void AddRegion(const char *pszURL, vsi_l_offset nFileOffsetStart,
-                   size_t nSize, const char *pData);
+                   size_t nSize, const char *pData,
+                   const FileProp *poFileProp = nullptr);
 
     std::pair<bool, std::string>
     NotifyStartDownloadRegion(const std::string &osURL,
@@ -0,0 +1,338 @@
+/******************************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Persistent on-disk cache of regions downloaded by /vsicurl/ and
+ *           related network file systems
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_port.h"
+#include "cpl_vsil_curl_class.h"
+
+#ifdef HAVE_CURL
+
+#include <algorithm>
+#include <cstring>
+#include <tuple>
+#include <vector>
+
+#include "cpl_conv.h"
+#include "cpl_sha256.h"
+#include "cpl_string.h"
+#include "cpl_vsi.h"
+
+//! @cond Doxygen_Suppress
+
+namespace cpl
+{
+
+// Entry file layout: magic, little-endian uint64 data size, data
+constexpr char DISK_CACHE_MAGIC[] = "GDALDC01";
+constexpr size_t DISK_CACHE_MAGIC_SIZE = sizeof(DISK_CACHE_MAGIC) - 1;
+constexpr size_t DISK_CACHE_HEADER_SIZE = DISK_CACHE_MAGIC_SIZE + 8;
+
+// Temporary files older than that are considered as left over by a
+// crashed process, and removed by Trim().
+constexpr time_t DISK_CACHE_STALE_TMP_DELAY = 3600;
+
+// Minimum age of an entry before a read refreshes its modification time, so
+// that frequently read entries do not cause a write each time.
+constexpr time_t DISK_CACHE_TOUCH_DELAY = 60;
+
+/************************************************************************/
+/*                          VSICurlDiskCache()                          */
+/************************************************************************/
+
+VSICurlDiskCache::VSICurlDiskCache(const std::string &osDir, GIntBig nMaxSize)
+    : m_osDir(osDir), m_nMaxSize(nMaxSize)
+{
+}
+
+/************************************************************************/
+/*                               Create()                               */
+/************************************************************************/
+
+/** Return the disk cache configured with CPL_VSIL_CURL_DISK_CACHE_DIR, or
+ * nullptr if it is not enabled.
+ *
+ * Handlers configured with the same settings share the same instance.
+ */
+std::shared_ptr<VSICurlDiskCache> VSICurlDiskCache::Create()
+{
+    const char *pszDir =
+        CPLGetConfigOption("CPL_VSIL_CURL_DISK_CACHE_DIR", nullptr);
+    if (pszDir == nullptr || pszDir[0] == '\0')
+        return nullptr;
+
+    GIntBig nMaxSize = static_cast<GIntBig>(1024) * 1024 * 1024;
+    const char *pszMaxSize =
+        CPLGetConfigOption("CPL_VSIL_CURL_DISK_CACHE_SIZE", nullptr);
+    if (pszMaxSize &&
+        (CPLParseMemorySize(pszMaxSize, &nMaxSize, nullptr) != CE_None ||
+         nMaxSize <= 0))
+    {
+        CPLError(CE_Warning, CPLE_AppDefined,
+                 "Invalid value for CPL_VSIL_CURL_DISK_CACHE_SIZE. "
+                 "Disabling disk cache.");
+        return nullptr;
+    }
+
+    static std::mutex oMutex;
+    static std::shared_ptr<VSICurlDiskCache> poCache;
+    std::lock_guard<std::mutex> oLock(oMutex);
+    if (!poCache || poCache->m_osDir != pszDir ||
+        poCache->m_nMaxSize != nMaxSize)
+    {
+        poCache = std::make_shared<VSICurlDiskCache>(pszDir, nMaxSize);
+    }
+    return poCache;
+}
+
+/************************************************************************/
+/*                            GetEntryPath()                            */
+/************************************************************************/
+
+// Entries are content-addressed by the SHA256 of their key (which avoids
+// storing URLs, that may contain secrets, in the cache directory), and
+// spread over 256 sub-directories.
+std::string VSICurlDiskCache::GetEntryPath(const std::string &osKey) const
+{
+    GByte abyHash[CPL_SHA256_HASH_SIZE];
+    CPL_SHA256(osKey.data(), osKey.size(), abyHash);
+    char *pszHex = CPLBinaryToHex(CPL_SHA256_HASH_SIZE, abyHash);
+    const std::string osHex(pszHex);
+    CPLFree(pszHex);
+    return CPLFormFilenameSafe(
+        CPLFormFilenameSafe(m_osDir.c_str(), osHex.substr(0, 2).c_str(),
+                            nullptr)
+            .c_str(),
+        osHex.c_str(), nullptr);
+}
+
+/************************************************************************/
+/*                                Read()                                */
+/************************************************************************/
+
+/** Fetch the data stored for osKey. Return false if there is no such
+ * entry, or if it is corrupted. */
+bool VSICurlDiskCache::Read(const std::string &osKey, std::string &osData)
+{
+    const std::string osPath = GetEntryPath(osKey);
+    VSIStatBufL sStat;
+    if (VSIStatL(osPath.c_str(), &sStat) != 0)
+        return false;
+    VSILFILE *fp = VSIFOpenL(osPath.c_str(), "rb");
+    if (fp == nullptr)
+        return false;
+
+    bool bOK = false;
+    GByte abyHeader[DISK_CACHE_HEADER_SIZE];
+    if (VSIFReadL(abyHeader, sizeof(abyHeader), 1, fp) == 1 &&
+        memcmp(abyHeader, DISK_CACHE_MAGIC, DISK_CACHE_MAGIC_SIZE) == 0)
+    {
+        uint64_t nSize = 0;
+        memcpy(&nSize, abyHeader + DISK_CACHE_MAGIC_SIZE, sizeof(nSize));
+        CPL_LSBPTR64(&nSize);
+        // Download chunks are at most a few MB large
+        constexpr uint64_t MAX_ENTRY_SIZE = 100 * 1024 * 1024;
+        if (nSize <= MAX_ENTRY_SIZE && VSIFSeekL(fp, 0, SEEK_END) == 0 &&
+            VSIFTellL(fp) == DISK_CACHE_HEADER_SIZE + nSize &&
+            VSIFSeekL(fp, DISK_CACHE_HEADER_SIZE, SEEK_SET) == 0)
+        {
+            try
+            {
+                osData.resize(static_cast<size_t>(nSize));
+                bOK = nSize == 0 || VSIFReadL(&osData[0], 1, osData.size(),
+                                              fp) == osData.size();
+            }
+            catch (const std::exception &)
+            {
+            }
+        }
+    }
+    VSIFCloseL(fp);
+
+    if (!bOK)
+    {
+        CPLDebug("VSICURL", "Ignoring corrupted disk cache entry %s",
+                 osPath.c_str());
+        osData.clear();
+    }
+    else if (sStat.st_mtime + DISK_CACHE_TOUCH_DELAY < time(nullptr))
+    {
+        // Trim() evicts entries by modification time. Refresh it, so that
+        // eviction follows the last use and not the creation of the entry.
+        // Rewriting the first byte of the magic, which is unchanged, is a
+        // portable way of doing that. Failure is not an issue.
+        fp = VSIFOpenL(osPath.c_str(), "r+b");
+        if (fp)
+        {
+            CPL_IGNORE_RET_VAL(VSIFWriteL(DISK_CACHE_MAGIC, 1, 1, fp));
+            VSIFCloseL(fp);
+        }
+    }
+    return bOK;
+}
+
+/************************************************************************/
+/*                               Write()                                */
+/************************************************************************/
+
+/** Store the data for osKey.
+ *
+ * The entry is written in a temporary file, which is then atomically renamed
+ * to its final name, so that concurrent readers, possibly in other
+ * processes, never see a partially written entry.
+ */
+void VSICurlDiskCache::Write(const std::string &osKey, const char *pData,
+                             size_t nSize)
+{
+    if (static_cast<GIntBig>(nSize) > m_nMaxSize)
+        return;
+
+    const std::string osPath = GetEntryPath(osKey);
+    VSIStatBufL sStat;
+    if (VSIStatL(osPath.c_str(), &sStat) == 0)
+    {
+        // Already there. As entries are keyed by ETag, the content is the
+        // same.
+        return;
+    }
+
+    const std::string osSubDir = CPLGetPathSafe(osPath.c_str());
+    if (VSIStatL(osSubDir.c_str(), &sStat) != 0 &&
+        VSIMkdirRecursive(osSubDir.c_str(), 0755) != 0 &&
+        VSIStatL(osSubDir.c_str(), &sStat) != 0)
+    {
+        if (!m_bWarningEmitted)
+        {
+            m_bWarningEmitted = true;
+            CPLError(CE_Warning, CPLE_FileIO,
+                     "Cannot create disk cache directory %s",
+                     osSubDir.c_str());
+        }
+        return;
+    }
+
+    const std::string osTmpPath =
+        osPath + CPLSPrintf(".%d.%d.tmp", CPLGetCurrentProcessID(),
+                            ++m_nTmpCounter);
+    VSILFILE *fp = VSIFOpenL(osTmpPath.c_str(), "wb");
+    if (fp == nullptr)
+    {
+        if (!m_bWarningEmitted)
+        {
+            m_bWarningEmitted = true;
+            CPLError(CE_Warning, CPLE_FileIO,
+                     "Cannot write in disk cache directory %s",
+                     osSubDir.c_str());
+        }
+        return;
+    }
+
+    GByte abyHeader[DISK_CACHE_HEADER_SIZE];
+    memcpy(abyHeader, DISK_CACHE_MAGIC, DISK_CACHE_MAGIC_SIZE);
+    uint64_t nSize64 = nSize;
+    CPL_LSBPTR64(&nSize64);
+    memcpy(abyHeader + DISK_CACHE_MAGIC_SIZE, &nSize64, sizeof(nSize64));
+    bool bOK = VSIFWriteL(abyHeader, sizeof(abyHeader), 1, fp) == 1 &&
+               (nSize == 0 || VSIFWriteL(pData, nSize, 1, fp) == 1);
+    bOK = VSIFCloseL(fp) == 0 && bOK;
+    // If another process has renamed the same entry in the meantime,
+    // the rename may fail on Windows, which is fine.
+    if (!bOK || VSIRename(osTmpPath.c_str(), osPath.c_str()) != 0)
+    {
+        VSIUnlink(osTmpPath.c_str());
+        return;
+    }
+
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+    m_nWrittenSinceLastScan += DISK_CACHE_HEADER_SIZE + nSize;
+    // Other processes may write in the same directory, so rescan it
+    // regularly, and not only when our own estimate exceeds the limit.
+    if (m_nEstimatedSize < 0 ||
+        m_nEstimatedSize + m_nWrittenSinceLastScan > m_nMaxSize ||
+        m_nWrittenSinceLastScan > m_nMaxSize / 10)
+    {
+        Trim();
+    }
+}
+
+/************************************************************************/
+/*                                Trim()                                */
+/************************************************************************/
+
+// Scan the cache directory and, if its total size exceeds the maximum size,
+// remove the least recently used entries until it gets below 90% of it.
+// Should be called with m_oMutex held.
+void VSICurlDiskCache::Trim()
+{
+    const time_t nNow = time(nullptr);
+
+    std::vector<std::tuple<time_t, GIntBig, std::string>> aoEntries;
+    GIntBig nTotalSize = 0;
+    const CPLStringList aosSubDirs(VSIReadDir(m_osDir.c_str()));
+    for (const char *pszSubDir : aosSubDirs)
+    {
+        if (strlen(pszSubDir) != 2)
+            continue;
+        const std::string osSubDir =
+            CPLFormFilenameSafe(m_osDir.c_str(), pszSubDir, nullptr);
+        const CPLStringList aosFiles(VSIReadDir(osSubDir.c_str()));
+        for (const char *pszFile : aosFiles)
+        {
+            if (pszFile[0] == '.')
+                continue;
+            std::string osFile =
+                CPLFormFilenameSafe(osSubDir.c_str(), pszFile, nullptr);
+            VSIStatBufL sStat;
+            if (VSIStatL(osFile.c_str(), &sStat) != 0 ||
+                !VSI_ISREG(sStat.st_mode))
+                continue;
+            if (cpl::ends_with(std::string(pszFile), ".tmp"))
+            {
+                if (sStat.st_mtime + DISK_CACHE_STALE_TMP_DELAY < nNow)
+                    VSIUnlink(osFile.c_str());
+                continue;
+            }
+            nTotalSize += static_cast<GIntBig>(sStat.st_size);
+            aoEntries.emplace_back(sStat.st_mtime,
+                                   static_cast<GIntBig>(sStat.st_size),
+                                   std::move(osFile));
+        }
+    }
+
+    if (nTotalSize > m_nMaxSize)
+    {
+        std::sort(aoEntries.begin(), aoEntries.end());
+        const GIntBig nTargetSize = m_nMaxSize / 10 * 9;
+        int nRemoved = 0;
+        for (const auto &oEntry : aoEntries)
+        {
+            if (nTotalSize <= nTargetSize)
+                break;
+            // Failure is not an issue: the file might have been removed by
+            // another process, or be opened on Windows.
+            if (VSIUnlink(std::get<2>(oEntry).c_str()) == 0)
+            {
+                nTotalSize -= std::get<1>(oEntry);
+                ++nRemoved;
+            }
+        }
+        CPLDebug("VSICURL", "Removed %d entries from disk cache %s", nRemoved,
+                 m_osDir.c_str());
+    }
+
+    m_nEstimatedSize = nTotalSize;
+    m_nWrittenSinceLastScan = 0;
+}
+
+}  // namespace cpl
+
+//! @endcond
+
+#endif  // HAVE_CURL
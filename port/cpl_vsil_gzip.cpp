@@ -3492,6 +3492,12 @@ class VSIZipFilesystemHandler final : public VSIArchiveFilesystemHandler
     CPL_DISALLOW_COPY_ASSIGN(VSIZipFilesystemHandler)
 
     std::map<CPLString, VSIZipWriteHandle *> oMapZipWriteHandles{};
+
+    // Shared by all SOZip handles, so that opening several files does not
+    // multiply the number of threads.
+    std::mutex m_oSOZipThreadPoolMutex{};
+    std::unique_ptr<CPLWorkerThreadPool> m_poSOZipThreadPool{};
+
     VSIVirtualHandleUniquePtr OpenForWrite_unlocked(const char *pszFilename,
                                                     const char *pszAccess);
 
@@ -3552,6 +3558,8 @@ class VSIZipFilesystemHandler final : public VSIArchiveFilesystemHandler
     const char *GetOptions() override;
 
     void RemoveFromMap(VSIZipWriteHandle *poHandle);
+
+    CPLWorkerThreadPool *GetSOZipThreadPool(int nThreads);
 };
 
 /************************************************************************/
@@ -3633,6 +3641,27 @@ VSIZipFilesystemHandler::~VSIZipFilesystemHandler()
     }
 }
 
+/************************************************************************/
+/*                         GetSOZipThreadPool()                         */
+/************************************************************************/
+
+CPLWorkerThreadPool *VSIZipFilesystemHandler::GetSOZipThreadPool(int nThreads)
+{
+    std::lock_guard oLock(m_oSOZipThreadPoolMutex);
+    if (m_poSOZipThreadPool == nullptr)
+    {
+        auto poPool = std::make_unique<CPLWorkerThreadPool>();
+        if (!poPool->Setup(nThreads, nullptr, nullptr, false))
+            return nullptr;
+        m_poSOZipThreadPool = std::move(poPool);
+    }
+    else if (nThreads > m_poSOZipThreadPool->GetThreadCount())
+    {
+        m_poSOZipThreadPool->Setup(nThreads, nullptr, nullptr, false);
+    }
+    return m_poSOZipThreadPool.get();
+}
+
 /************************************************************************/
 /*                           GetExtensions()                            */
 /************************************************************************/
@@ -3683,6 +3712,154 @@ VSIZipFilesystemHandler::CreateReader(const char *pszZipFileName)
     return poReader;
 }
 
+/************************************************************************/
+/*                      VSISOZipChunkDecompressor                       */
+/************************************************************************/
+
+// Decompresses independent SOZip chunks. One instance is used per thread.
+class VSISOZipChunkDecompressor
+{
+#ifdef HAVE_LIBDEFLATE
+    struct libdeflate_decompressor *pDecompressor_ = nullptr;
+#else
+    z_stream sStream_{};
+    bool bStreamInit_ = false;
+#endif
+
+    VSISOZipChunkDecompressor(const VSISOZipChunkDecompressor &) = delete;
+    VSISOZipChunkDecompressor &
+    operator=(const VSISOZipChunkDecompressor &) = delete;
+
+  public:
+    VSISOZipChunkDecompressor();
+    ~VSISOZipChunkDecompressor();
+
+    bool IsOK() const
+    {
+#ifdef HAVE_LIBDEFLATE
+        return pDecompressor_ != nullptr;
+#else
+        return bStreamInit_;
+#endif
+    }
+
+    bool Decompress(GByte *pabyCompressedData, size_t nCompressedSize,
+                    GByte *pabyOut, size_t nOutSize, vsi_l_offset nPos,
+                    std::string &osError);
+};
+
+/************************************************************************/
+/*                     VSISOZipChunkDecompressor()                      */
+/************************************************************************/
+
+VSISOZipChunkDecompressor::VSISOZipChunkDecompressor()
+{
+#ifdef HAVE_LIBDEFLATE
+    pDecompressor_ = libdeflate_alloc_decompressor();
+#else
+    memset(&sStream_, 0, sizeof(sStream_));
+    bStreamInit_ = inflateInit2(&sStream_, -MAX_WBITS) == Z_OK;
+#endif
+}
+
+/************************************************************************/
+/*                     ~VSISOZipChunkDecompressor()                     */
+/************************************************************************/
+
+VSISOZipChunkDecompressor::~VSISOZipChunkDecompressor()
+{
+#ifdef HAVE_LIBDEFLATE
+    if (pDecompressor_)
+        libdeflate_free_decompressor(pDecompressor_);
+#else
+    if (bStreamInit_)
+        inflateEnd(&sStream_);
+#endif
+}
+
+/************************************************************************/
+/*                             Decompress()                             */
+/************************************************************************/
+
+/** Decompress a chunk of exactly nOutSize bytes.
+ *
+ * pabyCompressedData may be modified. This does not emit any CPLError(),
+ * so that it can be called from a worker thread: osError is set instead.
+ */
+bool VSISOZipChunkDecompressor::Decompress(GByte *pabyCompressedData,
+                                           size_t nCompressedSize,
+                                           GByte *pabyOut, size_t nOutSize,
+                                           vsi_l_offset nPos,
+                                           std::string &osError)
+{
+    if (nCompressedSize >= 5 &&
+        pabyCompressedData[nCompressedSize - 5] == 0x00 &&
+        memcmp(&pabyCompressedData[nCompressedSize - 4], "\x00\x00\xFF\xFF",
+               4) == 0)
+    {
+        // Tag this flush block as the last one.
+        pabyCompressedData[nCompressedSize - 5] = 0x01;
+    }
+
+#ifdef HAVE_LIBDEFLATE
+    size_t nOut = 0;
+    if (libdeflate_deflate_decompress(pDecompressor_, pabyCompressedData,
+                                      nCompressedSize, pabyOut, nOutSize,
+                                      &nOut) != LIBDEFLATE_SUCCESS)
+    {
+        osError = CPLSPrintf(
+            "libdeflate_deflate_decompress() failed at pos " CPL_FRMT_GUIB,
+            static_cast<GUIntBig>(nPos));
+        return false;
+    }
+    if (nOut != nOutSize)
+    {
+        osError = CPLSPrintf("Only %u bytes decompressed at pos " CPL_FRMT_GUIB
+                             " whereas %u where expected",
+                             static_cast<unsigned>(nOut),
+                             static_cast<GUIntBig>(nPos),
+                             static_cast<unsigned>(nOutSize));
+        return false;
+    }
+#else
+    if constexpr (sizeof(size_t) > sizeof(uInt))
+    {
+        if (nCompressedSize > UINT32_MAX)
+        {
+            osError = "nCompressedToRead > UINT32_MAX";
+            return false;
+        }
+    }
+    sStream_.avail_in = static_cast<uInt>(nCompressedSize);
+    sStream_.next_in = pabyCompressedData;
+    sStream_.avail_out = static_cast<int>(nOutSize);
+    sStream_.next_out = pabyOut;
+
+    int err = inflate(&sStream_, Z_FINISH);
+    if ((err != Z_OK && err != Z_STREAM_END))
+    {
+        osError = CPLSPrintf("inflate() failed at pos " CPL_FRMT_GUIB,
+                             static_cast<GUIntBig>(nPos));
+        inflateReset(&sStream_);
+        return false;
+    }
+    if (sStream_.avail_in != 0)
+        CPLDebug("VSIZIP", "avail_in = %d", sStream_.avail_in);
+    if (sStream_.avail_out != 0)
+    {
+        osError = CPLSPrintf(
+            "Only %u bytes decompressed at pos " CPL_FRMT_GUIB
+            " whereas %u where expected",
+            static_cast<unsigned>(nOutSize - sStream_.avail_out),
+            static_cast<GUIntBig>(nPos), static_cast<unsigned>(nOutSize));
+        inflateReset(&sStream_);
+        return false;
+    }
+    inflateReset(&sStream_);
+#endif
+    return true;
+}
+
 /************************************************************************/
 /*                            VSISOZipHandle                            */
 /************************************************************************/
@@ -3699,18 +3876,30 @@ class VSISOZipHandle final : public VSIVirtualHandle
     bool bEOF_ = false;
     bool bError_ = false;
     vsi_l_offset nCurPos_ = 0;
-    bool bOK_ = true;
-#ifdef HAVE_LIBDEFLATE
-    struct libdeflate_decompressor *pDecompressor_ = nullptr;
-#else
-    z_stream sStream_{};
-#endif
+    VSISOZipChunkDecompressor oDecompressor_{};
+
+    // Multi-threaded decompression of chunks, during sequential reading
+    VSIZipFilesystemHandler *poFS_ = nullptr;
+    int nThreads_ = 1;
+    std::vector<std::unique_ptr<VSISOZipChunkDecompressor>>
+        apoWorkerDecompressors_{};
+    // Chunks following the last read ones, decompressed ahead of time
+    std::vector<GByte> abyReadAhead_{};
+    uint64_t nReadAheadFirstChunk_ = 0;
+    size_t nReadAheadChunkCount_ = 0;
+    vsi_l_offset nNextSequentialPos_ = 0;
 
     VSISOZipHandle(const VSISOZipHandle &) = delete;
     VSISOZipHandle &operator=(const VSISOZipHandle &) = delete;
 
+    bool ReadChunkOffsets(uint64_t nFirstChunk, size_t nCount,
+                          std::vector<uint64_t> &anOffsets);
+    bool ReadChunks(uint64_t nFirstChunk, size_t nRequestChunks,
+                    GByte *pabyOut, size_t nReadAheadChunks);
+
   public:
-    VSISOZipHandle(VSIVirtualHandleUniquePtr poVirtualHandleIn,
+    VSISOZipHandle(VSIZipFilesystemHandler *poFS,
+                   VSIVirtualHandleUniquePtr poVirtualHandleIn,
                    vsi_l_offset nPosCompressedStream, uint64_t compressed_size,
                    uint64_t uncompressed_size, vsi_l_offset indexPos,
                    uint32_t nToSkip, uint32_t nChunkSize);
@@ -3750,7 +3939,7 @@ class VSISOZipHandle final : public VSIVirtualHandle
 
     bool IsOK() const
     {
-        return bOK_;
+        return oDecompressor_.IsOK();
     }
 };
 
@@ -3758,7 +3947,8 @@ class VSISOZipHandle final : public VSIVirtualHandle
 /*                           VSISOZipHandle()                           */
 /************************************************************************/
 
-VSISOZipHandle::VSISOZipHandle(VSIVirtualHandleUniquePtr poVirtualHandleIn,
+VSISOZipHandle::VSISOZipHandle(VSIZipFilesystemHandler *poFS,
+                               VSIVirtualHandleUniquePtr poVirtualHandleIn,
                                vsi_l_offset nPosCompressedStream,
                                uint64_t compressed_size,
                                uint64_t uncompressed_size,
@@ -3767,18 +3957,18 @@ VSISOZipHandle::VSISOZipHandle(VSIVirtualHandleUniquePtr poVirtualHandleIn,
     : poBaseHandle_(std::move(poVirtualHandleIn)),
       nPosCompressedStream_(nPosCompressedStream),
       compressed_size_(compressed_size), uncompressed_size_(uncompressed_size),
-      indexPos_(indexPos), nToSkip_(nToSkip), nChunkSize_(nChunkSize)
+      indexPos_(indexPos), nToSkip_(nToSkip), nChunkSize_(nChunkSize),
+      poFS_(poFS)
 {
-#ifdef HAVE_LIBDEFLATE
-    pDecompressor_ = libdeflate_alloc_decompressor();
-    if (!pDecompressor_)
-        bOK_ = false;
-#else
-    memset(&sStream_, 0, sizeof(sStream_));
-    int err = inflateInit2(&sStream_, -MAX_WBITS);
-    if (err != Z_OK)
-        bOK_ = false;
-#endif
+    const char *pszThreads = CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+    if (pszThreads)
+    {
+        if (EQUAL(pszThreads, "ALL_CPUS"))
+            nThreads_ = CPLGetNumCPUs();
+        else
+            nThreads_ = atoi(pszThreads);
+        nThreads_ = std::max(1, std::min(128, nThreads_));
+    }
 }
 
 /************************************************************************/
@@ -3788,14 +3978,6 @@ VSISOZipHandle::VSISOZipHandle(VSIVirtualHandleUniquePtr poVirtualHandleIn,
 VSISOZipHandle::~VSISOZipHandle()
 {
     VSISOZipHandle::Close();
-    if (bOK_)
-    {
-#ifdef HAVE_LIBDEFLATE
-        libdeflate_free_decompressor(pDecompressor_);
-#else
-        inflateEnd(&sStream_);
-#endif
-    }
 }
 
 /************************************************************************/
@@ -3829,6 +4011,204 @@ int VSISOZipHandle::Seek(vsi_l_offset nOffset, int nWhence)
     return 0;
 }
 
+/************************************************************************/
+/*                          ReadChunkOffsets()                          */
+/************************************************************************/
+
+/** Read the offsets in the compressed stream of the nCount chunks starting
+ * at nFirstChunk. The chunk just after the last one may be requested.
+ */
+bool VSISOZipHandle::ReadChunkOffsets(uint64_t nFirstChunk, size_t nCount,
+                                      std::vector<uint64_t> &anOffsets)
+{
+    const uint64_t nChunks = 1 + (uncompressed_size_ - 1) / nChunkSize_;
+    CPLAssert(nCount > 0 && nFirstChunk + nCount <= nChunks + 1);
+
+    anOffsets.resize(nCount);
+
+    // The offset of the first chunk is not stored in the index, nor the
+    // end of the last one.
+    const uint64_t nFirstIndexed = std::max<uint64_t>(nFirstChunk, 1);
+    const uint64_t nEndIndexed = std::min(nFirstChunk + nCount, nChunks);
+    if (nFirstChunk == 0)
+        anOffsets[0] = 0;
+    if (nFirstChunk + nCount == nChunks + 1)
+        anOffsets[nCount - 1] = compressed_size_;
+
+    if (nEndIndexed > nFirstIndexed)
+    {
+        constexpr size_t nOffsetSize = 8;
+        const size_t nIndexed =
+            static_cast<size_t>(nEndIndexed - nFirstIndexed);
+        uint64_t *panOffsets =
+            anOffsets.data() + static_cast<size_t>(nFirstIndexed - nFirstChunk);
+        if (poBaseHandle_->Seek(indexPos_ + 32 + nToSkip_ +
+                                    (nFirstIndexed - 1) * nOffsetSize,
+                                SEEK_SET) != 0 ||
+            poBaseHandle_->Read(panOffsets, nIndexed * nOffsetSize) !=
+                nIndexed * nOffsetSize)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Cannot read nOffsetInCompressedStream");
+            return false;
+        }
+        for (size_t i = 0; i < nIndexed; ++i)
+            CPL_LSBPTR64(&panOffsets[i]);
+    }
+
+    for (size_t i = 0; i + 1 < nCount; ++i)
+    {
+        if (anOffsets[i + 1] <= anOffsets[i] ||
+            anOffsets[i + 1] - anOffsets[i] > 13 + 2 * nChunkSize_ ||
+            anOffsets[i + 1] > compressed_size_)
+        {
+            CPLError(
+                CE_Failure, CPLE_AppDefined,
+                "Invalid values for nOffsetInCompressedStream (" CPL_FRMT_GUIB
+                ") / "
+                "nNextOffsetInCompressedStream(" CPL_FRMT_GUIB ")",
+                static_cast<GUIntBig>(anOffsets[i]),
+                static_cast<GUIntBig>(anOffsets[i + 1]));
+            return false;
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                             ReadChunks()                             */
+/************************************************************************/
+
+/** Decompress nRequestChunks chunks starting at nFirstChunk into pabyOut,
+ * and the nReadAheadChunks following ones into abyReadAhead_.
+ *
+ * Chunks are independently decodable, so they are decompressed on the
+ * worker threads when there are several of them.
+ */
+bool VSISOZipHandle::ReadChunks(uint64_t nFirstChunk, size_t nRequestChunks,
+                                GByte *pabyOut, size_t nReadAheadChunks)
+{
+    const size_t nChunks = nRequestChunks + nReadAheadChunks;
+
+    std::vector<uint64_t> anOffsets;
+    std::vector<GByte> abyCompressedData;
+    try
+    {
+        if (!ReadChunkOffsets(nFirstChunk, nChunks + 1, anOffsets))
+            return false;
+
+        // Chunks are contiguous in the compressed stream
+        abyCompressedData.resize(
+            static_cast<size_t>(anOffsets[nChunks] - anOffsets[0]));
+
+        nReadAheadChunkCount_ = 0;
+        if (nReadAheadChunks)
+        {
+            abyReadAhead_.resize(nReadAheadChunks * nChunkSize_);
+            nReadAheadFirstChunk_ = nFirstChunk + nRequestChunks;
+        }
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory in VSISOZipHandle::ReadChunks()");
+        return false;
+    }
+
+    if (poBaseHandle_->Seek(nPosCompressedStream_ + anOffsets[0], SEEK_SET) !=
+            0 ||
+        poBaseHandle_->Read(abyCompressedData.data(),
+                            abyCompressedData.size()) !=
+            abyCompressedData.size())
+    {
+        return false;
+    }
+
+    const auto DecompressChunks =
+        [this, nFirstChunk, nRequestChunks, pabyOut, &anOffsets,
+         &abyCompressedData](VSISOZipChunkDecompressor &oDecompressor,
+                             size_t iStart, size_t iEnd, std::string &osError)
+    {
+        for (size_t i = iStart; i < iEnd; ++i)
+        {
+            const vsi_l_offset nPos = (nFirstChunk + i) * nChunkSize_;
+            const size_t nOutSize = static_cast<size_t>(std::min<uint64_t>(
+                nChunkSize_, uncompressed_size_ - nPos));
+            GByte *pabyDst =
+                i < nRequestChunks
+                    ? pabyOut + i * nChunkSize_
+                    : abyReadAhead_.data() + (i - nRequestChunks) * nChunkSize_;
+            if (!oDecompressor.Decompress(
+                    abyCompressedData.data() +
+                        static_cast<size_t>(anOffsets[i] - anOffsets[0]),
+                    static_cast<size_t>(anOffsets[i + 1] - anOffsets[i]),
+                    pabyDst, nOutSize, nPos, osError))
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    const int nJobs =
+        static_cast<int>(std::min(static_cast<size_t>(nThreads_), nChunks));
+    if (nJobs <= 1)
+    {
+        std::string osError;
+        if (!DecompressChunks(oDecompressor_, 0, nChunks, osError))
+        {
+            CPLError(CE_Failure, CPLE_AppDefined, "%s", osError.c_str());
+            return false;
+        }
+    }
+    else
+    {
+        auto poPool = poFS_->GetSOZipThreadPool(nThreads_);
+        if (!poPool)
+            return false;
+        // The pool is shared with other handles, so only wait for our jobs
+        auto poJobQueue = poPool->CreateJobQueue();
+        while (apoWorkerDecompressors_.size() < static_cast<size_t>(nJobs))
+        {
+            auto poDecompressor =
+                std::make_unique<VSISOZipChunkDecompressor>();
+            if (!poDecompressor->IsOK())
+                return false;
+            apoWorkerDecompressors_.push_back(std::move(poDecompressor));
+        }
+
+        std::vector<std::string> aosErrors(nJobs);
+        std::vector<int> abSuccess(nJobs, false);
+        for (int iJob = 0; iJob < nJobs; ++iJob)
+        {
+            const size_t iStart = nChunks * iJob / nJobs;
+            const size_t iEnd = nChunks * (iJob + 1) / nJobs;
+            poJobQueue->SubmitJob(
+                [this, &DecompressChunks, &aosErrors, &abSuccess, iJob, iStart,
+                 iEnd]()
+                {
+                    abSuccess[iJob] =
+                        DecompressChunks(*(apoWorkerDecompressors_[iJob]),
+                                         iStart, iEnd, aosErrors[iJob]);
+                });
+        }
+        poJobQueue->WaitCompletion();
+
+        for (int iJob = 0; iJob < nJobs; ++iJob)
+        {
+            if (!abSuccess[iJob])
+            {
+                CPLError(CE_Failure, CPLE_AppDefined, "%s",
+                         aosErrors[iJob].c_str());
+                return false;
+            }
+        }
+    }
+
+    nReadAheadChunkCount_ = nReadAheadChunks;
+    return true;
+}
+
 /************************************************************************/
 /*                                Read()                                */
 /************************************************************************/
@@ -3863,172 +4243,53 @@ size_t VSISOZipHandle::Read(void *pBuffer, size_t nBytes)
         return 0;
     }
 
-    const auto ReadOffsetInCompressedStream =
-        [this](uint64_t nChunkIdx) -> uint64_t
-    {
-        if (nChunkIdx == 0)
-            return 0;
-        if (nChunkIdx == 1 + (uncompressed_size_ - 1) / nChunkSize_)
-            return compressed_size_;
-        constexpr size_t nOffsetSize = 8;
-        if (poBaseHandle_->Seek(indexPos_ + 32 + nToSkip_ +
-                                    (nChunkIdx - 1) * nOffsetSize,
-                                SEEK_SET) != 0)
-            return static_cast<uint64_t>(-1);
-
-        uint64_t nOffset;
-        if (poBaseHandle_->Read(&nOffset, sizeof(nOffset)) != sizeof(nOffset))
-            return static_cast<uint64_t>(-1);
-        CPL_LSBPTR64(&nOffset);
-        return nOffset;
-    };
+    // When reading sequentially, decompress a few chunks after the
+    // requested ones, so that several threads can be used even if chunks
+    // are requested one at a time.
+    constexpr int READ_AHEAD_CHUNKS_PER_THREAD = 4;
+    const bool bSequential = nCurPos_ == nNextSequentialPos_;
 
-    size_t nOffsetInOutputBuffer = 0;
-    while (true)
+    GByte *pabyOut = static_cast<GByte *>(pBuffer);
+    while (nToRead > 0)
     {
-        uint64_t nOffsetInCompressedStream =
-            ReadOffsetInCompressedStream(nCurPos_ / nChunkSize_);
-        if (nOffsetInCompressedStream == static_cast<uint64_t>(-1))
-        {
-            bError_ = true;
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "Cannot read nOffsetInCompressedStream");
-            return 0;
-        }
-        uint64_t nNextOffsetInCompressedStream =
-            ReadOffsetInCompressedStream(1 + nCurPos_ / nChunkSize_);
-        if (nNextOffsetInCompressedStream == static_cast<uint64_t>(-1))
-        {
-            bError_ = true;
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "Cannot read nNextOffsetInCompressedStream");
-            return 0;
-        }
-
-        if (nNextOffsetInCompressedStream <= nOffsetInCompressedStream ||
-            nNextOffsetInCompressedStream - nOffsetInCompressedStream >
-                13 + 2 * nChunkSize_ ||
-            nNextOffsetInCompressedStream > compressed_size_)
-        {
-            bError_ = true;
-            CPLError(
-                CE_Failure, CPLE_AppDefined,
-                "Invalid values for nOffsetInCompressedStream (" CPL_FRMT_GUIB
-                ") / "
-                "nNextOffsetInCompressedStream(" CPL_FRMT_GUIB ")",
-                static_cast<GUIntBig>(nOffsetInCompressedStream),
-                static_cast<GUIntBig>(nNextOffsetInCompressedStream));
-            return 0;
-        }
-
-        // CPLDebug("VSIZIP", "Seek to compressed data at offset "
-        // CPL_FRMT_GUIB, static_cast<GUIntBig>(nPosCompressedStream_ +
-        // nOffsetInCompressedStream));
-        if (poBaseHandle_->Seek(
-                nPosCompressedStream_ + nOffsetInCompressedStream, SEEK_SET) !=
-            0)
-        {
-            bError_ = true;
-            return 0;
-        }
-
-        const size_t nCompressedToRead = static_cast<size_t>(
-            nNextOffsetInCompressedStream - nOffsetInCompressedStream);
-        // CPLDebug("VSIZIP", "nCompressedToRead = %d", nCompressedToRead);
-        std::vector<GByte> abyCompressedData(nCompressedToRead);
-        if (poBaseHandle_->Read(&abyCompressedData[0], nCompressedToRead) !=
-            nCompressedToRead)
+        const uint64_t nChunkIdx = nCurPos_ / nChunkSize_;
+        if (nChunkIdx >= nReadAheadFirstChunk_ &&
+            nChunkIdx < nReadAheadFirstChunk_ + nReadAheadChunkCount_)
         {
-            bError_ = true;
-            return 0;
+            const size_t nToReadThisIter =
+                std::min(nToRead, static_cast<size_t>(nChunkSize_));
+            memcpy(pabyOut,
+                   abyReadAhead_.data() +
+                       static_cast<size_t>(nChunkIdx - nReadAheadFirstChunk_) *
+                           nChunkSize_,
+                   nToReadThisIter);
+            pabyOut += nToReadThisIter;
+            nCurPos_ += nToReadThisIter;
+            nToRead -= nToReadThisIter;
+            continue;
         }
 
-        size_t nToReadThisIter =
-            std::min(nToRead, static_cast<size_t>(nChunkSize_));
-
-        if (nCompressedToRead >= 5 &&
-            abyCompressedData[nCompressedToRead - 5] == 0x00 &&
-            memcmp(&abyCompressedData[nCompressedToRead - 4],
-                   "\x00\x00\xFF\xFF", 4) == 0)
+        const size_t nRequestChunks = cpl::div_round_up(
+            nToRead, static_cast<size_t>(nChunkSize_));
+        size_t nReadAheadChunks = 0;
+        if (bSequential && nThreads_ > 1)
         {
-            // Tag this flush block as the last one.
-            abyCompressedData[nCompressedToRead - 5] = 0x01;
+            const uint64_t nChunks = 1 + (uncompressed_size_ - 1) / nChunkSize_;
+            nReadAheadChunks = static_cast<size_t>(std::min<uint64_t>(
+                nChunks - (nChunkIdx + nRequestChunks),
+                static_cast<uint64_t>(nThreads_) *
+                    READ_AHEAD_CHUNKS_PER_THREAD));
         }
 
-#ifdef HAVE_LIBDEFLATE
-        size_t nOut = 0;
-        if (libdeflate_deflate_decompress(
-                pDecompressor_, &abyCompressedData[0], nCompressedToRead,
-                static_cast<Bytef *>(pBuffer) + nOffsetInOutputBuffer,
-                nToReadThisIter, &nOut) != LIBDEFLATE_SUCCESS)
+        if (!ReadChunks(nChunkIdx, nRequestChunks, pabyOut, nReadAheadChunks))
         {
             bError_ = true;
-            CPLError(
-                CE_Failure, CPLE_AppDefined,
-                "libdeflate_deflate_decompress() failed at pos " CPL_FRMT_GUIB,
-                static_cast<GUIntBig>(nCurPos_));
             return 0;
         }
-        if (nOut != nToReadThisIter)
-        {
-            bError_ = true;
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "Only %u bytes decompressed at pos " CPL_FRMT_GUIB
-                     " whereas %u where expected",
-                     static_cast<unsigned>(nOut),
-                     static_cast<GUIntBig>(nCurPos_),
-                     static_cast<unsigned>(nToReadThisIter));
-            return 0;
-        }
-#else
-        if constexpr (sizeof(size_t) > sizeof(uInt))
-        {
-            if (nCompressedToRead > UINT32_MAX)
-            {
-                CPLError(CE_Failure, CPLE_AppDefined,
-                         "nCompressedToRead > UINT32_MAX");
-                return 0;
-            }
-        }
-        sStream_.avail_in = static_cast<uInt>(nCompressedToRead);
-        sStream_.next_in = &abyCompressedData[0];
-        sStream_.avail_out = static_cast<int>(nToReadThisIter);
-        sStream_.next_out =
-            static_cast<Bytef *>(pBuffer) + nOffsetInOutputBuffer;
-
-        int err = inflate(&sStream_, Z_FINISH);
-        if ((err != Z_OK && err != Z_STREAM_END))
-        {
-            bError_ = true;
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "inflate() failed at pos " CPL_FRMT_GUIB,
-                     static_cast<GUIntBig>(nCurPos_));
-            inflateReset(&sStream_);
-            return 0;
-        }
-        if (sStream_.avail_in != 0)
-            CPLDebug("VSIZIP", "avail_in = %d", sStream_.avail_in);
-        if (sStream_.avail_out != 0)
-        {
-            bError_ = true;
-            CPLError(
-                CE_Failure, CPLE_AppDefined,
-                "Only %u bytes decompressed at pos " CPL_FRMT_GUIB
-                " whereas %u where expected",
-                static_cast<unsigned>(nToReadThisIter - sStream_.avail_out),
-                static_cast<GUIntBig>(nCurPos_),
-                static_cast<unsigned>(nToReadThisIter));
-            inflateReset(&sStream_);
-            return 0;
-        }
-        inflateReset(&sStream_);
-#endif
-        nOffsetInOutputBuffer += nToReadThisIter;
-        nCurPos_ += nToReadThisIter;
-        nToRead -= nToReadThisIter;
-        if (nToRead == 0)
-            break;
+        nCurPos_ += nToRead;
+        nToRead = 0;
     }
+    nNextSequentialPos_ = nCurPos_;
 
     return nRet;
 }
@@ -4370,7 +4631,7 @@ VSIZipFilesystemHandler::Open(const char *pszFilename, const char *pszAccess,
         if (info.bSOZipIndexValid)
         {
             auto poSOZIPHandle = std::make_unique<VSISOZipHandle>(
-                std::move(info.poVirtualHandle), info.nStartDataStream,
+                this, std::move(info.poVirtualHandle), info.nStartDataStream,
                 info.nCompressedSize, info.nUncompressedSize,
                 info.nSOZIPStartData, info.nSOZIPToSkip, info.nSOZIPChunkSize);
             if (!poSOZIPHandle->IsOK())
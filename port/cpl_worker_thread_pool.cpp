@@ -13,14 +13,27 @@
 #include "cpl_port.h"
 #include "cpl_worker_thread_pool.h"
 
+#include <chrono>
 #include <cstddef>
 #include <memory>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_string.h"
 #include "cpl_vsi.h"
 
 static thread_local CPLWorkerThreadPool *threadLocalCurrentThreadPool = nullptr;
+static thread_local CPLWorkerThread *threadLocalCurrentWorkerThread = nullptr;
+
+/************************************************************************/
+/*                  CPLWorkerThreadPoolWorkStealing()                   */
+/************************************************************************/
+
+static bool CPLWorkerThreadPoolWorkStealing()
+{
+    return CPLTestBool(
+        CPLGetConfigOption("CPL_WORKER_THREAD_POOL_WORK_STEALING", "NO"));
+}
 
 /************************************************************************/
 /*                        CPLWorkerThreadPool()                         */
@@ -31,7 +44,8 @@ static thread_local CPLWorkerThreadPool *threadLocalCurrentThreadPool = nullptr;
  * The pool is in an uninitialized state after this call. The Setup() method
  * must be called.
  */
-CPLWorkerThreadPool::CPLWorkerThreadPool() : jobQueue{}
+CPLWorkerThreadPool::CPLWorkerThreadPool()
+    : jobQueue{}, m_bWorkStealing(CPLWorkerThreadPoolWorkStealing())
 {
 }
 
@@ -39,7 +53,8 @@ CPLWorkerThreadPool::CPLWorkerThreadPool() : jobQueue{}
  *
  * \param nThreads  Number of threads in the pool.
  */
-CPLWorkerThreadPool::CPLWorkerThreadPool(int nThreads) : jobQueue{}
+CPLWorkerThreadPool::CPLWorkerThreadPool(int nThreads)
+    : jobQueue{}, m_bWorkStealing(CPLWorkerThreadPoolWorkStealing())
 {
     Setup(nThreads, nullptr, nullptr);
 }
@@ -59,6 +74,7 @@ CPLWorkerThreadPool::~CPLWorkerThreadPool()
     {
         std::lock_guard<std::mutex> oGuard(m_mutex);
         eState = CPLWTS_STOP;
+        m_cvWorkStealing.notify_all();
     }
 
     for (auto &wt : aWT)
@@ -93,13 +109,16 @@ void CPLWorkerThreadPool::WorkerThreadFunction(void *user_data)
     CPLWorkerThreadPool *poTP = psWT->poTP;
 
     threadLocalCurrentThreadPool = poTP;
+    threadLocalCurrentWorkerThread = psWT;
 
     if (psWT->pfnInitFunc)
         psWT->pfnInitFunc(psWT->pInitData);
 
     while (true)
     {
-        std::function<void()> task = poTP->GetNextJob(psWT);
+        std::function<void()> task = poTP->m_bWorkStealing
+                                         ? poTP->GetNextJobWorkStealing(psWT)
+                                         : poTP->GetNextJob(psWT);
         if (!task)
             break;
 
@@ -140,6 +159,9 @@ bool CPLWorkerThreadPool::SubmitJob(std::function<void()> task)
     }
 #endif
 
+    if (m_bWorkStealing)
+        return SubmitJobWorkStealing(std::move(task));
+
     bool bMustIncrementWaitingWorkerThreadsAfterSubmission = false;
     if (threadLocalCurrentThreadPool == this)
     {
@@ -249,6 +271,16 @@ bool CPLWorkerThreadPool::SubmitJobs(CPLThreadFunc pfnFunc,
     }
 #endif
 
+    if (m_bWorkStealing)
+    {
+        for (void *pData : apData)
+        {
+            if (!SubmitJobWorkStealing([=] { pfnFunc(pData); }))
+                return false;
+        }
+        return true;
+    }
+
     if (threadLocalCurrentThreadPool == this)
     {
         // If SubmitJob() is called from a worker thread of this queue,
@@ -336,9 +368,29 @@ void CPLWorkerThreadPool::WaitCompletion(int nMaxRemainingJobs)
 {
     if (nMaxRemainingJobs < 0)
         nMaxRemainingJobs = 0;
+    const auto isDone = [this, nMaxRemainingJobs]
+    { return nPendingJobs <= nMaxRemainingJobs; };
+
+    if (IsCurrentThreadWorkStealingWorker())
+    {
+        // Help running pending jobs instead of blocking a worker thread
+        while (!isDone())
+        {
+            if (!RunPendingJob())
+            {
+                std::unique_lock<std::mutex> oGuard(m_mutex);
+                m_nCompletionWaiters++;
+                m_cv.wait_for(oGuard, std::chrono::milliseconds(1), isDone);
+                m_nCompletionWaiters--;
+            }
+        }
+        return;
+    }
+
     std::unique_lock<std::mutex> oGuard(m_mutex);
-    m_cv.wait(oGuard, [this, nMaxRemainingJobs]
-              { return nPendingJobs <= nMaxRemainingJobs; });
+    m_nCompletionWaiters++;
+    m_cv.wait(oGuard, isDone);
+    m_nCompletionWaiters--;
 }
 
 /************************************************************************/
@@ -357,8 +409,10 @@ void CPLWorkerThreadPool::WaitEvent()
     if (nPendingJobs == 0)
         return;
     const int nPendingJobsBefore = nPendingJobs;
+    m_nCompletionWaiters++;
     m_cv.wait(oGuard, [this, nPendingJobsBefore]
               { return nPendingJobs < nPendingJobsBefore || m_bNotifyEvent; });
+    m_nCompletionWaiters--;
     m_bNotifyEvent = false;
 }
 
@@ -417,6 +471,7 @@ bool CPLWorkerThreadPool::Setup(int nThreads, CPLThreadFunc pfnInitFunc,
         std::lock_guard<std::mutex> oGuard(m_mutex);
         if (nThreads > m_nMaxThreads)
             m_nMaxThreads = nThreads;
+        m_bAllThreadsStarted = static_cast<int>(aWT.size()) >= m_nMaxThreads;
         return true;
     }
 
@@ -434,6 +489,8 @@ bool CPLWorkerThreadPool::Setup(int nThreads, CPLThreadFunc pfnInitFunc,
             bRet = false;
             break;
         }
+        // Other worker threads may iterate over aWT in work-stealing mode
+        std::lock_guard<std::mutex> oGuard(m_mutex);
         aWT.emplace_back(std::move(wt));
     }
 
@@ -441,6 +498,7 @@ bool CPLWorkerThreadPool::Setup(int nThreads, CPLThreadFunc pfnInitFunc,
         std::lock_guard<std::mutex> oGuard(m_mutex);
         if (nThreads > m_nMaxThreads)
             m_nMaxThreads = nThreads;
+        m_bAllThreadsStarted = static_cast<int>(aWT.size()) >= m_nMaxThreads;
     }
 
     if (bWaitallStarted)
@@ -465,6 +523,18 @@ bool CPLWorkerThreadPool::Setup(int nThreads, CPLThreadFunc pfnInitFunc,
 
 void CPLWorkerThreadPool::DeclareJobFinished()
 {
+    if (m_bWorkStealing)
+    {
+        // Only take the mutex if somebody waits for job completion
+        nPendingJobs--;
+        if (m_nCompletionWaiters > 0)
+        {
+            std::lock_guard<std::mutex> oGuard(m_mutex);
+            m_cv.notify_all();
+        }
+        return;
+    }
+
     std::lock_guard<std::mutex> oGuard(m_mutex);
     nPendingJobs--;
     m_cv.notify_one();
@@ -538,6 +608,222 @@ CPLWorkerThreadPool::GetNextJob(CPLWorkerThread *psWorkerThread)
     }
 }
 
+/************************************************************************/
+/*                          SetWorkStealing()                           */
+/************************************************************************/
+
+/** Enable or disable the work-stealing mode.
+ *
+ * In that mode, each worker thread has its own job deque. Jobs submitted
+ * from a worker thread are pushed to its deque, without taking the pool
+ * mutex, and are run in LIFO order by this thread, or stolen in FIFO order
+ * by idle worker threads. Jobs submitted from other threads go to a shared
+ * queue.
+ *
+ * Jobs submitted from a worker thread are never run synchronously: a worker
+ * thread that waits for the completion of jobs, through WaitCompletion() or
+ * CPLJobQueue::WaitCompletion(), runs pending jobs in the meantime, instead
+ * of blocking. Consequently, a job must not hold a lock while it waits for
+ * other jobs, if these other jobs may try to acquire it.
+ *
+ * The default value is set by the CPL_WORKER_THREAD_POOL_WORK_STEALING
+ * configuration option (NO by default).
+ *
+ * This method must be called before Setup().
+ *
+ * @since GDAL 3.13
+ */
+void CPLWorkerThreadPool::SetWorkStealing(bool bEnable)
+{
+    CPLAssert(aWT.empty() && nPendingJobs == 0);
+    m_bWorkStealing = bEnable;
+}
+
+/************************************************************************/
+/*                     StartWorkerThreadIfNeeded()                      */
+/************************************************************************/
+
+// Should be called with m_mutex held.
+bool CPLWorkerThreadPool::StartWorkerThreadIfNeeded()
+{
+    if (static_cast<int>(aWT.size()) < m_nMaxThreads)
+    {
+        auto wt = std::make_unique<CPLWorkerThread>();
+        wt->poTP = this;
+        wt->hThread = CPLCreateJoinableThread(WorkerThreadFunction, wt.get());
+        if (wt->hThread == nullptr)
+            return false;
+        aWT.emplace_back(std::move(wt));
+    }
+    m_bAllThreadsStarted = static_cast<int>(aWT.size()) >= m_nMaxThreads;
+    return true;
+}
+
+/************************************************************************/
+/*                       SubmitJobWorkStealing()                        */
+/************************************************************************/
+
+bool CPLWorkerThreadPool::SubmitJobWorkStealing(std::function<void()> &&task)
+{
+    nPendingJobs++;
+
+    CPLWorkerThread *psWT = threadLocalCurrentWorkerThread;
+    if (psWT && psWT->poTP == this)
+    {
+        // Fast path for nested jobs: push at the back of the deque of the
+        // current worker thread, and only take the pool mutex if a worker
+        // thread must be started or woken up.
+        {
+            std::lock_guard<std::mutex> oGuard(psWT->m_dequeMutex);
+            psWT->m_jobDeque.emplace_back(std::move(task));
+        }
+        m_nQueuedJobs++;
+        if (nWaitingWorkerThreads > 0 || !m_bAllThreadsStarted)
+        {
+            std::lock_guard<std::mutex> oGuard(m_mutex);
+            StartWorkerThreadIfNeeded();
+            m_cvWorkStealing.notify_one();
+        }
+        return true;
+    }
+
+    std::lock_guard<std::mutex> oGuard(m_mutex);
+    if (!StartWorkerThreadIfNeeded() && aWT.empty())
+    {
+        nPendingJobs--;
+        return false;
+    }
+    jobQueue.emplace(std::move(task));
+    m_nQueuedJobs++;
+    m_cvWorkStealing.notify_one();
+    return true;
+}
+
+/************************************************************************/
+/*                       TryGetJobWorkStealing()                        */
+/************************************************************************/
+
+// Return a job to run by psWorkerThread, or an empty function if there is
+// none.
+std::function<void()>
+CPLWorkerThreadPool::TryGetJobWorkStealing(CPLWorkerThread *psWorkerThread)
+{
+    std::function<void()> task;
+
+    // Most recently submitted job of this thread first
+    {
+        std::lock_guard<std::mutex> oGuard(psWorkerThread->m_dequeMutex);
+        if (!psWorkerThread->m_jobDeque.empty())
+        {
+            task = std::move(psWorkerThread->m_jobDeque.back());
+            psWorkerThread->m_jobDeque.pop_back();
+            m_nQueuedJobs--;
+            return task;
+        }
+    }
+
+    if (m_nQueuedJobs == 0)
+        return task;
+
+    // Lock order: pool mutex, then the one of a worker deque.
+    std::lock_guard<std::mutex> oGuard(m_mutex);
+
+    // Then jobs submitted by non-worker threads
+    if (!jobQueue.empty())
+    {
+        task = std::move(jobQueue.front());
+        jobQueue.pop();
+        m_nQueuedJobs--;
+        return task;
+    }
+
+    // And finally steal the oldest job of another worker thread
+    const size_t nWorkers = aWT.size();
+    for (size_t i = 0; i < nWorkers; ++i)
+    {
+        const size_t iVictim = (psWorkerThread->m_iNextVictim + i) % nWorkers;
+        CPLWorkerThread *psVictim = aWT[iVictim].get();
+        if (psVictim == psWorkerThread)
+            continue;
+        std::lock_guard<std::mutex> oGuardVictim(psVictim->m_dequeMutex);
+        if (!psVictim->m_jobDeque.empty())
+        {
+#if DEBUG_VERBOSE
+            CPLDebug("JOB", "%p stole a job from %p", psWorkerThread,
+                     psVictim);
+#endif
+            task = std::move(psVictim->m_jobDeque.front());
+            psVictim->m_jobDeque.pop_front();
+            m_nQueuedJobs--;
+            psWorkerThread->m_iNextVictim = iVictim;
+            return task;
+        }
+    }
+
+    return task;
+}
+
+/************************************************************************/
+/*                       GetNextJobWorkStealing()                       */
+/************************************************************************/
+
+std::function<void()>
+CPLWorkerThreadPool::GetNextJobWorkStealing(CPLWorkerThread *psWorkerThread)
+{
+    while (true)
+    {
+        auto task = TryGetJobWorkStealing(psWorkerThread);
+        if (task)
+            return task;
+
+        std::unique_lock<std::mutex> oGuard(m_mutex);
+        if (eState == CPLWTS_STOP)
+            return task;
+
+        // Submitters increment m_nQueuedJobs before checking
+        // nWaitingWorkerThreads, and we do the reverse, so at least one
+        // of both sides sees the update of the other one.
+        nWaitingWorkerThreads++;
+        // Setup() may wait for all threads to be started
+        m_cv.notify_all();
+        if (m_nQueuedJobs == 0)
+        {
+#if DEBUG_VERBOSE
+            CPLDebug("JOB", "%p sleeping", psWorkerThread);
+#endif
+            m_cvWorkStealing.wait(oGuard);
+        }
+        nWaitingWorkerThreads--;
+    }
+}
+
+/************************************************************************/
+/*                 IsCurrentThreadWorkStealingWorker()                  */
+/************************************************************************/
+
+bool CPLWorkerThreadPool::IsCurrentThreadWorkStealingWorker() const
+{
+    return m_bWorkStealing && threadLocalCurrentWorkerThread &&
+           threadLocalCurrentWorkerThread->poTP == this;
+}
+
+/************************************************************************/
+/*                           RunPendingJob()                            */
+/************************************************************************/
+
+// Run a pending job, if any, from a worker thread in work-stealing mode.
+// Return whether a job has been run.
+bool CPLWorkerThreadPool::RunPendingJob()
+{
+    CPLAssert(IsCurrentThreadWorkStealingWorker());
+    auto task = TryGetJobWorkStealing(threadLocalCurrentWorkerThread);
+    if (!task)
+        return false;
+    task();
+    DeclareJobFinished();
+    return true;
+}
+
 /************************************************************************/
 /*                           CreateJobQueue()                           */
 /************************************************************************/
@@ -635,6 +921,19 @@ bool CPLJobQueue::SubmitJob(std::function<void()> task)
 void CPLJobQueue::WaitCompletion(int nMaxRemainingJobs)
 {
     std::unique_lock<std::mutex> oGuard(m_mutex);
+    if (m_poPool->IsCurrentThreadWorkStealingWorker())
+    {
+        // Help running pending jobs instead of blocking a worker thread
+        while (m_nPendingJobs > nMaxRemainingJobs)
+        {
+            oGuard.unlock();
+            const bool bRanJob = m_poPool->RunPendingJob();
+            oGuard.lock();
+            if (!bRanJob && m_nPendingJobs > nMaxRemainingJobs)
+                m_cv.wait_for(oGuard, std::chrono::milliseconds(1));
+        }
+        return;
+    }
     m_cv.wait(oGuard, [this, nMaxRemainingJobs]
               { return m_nPendingJobs <= nMaxRemainingJobs; });
 }
@@ -657,6 +956,18 @@ bool CPLJobQueue::WaitEvent()
         return false;
 
     const int nPendingJobsBefore = m_nPendingJobs;
+    if (m_poPool->IsCurrentThreadWorkStealingWorker())
+    {
+        while (m_nPendingJobs >= nPendingJobsBefore)
+        {
+            oGuard.unlock();
+            const bool bRanJob = m_poPool->RunPendingJob();
+            oGuard.lock();
+            if (!bRanJob && m_nPendingJobs >= nPendingJobsBefore)
+                m_cv.wait_for(oGuard, std::chrono::milliseconds(1));
+        }
+        return m_nPendingJobs > 0;
+    }
     m_cv.wait(oGuard, [this, nPendingJobsBefore]
               { return m_nPendingJobs < nPendingJobsBefore; });
     return m_nPendingJobs > 0;
@@ -16,7 +16,9 @@
 #include "cpl_multiproc.h"
 #include "cpl_list.h"
 
+#include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -45,6 +47,11 @@ struct CPLWorkerThread
 
     std::mutex m_mutex{};
     std::condition_variable m_cv{};
+
+    // Only used in work-stealing mode
+    std::mutex m_dequeMutex{};
+    std::deque<std::function<void()>> m_jobDeque{};
+    size_t m_iNextVictim = 0;
 };
 
 typedef enum
@@ -69,19 +76,37 @@ class CPL_DLL CPLWorkerThreadPool
     std::condition_variable m_cv{};
     volatile CPLWorkerThreadState eState = CPLWTS_OK;
     std::queue<std::function<void()>> jobQueue;
-    int nPendingJobs = 0;
+    std::atomic<int> nPendingJobs{0};
     bool m_bNotifyEvent = false;
 
     CPLList *psWaitingWorkerThreadsList = nullptr;
-    int nWaitingWorkerThreads = 0;
+    std::atomic<int> nWaitingWorkerThreads{0};
 
     int m_nMaxThreads = 0;
 
+    // Work-stealing mode
+    bool m_bWorkStealing = false;
+    std::condition_variable m_cvWorkStealing{};
+    std::atomic<int> m_nQueuedJobs{0};
+    std::atomic<int> m_nCompletionWaiters{0};
+    std::atomic<bool> m_bAllThreadsStarted{false};
+
     static void WorkerThreadFunction(void *user_data);
 
     void DeclareJobFinished();
     std::function<void()> GetNextJob(CPLWorkerThread *psWorkerThread);
 
+    bool StartWorkerThreadIfNeeded();
+    bool SubmitJobWorkStealing(std::function<void()> &&task);
+    std::function<void()>
+    TryGetJobWorkStealing(CPLWorkerThread *psWorkerThread);
+    std::function<void()>
+    GetNextJobWorkStealing(CPLWorkerThread *psWorkerThread);
+    bool IsCurrentThreadWorkStealingWorker() const;
+    bool RunPendingJob();
+
+    friend class CPLJobQueue;
+
   public:
     CPLWorkerThreadPool();
     explicit CPLWorkerThreadPool(int nThreads);
@@ -100,6 +125,16 @@ class CPL_DLL CPLWorkerThreadPool
     void WaitEvent();
     void WakeUpWaitEvent();
 
+    void SetWorkStealing(bool bEnable);
+
+    /** Return whether the work-stealing mode is enabled.
+     * @since GDAL 3.13
+     */
+    bool IsWorkStealing() const
+    {
+        return m_bWorkStealing;
+    }
+
     /** Return the number of threads setup */
     int GetThreadCount() const;
 };